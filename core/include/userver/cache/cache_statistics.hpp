@@ -24,6 +24,7 @@ struct UpdateStatistics final {
     utils::statistics::RateCounter update_failures_count{0};
 
     utils::statistics::RateCounter documents_read_count{0};
+    utils::statistics::RateCounter documents_read_bytes{0};
     utils::statistics::RateCounter documents_parse_failures{0};
 
     std::atomic<std::chrono::steady_clock::time_point> last_update_start_time{{}};
@@ -80,6 +81,12 @@ public:
     /// @param add the number of items (both valid and non-valid) newly received
     void IncreaseDocumentsReadCount(std::size_t add);
 
+    /// @brief Size of the data received from the data source, for caches that
+    /// are able to account it
+    /// @note This method can be called multiple times per `Update`
+    /// @param add the number of bytes newly received
+    void IncreaseDocumentsReadBytes(std::size_t add);
+
     /// @brief Each received item that failed validation should be accounted with
     /// this function, in addition to IncreaseDocumentsReadCount
     /// @note This method can be called multiple times per `Update`
@@ -8,6 +8,7 @@
 #endif
 
 #include <memory>
+#include <string_view>
 
 #include <userver/moodycamel/concurrentqueue_fwd.h>
 
@@ -44,6 +45,10 @@ namespace impl {
 class EasyWrapper;
 }  // namespace impl
 
+namespace native {
+class Transport;
+}  // namespace native
+
 struct TestsuiteConfig;
 class Statistics;
 struct PoolStatistics;
@@ -137,6 +142,7 @@ private:
     void IncPending() noexcept { ++pending_tasks_; }
     void DecPending() noexcept { --pending_tasks_; }
     void PushIdleEasy(std::shared_ptr<curl::easy>&& easy) noexcept;
+    Statistics* BindToDestination(curl::easy& easy, std::string_view url);
 
     std::shared_ptr<curl::easy> TryDequeueIdle() noexcept;
 
@@ -144,6 +150,7 @@ private:
 
     const DeadlinePropagationConfig deadline_propagation_config_;
     CancellationPolicy cancellation_policy_;
+    const bool destination_affinity_;
 
     std::shared_ptr<DestinationStatistics> destination_statistics_;
     std::unique_ptr<engine::ev::ThreadPool> thread_pool_;
@@ -171,6 +178,7 @@ private:
     std::shared_ptr<curl::ConnectRateLimiter> connect_rate_limiter_;
 
     clients::dns::Resolver* resolver_{nullptr};
+    std::unique_ptr<native::Transport> native_transport_;
     utils::NotNull<const tracing::TracingManagerBase*> tracing_manager_;
     impl::PluginPipeline plugin_pipeline_;
 };
@@ -37,6 +37,8 @@ namespace components {
 /// pool-statistics-disable | set to true to disable statistics for connection pool | false
 /// thread-name-prefix | set OS thread name to this value | ''
 /// threads | number of threads to process low level HTTP related IO system calls | 8
+/// destination-affinity | perform the requests to the same host on the same IO thread to reuse its connections, spilling over to a second thread under load | false
+/// transport | 'curl' or 'native', the latter performs plain HTTP/1.1 requests with coroutine sockets and falls back to libcurl for other requests | curl
 /// fs-task-processor | task processor to run blocking HTTP related calls, like DNS resolving or hosts reading | -
 /// destination-metrics-auto-max-size | set max number of automatically created destination metrics | 100
 /// user-agent | User-Agent HTTP header to show on all requests, result of utils::GetUserverIdentifier() if empty | empty
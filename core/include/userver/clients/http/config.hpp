@@ -26,6 +26,17 @@ enum class CancellationPolicy {
 
 CancellationPolicy Parse(yaml_config::YamlConfig value, formats::parse::To<CancellationPolicy>);
 
+/// Transport used to perform the requests
+enum class Transport {
+    /// libcurl driven by the ev threads, supports everything
+    kCurl,
+    /// Coroutine HTTP/1.1 client, falls back to libcurl for the requests
+    /// with features it does not support
+    kNative,
+};
+
+Transport Parse(yaml_config::YamlConfig value, formats::parse::To<Transport>);
+
 // Static config
 struct ClientSettings final {
     std::string thread_name_prefix{};
@@ -33,6 +44,8 @@ struct ClientSettings final {
     DeadlinePropagationConfig deadline_propagation{};
     const tracing::TracingManagerBase* tracing_manager{nullptr};
     CancellationPolicy cancellation_policy{CancellationPolicy::kCancel};
+    bool destination_affinity{false};
+    Transport transport{Transport::kCurl};
 };
 
 ClientSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ClientSettings>);
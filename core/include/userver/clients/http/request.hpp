@@ -40,6 +40,10 @@ namespace impl {
 class EasyWrapper;
 }  // namespace impl
 
+namespace native {
+class Transport;
+}  // namespace native
+
 /// HTTP request method
 enum class HttpMethod { kGet, kPost, kHead, kPut, kDelete, kPatch, kOptions };
 
@@ -262,6 +266,10 @@ public:
 
     void SetAllowedUrlsExtra(const std::vector<std::string>& urls) &;
 
+    // Perform the request with the native transport if possible. For internal
+    // use only.
+    void SetNativeTransport(native::Transport* transport) &;
+
     // Set deadline propagation settings. For internal use only.
     void SetDeadlinePropagationConfig(const DeadlinePropagationConfig& deadline_propagation_config) &;
     /// @endcond
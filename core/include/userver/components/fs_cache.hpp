@@ -23,6 +23,7 @@ namespace components {
 /// dir               | directory to cache files from                        | /var/www
 /// update-period     | Update period (0 - fill the cache only at startup)   | 0
 /// fs-task-processor | task processor to do filesystem operations           | fs-task-processor
+/// precompress       | build gzip and zstd variants of the files on load    | false
 
 // clang-format on
 
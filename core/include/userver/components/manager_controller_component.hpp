@@ -34,8 +34,10 @@ class Manager;
 /// coro_pool.max_size | max amount of coroutines to keep preallocated | 4000
 /// coro_pool.stack_size | size of a single coroutine | 256 * 1024
 /// coro_pool.local_cache_size | local coroutine cache size per thread | 32
+/// small_stack_coro_pool.* | options of the coroutine pool for task processors with `coro-stack-size-class: small`, same as for `coro_pool`; the pool is not created if the option is missing | -
 /// event_thread_pool.threads | number of threads to process low level IO system calls (number of ev loops to start in libev) | 2
 /// event_thread_pool.thread_name | set OS thread name to this value | 'event-worker'
+/// event_thread_pool.io_backend | kernel interface for I/O readiness notifications: 'default' (epoll) or 'io_uring'; 'io_uring' falls back to 'default' if not supported by the kernel | 'default'
 /// components | dictionary of "component name": "options" | -
 /// default_task_processor | name of the default task processor to use in components | -
 /// task_processors.*NAME*.*OPTIONS* | dictionary of task processors to create and their options. See description below | -
@@ -54,7 +56,8 @@ class Manager;
 /// worker_threads | threads count for the task processor | -
 /// os-scheduling | OS scheduling mode for the task processor threads. 'idle' sets the lowest priority. 'low-priority' sets the priority below 'normal' but higher than 'idle'. | normal
 /// spinning-iterations | tunes the number of spin-wait iterations in case of an empty task queue before threads go to sleep | 1000
-/// task-processor-queue | Task queue mode for the task processor. `global-task-queue` default task queue. `work-stealing-task-queue` experimental with potentially better scalability than `global-task-queue`. | global-task-queue
+/// task-processor-queue | Task queue mode for the task processor. `global-task-queue` default task queue. `work-stealing-task-queue` experimental with potentially better scalability than `global-task-queue`. `numa-work-stealing-task-queue` experimental `work-stealing-task-queue` that pins worker threads to NUMA nodes, keeps a global queue per node and prefers stealing tasks from the same node. `edf-task-queue` experimental task queue that runs tasks with the earliest deadline (see @ref scripts/docs/en/userver/deadline_propagation.md) first, gives tasks without a deadline at least every 4th slot and cancels tasks whose deadline expired while they were waiting in the queue. | global-task-queue
+/// coro-stack-size-class | `default` takes coroutines from `coro_pool`, `small` takes them from `small_stack_coro_pool`, e.g. for a task processor of connection tasks with shallow stacks | default
 /// task-trace | optional dictionary of tracing options | empty (disabled)
 /// task-trace.every | set N to trace each Nth task | 1000
 /// task-trace.max-context-switch-count | set upper limit of context switches to trace for a single task | 1000
@@ -17,9 +17,13 @@ struct TaskProcessorPoolsConfig final {
     std::size_t initial_coro_pool_size = 10;
     std::size_t max_coro_pool_size = 100;
     std::size_t coro_stack_size = 256 * 1024ULL;
+    /// Stack size of the small stack size class of coroutines, 0 disables the class
+    std::size_t small_coro_stack_size = 0;
     std::size_t ev_threads_num = 1;
     std::string ev_thread_name = "ev";
     bool ev_default_loop_disabled = false;
+    /// Use io_uring in ev threads if it is supported by the kernel
+    bool ev_io_uring_enabled = false;
 };
 
 /// @brief Runs a payload in a temporary coroutine engine instance.
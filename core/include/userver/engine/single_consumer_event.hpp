@@ -7,6 +7,7 @@
 #include <chrono>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/impl/context_accessor.hpp>
 #include <userver/engine/impl/wait_list_fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -16,7 +17,11 @@ namespace engine {
 /// @ingroup userver_concurrency
 ///
 /// @brief A multiple-producers, single-consumer event
-class SingleConsumerEvent final {
+///
+/// The event can be waited for together with tasks, futures and sockets using
+/// engine::WaitAny. WaitAny does not reset the signal, call Reset or
+/// WaitForEvent after it.
+class SingleConsumerEvent final : private impl::ContextAccessor {
 public:
     struct NoAutoReset final {};
 
@@ -96,11 +101,21 @@ public:
     void Send();
 
     /// Returns `true` iff already signaled. Never resets the signal.
-    [[nodiscard]] bool IsReady() const noexcept;
+    [[nodiscard]] bool IsReady() const noexcept override;
+
+    /// @cond
+    // For internal use only.
+    impl::ContextAccessor* TryGetContextAccessor() noexcept { return this; }
+    /// @endcond
 
 private:
     class EventWaitStrategy;
 
+    impl::EarlyWakeup TryAppendWaiter(impl::TaskContext& waiter) override;
+    void RemoveWaiter(impl::TaskContext& waiter) noexcept override;
+    void RethrowErrorResult() const override;
+    void AfterWait() noexcept override;
+
     bool GetIsSignaled() noexcept;
 
     void CheckIsAutoResetForWaitPredicate();
@@ -3,6 +3,7 @@
 /// @file userver/fs/read.hpp
 /// @brief functions for asynchronous file read operations
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -19,6 +20,16 @@ namespace fs {
 struct FileInfoWithData {
     std::string data;
     std::string extension;
+    /// Quoted strong validator of the `data`, suitable for the ETag header.
+    /// The validators of the compressed variants are derived from it.
+    std::string etag;
+    std::chrono::system_clock::time_point last_modified;
+    /// `data` compressed with gzip, empty if not precompressed or if the
+    /// compression does not reduce the size
+    std::string gzip_data;
+    /// `data` compressed with zstd, empty if not precompressed or if the
+    /// compression does not reduce the size
+    std::string zstd_data;
 };
 
 using FileInfoWithDataConstPtr = std::shared_ptr<const FileInfoWithData>;
@@ -28,6 +39,8 @@ enum class SettingsReadFile {
     kNone = 0,
     /// Skip hidden files,
     kSkipHidden = 1 << 0,
+    /// Fill FileInfoWithData::gzip_data and FileInfoWithData::zstd_data
+    kPrecompress = 1 << 1,
 };
 
 /// @brief Returns relative path from full path
@@ -50,6 +63,15 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     utils::Flags<SettingsReadFile> flags = {SettingsReadFile::kSkipHidden}
 );
 
+/// @brief Reads file contents and metadata asynchronously
+/// @param async_tp TaskProcessor for synchronous waiting
+/// @param path file to read
+/// @param flags settings read files, SettingsReadFile::kSkipHidden is ignored
+/// @throws std::runtime_error if read fails for any reason (e.g. no such file,
+/// read error, etc.),
+FileInfoWithDataConstPtr
+ReadFileInfoWithData(engine::TaskProcessor& async_tp, const std::string& path, utils::Flags<SettingsReadFile> flags);
+
 /// @brief Reads file contents asynchronously
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path file to open
@@ -47,6 +47,7 @@ namespace components {
 /// flush_level | messages of this and higher levels get flushed to the file immediately | warning
 /// message_queue_size | the size of internal message queue, must be a power of 2 | 65536
 /// overflow_behavior | message handling policy while the queue is full: `discard` drops messages, `block` waits until message gets into the queue | discard
+/// thread_buffer_size | the size in bytes of a per task processor thread buffer for log records, a power of 2 not less than 16. Records of a task are passed through the buffer in bulk once the task is switched out, bypassing the message queue. When the buffer is full, the message queue and `overflow_behavior` are used | disabled
 /// testsuite-capture | if exists, setups additional TCP log sink for testing purposes | {}
 /// fs-task-processor | task processor for disk I/O operations for this logger | fs-task-processor of the loggers component
 ///
@@ -1,7 +1,7 @@
 #pragma once
 
 /// @file userver/rcu/fwd.hpp
-/// @brief Forward declarations for rcu::Variable and rcu::RcuMap
+/// @brief Forward declarations for rcu::Variable, rcu::RcuMap and rcu::ShardedRcuMap
 
 USERVER_NAMESPACE_BEGIN
 
@@ -26,6 +26,9 @@ class WritablePtr;
 template <typename Key, typename Value, typename RcuMapTraits = DefaultRcuMapTraits<Key>>
 class RcuMap;
 
+template <typename Key, typename Value, typename RcuMapTraits = DefaultRcuMapTraits<Key>>
+class ShardedRcuMap;
+
 }  // namespace rcu
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,389 @@
+#pragma once
+
+/// @file userver/rcu/sharded_rcu_map.hpp
+/// @brief @copybrief rcu::ShardedRcuMap
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <userver/rcu/fwd.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace rcu {
+
+/// @brief Forward iterator for the rcu::ShardedRcuMap
+///
+/// Use member functions of rcu::ShardedRcuMap to retrieve the iterator.
+template <typename ShardIterator>
+class ShardedRcuMapIterator final {
+public:
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = ptrdiff_t;
+    using value_type = typename ShardIterator::value_type;
+    using reference = typename ShardIterator::reference;
+    using pointer = typename ShardIterator::pointer;
+
+    ShardedRcuMapIterator() = default;
+
+    ShardedRcuMapIterator operator++(int);
+    ShardedRcuMapIterator& operator++();
+    reference operator*() const;
+    pointer operator->() const;
+
+    bool operator==(const ShardedRcuMapIterator&) const;
+    bool operator!=(const ShardedRcuMapIterator&) const;
+
+    /// @cond
+    /// For internal use only
+    explicit ShardedRcuMapIterator(std::shared_ptr<const std::vector<ShardIterator>> shard_begins);
+    /// @endcond
+
+private:
+    void SkipExhaustedShards();
+
+    // Empty for the end iterator
+    std::shared_ptr<const std::vector<ShardIterator>> shard_begins_;
+    std::size_t shard_index_{0};
+    ShardIterator it_;
+};
+
+/// @ingroup userver_concurrency userver_containers
+///
+/// @brief Map-like structure allowing RCU keyset updates, that splits the
+/// keys between several independent rcu::RcuMap shards.
+///
+/// Has the same API as rcu::RcuMap, except for the `StartWrite()`
+/// transactions. A keyset change copies only the shard of the key, so writes
+/// cost O(size / shard_count) instead of O(size). Use it for big maps with
+/// frequent inserts and erases; for rarely changed maps rcu::RcuMap is
+/// slightly faster to iterate.
+///
+/// Iteration takes a snapshot of every shard at the start of the iteration,
+/// so the keyset of each shard is not affected by concurrent changes. Changes
+/// of different shards are not atomic relative to each other, e.g. `Assign`
+/// and `Clear` may be observed partially applied.
+/// @note No synchronization is provided for value access, it must be
+/// implemented by Value when necessary.
+///
+/// ## Example usage:
+///
+/// @snippet rcu/sharded_rcu_map_test.cpp  Sample rcu::ShardedRcuMap usage
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename Key, typename Value, typename RcuMapTraits>
+class ShardedRcuMap final {
+public:
+    using Shard = RcuMap<Key, Value, RcuMapTraits>;
+    using Hash = typename Shard::Hash;
+    using KeyEqual = typename Shard::KeyEqual;
+    using MutexType = typename Shard::MutexType;
+    using ValuePtr = typename Shard::ValuePtr;
+    using Iterator = ShardedRcuMapIterator<typename Shard::Iterator>;
+    using ConstValuePtr = typename Shard::ConstValuePtr;
+    using ConstIterator = ShardedRcuMapIterator<typename Shard::ConstIterator>;
+    using RawMap = typename Shard::RawMap;
+    using Snapshot = typename Shard::Snapshot;
+    using InsertReturnType = typename Shard::InsertReturnType;
+
+    static constexpr std::size_t kDefaultShardCount = 16;
+
+    explicit ShardedRcuMap(std::size_t shard_count = kDefaultShardCount);
+
+    ShardedRcuMap(const ShardedRcuMap&) = delete;
+    ShardedRcuMap(ShardedRcuMap&&) = delete;
+    ShardedRcuMap& operator=(const ShardedRcuMap&) = delete;
+    ShardedRcuMap& operator=(ShardedRcuMap&&) = delete;
+
+    /// Returns an estimated size of the map at some point in time
+    size_t SizeApprox() const;
+
+    std::size_t GetShardCount() const noexcept { return shard_count_; }
+
+    /// @name Iteration support
+    /// @details Keyset of each shard is fixed at the start of the iteration and
+    /// is not affected by concurrent changes.
+    /// @{
+    ConstIterator begin() const;
+    ConstIterator end() const;
+    Iterator begin();
+    Iterator end();
+    /// @}
+
+    /// @brief Returns a readonly value pointer by its key if exists
+    /// @throws MissingKeyException if the key is not present
+    const ConstValuePtr operator[](const Key&) const;
+
+    /// @brief Returns a modifiable value pointer by key if exists or
+    /// default-creates one
+    /// @note Copies the shard of the key if the key doesn't exist.
+    const ValuePtr operator[](const Key&);
+
+    /// @brief Inserts a new element into the container if there is no element
+    /// with the key in the container.
+    /// @see rcu::RcuMap::Insert
+    InsertReturnType Insert(const Key& key, ValuePtr value);
+
+    /// @brief Inserts a new element into the container constructed in-place with
+    /// the given args if there is no element with the key in the container.
+    /// @see rcu::RcuMap::Emplace
+    template <typename... Args>
+    InsertReturnType Emplace(const Key& key, Args&&... args);
+
+    /// @brief Constructs the value only if there is no element with the key in
+    /// the container.
+    /// @see rcu::RcuMap::TryEmplace
+    template <typename... Args>
+    InsertReturnType TryEmplace(const Key& key, Args&&... args);
+
+    /// @brief If a key equivalent to `key` already exists in the container,
+    /// replaces the associated value. Otherwise, inserts a new pair into the map.
+    template <typename RawKey>
+    void InsertOrAssign(RawKey&& key, ValuePtr value);
+
+    /// @brief Returns a readonly value pointer by its key or an empty pointer
+    const ConstValuePtr Get(const Key&) const;
+
+    /// @brief Returns a modifiable value pointer by key or an empty pointer
+    const ValuePtr Get(const Key&);
+
+    /// @brief Removes a key from the map
+    /// @returns whether the key was present
+    /// @note Copies the shard of the key.
+    bool Erase(const Key&);
+
+    /// @brief Removes a key from the map returning its value
+    /// @returns a value if the key was present, empty pointer otherwise
+    /// @note Copies the shard of the key.
+    ValuePtr Pop(const Key&);
+
+    /// Resets the map to an empty state, shard by shard
+    void Clear();
+
+    /// Replace current data by data from `new_map`, shard by shard
+    void Assign(RawMap new_map);
+
+    /// @brief Returns a readonly copy of the map
+    /// @note Equivalent to `{begin(), end()}` construct, preferable
+    /// for long-running operations.
+    Snapshot GetSnapshot() const;
+
+private:
+    std::size_t GetShardIndex(const Key& key) const;
+    Shard& GetShard(const Key& key) { return shards_[GetShardIndex(key)]; }
+    const Shard& GetShard(const Key& key) const { return shards_[GetShardIndex(key)]; }
+
+    Hash hash_;
+    const std::size_t shard_count_;
+    const std::unique_ptr<Shard[]> shards_;
+};
+
+template <typename K, typename V, typename RcuMapTraits>
+ShardedRcuMap<K, V, RcuMapTraits>::ShardedRcuMap(std::size_t shard_count)
+    : shard_count_(shard_count), shards_(std::make_unique<Shard[]>(shard_count)) {
+    UINVARIANT(shard_count_ > 0, "ShardedRcuMap requires at least one shard");
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+std::size_t ShardedRcuMap<K, V, RcuMapTraits>::GetShardIndex(const K& key) const {
+    // Mixing the bits, so that keys of a shard are still spread evenly
+    // between the buckets of the shard
+    const std::uint64_t hash = hash_(key);
+    return static_cast<std::size_t>((hash * 0x9E3779B97F4A7C15ULL) >> 32) % shard_count_;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+size_t ShardedRcuMap<K, V, RcuMapTraits>::SizeApprox() const {
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < shard_count_; ++i) {
+        result += shards_[i].SizeApprox();
+    }
+    return result;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::begin() const -> ConstIterator {
+    auto shard_begins = std::make_shared<std::vector<typename Shard::ConstIterator>>();
+    shard_begins->reserve(shard_count_);
+    for (std::size_t i = 0; i < shard_count_; ++i) {
+        shard_begins->push_back(std::as_const(shards_[i]).begin());
+    }
+    return ConstIterator{std::move(shard_begins)};
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::end() const -> ConstIterator {
+    return {};
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::begin() -> Iterator {
+    auto shard_begins = std::make_shared<std::vector<typename Shard::Iterator>>();
+    shard_begins->reserve(shard_count_);
+    for (std::size_t i = 0; i < shard_count_; ++i) {
+        shard_begins->push_back(shards_[i].begin());
+    }
+    return Iterator{std::move(shard_begins)};
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::end() -> Iterator {
+    return {};
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+// Protects from assignment to map[key]
+// NOLINTNEXTLINE(readability-const-return-type)
+const typename ShardedRcuMap<K, V, RcuMapTraits>::ConstValuePtr
+ShardedRcuMap<K, V, RcuMapTraits>::operator[](const K& key) const {
+    return GetShard(key)[key];
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+// Protects from assignment to map[key]
+// NOLINTNEXTLINE(readability-const-return-type)
+const typename ShardedRcuMap<K, V, RcuMapTraits>::ValuePtr ShardedRcuMap<K, V, RcuMapTraits>::operator[](const K& key) {
+    return GetShard(key)[key];
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::Insert(const K& key, ValuePtr value) -> InsertReturnType {
+    return GetShard(key).Insert(key, std::move(value));
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+template <typename... Args>
+auto ShardedRcuMap<K, V, RcuMapTraits>::Emplace(const K& key, Args&&... args) -> InsertReturnType {
+    return GetShard(key).Emplace(key, std::forward<Args>(args)...);
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+template <typename... Args>
+auto ShardedRcuMap<K, V, RcuMapTraits>::TryEmplace(const K& key, Args&&... args) -> InsertReturnType {
+    return GetShard(key).TryEmplace(key, std::forward<Args>(args)...);
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+template <typename RawKey>
+void ShardedRcuMap<K, V, RcuMapTraits>::InsertOrAssign(RawKey&& key, ValuePtr value) {
+    auto& shard = GetShard(key);
+    shard.InsertOrAssign(std::forward<RawKey>(key), std::move(value));
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+// Protects from assignment to map[key]
+// NOLINTNEXTLINE(readability-const-return-type)
+const typename ShardedRcuMap<K, V, RcuMapTraits>::ConstValuePtr
+ShardedRcuMap<K, V, RcuMapTraits>::Get(const K& key) const {
+    return GetShard(key).Get(key);
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+// Protects from assignment to map[key]
+// NOLINTNEXTLINE(readability-const-return-type)
+const typename ShardedRcuMap<K, V, RcuMapTraits>::ValuePtr ShardedRcuMap<K, V, RcuMapTraits>::Get(const K& key) {
+    return GetShard(key).Get(key);
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+bool ShardedRcuMap<K, V, RcuMapTraits>::Erase(const K& key) {
+    return GetShard(key).Erase(key);
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::Pop(const K& key) -> ValuePtr {
+    return GetShard(key).Pop(key);
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+void ShardedRcuMap<K, V, RcuMapTraits>::Clear() {
+    for (std::size_t i = 0; i < shard_count_; ++i) {
+        shards_[i].Clear();
+    }
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+void ShardedRcuMap<K, V, RcuMapTraits>::Assign(RawMap new_map) {
+    std::vector<RawMap> shard_maps(shard_count_);
+    while (!new_map.empty()) {
+        auto node = new_map.extract(new_map.begin());
+        shard_maps[GetShardIndex(node.key())].insert(std::move(node));
+    }
+    for (std::size_t i = 0; i < shard_count_; ++i) {
+        shards_[i].Assign(std::move(shard_maps[i]));
+    }
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::GetSnapshot() const -> Snapshot {
+    return {begin(), end()};
+}
+
+template <typename ShardIterator>
+ShardedRcuMapIterator<ShardIterator>::ShardedRcuMapIterator(
+    std::shared_ptr<const std::vector<ShardIterator>> shard_begins
+)
+    : shard_begins_(std::move(shard_begins)) {
+    UASSERT(shard_begins_ && !shard_begins_->empty());
+    it_ = shard_begins_->front();
+    SkipExhaustedShards();
+}
+
+template <typename ShardIterator>
+auto ShardedRcuMapIterator<ShardIterator>::operator++(int) -> ShardedRcuMapIterator {
+    ShardedRcuMapIterator tmp(*this);
+    ++*this;
+    return tmp;
+}
+
+template <typename ShardIterator>
+auto ShardedRcuMapIterator<ShardIterator>::operator++() -> ShardedRcuMapIterator& {
+    ++it_;
+    SkipExhaustedShards();
+    return *this;
+}
+
+template <typename ShardIterator>
+auto ShardedRcuMapIterator<ShardIterator>::operator*() const -> reference {
+    return *it_;
+}
+
+template <typename ShardIterator>
+auto ShardedRcuMapIterator<ShardIterator>::operator->() const -> pointer {
+    return it_.operator->();
+}
+
+template <typename ShardIterator>
+bool ShardedRcuMapIterator<ShardIterator>::operator==(const ShardedRcuMapIterator& rhs) const {
+    if (!shard_begins_ || !rhs.shard_begins_) return shard_begins_ == rhs.shard_begins_;
+    return shard_begins_ == rhs.shard_begins_ && shard_index_ == rhs.shard_index_ && it_ == rhs.it_;
+}
+
+template <typename ShardIterator>
+bool ShardedRcuMapIterator<ShardIterator>::operator!=(const ShardedRcuMapIterator& rhs) const {
+    return !(*this == rhs);
+}
+
+template <typename ShardIterator>
+void ShardedRcuMapIterator<ShardIterator>::SkipExhaustedShards() {
+    while (it_ == ShardIterator{}) {
+        if (++shard_index_ == shard_begins_->size()) {
+            // Turn into the end iterator and release the snapshots
+            shard_begins_.reset();
+            shard_index_ = 0;
+            it_ = {};
+            return;
+        }
+        it_ = (*shard_begins_)[shard_index_];
+    }
+}
+
+}  // namespace rcu
+
+USERVER_NAMESPACE_END
@@ -77,6 +77,7 @@ namespace components {
 /// connection.requests_queue_size_threshold | drop requests from handlers that allow throttling if there's more pending requests than allowed by this value | 100
 /// connection.keepalive_timeout | timeout in seconds to drop connection if there's not data received from it | 600
 /// connection.stream_close_check_delay | delay in microseconds of the start of stream close check routine; do not set if not sure what it is doing | 20ms
+/// connection.max_pipelined_requests | max count of HTTP/1.1 pipelined requests of a single connection that are handled concurrently; responses are still sent in the order of requests | 1
 /// connection.http-version | the HTTP protocol version | '1.1'
 /// connection.http2-session.max_concurrent_streams | max number of concurrent open streams | 100
 /// connection.http2-session.max_frame_size | max size of the HTTP/2.0 frame | 16384
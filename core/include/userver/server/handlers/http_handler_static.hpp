@@ -19,6 +19,13 @@ namespace server::handlers {
 /// @brief Handler that returns HTTP 200 if file exist
 /// and returns file data with mapped content/type
 ///
+/// The file data is shared with the response without copying. The handler sets
+/// `ETag` and `Last-Modified` headers and responds with HTTP 304 to the matching
+/// `If-None-Match` or `If-Modified-Since` requests. If the FsCache component has
+/// `precompress: true`, the zstd or gzip variant of the file is sent to the
+/// clients that accept it via `Accept-Encoding`. Such files are served with
+/// `Vary: Accept-Encoding` and each variant has its own `ETag`.
+///
 /// ## HttpHandlerStatic Dynamic config
 /// * @ref USERVER_FILES_CONTENT_TYPE_MAP
 ///
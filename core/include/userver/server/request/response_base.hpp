@@ -4,6 +4,7 @@
 #include <chrono>
 #include <functional>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <string>
 
@@ -82,8 +83,16 @@ public:
     virtual ~ResponseBase() noexcept;
 
     void SetData(std::string data);
-    const std::string& GetData() const { return data_; }
-    std::string&& ExtractData() { return std::move(data_); }
+
+    /// @brief Sets the body to an immutable buffer shared with other responses
+    /// (e.g. with a cached file), avoiding a copy of the data.
+    ///
+    /// Any subsequent SetData call replaces the shared body.
+    void SetSharedData(std::shared_ptr<const std::string> data);
+    bool HasSharedData() const noexcept { return shared_data_ != nullptr; }
+
+    const std::string& GetData() const { return shared_data_ ? *shared_data_ : data_; }
+    std::string&& ExtractData();
 
     virtual bool IsBodyStreamed() const = 0;
     virtual bool WaitForHeadersEnd() = 0;
@@ -138,6 +147,7 @@ private:
     ResponseDataAccounter& accounter_;
     std::optional<Guard> guard_;
     std::string data_;
+    std::shared_ptr<const std::string> shared_data_;
     std::chrono::steady_clock::time_point create_time_;
     std::chrono::steady_clock::time_point ready_time_;
     std::chrono::steady_clock::time_point sent_time_;
@@ -31,6 +31,7 @@ void CombineStatistics(
     result.update_no_changes_count = a.update_no_changes_count.Load() + b.update_no_changes_count.Load();
     result.update_failures_count = a.update_failures_count.Load() + b.update_failures_count.Load();
     result.documents_read_count = a.documents_read_count.Load() + b.documents_read_count.Load();
+    result.documents_read_bytes = a.documents_read_bytes.Load() + b.documents_read_bytes.Load();
     result.documents_parse_failures = a.documents_parse_failures.Load() + b.documents_parse_failures.Load();
 
     result.last_update_start_time = std::max(a.last_update_start_time.load(), b.last_update_start_time.load());
@@ -64,6 +65,7 @@ void DumpMetric(utils::statistics::Writer& writer, const UpdateStatistics& stats
         // v2 - please see note above
         documents["read_count.v2"] = stats.documents_read_count;
         documents["parse_failures.v2"] = stats.documents_parse_failures;
+        documents["read_bytes"] = stats.documents_read_bytes;
     }
 
     if (auto age = writer["time"]) {
@@ -125,6 +127,10 @@ void UpdateStatisticsScope::IncreaseDocumentsReadCount(std::size_t add) {
     update_stats_.documents_read_count += utils::statistics::Rate{add};
 }
 
+void UpdateStatisticsScope::IncreaseDocumentsReadBytes(std::size_t add) {
+    update_stats_.documents_read_bytes += utils::statistics::Rate{add};
+}
+
 void UpdateStatisticsScope::IncreaseDocumentsParseFailures(std::size_t add) {
     update_stats_.documents_parse_failures += utils::statistics::Rate{add};
 }
@@ -2,7 +2,9 @@
 
 #include <chrono>
 #include <cstdlib>
+#include <functional>
 #include <limits>
+#include <string_view>
 
 #include <moodycamel/concurrentqueue.h>
 
@@ -15,6 +17,7 @@
 
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
+#include <clients/http/native/transport.hpp>
 #include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
 #include <curl-ev/multi.hpp>
@@ -33,6 +36,18 @@ const auto kEasyReinitPeriod = std::chrono::minutes{1};
 // Clamp too high values to LONG_MAX, it shouldn't matter for these magnitudes.
 long ClampToLong(size_t value) { return std::min<size_t>(value, std::numeric_limits<long>::max()); }
 
+// A destination spills over to its spare multi when its home multi performs
+// that many requests more than twice the requests of the spare one
+constexpr long long kSpillOverMinExcess = 16;
+
+// Requests with the same scheme and authority may share connections
+std::string_view GetConnectionDestination(std::string_view url) {
+    constexpr std::string_view kSchemeSeparator = "://";
+    const auto scheme_end = url.find(kSchemeSeparator);
+    const auto authority_begin = scheme_end == std::string_view::npos ? 0 : scheme_end + kSchemeSeparator.size();
+    return url.substr(0, url.find_first_of("/?#", authority_begin));
+}
+
 const tracing::TracingManagerBase* GetTracingManager(const ClientSettings& settings) {
     UASSERT(settings.tracing_manager);
     return settings.tracing_manager;
@@ -47,6 +62,7 @@ Client::Client(
 )
     : deadline_propagation_config_(settings.deadline_propagation),
       cancellation_policy_(settings.cancellation_policy),
+      destination_affinity_(settings.destination_affinity),
       destination_statistics_(std::make_shared<DestinationStatistics>()),
       statistics_(settings.io_threads),
       fs_task_processor_(fs_task_processor),
@@ -62,6 +78,10 @@ Client::Client(
     ev_config.thread_name = kIoThreadName + (thread_name_prefix.empty() ? "" : ("-" + thread_name_prefix));
     thread_pool_ = std::make_unique<engine::ev::ThreadPool>(std::move(ev_config));
 
+    if (settings.transport == Transport::kNative) {
+        native_transport_ = std::make_unique<native::Transport>(fs_task_processor_);
+    }
+
     ReinitEasy();
 
     multis_.reserve(io_threads);
@@ -147,6 +167,9 @@ Request Client::CreateRequest() {
     }
     auto urls = allowed_urls_extra_.Read();
     request.SetAllowedUrlsExtra(*urls);
+    if (native_transport_) {
+        request.SetNativeTransport(native_transport_.get());
+    }
 
     if (user_agent_) {
         request.user_agent(*user_agent_);
@@ -178,7 +201,10 @@ void Client::SetMaxHostConnections(size_t max_host_connections) {
 
 std::string Client::GetProxy() const { return proxy_.ReadCopy(); }
 
-void Client::SetDnsResolver(clients::dns::Resolver* resolver) { resolver_ = resolver; }
+void Client::SetDnsResolver(clients::dns::Resolver* resolver) {
+    resolver_ = resolver;
+    if (native_transport_) native_transport_->SetDnsResolver(resolver);
+}
 
 void Client::ReinitEasy() {
     easy_.Set(utils::CriticalAsync(fs_task_processor_, "http_easy_reinit", &curl::easy::CreateBlocking).Get());
@@ -232,6 +258,25 @@ void Client::PushIdleEasy(std::shared_ptr<curl::easy>&& easy) noexcept {
     DecPending();
 }
 
+Statistics* Client::BindToDestination(curl::easy& easy, std::string_view url) {
+    const auto size = multis_.size();
+    if (!destination_affinity_ || size < 2) return nullptr;
+
+    // Both multis are stable for the destination, so its requests share the
+    // connections of at most two multis
+    const auto hash = std::hash<std::string_view>{}(GetConnectionDestination(url));
+    const auto home = hash % size;
+    const auto spare = (home + 1 + (hash / size) % (size - 1)) % size;
+
+    const auto home_load = multis_[home]->Statistics().active_easy_count();
+    const auto spare_load = multis_[spare]->Statistics().active_easy_count();
+    const auto idx = home_load > 2 * spare_load + kSpillOverMinExcess ? spare : home;
+
+    if (multis_[idx].get() == easy.GetMulti()) return nullptr;
+    easy.SetMulti(*multis_[idx]);
+    return &statistics_[idx];
+}
+
 std::shared_ptr<curl::easy> Client::TryDequeueIdle() noexcept {
     std::shared_ptr<curl::easy> result;
     if (!idle_queue_->try_dequeue(result)) {
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/current_task.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/tracing/manager.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr auto kTimeout = std::chrono::seconds{10};
+constexpr std::string_view kResponse = "HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok";
+
+void ServeKeepAlive(engine::io::Socket socket) {
+    std::string buffer(4096, '\0');
+    std::string received;
+    try {
+        for (;;) {
+            const auto size = socket.RecvSome(buffer.data(), buffer.size(), {});
+            if (size == 0) return;
+            received.append(buffer.data(), size);
+
+            // Requests without a body only
+            for (auto pos = received.find("\r\n\r\n"); pos != std::string::npos; pos = received.find("\r\n\r\n")) {
+                received.erase(0, pos + 4);
+                [[maybe_unused]] const auto sent = socket.SendAll(kResponse.data(), kResponse.size(), {});
+            }
+        }
+    } catch (const engine::io::IoException&) {
+        // The client has gone or the server is stopping
+    }
+}
+
+void Serve(internal::net::TcpListener& listener) {
+    std::vector<engine::TaskWithResult<void>> connections;
+    try {
+        for (;;) {
+            connections.push_back(engine::AsyncNoSpan(&ServeKeepAlive, listener.socket.Accept({})));
+        }
+    } catch (const engine::io::IoException&) {
+        // Cancelled
+    }
+    for (auto& connection : connections) connection.SyncCancel();
+}
+
+}  // namespace
+
+// Arg(0) - libcurl transport, Arg(1) - native transport
+void http_client_get(benchmark::State& state) {
+    engine::RunStandalone(4, [&] {
+        internal::net::TcpListener listener{internal::net::IpVersion::kV4};
+        auto server = engine::AsyncNoSpan([&listener] { Serve(listener); });
+        const auto url = fmt::format("http://127.0.0.1:{}/", listener.Port());
+
+        const tracing::GenericTracingManager tracing_manager{
+            tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+        clients::http::ClientSettings settings;
+        settings.io_threads = 1;
+        settings.tracing_manager = &tracing_manager;
+        settings.transport = state.range(0) ? clients::http::Transport::kNative : clients::http::Transport::kCurl;
+        clients::http::Client client{
+            std::move(settings),
+            engine::current_task::GetTaskProcessor(),
+            std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+
+        for ([[maybe_unused]] auto _ : state) {
+            auto response = client.CreateRequest().get(url).timeout(kTimeout).perform();
+            benchmark::DoNotOptimize(response);
+        }
+
+        server.SyncCancel();
+    });
+}
+BENCHMARK(http_client_get)->Arg(0)->Arg(1);
+
+USERVER_NAMESPACE_END
@@ -7,9 +7,11 @@
 #include <boost/algorithm/string/trim.hpp>
 
 #include <clients/http/client_utils_test.hpp>
+#include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
 #include <engine/task/task_processor.hpp>
 #include <userver/clients/dns/resolver.hpp>
+#include <userver/clients/http/config.hpp>
 #include <userver/clients/http/connect_to.hpp>
 #include <userver/clients/http/streamed_response.hpp>
 #include <userver/concurrent/queue.hpp>
@@ -23,6 +25,7 @@
 #include <userver/http/common_headers.hpp>
 #include <userver/http/http_version.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/tracing/manager.hpp>
 #include <userver/tracing/tracing.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/userver_info.hpp>
@@ -548,6 +551,31 @@ std::string DifferentUrlsRetry(
 
 }  // namespace sample2
 
+std::unique_ptr<clients::http::Client> CreateNativeHttpClient(const tracing::TracingManagerBase& tracing_manager) {
+    clients::http::ClientSettings settings;
+    settings.io_threads = 1;
+    settings.tracing_manager = &tracing_manager;
+    settings.transport = clients::http::Transport::kNative;
+    return std::make_unique<clients::http::Client>(
+        std::move(settings),
+        engine::current_task::GetTaskProcessor(),
+        std::vector<utils::NotNull<clients::http::Plugin*>>{}
+    );
+}
+
+HttpResponse EchoKeepAliveCallback(const HttpRequest& request, HttpResponse::Commands command) {
+    const auto body = request.substr(request.find("\r\n\r\n") + 4);
+    return {
+        fmt::format(
+            "HTTP/1.1 200 OK\r\n{}: {}\r\nContent-Length: {}\r\n\r\n{}",
+            kTestHeader,
+            TryGetHeader(request, kTestHeader),
+            body.size(),
+            body
+        ),
+        command};
+}
+
 }  // namespace
 
 UTEST(HttpClient, PostEcho) {
@@ -595,6 +623,117 @@ UTEST(HttpClient, PostEcho) {
     }
 }
 
+namespace {
+
+struct ConnectionReuse {
+    std::size_t connections_opened{0};
+    std::uint64_t sockets_reused{0};
+};
+
+// The requests are created before performing any of them, so each one gets a
+// fresh easy handle bound to a random multi
+ConnectionReuse PerformWithFreshEasies(bool destination_affinity, std::size_t requests_count) {
+    const utest::SimpleServer http_server{[](const HttpRequest&) {
+        return HttpResponse{"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n", HttpResponse::kWriteAndContinue};
+    }};
+
+    const tracing::GenericTracingManager tracing_manager{tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+    clients::http::ClientSettings settings;
+    settings.io_threads = 4;
+    settings.tracing_manager = &tracing_manager;
+    settings.destination_affinity = destination_affinity;
+    clients::http::Client http_client{
+        std::move(settings),
+        engine::current_task::GetTaskProcessor(),
+        std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+
+    std::vector<clients::http::Request> requests;
+    requests.reserve(requests_count);
+    for (std::size_t i = 0; i < requests_count; ++i) {
+        requests.push_back(http_client.CreateRequest());
+    }
+    for (auto& request : requests) {
+        const auto res = request.get(http_server.GetBaseUrl()).timeout(kTimeout).perform();
+        EXPECT_EQ(res->status_code(), 200);
+    }
+
+    ConnectionReuse result;
+    result.connections_opened = http_server.GetConnectionsOpenedCount();
+    for (const auto& multi_stats : http_client.GetPoolStatistics().multi) {
+        result.sockets_reused += multi_stats.multi.socket_reused.value;
+    }
+    return result;
+}
+
+}  // namespace
+
+UTEST(HttpClient, DestinationAffinity) {
+    constexpr std::size_t kRequests = 16;
+
+    // The connection cache is per multi, the easies spread over 4 multis open
+    // a connection in each of them. All of them landing on a single multi has
+    // the probability of 4^-15.
+    const auto baseline = PerformWithFreshEasies(false, kRequests);
+    EXPECT_GT(baseline.connections_opened, 1);
+    EXPECT_EQ(baseline.sockets_reused, kRequests - baseline.connections_opened);
+
+    // Requests to the same destination are performed by the same multi, so
+    // they share a single connection whatever easy handle performs them
+    const auto affine = PerformWithFreshEasies(true, kRequests);
+    EXPECT_EQ(affine.connections_opened, 1);
+    EXPECT_EQ(affine.sockets_reused, kRequests - 1);
+    EXPECT_GT(affine.sockets_reused, baseline.sockets_reused);
+}
+
+UTEST(HttpClient, NativeTransport) {
+    const utest::SimpleServer http_server{[](const HttpRequest& request) {
+        return EchoKeepAliveCallback(request, HttpResponse::kWriteAndContinue);
+    }};
+    const tracing::GenericTracingManager tracing_manager{tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+    const auto http_client = CreateNativeHttpClient(tracing_manager);
+
+    for (unsigned i = 0; i < kFewRepetitions; ++i) {
+        const auto data = fmt::format("{} {}", kTestData, i);
+        const auto res = http_client->CreateRequest()
+                             .post(http_server.GetBaseUrl(), data)
+                             .headers({{kTestHeader, "value"}})
+                             .timeout(kTimeout)
+                             .perform();
+        EXPECT_EQ(res->status_code(), 200);
+        EXPECT_EQ(res->body(), data);
+        EXPECT_EQ(res->headers()[kTestHeaderMixedCase], "value");
+        EXPECT_EQ(res->GetStats().open_socket_count, i == 0 ? 1 : 0);
+    }
+    EXPECT_EQ(http_server.GetConnectionsOpenedCount(), 1);
+}
+
+UTEST(HttpClient, NativeTransportClosedConnection) {
+    // The server closes the connections without telling the client, the
+    // requests must be resent over the new connections
+    const utest::SimpleServer http_server{[](const HttpRequest& request) {
+        return EchoKeepAliveCallback(request, HttpResponse::kWriteAndClose);
+    }};
+    const tracing::GenericTracingManager tracing_manager{tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+    const auto http_client = CreateNativeHttpClient(tracing_manager);
+
+    for (unsigned i = 0; i < kFewRepetitions; ++i) {
+        const auto res =
+            http_client->CreateRequest().post(http_server.GetBaseUrl(), kTestData).timeout(kTimeout).perform();
+        EXPECT_EQ(res->status_code(), 200);
+        EXPECT_EQ(res->body(), kTestData);
+    }
+    EXPECT_EQ(http_server.GetConnectionsOpenedCount(), kFewRepetitions);
+}
+
+UTEST(HttpClient, NativeTransportTimeout) {
+    const utest::SimpleServer http_server{&sleep_callback};
+    const tracing::GenericTracingManager tracing_manager{tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+    const auto http_client = CreateNativeHttpClient(tracing_manager);
+
+    auto request = http_client->CreateRequest().get(http_server.GetBaseUrl()).retry(2).timeout(kSmallTimeout);
+    UEXPECT_THROW((void)request.perform(), clients::http::TimeoutException);
+}
+
 UTEST(HttpClient, StatsOnTimeout) {
     const int kRetries = 5;
     const utest::SimpleServer http_server{&sleep_callback};
@@ -176,6 +176,22 @@ properties:
         type: integer
         description: number of threads to process low level HTTP related IO system calls
         defaultDescription: 8
+    destination-affinity:
+        type: boolean
+        description: |
+            perform the requests to the same host on the same IO thread to reuse
+            its connections, spilling over to a second thread under load
+        defaultDescription: false
+    transport:
+        type: string
+        description: |
+            'curl' performs the requests with libcurl, 'native' uses the
+            coroutine HTTP/1.1 client and falls back to libcurl for the
+            requests it does not support
+        defaultDescription: curl
+        enum:
+          - curl
+          - native
     fs-task-processor:
         type: string
         description: task processor to run blocking HTTP related calls, like DNS resolving or hosts reading
@@ -47,11 +47,20 @@ CancellationPolicy Parse(yaml_config::YamlConfig value, formats::parse::To<Cance
     throw std::runtime_error("Invalid CancellationPolicy value: " + str);
 }
 
+Transport Parse(yaml_config::YamlConfig value, formats::parse::To<Transport>) {
+    auto str = value.As<std::string>();
+    if (str == "curl") return Transport::kCurl;
+    if (str == "native") return Transport::kNative;
+    throw std::runtime_error("Invalid Transport value: " + str);
+}
+
 ClientSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ClientSettings>) {
     ClientSettings result;
     result.thread_name_prefix = value["thread-name-prefix"].As<std::string>(result.thread_name_prefix);
     result.io_threads = value["threads"].As<size_t>(result.io_threads);
     result.deadline_propagation = ParseDeadlinePropagationConfig(value);
+    result.destination_affinity = value["destination-affinity"].As<bool>(result.destination_affinity);
+    result.transport = value["transport"].As<Transport>(result.transport);
     return result;
 }
 
@@ -24,6 +24,8 @@ curl::easy& EasyWrapper::Easy() { return *easy_; }
 
 const curl::easy& EasyWrapper::Easy() const { return *easy_; }
 
+Statistics* EasyWrapper::BindToDestination(std::string_view url) { return client_.BindToDestination(*easy_, url); }
+
 }  // namespace clients::http::impl
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string_view>
 
 #include <curl-ev/easy.hpp>
 
@@ -8,6 +9,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace clients::http {
 class Client;
+class Statistics;
 }  // namespace clients::http
 
 namespace clients::http::impl {
@@ -26,6 +28,11 @@ public:
     curl::easy& Easy();
     const curl::easy& Easy() const;
 
+    /// Moves the easy to the multi chosen for the destination of the URL,
+    /// returns the statistics of the new multi or nullptr if the easy was not
+    /// moved. Must not be called while the easy is being performed.
+    Statistics* BindToDestination(std::string_view url);
+
 private:
     std::shared_ptr<curl::easy> easy_;
     Client& client_;
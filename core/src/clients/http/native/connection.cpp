@@ -0,0 +1,100 @@
+#include <clients/http/native/connection.hpp>
+
+#include <netinet/tcp.h>
+
+#include <exception>
+
+#include <fmt/format.h>
+
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/io/tls_wrapper.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::native {
+
+namespace {
+
+constexpr std::size_t kReadBufferSize = 16 * 1024;
+
+}  // namespace
+
+ResponseError::ResponseError(std::string message, bool nothing_received)
+    : std::runtime_error(std::move(message)), nothing_received_(nothing_received) {}
+
+std::unique_ptr<Connection> Connection::Connect(
+    const std::vector<engine::io::Sockaddr>& addrs,
+    const std::string& tls_server_name,
+    engine::Deadline deadline
+) {
+    UINVARIANT(!addrs.empty(), "No addresses to connect to");
+
+    std::exception_ptr last_error;
+    for (const auto& addr : addrs) {
+        try {
+            engine::io::Socket socket{addr.Domain(), engine::io::SocketType::kStream};
+            socket.Connect(addr, deadline);
+            socket.SetOption(IPPROTO_TCP, TCP_NODELAY, 1);
+
+            if (tls_server_name.empty()) {
+                return std::make_unique<Connection>(std::make_unique<engine::io::Socket>(std::move(socket)));
+            }
+            auto tls = engine::io::TlsWrapper::StartTlsClient(std::move(socket), tls_server_name, deadline);
+            return std::make_unique<Connection>(std::make_unique<engine::io::TlsWrapper>(std::move(tls)));
+        } catch (const engine::io::IoInterrupted&) {
+            // Timeouts and cancellations are not specific to the address
+            throw;
+        } catch (const engine::io::IoException& ex) {
+            LOG_INFO() << "Failed to connect to " << addr << ": " << ex;
+            last_error = std::current_exception();
+        }
+    }
+    std::rethrow_exception(last_error);
+}
+
+Connection::Connection(std::unique_ptr<engine::io::RwBase> stream) : stream_(std::move(stream)) { UASSERT(stream_); }
+
+ParsedResponse
+Connection::Perform(std::string_view head, std::string_view body, bool is_head_request, engine::Deadline deadline) {
+    UASSERT(IsReusable());
+    // Stays false if anything below throws
+    reusable_ = false;
+
+    ResponseParser parser{is_head_request};
+    try {
+        const auto sent = stream_->WriteAll({{head.data(), head.size()}, {body.data(), body.size()}}, deadline);
+        if (sent != head.size() + body.size()) {
+            throw ResponseError("Connection closed by peer while sending the request", true);
+        }
+
+        std::string buffer(kReadBufferSize, '\0');
+        for (;;) {
+            const auto received = stream_->ReadSome(buffer.data(), buffer.size(), deadline);
+            const auto state = received ? parser.Parse({buffer.data(), received}) : parser.Finish();
+            if (state == ResponseParser::State::kComplete) break;
+            if (state == ResponseParser::State::kError) {
+                throw ResponseError(
+                    received ? "Malformed HTTP response" : "Connection closed by peer before the response is complete",
+                    !parser.IsStarted()
+                );
+            }
+        }
+    } catch (const engine::io::IoSystemError& ex) {
+        // Resets of idle connections are reported on send or on the first read
+        if (parser.IsStarted()) throw;
+        throw ResponseError(fmt::format("Failed to perform the request: {}", ex.what()), true);
+    }
+
+    auto& response = parser.GetResponse();
+    reusable_ = response.keep_alive;
+    return std::move(response);
+}
+
+bool Connection::IsReusable() const { return reusable_ && stream_->IsValid(); }
+
+}  // namespace clients::http::native
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/io/common.hpp>
+#include <userver/engine/io/sockaddr.hpp>
+
+#include <clients/http/native/response_parser.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::native {
+
+/// Keep-alive HTTP/1.1 connection, plain or TLS, performing one request at
+/// a time.
+class Connection final {
+public:
+    /// Connects to the first reachable address, TLS is used if `tls_server_name`
+    /// is not empty.
+    /// @throws engine::io::IoException on connection failures
+    static std::unique_ptr<Connection> Connect(
+        const std::vector<engine::io::Sockaddr>& addrs,
+        const std::string& tls_server_name,
+        engine::Deadline deadline
+    );
+
+    explicit Connection(std::unique_ptr<engine::io::RwBase> stream);
+
+    /// Sends the request and receives the response.
+    /// @throws engine::io::IoException on send and receive failures
+    /// @throws ResponseError if the response is malformed, the connection is
+    /// closed before the response is complete or reset before anything is
+    /// received
+    ParsedResponse
+    Perform(std::string_view head, std::string_view body, bool is_head_request, engine::Deadline deadline);
+
+    /// Whether the connection may be used for the next request
+    bool IsReusable() const;
+
+private:
+    std::unique_ptr<engine::io::RwBase> stream_;
+    bool reusable_{true};
+};
+
+/// Thrown when the response can not be parsed or is truncated
+class ResponseError final : public std::runtime_error {
+public:
+    /// `nothing_received` tells that the peer closed the connection without
+    /// sending anything, which usually means that an idle connection expired
+    ResponseError(std::string message, bool nothing_received);
+
+    bool IsNothingReceived() const { return nothing_received_; }
+
+private:
+    const bool nothing_received_;
+};
+
+}  // namespace clients::http::native
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,147 @@
+#include <clients/http/native/response_parser.hpp>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::native {
+
+namespace {
+
+bool IsInformational(int status_code) { return status_code >= 100 && status_code < 200; }
+
+void TrimRight(std::string& value) {
+    while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) value.pop_back();
+}
+
+}  // namespace
+
+const llhttp_settings_t ResponseParser::parser_settings = []() {
+    llhttp_settings_t settings{};
+    llhttp_settings_init(&settings);
+    settings.on_message_begin = ResponseParser::OnMessageBegin;
+    settings.on_header_field = ResponseParser::OnHeaderField;
+    settings.on_header_value = ResponseParser::OnHeaderValue;
+    settings.on_headers_complete = ResponseParser::OnHeadersComplete;
+    settings.on_body = ResponseParser::OnBody;
+    settings.on_message_complete = ResponseParser::OnMessageComplete;
+    return settings;
+}();
+
+ResponseParser::ResponseParser(bool is_head_request) : is_head_request_(is_head_request) {
+    llhttp_init(&parser_, HTTP_RESPONSE, &parser_settings);
+    parser_.data = this;
+}
+
+ResponseParser::State ResponseParser::Parse(std::string_view data) {
+    UASSERT(!complete_);
+    if (data.empty()) return State::kIncomplete;
+    started_ = true;
+
+    const auto err = llhttp_execute(&parser_, data.data(), data.size());
+    if (err == HPE_PAUSED) {
+        UASSERT(complete_);
+        // Pipelining is not used, the data after the response means the
+        // connection is out of sync
+        if (llhttp_get_error_pos(&parser_) != data.data() + data.size()) response_.keep_alive = false;
+        return State::kComplete;
+    }
+    if (err != HPE_OK) {
+        LOG_WARNING() << "Failed to parse HTTP response: " << llhttp_errno_name(err) << ' '
+                      << llhttp_get_error_reason(&parser_);
+        return State::kError;
+    }
+    return State::kIncomplete;
+}
+
+ResponseParser::State ResponseParser::Finish() {
+    if (!complete_) {
+        const auto err = llhttp_finish(&parser_);
+        if (err != HPE_OK && err != HPE_PAUSED) return State::kError;
+    }
+    if (!complete_) return State::kError;
+
+    response_.keep_alive = false;
+    return State::kComplete;
+}
+
+int ResponseParser::OnMessageBegin(llhttp_t* p) {
+    auto* parser = static_cast<ResponseParser*>(p->data);
+    UASSERT(parser != nullptr);
+    // Interim 1xx responses are skipped
+    parser->response_ = ParsedResponse{};
+    parser->in_header_value_ = false;
+    return 0;
+}
+
+int ResponseParser::OnHeaderField(llhttp_t* p, const char* data, std::size_t size) {
+    auto* parser = static_cast<ResponseParser*>(p->data);
+    UASSERT(parser != nullptr);
+    return parser->OnHeaderFieldImpl(data, size);
+}
+
+int ResponseParser::OnHeaderValue(llhttp_t* p, const char* data, std::size_t size) {
+    auto* parser = static_cast<ResponseParser*>(p->data);
+    UASSERT(parser != nullptr);
+    return parser->OnHeaderValueImpl(data, size);
+}
+
+int ResponseParser::OnHeadersComplete(llhttp_t* p) {
+    auto* parser = static_cast<ResponseParser*>(p->data);
+    UASSERT(parser != nullptr);
+    return parser->OnHeadersCompleteImpl(p);
+}
+
+int ResponseParser::OnBody(llhttp_t* p, const char* data, std::size_t size) {
+    auto* parser = static_cast<ResponseParser*>(p->data);
+    UASSERT(parser != nullptr);
+    parser->response_.body.append(data, size);
+    return 0;
+}
+
+int ResponseParser::OnMessageComplete(llhttp_t* p) {
+    auto* parser = static_cast<ResponseParser*>(p->data);
+    UASSERT(parser != nullptr);
+    return parser->OnMessageCompleteImpl(p);
+}
+
+int ResponseParser::OnHeaderFieldImpl(const char* data, std::size_t size) {
+    auto& headers = response_.headers;
+    if (in_header_value_ || headers.empty()) {
+        headers.emplace_back();
+        in_header_value_ = false;
+    }
+    headers.back().first.append(data, size);
+    return 0;
+}
+
+int ResponseParser::OnHeaderValueImpl(const char* data, std::size_t size) {
+    UASSERT(!response_.headers.empty());
+    in_header_value_ = true;
+    response_.headers.back().second.append(data, size);
+    return 0;
+}
+
+int ResponseParser::OnHeadersCompleteImpl(llhttp_t* p) {
+    response_.status_code = p->status_code;
+    for (auto& header : response_.headers) TrimRight(header.second);
+
+    // 1 tells llhttp that there is no body
+    return is_head_request_ && !IsInformational(response_.status_code) ? 1 : 0;
+}
+
+int ResponseParser::OnMessageCompleteImpl(llhttp_t* p) {
+    if (IsInformational(response_.status_code)) {
+        // 101 Switching Protocols is never requested
+        return response_.status_code == 101 ? -1 : 0;
+    }
+
+    complete_ = true;
+    response_.keep_alive = llhttp_should_keep_alive(p);
+    return HPE_PAUSED;
+}
+
+}  // namespace clients::http::native
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <llhttp.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::native {
+
+struct ParsedResponse {
+    int status_code{0};
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::string body;
+    /// The connection may be used for the next request
+    bool keep_alive{false};
+};
+
+/// Incremental parser of an HTTP/1.x response, built on llhttp like the
+/// request parser of the HTTP server.
+class ResponseParser final {
+public:
+    enum class State {
+        kIncomplete,
+        kComplete,
+        kError,
+    };
+
+    /// Responses to HEAD requests have no body whatever the headers say
+    explicit ResponseParser(bool is_head_request);
+
+    ResponseParser(ResponseParser&&) = delete;
+    ResponseParser& operator=(ResponseParser&&) = delete;
+
+    /// Feeds the next chunk of the data received from the connection
+    State Parse(std::string_view data);
+
+    /// Must be called when the peer closes the connection, completes the
+    /// response whose body is delimited by the connection close
+    State Finish();
+
+    /// Whether any byte of the response was received
+    bool IsStarted() const { return started_; }
+
+    ParsedResponse& GetResponse() { return response_; }
+
+private:
+    static int OnMessageBegin(llhttp_t* p);
+    static int OnHeaderField(llhttp_t* p, const char* data, std::size_t size);
+    static int OnHeaderValue(llhttp_t* p, const char* data, std::size_t size);
+    static int OnHeadersComplete(llhttp_t* p);
+    static int OnBody(llhttp_t* p, const char* data, std::size_t size);
+    static int OnMessageComplete(llhttp_t* p);
+
+    int OnHeaderFieldImpl(const char* data, std::size_t size);
+    int OnHeaderValueImpl(const char* data, std::size_t size);
+    int OnHeadersCompleteImpl(llhttp_t* p);
+    int OnMessageCompleteImpl(llhttp_t* p);
+
+    const bool is_head_request_;
+    bool started_{false};
+    bool complete_{false};
+    bool in_header_value_{false};
+
+    llhttp_t parser_{};
+    ParsedResponse response_;
+
+    static const llhttp_settings_t parser_settings;
+};
+
+}  // namespace clients::http::native
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,110 @@
+#include <clients/http/native/response_parser.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using clients::http::native::ResponseParser;
+using State = ResponseParser::State;
+
+constexpr std::string_view kContentLength =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Length: 4\r\n"
+    "X-Header: value  \r\n\r\n"
+    "body";
+
+constexpr std::string_view kChunked =
+    "HTTP/1.1 201 Created\r\n"
+    "Transfer-Encoding: chunked\r\n\r\n"
+    "2\r\nbo\r\n2\r\ndy\r\n0\r\n\r\n";
+
+constexpr std::string_view kContinue =
+    "HTTP/1.1 100 Continue\r\n\r\n"
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Length: 2\r\n\r\n"
+    "ok";
+
+constexpr std::string_view kUntilClose =
+    "HTTP/1.1 200 OK\r\n\r\n"
+    "body";
+
+}  // namespace
+
+TEST(HttpClientNativeResponseParser, ContentLength) {
+    ResponseParser parser{false};
+    EXPECT_FALSE(parser.IsStarted());
+    ASSERT_EQ(parser.Parse(kContentLength), State::kComplete);
+
+    const auto& response = parser.GetResponse();
+    EXPECT_EQ(response.status_code, 200);
+    EXPECT_EQ(response.body, "body");
+    EXPECT_TRUE(response.keep_alive);
+    ASSERT_EQ(response.headers.size(), 2);
+    EXPECT_EQ(response.headers[1].first, "X-Header");
+    EXPECT_EQ(response.headers[1].second, "value");
+}
+
+TEST(HttpClientNativeResponseParser, ByteByByte) {
+    ResponseParser parser{false};
+    for (std::size_t i = 0; i + 1 < kChunked.size(); ++i) {
+        ASSERT_EQ(parser.Parse(kChunked.substr(i, 1)), State::kIncomplete);
+    }
+    ASSERT_EQ(parser.Parse(kChunked.substr(kChunked.size() - 1)), State::kComplete);
+
+    const auto& response = parser.GetResponse();
+    EXPECT_EQ(response.status_code, 201);
+    EXPECT_EQ(response.body, "body");
+    EXPECT_TRUE(response.keep_alive);
+}
+
+TEST(HttpClientNativeResponseParser, Head) {
+    ResponseParser parser{true};
+    ASSERT_EQ(parser.Parse("HTTP/1.1 200 OK\r\nContent-Length: 4\r\n\r\n"), State::kComplete);
+    EXPECT_EQ(parser.GetResponse().body, "");
+    EXPECT_TRUE(parser.GetResponse().keep_alive);
+}
+
+TEST(HttpClientNativeResponseParser, SkipsInformational) {
+    ResponseParser parser{false};
+    ASSERT_EQ(parser.Parse(kContinue), State::kComplete);
+    EXPECT_EQ(parser.GetResponse().status_code, 200);
+    EXPECT_EQ(parser.GetResponse().body, "ok");
+}
+
+TEST(HttpClientNativeResponseParser, UntilClose) {
+    ResponseParser parser{false};
+    ASSERT_EQ(parser.Parse(kUntilClose), State::kIncomplete);
+    ASSERT_EQ(parser.Finish(), State::kComplete);
+    EXPECT_EQ(parser.GetResponse().body, "body");
+    EXPECT_FALSE(parser.GetResponse().keep_alive);
+}
+
+TEST(HttpClientNativeResponseParser, ConnectionClose) {
+    ResponseParser parser{false};
+    ASSERT_EQ(parser.Parse("HTTP/1.1 204 No Content\r\nConnection: close\r\n\r\n"), State::kComplete);
+    EXPECT_FALSE(parser.GetResponse().keep_alive);
+}
+
+TEST(HttpClientNativeResponseParser, Truncated) {
+    ResponseParser parser{false};
+    ASSERT_EQ(parser.Parse(kContentLength.substr(0, kContentLength.size() - 1)), State::kIncomplete);
+    EXPECT_TRUE(parser.IsStarted());
+    EXPECT_EQ(parser.Finish(), State::kError);
+}
+
+TEST(HttpClientNativeResponseParser, Malformed) {
+    ResponseParser parser{false};
+    EXPECT_EQ(parser.Parse("HTTP/1.1 OK\r\n\r\n"), State::kError);
+}
+
+TEST(HttpClientNativeResponseParser, TrailingData) {
+    ResponseParser parser{false};
+    ASSERT_EQ(parser.Parse(std::string{kContentLength} + "garbage"), State::kComplete);
+    EXPECT_EQ(parser.GetResponse().body, "body");
+    // The connection is out of sync
+    EXPECT_FALSE(parser.GetResponse().keep_alive);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,307 @@
+#include <clients/http/native/transport.hpp>
+
+#include <chrono>
+#include <exception>
+#include <system_error>
+#include <memory>
+
+#include <fmt/format.h>
+#include <moodycamel/concurrentqueue.h>
+
+#include <curl-ev/error_code.hpp>
+#include <userver/clients/dns/exception.hpp>
+#include <userver/clients/dns/resolver.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/net/blocking/get_addr_info.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::native {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using ErrorCode = curl::errc::EasyErrorCode;
+
+/// Same as the limit of the libcurl path
+constexpr std::size_t kMaxRedirectCount = 10;
+/// Idle connections above that are closed
+constexpr std::size_t kMaxIdleConnections = 256;
+/// Servers close idle connections after some time, do not try the old ones
+constexpr auto kMaxIdleTime = std::chrono::seconds{30};
+/// Same as the default DNS cache timeout of libcurl
+constexpr auto kAddressesTtl = std::chrono::seconds{60};
+
+class TransportError final : public std::runtime_error {
+public:
+    TransportError(ErrorCode code, const std::string& message) : std::runtime_error(message), code_(code) {}
+
+    std::error_code GetCode() const { return code_; }
+
+private:
+    const ErrorCode code_;
+};
+
+bool IsRedirect(int status_code) {
+    return status_code == 301 || status_code == 302 || status_code == 303 || status_code == 307 ||
+           status_code == 308;
+}
+
+std::string_view FindHeader(const std::vector<std::pair<std::string, std::string>>& headers, std::string_view name) {
+    for (const auto& [key, value] : headers) {
+        if (utils::StrIcaseEqual{}(key, name)) return value;
+    }
+    return {};
+}
+
+std::string StripBrackets(std::string host) {
+    // IPv6 literals are enclosed in brackets in URLs
+    if (host.size() > 2 && host.front() == '[' && host.back() == ']') return host.substr(1, host.size() - 2);
+    return host;
+}
+
+}  // namespace
+
+struct Transport::Destination {
+    explicit Destination(const curl::url& url) {
+        const std::string scheme = url.GetSchemePtr().get();
+        if (!IsSupportedScheme(scheme)) {
+            throw TransportError(ErrorCode::kUnsupportedProtocol, "Unsupported scheme " + scheme);
+        }
+        tls = scheme == "https";
+        authority = url.GetHostPtr().get();
+        host = StripBrackets(authority);
+        port = url.GetPortPtr().get();
+        authority += ':';
+        authority += port;
+        key = scheme + "://" + authority;
+    }
+
+    std::string key;
+    std::string authority;
+    std::string host;
+    std::string port;
+    bool tls{false};
+};
+
+class Transport::DestinationPool final {
+public:
+    std::unique_ptr<Connection> TryPop() {
+        IdleConnection idle;
+        while (idle_.try_dequeue(idle)) {
+            --idle_count_;
+            if (idle.since + kMaxIdleTime > Clock::now() && idle.connection->IsReusable()) {
+                return std::move(idle.connection);
+            }
+        }
+        return {};
+    }
+
+    void Push(std::unique_ptr<Connection> connection) {
+        if (!connection->IsReusable() || ++idle_count_ > kMaxIdleConnections) {
+            if (connection->IsReusable()) --idle_count_;
+            return;
+        }
+        idle_.enqueue(IdleConnection{std::move(connection), Clock::now()});
+    }
+
+    std::shared_ptr<const std::vector<engine::io::Sockaddr>> GetAddresses() const {
+        auto addresses = addresses_.ReadCopy();
+        if (addresses.expires_at < Clock::now()) return {};
+        return addresses.addrs;
+    }
+
+    void SetAddresses(std::vector<engine::io::Sockaddr> addrs) {
+        addresses_.Assign(Addresses{
+            std::make_shared<const std::vector<engine::io::Sockaddr>>(std::move(addrs)), Clock::now() + kAddressesTtl});
+    }
+
+private:
+    struct IdleConnection {
+        std::unique_ptr<Connection> connection;
+        Clock::time_point since;
+    };
+
+    struct Addresses {
+        std::shared_ptr<const std::vector<engine::io::Sockaddr>> addrs;
+        Clock::time_point expires_at;
+    };
+
+    moodycamel::ConcurrentQueue<IdleConnection> idle_;
+    std::atomic<std::size_t> idle_count_{0};
+    rcu::Variable<Addresses> addresses_;
+};
+
+Transport::Transport(engine::TaskProcessor& fs_task_processor) : fs_task_processor_(fs_task_processor) {}
+
+Transport::~Transport() = default;
+
+void Transport::SetDnsResolver(clients::dns::Resolver* resolver) { resolver_ = resolver; }
+
+bool Transport::IsSupportedScheme(std::string_view scheme) { return scheme == "http" || scheme == "https"; }
+
+std::error_code Transport::Perform(RequestData& request, ResponseData& response, engine::Deadline deadline) {
+    const auto start = Clock::now();
+    std::error_code ec;
+    try {
+        for (std::size_t redirects = 0;; ++redirects) {
+            auto parsed = PerformOnce(request, response, deadline);
+            const auto location = FindHeader(parsed.headers, "Location");
+            if (!request.follow_redirects || !IsRedirect(parsed.status_code) || location.empty()) {
+                response.status_code = parsed.status_code;
+                response.headers = std::move(parsed.headers);
+                response.body = std::move(parsed.body);
+                break;
+            }
+
+            if (redirects == kMaxRedirectCount) {
+                throw TransportError(ErrorCode::kTooManyRedirects, "Too many redirects");
+            }
+            // Relative locations are resolved against the current URL
+            request.url.SetUrl(std::string{location}.c_str());
+            // Same as libcurl does by default
+            if (parsed.status_code == 303 || (parsed.status_code != 307 && parsed.status_code != 308 &&
+                                              request.method == "POST")) {
+                if (request.method != "HEAD") request.method = "GET";
+                request.body = {};
+            }
+        }
+    } catch (const TransportError& ex) {
+        LOG_INFO() << ex.what();
+        ec = ex.GetCode();
+    } catch (const ResponseError& ex) {
+        LOG_INFO() << ex.what();
+        ec = ErrorCode::kRecvError;
+    } catch (const engine::io::IoTimeout&) {
+        ec = ErrorCode::kOperationTimedout;
+    } catch (const engine::io::IoCancelled&) {
+        ec = std::make_error_code(std::errc::operation_canceled);
+    } catch (const engine::io::TlsException& ex) {
+        LOG_INFO() << ex;
+        ec = ErrorCode::kSslConnectError;
+    } catch (const engine::io::IoException& ex) {
+        LOG_INFO() << ex;
+        ec = ErrorCode::kRecvError;
+    } catch (const std::system_error& ex) {
+        // curl::url reports malformed redirect locations this way
+        LOG_INFO() << ex.what();
+        ec = ErrorCode::kUrlMalformat;
+    }
+
+    response.effective_url = request.url.GetUrlPtr().get();
+    response.stats.time_to_process = Clock::now() - start;
+    return ec;
+}
+
+ParsedResponse Transport::PerformOnce(const RequestData& request, ResponseData& response, engine::Deadline deadline) {
+    const Destination destination{request.url};
+    const auto pool = pools_[destination.key];
+
+    const auto path = request.url.GetPathPtr();
+    std::error_code query_ec;
+    const auto query = request.url.GetQueryPtr(query_ec);
+    auto head = fmt::format(
+        "{} {}{}{} HTTP/1.1\r\nHost: {}\r\n",
+        request.method,
+        path.get(),
+        query ? "?" : "",
+        query ? query.get() : "",
+        destination.authority
+    );
+    if (!request.body.empty() || (request.method != "GET" && request.method != "HEAD")) {
+        head += fmt::format("Content-Length: {}\r\n", request.body.size());
+    }
+    head += request.headers;
+    head += "\r\n";
+
+    const bool is_head_request = request.method == "HEAD";
+    if (auto connection = pool->TryPop()) {
+        try {
+            auto parsed = connection->Perform(head, request.body, is_head_request, deadline);
+            response.connection_reused = true;
+            pool->Push(std::move(connection));
+            return parsed;
+        } catch (const ResponseError& ex) {
+            // The idle connection was closed by the server, retry on a new one
+            if (!ex.IsNothingReceived()) throw;
+            LOG_DEBUG() << "Idle connection to " << destination.key << " was closed: " << ex.what();
+        }
+    }
+
+    auto connection = Connect(destination, *pool, response, deadline);
+    auto parsed = connection->Perform(head, request.body, is_head_request, deadline);
+    response.connection_reused = false;
+    pool->Push(std::move(connection));
+    return parsed;
+}
+
+std::unique_ptr<Connection> Transport::Connect(
+    const Destination& destination,
+    DestinationPool& pool,
+    ResponseData& response,
+    engine::Deadline deadline
+) {
+    auto addrs = pool.GetAddresses();
+    if (!addrs) {
+        auto resolved = Resolve(destination, deadline);
+        if (resolved.empty()) {
+            throw TransportError(ErrorCode::kCouldNotResolveHost, "No addresses for " + destination.host);
+        }
+        pool.SetAddresses(std::move(resolved));
+        addrs = pool.GetAddresses();
+        UASSERT(addrs);
+    }
+
+    const auto start = Clock::now();
+    ++response.stats.open_socket_count;
+    try {
+        auto connection = Connection::Connect(*addrs, destination.tls ? destination.host : std::string{}, deadline);
+        response.stats.time_to_connect = Clock::now() - start;
+        return connection;
+    } catch (const engine::io::IoInterrupted&) {
+        throw;
+    } catch (const engine::io::TlsException&) {
+        throw;
+    } catch (const engine::io::IoException& ex) {
+        throw TransportError(
+            ErrorCode::kCouldNotConnect, fmt::format("Failed to connect to {}: {}", destination.key, ex.what())
+        );
+    }
+}
+
+std::vector<engine::io::Sockaddr> Transport::Resolve(const Destination& destination, engine::Deadline deadline) {
+    try {
+        if (auto* resolver = resolver_.load()) {
+            const auto port = std::stoi(destination.port);
+            std::vector<engine::io::Sockaddr> result;
+            for (auto addr : resolver->Resolve(destination.host, deadline)) {
+                addr.SetPort(port);
+                result.push_back(addr);
+            }
+            return result;
+        }
+
+        // getaddrinfo may read files and block for a long time
+        return engine::AsyncNoSpan(
+                   fs_task_processor_,
+                   [&destination] { return net::blocking::GetAddrInfo(destination.host, destination.port.c_str()); }
+        )
+            .Get();
+    } catch (const engine::WaitInterruptedException&) {
+        throw engine::io::IoCancelled{};
+    } catch (const clients::dns::NotResolvedException& ex) {
+        throw TransportError(ErrorCode::kCouldNotResolveHost, ex.what());
+    } catch (const std::runtime_error& ex) {
+        throw TransportError(ErrorCode::kCouldNotResolveHost, ex.what());
+    }
+}
+
+}  // namespace clients::http::native
+
+USERVER_NAMESPACE_END
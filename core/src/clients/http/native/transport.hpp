@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <userver/clients/dns/resolver_fwd.hpp>
+#include <userver/clients/http/local_stats.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/rcu/rcu_map.hpp>
+
+#include <clients/http/native/connection.hpp>
+#include <curl-ev/url.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::native {
+
+struct RequestData {
+    std::string method;
+    curl::url url;
+    /// "Name: value\r\n" lines of all the headers except Host and Content-Length
+    std::string headers;
+    std::string_view body;
+    bool follow_redirects{false};
+};
+
+struct ResponseData {
+    int status_code{0};
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::string body;
+    std::string effective_url;
+    LocalStats stats;
+    /// Whether the last request was sent over an already open connection
+    bool connection_reused{false};
+};
+
+/// HTTP/1.1 transport built on coroutine sockets, an alternative to libcurl
+/// for plain requests.
+///
+/// Keep-alive connections are pooled per destination (scheme, host and port)
+/// and are used by one request at a time, the request runs entirely in the
+/// calling task.
+class Transport final {
+public:
+    explicit Transport(engine::TaskProcessor& fs_task_processor);
+    ~Transport();
+
+    /// Uses getaddrinfo on the fs task processor if not set
+    void SetDnsResolver(clients::dns::Resolver* resolver);
+
+    /// Performs the request, following the redirects if requested. Errors are
+    /// reported with the codes libcurl uses for the same failures.
+    std::error_code Perform(RequestData& request, ResponseData& response, engine::Deadline deadline);
+
+    /// Whether the request to the URL can be performed by the transport
+    static bool IsSupportedScheme(std::string_view scheme);
+
+private:
+    class DestinationPool;
+    struct Destination;
+
+    ParsedResponse PerformOnce(const RequestData& request, ResponseData& response, engine::Deadline deadline);
+
+    std::unique_ptr<Connection> Connect(
+        const Destination& destination,
+        DestinationPool& pool,
+        ResponseData& response,
+        engine::Deadline deadline
+    );
+
+    std::vector<engine::io::Sockaddr> Resolve(const Destination& destination, engine::Deadline deadline);
+
+    engine::TaskProcessor& fs_task_processor_;
+    std::atomic<clients::dns::Resolver*> resolver_{nullptr};
+    rcu::RcuMap<std::string, DestinationPool> pools_;
+};
+
+}  // namespace clients::http::native
+
+USERVER_NAMESPACE_END
@@ -124,23 +124,19 @@ bool IsUserAgentHeader(std::string_view header_name) {
     return utils::StrIcaseEqual{}(header_name, USERVER_NAMESPACE::http::headers::kUserAgent);
 }
 
-void SetUserAgent(curl::easy& easy, const std::string& value) { easy.set_user_agent(value); }
-
-void SetUserAgent(curl::easy& easy, std::string_view value) { easy.set_user_agent(std::string{value}); }
-
 template <class Range>
-void SetHeaders(curl::easy& easy, const Range& headers_range) {
+void SetHeaders(RequestState& state, const Range& headers_range) {
     for (const auto& [name, value] : headers_range) {
         if (!IsUserAgentHeader(name)) {
-            easy.add_header(name, value);
+            state.easy().add_header(name, value);
         } else {
-            clients::http::SetUserAgent(easy, value);
+            state.user_agent(std::string{value});
         }
     }
 }
 
 template <class Range>
-void SetCookies(curl::easy& easy, const Range& cookies_range) {
+void SetCookies(RequestState& state, const Range& cookies_range) {
     std::string cookie_str;
     for (const auto& [name, value] : cookies_range) {
         if (!cookie_str.empty()) cookie_str += "; ";
@@ -148,7 +144,7 @@ void SetCookies(curl::easy& easy, const Range& cookies_range) {
         cookie_str += '=';
         cookie_str += value;
     }
-    easy.set_cookie(cookie_str);
+    state.cookies(cookie_str);
 }
 
 template <class Range>
@@ -319,12 +315,14 @@ Request& Request::unix_socket_path(const std::string& path) & {
 Request Request::unix_socket_path(const std::string& path) && { return std::move(this->unix_socket_path(path)); }
 
 Request& Request::use_ipv4() & {
+    pimpl_->DisableNativeTransport();
     pimpl_->easy().set_ip_resolve(curl::easy::ip_resolve_v4);
     return *this;
 }
 Request Request::use_ipv4() && { return std::move(this->use_ipv4()); }
 
 Request& Request::use_ipv6() & {
+    pimpl_->DisableNativeTransport();
     pimpl_->easy().set_ip_resolve(curl::easy::ip_resolve_v6);
     return *this;
 }
@@ -344,6 +342,7 @@ Request& Request::data(std::string data) & {
 Request Request::data(std::string data) && { return std::move(this->data(std::move(data))); }
 
 Request& Request::form(Form&& form) & {
+    pimpl_->DisableNativeTransport();
     pimpl_->easy().set_http_post(std::move(form).GetNative());
     pimpl_->easy().add_header(kHeaderExpect, "", curl::easy::EmptyHeaderAction::kDoNotSend);
     return *this;
@@ -351,13 +350,13 @@ Request& Request::form(Form&& form) & {
 Request Request::form(Form&& form) && { return std::move(this->form(std::move(form))); }
 
 Request& Request::headers(const Headers& headers) & {
-    SetHeaders(pimpl_->easy(), headers);
+    SetHeaders(*pimpl_, headers);
     return *this;
 }
 Request Request::headers(const Headers& headers) && { return std::move(this->headers(headers)); }
 
 Request& Request::headers(const std::initializer_list<std::pair<std::string_view, std::string_view>>& headers) & {
-    SetHeaders(pimpl_->easy(), headers);
+    SetHeaders(*pimpl_, headers);
     return *this;
 }
 Request Request::headers(const std::initializer_list<std::pair<std::string_view, std::string_view>>& headers) && {
@@ -375,12 +374,14 @@ Request::http_auth_type(HttpAuthType value, bool auth_only, std::string_view use
 }
 
 Request& Request::proxy_headers(const Headers& headers) & {
+    pimpl_->DisableNativeTransport();
     SetProxyHeaders(pimpl_->easy(), headers);
     return *this;
 }
 Request Request::proxy_headers(const Headers& headers) && { return std::move(this->proxy_headers(headers)); }
 
 Request& Request::proxy_headers(const std::initializer_list<std::pair<std::string_view, std::string_view>>& headers) & {
+    pimpl_->DisableNativeTransport();
     SetProxyHeaders(pimpl_->easy(), headers);
     return *this;
 }
@@ -389,7 +390,7 @@ Request Request::proxy_headers(const std::initializer_list<std::pair<std::string
 }
 
 Request& Request::user_agent(const std::string& value) & {
-    pimpl_->easy().set_user_agent(value.c_str());
+    pimpl_->user_agent(value);
     return *this;
 }
 Request Request::user_agent(const std::string& value) && { return std::move(this->user_agent(value)); }
@@ -407,13 +408,13 @@ Request& Request::proxy_auth_type(ProxyAuthType value) & {
 Request Request::proxy_auth_type(ProxyAuthType value) && { return std::move(this->proxy_auth_type(value)); }
 
 Request& Request::cookies(const Cookies& cookies) & {
-    SetCookies(pimpl_->easy(), cookies);
+    SetCookies(*pimpl_, cookies);
     return *this;
 }
 Request Request::cookies(const Cookies& cookies) && { return std::move(this->cookies(cookies)); }
 
 Request& Request::cookies(const std::unordered_map<std::string, std::string>& cookies) & {
-    SetCookies(pimpl_->easy(), cookies);
+    SetCookies(*pimpl_, cookies);
     return *this;
 }
 Request Request::cookies(const std::unordered_map<std::string, std::string>& cookies) && {
@@ -421,6 +422,8 @@ Request Request::cookies(const std::unordered_map<std::string, std::string>& coo
 }
 
 Request& Request::method(HttpMethod method) & {
+    // GET is the default of libcurl unless there is a body
+    pimpl_->SetNativeMethod(method == HttpMethod::kGet ? std::string{} : ToString(method));
     switch (method) {
         case HttpMethod::kDelete:
         case HttpMethod::kOptions:
@@ -470,6 +473,7 @@ Request& Request::set_custom_http_request_method(std::string method) & {
     LOG_LIMITED_WARNING() << "This method can cause unexpected effects in libcurl, i.e., timeouts, "
                              "changing of request type. Use it only if you need to make "
                              "GET-request with body.";
+    pimpl_->SetNativeMethod(method);
     pimpl_->easy().set_custom_request(method);
     return *this;
 }
@@ -533,6 +537,8 @@ void Request::SetTestsuiteConfig(const std::shared_ptr<const TestsuiteConfig>& c
 
 void Request::SetAllowedUrlsExtra(const std::vector<std::string>& urls) & { pimpl_->SetAllowedUrlsExtra(urls); }
 
+void Request::SetNativeTransport(native::Transport* transport) & { pimpl_->SetNativeTransport(transport); }
+
 void Request::SetDeadlinePropagationConfig(const DeadlinePropagationConfig& deadline_propagation_config) & {
     pimpl_->SetDeadlinePropagationConfig(deadline_propagation_config);
 }
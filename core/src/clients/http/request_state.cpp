@@ -13,9 +13,12 @@
 #include <boost/range/adaptor/transformed.hpp>
 
 #include <curl-ev/error_code.hpp>
+#include <curl-ev/string_list.hpp>
 #include <userver/baggage/baggage.hpp>
 #include <userver/clients/dns/resolver.hpp>
 #include <userver/clients/http/connect_to.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
@@ -256,20 +259,26 @@ RequestState::~RequestState() {
 }
 
 void RequestState::follow_redirects(bool follow) {
+    native_.follow_redirects = follow;
     easy().set_follow_location(follow);
     easy().set_post_redir(static_cast<long>(follow));
     if (follow) easy().set_max_redirs(kMaxRedirectCount);
 }
 
 void RequestState::verify(bool verify) {
+    if (!verify) DisableNativeTransport();
     easy().set_ssl_verify_host(verify);
     easy().set_ssl_verify_peer(verify);
 }
 
-void RequestState::ca_info(const std::string& file_path) { easy().set_ca_info(file_path.c_str()); }
+void RequestState::ca_info(const std::string& file_path) {
+    DisableNativeTransport();
+    easy().set_ca_info(file_path.c_str());
+}
 
 void RequestState::ca(crypto::Certificate cert) {
     UINVARIANT(cert, "No certificate");
+    DisableNativeTransport();
     if constexpr (curl::easy::is_set_ca_info_blob_available) {
         ModernCaImpl(easy(), std::move(cert));
     } else {
@@ -280,11 +289,15 @@ void RequestState::ca(crypto::Certificate cert) {
     }
 }
 
-void RequestState::crl_file(const std::string& file_path) { easy().set_crl_file(file_path.c_str()); }
+void RequestState::crl_file(const std::string& file_path) {
+    DisableNativeTransport();
+    easy().set_crl_file(file_path.c_str());
+}
 
 void RequestState::client_key_cert(crypto::PrivateKey pkey, crypto::Certificate cert) {
     UINVARIANT(pkey, "No private key");
     UINVARIANT(cert, "No certificate");
+    DisableNativeTransport();
 
     if constexpr (curl::easy::is_set_ssl_cert_blob_available && curl::easy::is_set_ssl_key_blob_available) {
         ModernClientKeyCertImpl(easy(), std::move(pkey), std::move(cert));
@@ -328,7 +341,13 @@ void RequestState::client_key_cert(crypto::PrivateKey pkey, crypto::Certificate
     }
 }
 
-void RequestState::http_version(curl::easy::http_version_t version) { easy().set_http_version(version); }
+void RequestState::http_version(curl::easy::http_version_t version) {
+    // The native transport speaks HTTP/1.1 only
+    if (version != curl::easy::http_version_none && version != curl::easy::http_version_1_1) {
+        DisableNativeTransport();
+    }
+    easy().set_http_version(version);
+}
 
 void RequestState::set_timeout(long timeout_ms) {
     original_timeout_ = std::chrono::milliseconds{timeout_ms};
@@ -341,21 +360,29 @@ void RequestState::retry(short retries, bool on_fails) {
     retry_.on_fails = on_fails;
 }
 
-void RequestState::unix_socket_path(const std::string& path) { easy().set_unix_socket_path(path); }
+void RequestState::unix_socket_path(const std::string& path) {
+    DisableNativeTransport();
+    easy().set_unix_socket_path(path);
+}
 
 void RequestState::connect_to(const ConnectTo& connect_to) {
     curl::native::curl_slist* ptr = connect_to.GetUnderlying();
     if (ptr) {
+        DisableNativeTransport();
         easy().set_connect_to(ptr);
     }
 }
 
 void RequestState::proxy(const std::string& value) {
+    if (!value.empty()) DisableNativeTransport();
     proxy_url_ = value;
     easy().set_proxy(value);
 }
 
-void RequestState::proxy_auth_type(curl::easy::proxyauth_t value) { easy().set_proxy_auth(value); }
+void RequestState::proxy_auth_type(curl::easy::proxyauth_t value) {
+    DisableNativeTransport();
+    easy().set_proxy_auth(value);
+}
 
 void RequestState::http_auth_type(
     curl::easy::httpauth_t value,
@@ -363,14 +390,37 @@ void RequestState::http_auth_type(
     std::string_view user,
     std::string_view password
 ) {
+    DisableNativeTransport();
     easy().set_http_auth(value, auth_only);
     easy().set_user(std::string{user}.c_str());
     easy().set_password(std::string{password}.c_str());
 }
 
+void RequestState::user_agent(const std::string& value) {
+    native_.user_agent = value;
+    easy().set_user_agent(value);
+}
+
+void RequestState::cookies(const std::string& value) {
+    native_.cookies = value;
+    easy().set_cookie(value);
+}
+
+void RequestState::SetNativeTransport(native::Transport* transport) { native_.transport = transport; }
+
+void RequestState::SetNativeMethod(std::string method) { native_.method = std::move(method); }
+
+void RequestState::DisableNativeTransport() { native_.supported = false; }
+
 void RequestState::Cancel() {
     // We can not call `retry_.timer.reset();` here because of data race
     is_cancelled_ = true;
+    if (native_.active) {
+        // The attempt task checks `is_cancelled_` if it is not spawned yet
+        const std::lock_guard lock{native_.cancellation_mutex};
+        if (native_.cancellation_token.IsValid()) native_.cancellation_token.RequestCancel();
+        return;
+    }
     easy().cancel();
 }
 
@@ -442,7 +492,6 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder, std::error
     UASSERT(holder);
     UASSERT(holder->span_storage_);
     auto& span = holder->span_storage_->Get();
-    auto& easy = holder->easy();
 
     // TODO don't swallow errors, report them to StreamedResponse
     auto* stream_data = std::get_if<StreamData>(&holder->data_);
@@ -451,7 +500,7 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder, std::error
         LOG_DEBUG() << "Stream API, status code is set (with body)";
     }
 
-    const auto status_code = static_cast<Status>(easy.get_response_code());
+    const auto status_code = static_cast<Status>(holder->GetResponseCode());
 
     holder->CheckResponseDeadline(err, status_code);
 
@@ -461,8 +510,13 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder, std::error
     }
 
     holder->AccountResponse(err);
-    const auto sockets = easy.get_num_connects();
-    holder->WithRequestStats([sockets](RequestStats& stats) { stats.AccountOpenSockets(sockets); });
+    const auto sockets = holder->GetNumConnects();
+    // A failed request may have not opened a socket without reusing one
+    const bool socket_reused = !err && sockets == 0;
+    holder->WithRequestStats([sockets, socket_reused](RequestStats& stats) {
+        stats.AccountOpenSockets(sockets);
+        if (socket_reused) stats.AccountSocketReused();
+    });
 
     span.AddTag(tracing::kAttempts, holder->retry_.current);
     if (holder->deadline_propagation_config_.update_header) {
@@ -470,9 +524,9 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder, std::error
     }
 
     if (err) {
-        if (easy.rate_limit_error()) {
+        if (!holder->native_.active && holder->easy().rate_limit_error()) {
             // The most probable cause, takes precedence
-            err = easy.rate_limit_error();
+            err = holder->easy().rate_limit_error();
         }
 
         span.AddTag(tracing::kErrorFlag, true);
@@ -501,7 +555,7 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder, std::error
     } else {
         span.AddTag(tracing::kHttpStatusCode, status_code);
         holder->response()->SetStatusCode(status_code);
-        holder->response()->SetStats(easy.get_local_stats());
+        holder->response()->SetStats(holder->GetLocalStats());
 
         if (holder->response()->IsError()) span.AddTag(tracing::kErrorFlag, true);
 
@@ -558,6 +612,18 @@ void RequestState::on_retry(std::shared_ptr<RequestState> holder, std::error_cod
 
         // increase try
         ++holder->retry_.current;
+
+        if (holder->native_.active) {
+            auto& holder_ref = *holder;
+            holder_ref.SpawnNative([holder = std::move(holder), backoff] {
+                engine::InterruptibleSleepFor(backoff);
+                holder->on_retry_timer(
+                    holder->is_cancelled_ ? std::make_error_code(std::errc::operation_canceled) : std::error_code{}
+                );
+            });
+            return;
+        }
+
         holder->easy().mark_retry();
 
         holder->retry_.timer.emplace(holder->easy().GetThreadControl());
@@ -643,7 +709,9 @@ const std::string& RequestState::GetLoggedOriginalUrl() const noexcept {
 std::string_view RequestState::GetLoggedEffectiveUrl() noexcept {
     // If log_url_ exists, we use log_url_ with a semantic like original_url,
     // instead of effective_url
-    return log_url_ ? *log_url_ : easy().get_effective_url();
+    if (log_url_) return *log_url_;
+    if (native_.active) return native_.response.effective_url;
+    return easy().get_effective_url();
 }
 
 engine::Future<std::shared_ptr<Response>> RequestState::async_perform(utils::impl::SourceLocation location) {
@@ -706,7 +774,11 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
 
     plugin_pipeline_.HookPerformRequest(*this);
 
-    if (resolver_ && retry_.current == 1) {
+    if (native_.active) {
+        SpawnNative([holder = shared_from_this(), handler = std::move(handler)] {
+            handler(holder->PerformNativeAttempt());
+        });
+    } else if (resolver_ && retry_.current == 1) {
         engine::AsyncNoSpan([this, holder = shared_from_this(), handler = std::move(handler)]() mutable {
             try {
                 ResolveTargetAddress(*resolver_);
@@ -787,7 +859,7 @@ void RequestState::HandleDeadlineAlreadyPassed() {
 
     WithRequestStats([](RequestStats& stats) { stats.AccountCancelledByDeadline(); });
 
-    auto exc = PrepareDeadlinePassedException(GetLoggedOriginalUrl(), easy().get_local_stats());
+    auto exc = PrepareDeadlinePassedException(GetLoggedOriginalUrl(), GetLocalStats());
 
     const utils::Overloaded visitor{
         [&exc](FullBufferedData& buffered_data) {
@@ -806,7 +878,7 @@ void RequestState::HandleDeadlineAlreadyPassed() {
 }
 
 void RequestState::CheckResponseDeadline(std::error_code& err, Status status_code) {
-    const std::chrono::microseconds attempt_time{easy().get_total_time_usec()};
+    const auto attempt_time = GetAttemptTime();
 
     if (!deadline_expired_ && timeout_updated_by_deadline_ &&
         (attempt_time >= remote_timeout_ || (!err && IsDeadlineExpiredResponse(status_code)))) {
@@ -844,7 +916,7 @@ bool RequestState::IsDeadlineExpiredResponse(Status status_code) {
 }
 
 bool RequestState::ShouldRetryResponse() {
-    const auto status_code = static_cast<Status>(easy().get_response_code());
+    const auto status_code = static_cast<Status>(GetResponseCode());
 
     if (IsDeadlineExpiredResponse(status_code)) {
         // See IsDeadlineExpiredResponse, case (2).
@@ -864,16 +936,16 @@ void RequestState::AccountResponse(std::error_code err) {
         if (err)
             stats.FinishEc(err, attempts);
         else
-            stats.FinishOk(static_cast<int>(easy().get_response_code()), attempts);
+            stats.FinishOk(static_cast<int>(GetResponseCode()), attempts);
     });
 }
 
 std::exception_ptr RequestState::PrepareException(std::error_code err) {
     if (deadline_expired_) {
-        return PrepareDeadlinePassedException(GetLoggedEffectiveUrl(), easy().get_local_stats());
+        return PrepareDeadlinePassedException(GetLoggedEffectiveUrl(), GetLocalStats());
     }
 
-    return http::PrepareException(err, GetLoggedEffectiveUrl(), easy().get_local_stats());
+    return http::PrepareException(err, GetLoggedEffectiveUrl(), GetLocalStats());
 }
 
 void RequestState::ThrowDeadlineExpiredException() {
@@ -907,6 +979,15 @@ void RequestState::ResetDataForNewRequest() {
     // the original timeout is exceeded.
     SetEasyTimeout(original_timeout_);
 
+    // With destination affinity the easy may move to the multi of another IO
+    // thread, the request is accounted in the statistics of that multi
+    if (auto* multi_stats = easy_.BindToDestination(easy().get_original_url())) {
+        stats_ = multi_stats->CreateRequestStats();
+    }
+
+    native_.active = IsNativeApplicable();
+    native_.response = {};
+
     StartStats();
 }
 
@@ -1018,6 +1099,122 @@ void RequestState::ResolveTargetAddress(clients::dns::Resolver& resolver) {
     easy().add_resolve(hostname, target.Get().GetPortPtr().get(), fmt::to_string(fmt::join(addr_strings, ",")));
 }
 
+bool RequestState::IsNativeApplicable() const {
+    if (!native_.transport || !native_.supported) return false;
+    // The native transport returns the whole body at once
+    if (!std::holds_alternative<FullBufferedData>(data_)) return false;
+
+    std::error_code ec;
+    const auto scheme = easy().get_easy_url().GetSchemePtr(ec);
+    if (ec || !native::Transport::IsSupportedScheme(scheme.get())) return false;
+
+    // The native transport frames the messages itself and does not decode
+    // compressed bodies
+    for (const std::string_view name :
+         {USERVER_NAMESPACE::http::headers::kHost,
+          USERVER_NAMESPACE::http::headers::kContentLength,
+          USERVER_NAMESPACE::http::headers::kTransferEncoding,
+          USERVER_NAMESPACE::http::headers::kAcceptEncoding}) {
+        if (easy().FindHeaderByName(name)) return false;
+    }
+    return true;
+}
+
+template <typename Func>
+void RequestState::SpawnNative(Func&& func) {
+    auto task = engine::CriticalAsyncNoSpan(std::forward<Func>(func));
+    {
+        const std::lock_guard lock{native_.cancellation_mutex};
+        native_.cancellation_token = engine::TaskCancellationToken{task};
+        // Cancel() may have missed the token
+        if (is_cancelled_) native_.cancellation_token.RequestCancel();
+    }
+    std::move(task).Detach();
+}
+
+std::error_code RequestState::PerformNativeAttempt() {
+    UASSERT(native_.transport);
+    auto& response = native_.response;
+    response = {};
+    if (is_cancelled_) return std::make_error_code(std::errc::operation_canceled);
+
+    native::RequestData request;
+    request.method = native_.method;
+    if (request.method.empty()) request.method = easy().has_post_data() ? "POST" : "GET";
+    request.url = easy().get_easy_url();
+    request.headers = MakeNativeHeaders();
+    if (easy().has_post_data() && request.method != "HEAD") request.body = easy().get_post_data();
+    request.follow_redirects = native_.follow_redirects;
+
+    const auto err =
+        native_.transport->Perform(request, response, engine::Deadline::FromDuration(original_timeout_));
+    response.stats.retries_count = retry_.current - 1;
+    if (err) return err;
+
+    response_->headers().clear();
+    response_->cookies().clear();
+    for (const auto& [name, value] : response.headers) {
+        if (IsSetCookie(name)) {
+            ParseSingleCookie(value.data(), value.size());
+        } else {
+            response_->headers().emplace(name, value);
+        }
+    }
+    response_->sink_string() = std::move(response.body);
+    response_->SetStatusCode(static_cast<Status>(response.status_code));
+    return {};
+}
+
+std::string RequestState::MakeNativeHeaders() const {
+    std::string result;
+    const auto append = [&result](std::string_view name, std::string_view value) {
+        result.append(name).append(": ").append(value).append("\r\n");
+    };
+
+    // Same defaults as in libcurl
+    if (!easy().FindHeaderByName(USERVER_NAMESPACE::http::headers::kAccept)) {
+        append(USERVER_NAMESPACE::http::headers::kAccept, "*/*");
+    }
+    if (!native_.user_agent.empty()) append(USERVER_NAMESPACE::http::headers::kUserAgent, native_.user_agent);
+    if (!native_.cookies.empty()) append(USERVER_NAMESPACE::http::headers::kCookie, native_.cookies);
+
+    const auto* headers = easy().get_headers();
+    if (!headers) return result;
+    headers->ForEach([&append](std::string_view header) {
+        // libcurl semantics: "Name: value" is sent as is, "Name:" removes the
+        // header and "Name;" sends it with an empty value
+        const auto pos = header.find_first_of(":;");
+        if (pos == std::string_view::npos) return;
+        const auto name = header.substr(0, pos);
+        if (header[pos] == ';') {
+            if (pos + 1 == header.size()) append(name, {});
+            return;
+        }
+
+        auto value = header.substr(pos + 1);
+        while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) value.remove_prefix(1);
+        if (!value.empty()) append(name, value);
+    });
+    return result;
+}
+
+long RequestState::GetResponseCode() {
+    return native_.active ? native_.response.status_code : easy().get_response_code();
+}
+
+long RequestState::GetNumConnects() {
+    return native_.active ? static_cast<long>(native_.response.stats.open_socket_count) : easy().get_num_connects();
+}
+
+LocalStats RequestState::GetLocalStats() { return native_.active ? native_.response.stats : easy().get_local_stats(); }
+
+std::chrono::microseconds RequestState::GetAttemptTime() {
+    if (native_.active) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(native_.response.stats.time_to_process);
+    }
+    return std::chrono::microseconds{easy().get_total_time_usec()};
+}
+
 void RequestState::SetTracingManager(const tracing::TracingManagerBase& m) { tracing_manager_ = m; }
 
 PluginRequest RequestState::GetEditableRequestInstance() { return PluginRequest(*this); }
@@ -3,6 +3,7 @@
 #include <array>
 #include <cstdlib>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <system_error>
@@ -18,6 +19,7 @@
 #include <userver/crypto/private_key.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/future.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/http/url.hpp>
 #include <userver/tracing/in_place_span.hpp>
@@ -28,6 +30,7 @@
 
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
+#include <clients/http/native/transport.hpp>
 #include <clients/http/testsuite.hpp>
 #include <crypto/helpers.hpp>
 #include <engine/ev/watcher/timer_watcher.hpp>
@@ -92,6 +95,18 @@ public:
     void proxy_auth_type(curl::easy::proxyauth_t value);
     /// sets proxy auth type and credentials to use
     void http_auth_type(curl::easy::httpauth_t value, bool auth_only, std::string_view user, std::string_view password);
+    /// sets user agent
+    void user_agent(const std::string& value);
+    /// sets cookies as a "name=value; name2=value2" string
+    void cookies(const std::string& value);
+
+    /// perform the requests with the native transport when possible
+    void SetNativeTransport(native::Transport* transport);
+    /// set method for the native transport, empty means GET or POST depending
+    /// on the request body, as in libcurl
+    void SetNativeMethod(std::string method);
+    /// the request uses a feature the native transport does not support
+    void DisableNativeTransport();
 
     /// get timeout value in milliseconds
     long timeout() const { return original_timeout_.count(); }
@@ -180,6 +195,18 @@ private:
 
     void ResolveTargetAddress(clients::dns::Resolver& resolver);
 
+    bool IsNativeApplicable() const;
+    template <typename Func>
+    void SpawnNative(Func&& func);
+    std::error_code PerformNativeAttempt();
+    std::string MakeNativeHeaders() const;
+
+    // Values of the last attempt from the transport that performed it
+    long GetResponseCode();
+    long GetNumConnects();
+    LocalStats GetLocalStats();
+    std::chrono::microseconds GetAttemptTime();
+
     /// curl handler wrapper
     impl::EasyWrapper easy_;
     RequestStats stats_;
@@ -246,6 +273,22 @@ private:
     };
 
     std::variant<FullBufferedData, StreamData> data_;
+
+    /// native transport state, the values set in curl::easy can not be read
+    struct {
+        native::Transport* transport{nullptr};
+        bool supported{true};
+        /// whether the current request is performed by the native transport
+        bool active{false};
+        bool follow_redirects{false};
+        std::string method;
+        std::string user_agent;
+        std::string cookies;
+        native::ResponseData response;
+
+        std::mutex cancellation_mutex;
+        engine::TaskCancellationToken cancellation_token;
+    } native_;
 };
 
 }  // namespace clients::http
@@ -34,6 +34,13 @@ RequestStats::~RequestStats() {
 
 RequestStats::RequestStats(RequestStats&& other) noexcept : stats_{std::exchange(other.stats_, nullptr)} {}
 
+RequestStats& RequestStats::operator=(RequestStats&& other) noexcept {
+    // The previous statistics are released by the destructor of `other`
+    std::swap(stats_, other.stats_);
+    start_time_ = other.start_time_;
+    return *this;
+}
+
 void RequestStats::Start() { start_time_ = std::chrono::steady_clock::now(); }
 
 void RequestStats::FinishOk(int code, unsigned int attempts) noexcept {
@@ -72,6 +79,11 @@ void RequestStats::AccountOpenSockets(size_t sockets) noexcept {
     stats_->socket_open_ += utils::statistics::Rate{sockets};
 }
 
+void RequestStats::AccountSocketReused() noexcept {
+    UASSERT(stats_);
+    ++stats_->socket_reused_;
+}
+
 void RequestStats::AccountTimeoutUpdatedByDeadline() noexcept {
     UASSERT(stats_);
     ++stats_->timeout_updated_by_deadline_;
@@ -168,6 +180,7 @@ void DumpMetric(utils::statistics::Writer& writer, const DestinationStatisticsVi
     writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
 
     writer["sockets"]["open"] = stats.multi.socket_open;
+    writer["sockets"]["reused"] = stats.multi.socket_reused;
 }
 
 void DumpMetric(utils::statistics::Writer& writer, const InstanceStatistics& stats) {
@@ -205,6 +218,7 @@ InstanceStatistics::InstanceStatistics(const Statistics& other)
       reply_status(other.reply_status_) {
     for (size_t i = 0; i < error_count.size(); i++) error_count[i] = other.error_count_[i].Load();
     multi.socket_open = other.socket_open_.Load();
+    multi.socket_reused = other.socket_reused_.Load();
 }
 
 uint64_t InstanceStatistics::GetNotOkErrorCount() const {
@@ -28,7 +28,7 @@ public:
     RequestStats& operator=(const RequestStats&) = delete;
 
     RequestStats(RequestStats&&) noexcept;
-    RequestStats& operator=(RequestStats&&) = delete;
+    RequestStats& operator=(RequestStats&&) noexcept;
 
     void Start();
     void FinishOk(int code, unsigned int attempts) noexcept;
@@ -37,6 +37,7 @@ public:
     void StoreTimeToStart(std::chrono::microseconds micro_seconds) noexcept;
 
     void AccountOpenSockets(size_t sockets) noexcept;
+    void AccountSocketReused() noexcept;
 
     void AccountTimeoutUpdatedByDeadline() noexcept;
     void AccountCancelledByDeadline() noexcept;
@@ -52,10 +53,13 @@ struct MultiStats {
     utils::statistics::Rate socket_open;
     utils::statistics::Rate socket_close;
     utils::statistics::Rate socket_ratelimit;
+    // Requests performed over an already open connection
+    utils::statistics::Rate socket_reused;
     double current_load{0};
 
     MultiStats& operator+=(const MultiStats& other) {
         socket_open += other.socket_open;
+        socket_reused += other.socket_reused;
         socket_close += other.socket_close;
         socket_ratelimit += other.socket_ratelimit;
         current_load += other.current_load;
@@ -103,6 +107,7 @@ private:
     std::array<utils::statistics::RateCounter, kErrorGroupCount> error_count_;
     utils::statistics::RateCounter retries_;
     utils::statistics::RateCounter socket_open_{0};
+    utils::statistics::RateCounter socket_reused_{0};
     utils::statistics::RateCounter timeout_updated_by_deadline_;
     utils::statistics::RateCounter cancelled_by_deadline_;
     utils::statistics::HttpCodes reply_status_;
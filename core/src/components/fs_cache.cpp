@@ -7,6 +7,18 @@ USERVER_NAMESPACE_BEGIN
 
 namespace components {
 
+namespace {
+
+utils::Flags<fs::SettingsReadFile> ParseSettingsReadFile(const components::ComponentConfig& config) {
+    utils::Flags<fs::SettingsReadFile> flags{fs::SettingsReadFile::kSkipHidden};
+    if (config["precompress"].As<bool>(false)) {
+        flags |= fs::SettingsReadFile::kPrecompress;
+    }
+    return flags;
+}
+
+}  // namespace
+
 const FsCache::Client& FsCache::GetClient() const { return client_; }
 
 FsCache::FsCache(const components::ComponentConfig& config, const components::ComponentContext& context)
@@ -14,7 +26,8 @@ FsCache::FsCache(const components::ComponentConfig& config, const components::Co
       client_(
           config["dir"].As<std::string>("/var/www"),
           config["update-period"].As<std::chrono::milliseconds>(0),
-          context.GetTaskProcessor(config["fs-task-processor"].As<std::string>("fs-task-processor"))
+          context.GetTaskProcessor(config["fs-task-processor"].As<std::string>("fs-task-processor")),
+          ParseSettingsReadFile(config)
       ) {}
 
 yaml_config::Schema FsCache::GetStaticConfigSchema() {
@@ -36,6 +49,13 @@ properties:
         type: string
         description: task processor to do filesystem operations
         defaultDescription: fs-task-processor
+    precompress:
+        type: boolean
+        description: |
+            build gzip and zstd variants of the files on load, so that
+            server::handlers::HttpHandlerStatic could serve them to the clients
+            that accept them
+        defaultDescription: false
 )");
 }
 
@@ -141,7 +141,11 @@ void Manager::TaskProcessorsStorage::WaitForAllTasksBlocking() const noexcept {
 Manager::Manager(std::unique_ptr<ManagerConfig>&& config, const ComponentList& component_list)
     : config_(std::move(config)),
       task_processors_storage_(
-          std::make_shared<engine::impl::TaskProcessorPools>(config_->coro_pool, config_->event_thread_pool)
+          std::make_shared<engine::impl::TaskProcessorPools>(
+              config_->coro_pool,
+              config_->small_stack_coro_pool,
+              config_->event_thread_pool
+          )
       ),
       start_time_(std::chrono::steady_clock::now()) {
     LOG_INFO() << "Starting components manager";
@@ -111,6 +111,29 @@ properties:
                     lead to inaccuracy in coro pool size estimation.
                     local_cache_size=0 disables local cache.
                 defaultDescription: 8
+    small_stack_coro_pool:
+        type: object
+        description: |
+            options of the coroutines pool with small stacks, used by task
+            processors with `coro-stack-size-class: small`
+        additionalProperties: false
+        properties:
+            initial_size:
+                type: integer
+                description: amount of coroutines to preallocate on startup
+                defaultDescription: 1000
+            max_size:
+                type: integer
+                description: max amount of coroutines to keep preallocated
+                defaultDescription: 4000
+            stack_size:
+                type: integer
+                description: size of a single coroutine, bytes
+                defaultDescription: 64 * 1024
+            local_cache_size:
+                type: integer
+                description: local coroutine cache size per TaskProcessor worker thread
+                defaultDescription: 8
     event_thread_pool:
         type: object
         description: event thread pool options
@@ -121,6 +144,16 @@ properties:
                 description: >
                     number of threads to process low level IO system calls
                     (number of ev loops to start in libev)
+            io_backend:
+                type: string
+                description: >
+                    kernel interface for I/O readiness notifications;
+                    'io_uring' falls back to 'default' (epoll) if not
+                    supported by the kernel
+                defaultDescription: default
+                enum:
+                  - default
+                  - io_uring
     components:
         type: object
         description: 'dictionary of "component name": "options"'
@@ -169,10 +202,29 @@ properties:
                         `global-task-queue` default task queue.
                         `work-stealing-task-queue` experimental with
                         potentially better scalability than `global-task-queue`.
+                        `numa-work-stealing-task-queue` experimental
+                        `work-stealing-task-queue` that pins worker threads to
+                        NUMA nodes and prefers stealing from the same node.
+                        `edf-task-queue` experimental queue that runs tasks
+                        with the earliest (propagated) deadline first and
+                        cancels not yet started tasks whose deadline expired
+                        in the queue. Request deadlines are used only if
+                        cancel-by-deadline is enabled in the dynamic config.
                     defaultDescription: global-task-queue
                     enum:
                       - global-task-queue
                       - work-stealing-task-queue
+                      - numa-work-stealing-task-queue
+                      - edf-task-queue
+                coro-stack-size-class:
+                    type: string
+                    description: |
+                        Stack size class of the task processor coroutines.
+                        `small` takes coroutines from `small_stack_coro_pool`.
+                    defaultDescription: default
+                    enum:
+                      - default
+                      - small
                 task-trace:
                     type: object
                     description: .
@@ -241,6 +293,10 @@ ManagerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Man
     ManagerConfig config;
 
     config.coro_pool = value["coro_pool"].As<engine::coro::PoolConfig>({});
+    config.small_stack_coro_pool = value["small_stack_coro_pool"].As<std::optional<engine::coro::PoolConfig>>();
+    if (config.small_stack_coro_pool && value["small_stack_coro_pool"]["stack_size"].IsMissing()) {
+        config.small_stack_coro_pool->stack_size = engine::coro::kSmallStackSize;
+    }
     config.event_thread_pool = value["event_thread_pool"].As<engine::ev::ThreadPoolConfig>();
     if (config.event_thread_pool.threads < 1) {
         throw std::runtime_error(
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -19,6 +20,7 @@ enum class ValidationMode;
 
 struct ManagerConfig {
     engine::coro::PoolConfig coro_pool;
+    std::optional<engine::coro::PoolConfig> small_stack_coro_pool;
     engine::ev::ThreadPoolConfig event_thread_pool;
     std::vector<components::ComponentConfig> components;
     std::vector<engine::TaskProcessorConfig> task_processors;
@@ -21,6 +21,8 @@ components_manager:
     max_size#fallback: 50000
     stack_size#env: USERVER_STACK_SIZE
     local_cache_size: 32
+  small_stack_coro_pool:
+    max_size: 100
   default_task_processor: main-task-processor
   mlock_debug_info: $variable_does_not_exist
   mlock_debug_info#env: MLOCK_DEBUG_INFO
@@ -214,6 +216,10 @@ TEST(ManagerConfig, Basic) {
     EXPECT_FALSE(mc.mlock_debug_info) << "#env does not work with missing substitution vars";
     EXPECT_EQ(mc.coro_pool.stack_size, 1024) << "#env does not work";
 
+    ASSERT_TRUE(mc.small_stack_coro_pool);
+    EXPECT_EQ(mc.small_stack_coro_pool->max_size, 100);
+    EXPECT_EQ(mc.small_stack_coro_pool->stack_size, engine::coro::kSmallStackSize);
+
     EXPECT_EQ(mc.task_processors.size(), 5);
 
     ASSERT_EQ(mc.components.size(), 28);
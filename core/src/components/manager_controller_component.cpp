@@ -31,6 +31,12 @@ void DumpMetric(utils::statistics::Writer& writer, const engine::TaskProcessor&
         tasks["finished"] = stopped.value;
         tasks["cancelled"] = counter.GetCancelledTasks().value;
         tasks["cancelled_overload"] = counter.GetCancelledTasksOverload().value;
+        if (const auto cross_node_steals = task_processor.GetTaskQueueCrossNodeSteals()) {
+            tasks["cross_node_steals"] = *cross_node_steals;
+        }
+        if (const auto expired_drops = task_processor.GetTaskQueueExpiredDrops()) {
+            tasks["expired_drops"] = *expired_drops;
+        }
     }
 
     writer["errors"].ValueWithLabels(
@@ -49,6 +55,21 @@ void DumpMetric(utils::statistics::Writer& writer, const engine::TaskProcessor&
     writer["worker-threads"] = task_processor.GetWorkerCount();
 }
 
+namespace coro {
+
+void DumpMetric(utils::statistics::Writer& writer, const PoolStats& stats) {
+    if (auto coro_stats = writer["coroutines"]) {
+        coro_stats["active"] = stats.active_coroutines;
+        coro_stats["total"] = stats.total_coroutines;
+    }
+    if (auto stack_usage_stats = writer["stack-usage"]) {
+        stack_usage_stats["max-usage-percent"] = stats.max_stack_usage_pct;
+        stack_usage_stats["is-monitor-active"] = stats.is_stack_usage_monitor_active;
+    }
+}
+
+}  // namespace coro
+
 }  // namespace engine
 
 namespace components {
@@ -93,16 +114,9 @@ void ManagerControllerComponent::WriteStatistics(utils::statistics::Writer& writ
     writer["ev-threads"]["cpu-load-percent"] = pools_ptr->EventThreadPool();
 
     // coroutines
-    if (auto coro_pool = writer["coro-pool"]) {
-        const auto stats = components_manager_.GetTaskProcessorPools()->GetCoroPool().GetStats();
-        if (auto coro_stats = coro_pool["coroutines"]) {
-            coro_stats["active"] = stats.active_coroutines;
-            coro_stats["total"] = stats.total_coroutines;
-        }
-        if (auto stack_usage_stats = coro_pool["stack-usage"]) {
-            stack_usage_stats["max-usage-percent"] = stats.max_stack_usage_pct;
-            stack_usage_stats["is-monitor-active"] = stats.is_stack_usage_monitor_active;
-        }
+    writer["coro-pool"] = pools_ptr->GetCoroPool().GetStats();
+    if (const auto* small_stack_coro_pool = pools_ptr->GetSmallStackCoroPool()) {
+        writer["small-stack-coro-pool"] = small_stack_coro_pool->GetStats();
     }
 
     // misc
@@ -12,6 +12,9 @@ namespace compression::gzip {
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Compresses the string with the specified compression level (1-9).
+std::string Compress(std::string_view data, int level);
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
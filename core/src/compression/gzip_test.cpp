@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include <boost/iostreams/filter/gzip.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 #include <compression/gzip.hpp>
@@ -28,4 +30,15 @@ TEST(Gzip, TestOverflow) {
     EXPECT_THROW(compression::gzip::Decompress(compressed, big_msg.size() / 2), compression::TooBigError);
 }
 
+TEST(Gzip, CompressDecompress) {
+    std::string data;
+    for (int i = 0; i < 1000; ++i) data += "Some repetitive data " + std::to_string(i % 10);
+
+    const auto compressed = compression::gzip::Compress(data, 9);
+    EXPECT_LT(compressed.size(), data.size());
+    EXPECT_EQ(compression::gzip::Decompress(compressed, data.size()), data);
+
+    EXPECT_EQ(compression::gzip::Decompress(compression::gzip::Compress({}, 1), 0), "");
+}
+
 USERVER_NAMESPACE_END
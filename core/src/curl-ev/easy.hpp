@@ -216,6 +216,10 @@ public:
 
     const multi* GetMulti() const { return multi_; }
 
+    // Moves the easy to another multi, must not be called while the easy is
+    // being performed
+    void SetMulti(multi& multi_handle);
+
     inline native::CURL* native_handle() { return handle_; }
     engine::ev::ThreadControl& GetThreadControl();
 
@@ -431,6 +435,7 @@ public:
     void set_headers(std::shared_ptr<string_list> headers);
     void set_headers(std::shared_ptr<string_list> headers, std::error_code& ec);
     std::optional<std::string_view> FindHeaderByName(std::string_view name) const;
+    const string_list* get_headers() const { return headers_.get(); }
     void add_proxy_header(
         std::string_view name,
         std::string_view value,
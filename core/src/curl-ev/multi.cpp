@@ -106,6 +106,7 @@ multi::~multi() {
 
 void multi::add(easy* easy_handle) {
     pimpl_->easy_handles_.insert(easy_handle);
+    statistics_.mark_easy_added();
     add_handle(easy_handle->native_handle());
 }
 
@@ -114,6 +115,7 @@ void multi::remove(easy* easy_handle) {
 
     if (it != pimpl_->easy_handles_.end()) {
         pimpl_->easy_handles_.erase(it);
+        statistics_.mark_easy_removed();
         remove_handle(easy_handle->native_handle());
     }
 }
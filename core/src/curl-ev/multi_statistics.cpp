@@ -13,12 +13,18 @@ void MultiStatistics::mark_close_socket() { close_++; }
 
 void MultiStatistics::mark_socket_ratelimited() { ratelimited_++; }
 
+void MultiStatistics::mark_easy_added() { active_easy_.fetch_add(1, std::memory_order_relaxed); }
+
+void MultiStatistics::mark_easy_removed() { active_easy_.fetch_sub(1, std::memory_order_relaxed); }
+
 long long MultiStatistics::open_socket_total() const { return open_.load(); }
 
 long long MultiStatistics::close_socket_total() const { return close_.load(); }
 
 long long MultiStatistics::socket_ratelimited_total() const { return ratelimited_.load(); }
 
+long long MultiStatistics::active_easy_count() const { return active_easy_.load(std::memory_order_relaxed); }
+
 utils::statistics::BusyStorage& MultiStatistics::get_busy_storage() { return busy_storage_; }
 
 const utils::statistics::BusyStorage& MultiStatistics::get_busy_storage() const { return busy_storage_; }
@@ -16,10 +16,14 @@ public:
     void mark_open_socket();
     void mark_close_socket();
     void mark_socket_ratelimited();
+    void mark_easy_added();
+    void mark_easy_removed();
 
     long long open_socket_total() const;
     long long close_socket_total() const;
     long long socket_ratelimited_total() const;
+    // Number of the easy handles being performed
+    long long active_easy_count() const;
 
     utils::statistics::BusyStorage& get_busy_storage();
     const utils::statistics::BusyStorage& get_busy_storage() const;
@@ -28,6 +32,7 @@ private:
     std::atomic_llong open_{0};
     std::atomic_llong close_{0};
     std::atomic_llong ratelimited_{0};
+    std::atomic_llong active_easy_{0};
     utils::statistics::BusyStorage busy_storage_;
 };
 
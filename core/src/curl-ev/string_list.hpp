@@ -38,6 +38,11 @@ public:
     void add(std::string str);
     void clear() noexcept;
 
+    template <typename Func>
+    void ForEach(const Func& func) const {
+        for (const auto& list_elem : list_elements_) func(std::string_view{list_elem.value});
+    }
+
     template <typename Pred>
     std::optional<std::string_view> FindIf(const Pred& pred) const {
         for (const auto& list_elem : list_elements_) {
@@ -51,7 +51,7 @@ typename Pool::CoroutinePtr Pool::GetCoroutine() {
     // First try to dequeue from 'working set': if we can get a coroutine
     // from there we are happy, because we saved on minor-page-faulting (thus
     // increasing resident memory usage) a not-yet-de-virtualized coroutine stack.
-    if (!local_coro_buffer_.empty() || TryPopulateLocalCache()) {
+    if (IsLocalCacheOwner() && (!local_coro_buffer_.empty() || TryPopulateLocalCache())) {
         coroutine = std::move(local_coro_buffer_.back());
         local_coro_buffer_.pop_back();
     } else if (initial_coroutines_.try_dequeue(mover)) {
@@ -64,7 +64,7 @@ typename Pool::CoroutinePtr Pool::GetCoroutine() {
 }
 
 void Pool::PutCoroutine(CoroutinePtr&& coroutine_ptr) {
-    if (config_.local_cache_size == 0) {
+    if (config_.local_cache_size == 0 || !IsLocalCacheOwner()) {
         const bool ok =
             // We only ever return coroutines into our 'working set'.
             used_coroutines_.enqueue(GetUsedPoolToken<moodycamel::ProducerToken>(), std::move(coroutine_ptr.Get()));
@@ -91,9 +91,19 @@ PoolStats Pool::GetStats() const {
     return stats;
 }
 
-void Pool::PrepareLocalCache() { local_coro_buffer_.reserve(config_.local_cache_size); }
+void Pool::PrepareLocalCache() {
+    UASSERT_MSG(
+        local_coro_buffer_owner_ == nullptr || local_coro_buffer_owner_ == this,
+        "Thread local coroutine cache is already used by another pool"
+    );
+    local_coro_buffer_owner_ = this;
+    local_coro_buffer_.reserve(config_.local_cache_size);
+}
 
 void Pool::ClearLocalCache() {
+    if (!IsLocalCacheOwner()) return;
+    local_coro_buffer_owner_ = nullptr;
+
     const std::size_t current_idle_coroutines_num = idle_coroutines_num_.load();
     std::size_t return_to_pool_from_local_cache_num = 0;
 
@@ -54,11 +54,16 @@ private:
     // local coroutine cache.
     const std::size_t local_coroutine_move_size_;
 
+    bool IsLocalCacheOwner() const noexcept { return local_coro_buffer_owner_ == this; }
+
     // Reduces contention by allowing bulk operations on used_coroutines_.
     // Coroutines in local_coro_buffer_ are counted as used in statistics.
     // Unprotected thread_local is OK here, because coro::Pool is always used
     // outside of any coroutine.
     static inline thread_local std::vector<Coroutine> local_coro_buffer_;
+    // There may be several pools with different stack sizes, but a thread
+    // caches coroutines of a single pool only.
+    static inline thread_local const Pool* local_coro_buffer_owner_{nullptr};
 
     boost::coroutines2::protected_fixedsize_stack stack_allocator_;
     // Some pointers arithmetic in StackUsageMonitor depends on this.
@@ -1,9 +1,19 @@
 #include "pool_config.hpp"
 
+#include <userver/utils/trivial_map.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro {
 
+StackSizeClass Parse(const yaml_config::YamlConfig& value, formats::parse::To<StackSizeClass>) {
+    static constexpr utils::TrivialBiMap kMap([](auto selector) {
+        return selector().Case(StackSizeClass::kDefault, "default").Case(StackSizeClass::kSmall, "small");
+    });
+
+    return utils::ParseFromValueString(value, kMap);
+}
+
 PoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<PoolConfig>) {
     PoolConfig config;
     config.initial_size = value["initial_size"].As<size_t>(config.initial_size);
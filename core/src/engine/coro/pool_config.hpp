@@ -9,6 +9,15 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro {
 
+// Coroutines of a TaskProcessor are taken from the pool of its stack size
+// class. kSmall is meant for tasks with shallow stacks, e.g. connections.
+enum class StackSizeClass {
+    kDefault,
+    kSmall,
+};
+
+StackSizeClass Parse(const yaml_config::YamlConfig& value, formats::parse::To<StackSizeClass>);
+
 struct PoolConfig {
     std::size_t initial_size = 1000;
     std::size_t max_size = 4000;
@@ -18,6 +27,9 @@ struct PoolConfig {
 
 PoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<PoolConfig>);
 
+// Default stack size of the kSmall class coroutines
+inline constexpr std::size_t kSmallStackSize = 64 * 1024ULL;
+
 }  // namespace engine::coro
 
 USERVER_NAMESPACE_END
@@ -40,11 +40,21 @@ void ReleaseEvDefaultLoop() {
     GetEvDefaultLoopFlag().clear();
 }
 
+// EVBACKEND_IOURING is an enumerator rather than a macro and is missing in
+// libev before 4.31, where the bit is never reported as supported.
+#if EV_VERSION_MAJOR > 4 || (EV_VERSION_MAJOR == 4 && EV_VERSION_MINOR >= 31)
+constexpr unsigned int kEvBackendIoUring = EVBACKEND_IOURING;
+#else
+constexpr unsigned int kEvBackendIoUring = 0x80;
+#endif
+
+bool IsIoUringBuiltIn() noexcept { return (ev_supported_backends() & kEvBackendIoUring) != 0; }
+
 }  // namespace
 
-EventLoop::EventLoop(EvLoopType ev_loop_mode) : ev_loop_mode_(ev_loop_mode) {
+EventLoop::EventLoop(EvLoopType ev_loop_mode, IoBackend io_backend) : ev_loop_mode_(ev_loop_mode) {
     if (ev_loop_mode_ == EvLoopType::kDefaultLoop) AcquireEvDefaultLoop();
-    Start();
+    Start(io_backend);
 }
 
 EventLoop::~EventLoop() {
@@ -56,6 +66,22 @@ EventLoop::~EventLoop() {
     }
 }
 
+IoBackend EventLoop::GetIoBackend() const noexcept {
+    if (ev_backend(loop_) == kEvBackendIoUring) return IoBackend::kIoUring;
+    return IoBackend::kDefault;
+}
+
+bool EventLoop::IsIoUringAvailable() noexcept {
+    if (!IsIoUringBuiltIn()) return false;
+
+    // io_uring_setup() may be forbidden even on new kernels, for example by
+    // seccomp in containers
+    auto* loop = ev_loop_new(kEvBackendIoUring);
+    if (!loop) return false;
+    ev_loop_destroy(loop);
+    return true;
+}
+
 void EventLoop::RunOnce() noexcept {
     UASSERT(DebugIsSameOsThread());
     ev_run(loop_, EVRUN_ONCE);
@@ -77,10 +103,28 @@ bool EventLoop::DebugIsSameOsThread() noexcept {
     return true;
 }
 
-void EventLoop::Start() {
-    loop_ = ((ev_loop_mode_ == EvLoopType::kDefaultLoop) ? ev_default_loop(EVFLAG_AUTO) : ev_loop_new(EVFLAG_AUTO));
+struct ev_loop* EventLoop::CreateLoop(unsigned int flags) {
+    return (ev_loop_mode_ == EvLoopType::kDefaultLoop) ? ev_default_loop(flags) : ev_loop_new(flags);
+}
+
+void EventLoop::Start(IoBackend io_backend) {
+    if (io_backend == IoBackend::kIoUring) {
+        if (IsIoUringBuiltIn()) {
+            // libev fails to create the loop if io_uring_setup() is not available,
+            // for example on old kernels or in restricted containers.
+            loop_ = CreateLoop(kEvBackendIoUring);
+            if (!loop_) {
+                LOG_WARNING() << "io_uring is not supported by the kernel, falling back to the default ev backend";
+            }
+        } else {
+            LOG_WARNING() << "libev is built without io_uring support, falling back to the default ev backend";
+        }
+    }
+    if (!loop_) loop_ = CreateLoop(EVFLAG_AUTO);
 
     UASSERT(loop_);
+    LOG_DEBUG() << "Started ev loop with backend " << ev_backend(loop_) << " for thread_name="
+                << utils::GetCurrentThreadName();
 #ifdef EV_HAS_IO_PESSIMISTIC_REMOVE
     ev_set_io_pessimistic_remove(loop_);
 #endif
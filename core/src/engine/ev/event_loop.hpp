@@ -5,6 +5,7 @@
 #include <ev.h>
 
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/thread_pool_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -17,12 +18,19 @@ public:
         kDefaultLoop,
     };
 
-    explicit EventLoop(EvLoopType ev_loop_mode);
+    explicit EventLoop(EvLoopType ev_loop_mode, IoBackend io_backend = IoBackend::kDefault);
 
     ~EventLoop();
 
     struct ev_loop* GetEvLoop() const noexcept { return loop_; }
 
+    /// @returns the actually used backend, that could differ from the
+    /// requested one if it is not supported by the kernel
+    IoBackend GetIoBackend() const noexcept;
+
+    /// @returns true if both libev and the kernel support io_uring
+    static bool IsIoUringAvailable() noexcept;
+
     void RunOnce() noexcept;
 
     // Callbacks passed to RunInEvLoopAsync() are serialized.
@@ -34,7 +42,8 @@ public:
 private:
     void AssertSameOsThread() noexcept;
 
-    void Start();
+    void Start(IoBackend io_backend);
+    struct ev_loop* CreateLoop(unsigned int flags);
 
     static void ChildWatcher(struct ev_loop*, ev_child* w, int) noexcept;
     static void ChildWatcherImpl(ev_child* w);
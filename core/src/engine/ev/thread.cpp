@@ -27,13 +27,16 @@ const auto kCpuStatsThrottle = static_cast<std::size_t>(kCpuStatsCollectInterval
 
 }  // namespace
 
-Thread::Thread(const std::string& thread_name) : Thread(thread_name, EventLoop::EvLoopType::kNewLoop) {}
+Thread::Thread(const std::string& thread_name, IoBackend io_backend)
+    : Thread(thread_name, EventLoop::EvLoopType::kNewLoop, io_backend) {}
 
-Thread::Thread(const std::string& thread_name, UseDefaultEvLoop)
-    : Thread(thread_name, EventLoop::EvLoopType::kDefaultLoop) {}
+Thread::Thread(const std::string& thread_name, UseDefaultEvLoop, IoBackend io_backend)
+    : Thread(thread_name, EventLoop::EvLoopType::kDefaultLoop, io_backend) {}
 
-Thread::Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type)
-    : event_loop_(ev_loop_type), name_{thread_name}, cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle} {
+Thread::Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type, IoBackend io_backend)
+    : event_loop_(ev_loop_type, io_backend),
+      name_{thread_name},
+      cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle} {
     UASSERT_MSG(kDeferredInterval > std::chrono::milliseconds{4}, "Timer events would happen too often");
     Start();
 }
@@ -27,13 +27,15 @@ public:
     struct UseDefaultEvLoop {};
     static constexpr UseDefaultEvLoop kUseDefaultEvLoop{};
 
-    explicit Thread(const std::string& thread_name);
-    Thread(const std::string& thread_name, UseDefaultEvLoop);
+    explicit Thread(const std::string& thread_name, IoBackend io_backend = IoBackend::kDefault);
+    Thread(const std::string& thread_name, UseDefaultEvLoop, IoBackend io_backend = IoBackend::kDefault);
 
     ~Thread();
 
     struct ev_loop* GetEvLoop() const { return event_loop_.GetEvLoop(); }
 
+    IoBackend GetIoBackend() const noexcept { return event_loop_.GetIoBackend(); }
+
     // Callbacks passed to RunInEvLoopAsync() are serialized.
     // All callbacks are guaranteed to execute.
     void RunInEvLoopAsync(AsyncPayloadBase& payload) noexcept;
@@ -49,7 +51,7 @@ public:
     const std::string& GetName() const;
 
 private:
-    Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type);
+    Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type, IoBackend io_backend);
 
     void RegisterInEvLoop(AsyncPayloadBase& payload);
 
@@ -1,13 +1,28 @@
 #include "thread_pool_config.hpp"
 
+#include <stdexcept>
+
+#include <fmt/format.h>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+IoBackend Parse(const yaml_config::YamlConfig& value, formats::parse::To<IoBackend>) {
+    const auto backend = value.As<std::string>();
+    if (backend == "default") return IoBackend::kDefault;
+    if (backend == "io_uring") return IoBackend::kIoUring;
+
+    throw std::runtime_error(fmt::format(
+        "Invalid value '{}' of {}, expected one of: 'default', 'io_uring'", backend, value.GetPath()
+    ));
+}
+
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ThreadPoolConfig>) {
     ThreadPoolConfig config;
     config.threads = value["threads"].As<std::size_t>(config.threads);
     config.thread_name = value["thread_name"].As<std::string>(config.thread_name);
+    config.io_backend = value["io_backend"].As<IoBackend>(config.io_backend);
     return config;
 }
 
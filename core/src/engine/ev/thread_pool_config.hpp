@@ -9,12 +9,24 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+/// Kernel interface used by the ev loops to wait for the I/O readiness
+enum class IoBackend {
+    /// Whatever libev considers the best for the platform (epoll on Linux)
+    kDefault,
+    /// io_uring with batched submissions of poll requests; falls back to
+    /// kDefault at runtime if the kernel or libev does not support it
+    kIoUring,
+};
+
 struct ThreadPoolConfig {
     std::size_t threads = 2;
     std::string thread_name = "event-worker";
     bool ev_default_loop_disabled = false;
+    IoBackend io_backend = IoBackend::kDefault;
 };
 
+IoBackend Parse(const yaml_config::YamlConfig& value, formats::parse::To<IoBackend>);
+
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ThreadPoolConfig>);
 
 }  // namespace engine::ev
@@ -3,20 +3,20 @@
 #include <fcntl.h>
 #include <sys/param.h>
 
+#include <engine/ev/event_loop.hpp>
 #include <engine/ev/thread.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utest/utest.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
-#if defined(BSD) && !defined(__APPLE__)
-UTEST(IoWatcher, DISABLED_DevNull) {
-#else
-UTEST(IoWatcher, DevNull) {
-#endif
+namespace {
+
+void TestDevNull(engine::ev::IoBackend io_backend) {
     LOG_DEBUG() << "Opening /dev/null";
-    engine::ev::Thread thread{"test_thread"};
+    engine::ev::Thread thread{"test_thread", io_backend};
     engine::ev::ThreadControl thread_control(thread);
+    EXPECT_EQ(thread.GetIoBackend(), io_backend);
 
     int fd = open("/dev/null", O_RDONLY | O_NONBLOCK | O_CLOEXEC);
     EXPECT_NE(-1, fd);
@@ -49,4 +49,25 @@ UTEST(IoWatcher, DevNull) {
     EXPECT_EQ(counter, 0);
 }
 
+}  // namespace
+
+#if defined(BSD) && !defined(__APPLE__)
+UTEST(IoWatcher, DISABLED_DevNull) {
+#else
+UTEST(IoWatcher, DevNull) {
+#endif
+    TestDevNull(engine::ev::IoBackend::kDefault);
+}
+
+#if defined(BSD) && !defined(__APPLE__)
+UTEST(IoWatcher, DISABLED_DevNullIoUring) {
+#else
+UTEST(IoWatcher, DevNullIoUring) {
+#endif
+    if (!engine::ev::EventLoop::IsIoUringAvailable()) {
+        GTEST_SKIP() << "io_uring is not supported by libev or by the kernel";
+    }
+    TestDevNull(engine::ev::IoBackend::kIoUring);
+}
+
 USERVER_NAMESPACE_END
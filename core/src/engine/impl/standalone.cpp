@@ -1,6 +1,7 @@
 #include <engine/impl/standalone.hpp>
 
 #include <future>
+#include <optional>
 
 #include <engine/coro/pool_config.hpp>
 #include <engine/ev/thread_pool_config.hpp>
@@ -21,12 +22,21 @@ std::shared_ptr<TaskProcessorPools> MakeTaskProcessorPools(const TaskProcessorPo
     coro_config.max_size = pools_config.max_coro_pool_size;
     coro_config.stack_size = pools_config.coro_stack_size;
 
+    std::optional<coro::PoolConfig> small_stack_coro_config;
+    if (pools_config.small_coro_stack_size != 0) {
+        small_stack_coro_config.emplace(coro_config);
+        small_stack_coro_config->stack_size = pools_config.small_coro_stack_size;
+    }
+
     ev::ThreadPoolConfig ev_config;
     ev_config.threads = pools_config.ev_threads_num;
     ev_config.thread_name = pools_config.ev_thread_name;
     ev_config.ev_default_loop_disabled = pools_config.ev_default_loop_disabled;
+    ev_config.io_backend = pools_config.ev_io_uring_enabled ? ev::IoBackend::kIoUring : ev::IoBackend::kDefault;
 
-    return std::make_shared<TaskProcessorPools>(std::move(coro_config), std::move(ev_config));
+    return std::make_shared<TaskProcessorPools>(
+        std::move(coro_config), std::move(small_stack_coro_config), std::move(ev_config)
+    );
 }
 
 TaskProcessorHolder
@@ -2,6 +2,7 @@
 
 #include <unistd.h>
 
+#include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <utils/check_syscall.hpp>
 
@@ -94,4 +95,41 @@ void fd_control_construct_wait_destroy(benchmark::State& state) {
 }
 BENCHMARK(fd_control_construct_wait_destroy);
 
+// Every iteration is a pair of readiness notifications delivered through ev
+// threads. Arg(0) - the default ev backend, Arg(1) - io_uring.
+void fd_control_ping_pong(benchmark::State& state) {
+    engine::TaskProcessorPoolsConfig config;
+    config.ev_io_uring_enabled = (state.range(0) != 0);
+
+    engine::RunStandalone(2, config, [&] {
+        const auto deadline = Deadline::FromDuration(std::chrono::seconds{60});
+        Pipe ping;
+        Pipe pong;
+        auto ping_in = FdControl::Adopt(ping.ExtractIn());
+        auto pong_in = FdControl::Adopt(pong.ExtractIn());
+        const int ping_out = ping.ExtractOut();
+        const int pong_out = pong.ExtractOut();
+
+        auto echo_task = engine::AsyncNoSpan([&] {
+            char c{};
+            while (ping_in->Read().Wait(deadline)) {
+                if (::read(ping_in->Fd(), &c, 1) != 1) return;
+                [[maybe_unused]] const auto res = ::write(pong_out, &c, 1);
+            }
+        });
+
+        char c = 'x';
+        for ([[maybe_unused]] auto _ : state) {
+            [[maybe_unused]] auto res = ::write(ping_out, &c, 1);
+            [[maybe_unused]] const bool ready = pong_in->Read().Wait(deadline);
+            res = ::read(pong_in->Fd(), &c, 1);
+        }
+
+        ::close(ping_out);
+        echo_task.Get();
+        ::close(pong_out);
+    });
+}
+BENCHMARK(fd_control_ping_pong)->Arg(0)->Arg(1);
+
 USERVER_NAMESPACE_END
@@ -75,6 +75,37 @@ void socket_send_all_v(benchmark::State& state) {
 }
 BENCHMARK(socket_send_all_v);
 
+// Arg(0) - the default ev backend, Arg(1) - io_uring
+void socket_ping_pong(benchmark::State& state) {
+    engine::TaskProcessorPoolsConfig config;
+    config.ev_io_uring_enabled = (state.range(0) != 0);
+
+    engine::RunStandalone(2, config, [&]() {
+        const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+        internal::net::TcpListener listener;
+        auto [server, client] = listener.MakeSocketPair(test_deadline);
+        auto task_echo = engine::AsyncNoSpan(
+            [test_deadline](auto&& server) {
+                std::array<char, 8> buf = {};
+                while (server.RecvAll(buf.data(), buf.size(), test_deadline) == buf.size()) {
+                    [[maybe_unused]] const auto sent = server.SendAll(buf.data(), buf.size(), test_deadline);
+                }
+            },
+            std::move(server)
+        );
+
+        std::array<char, 8> buf = {};
+        for ([[maybe_unused]] auto _ : state) {
+            [[maybe_unused]] const auto sent = client.SendAll(buf.data(), buf.size(), test_deadline);
+            const auto received = client.RecvAll(buf.data(), buf.size(), test_deadline);
+            benchmark::DoNotOptimize(received);
+        }
+        client.Close();
+        task_echo.Get();
+    });
+}
+BENCHMARK(socket_ping_pong)->Arg(0)->Arg(1);
+
 [[maybe_unused]] void socket_send_all_v_range(benchmark::State& state) {
     engine::RunStandalone(2, [&]() {
         const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
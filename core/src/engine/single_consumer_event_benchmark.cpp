@@ -12,6 +12,7 @@
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/wait_any.hpp>
 
 using namespace std::chrono_literals;
 
@@ -101,4 +102,59 @@ void SingleConsumerEventPingPong(benchmark::State& state) {
 
 BENCHMARK(SingleConsumerEventPingPong);
 
+// Emulates waiting for either a socket or a notification, as HTTP/2 connections
+// do: the notification is awaited via a helper task.
+void SingleConsumerEventWaitAnyViaTask(benchmark::State& state) {
+    engine::RunStandalone(2, [&] {
+        concurrent::impl::InterferenceShield<engine::SingleConsumerEvent> ping;
+        concurrent::impl::InterferenceShield<engine::SingleConsumerEvent> pong;
+        auto idle = engine::AsyncNoSpan([] { engine::InterruptibleSleepFor(std::chrono::hours{1}); });
+
+        auto companion = engine::AsyncNoSpan([&] {
+            while (true) {
+                ping->Send();
+                if (!pong->WaitForEvent()) return;
+            }
+        });
+
+        for ([[maybe_unused]] auto _ : state) {
+            auto helper = engine::AsyncNoSpan([&] { [[maybe_unused]] const auto res = ping->WaitForEvent(); });
+            benchmark::DoNotOptimize(engine::WaitAny(idle, helper));
+            pong->Send();
+        }
+
+        companion.SyncCancel();
+        idle.SyncCancel();
+    });
+}
+
+BENCHMARK(SingleConsumerEventWaitAnyViaTask);
+
+// Same as above, but the notification is awaited directly
+void SingleConsumerEventWaitAny(benchmark::State& state) {
+    engine::RunStandalone(2, [&] {
+        concurrent::impl::InterferenceShield<engine::SingleConsumerEvent> ping;
+        concurrent::impl::InterferenceShield<engine::SingleConsumerEvent> pong;
+        auto idle = engine::AsyncNoSpan([] { engine::InterruptibleSleepFor(std::chrono::hours{1}); });
+
+        auto companion = engine::AsyncNoSpan([&] {
+            while (true) {
+                ping->Send();
+                if (!pong->WaitForEvent()) return;
+            }
+        });
+
+        for ([[maybe_unused]] auto _ : state) {
+            benchmark::DoNotOptimize(engine::WaitAny(idle, *ping));
+            ping->Reset();
+            pong->Send();
+        }
+
+        companion.SyncCancel();
+        idle.SyncCancel();
+    });
+}
+
+BENCHMARK(SingleConsumerEventWaitAny);
+
 USERVER_NAMESPACE_END
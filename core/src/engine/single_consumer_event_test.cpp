@@ -6,6 +6,7 @@
 #include <userver/engine/async.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
+#include <userver/engine/wait_any.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/fixed_array.hpp>
@@ -312,4 +313,58 @@ UTEST(SingleConsumerEvent, WaitAndDestroyCancellation) {
     UEXPECT_THROW_MSG(sender.Get(), engine::TaskCancelledException, "User request");
 }
 
+UTEST(SingleConsumerEvent, WaitAny) {
+    engine::SingleConsumerEvent event;
+    auto task = engine::AsyncNoSpan([] { engine::InterruptibleSleepFor(utest::kMaxTestWaitTime); });
+
+    auto sender = engine::AsyncNoSpan([&event] { event.Send(); });
+    EXPECT_EQ(engine::WaitAny(task, event), 1);
+    EXPECT_TRUE(event.IsReady());
+
+    // WaitAny does not consume the signal
+    EXPECT_EQ(engine::WaitAny(event, task), 0);
+    EXPECT_TRUE(event.WaitForEventFor(utest::kMaxTestWaitTime));
+    EXPECT_FALSE(event.IsReady());
+
+    task.RequestCancel();
+    EXPECT_EQ(engine::WaitAny(event, task), 1);
+}
+
+UTEST(SingleConsumerEvent, WaitAnyTimeout) {
+    engine::SingleConsumerEvent event;
+    EXPECT_EQ(engine::WaitAnyFor(std::chrono::milliseconds{10}, event), std::nullopt);
+
+    event.Send();
+    EXPECT_EQ(engine::WaitAnyFor(std::chrono::milliseconds{10}, event), 0);
+    event.Reset();
+    EXPECT_FALSE(event.IsReady());
+}
+
+UTEST(SingleConsumerEvent, WaitAnyRepeated) {
+    engine::SingleConsumerEvent event;
+    auto task = engine::AsyncNoSpan([] { engine::InterruptibleSleepFor(utest::kMaxTestWaitTime); });
+
+    constexpr int kIterations = 100;
+    auto sender = engine::AsyncNoSpan([&event] {
+        for (int i = 0; i < kIterations; ++i) {
+            event.Send();
+            engine::Yield();
+        }
+    });
+
+    int received = 0;
+    while (!sender.IsFinished() || event.IsReady()) {
+        const auto index = engine::WaitAnyFor(std::chrono::milliseconds{10}, event, task);
+        if (index == 0) {
+            event.Reset();
+            ++received;
+        } else {
+            ASSERT_EQ(index, std::nullopt);
+        }
+    }
+    EXPECT_GT(received, 0);
+    EXPECT_LE(received, kIterations);
+    task.SyncCancel();
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,104 @@
+#include <engine/task/edf_task_queue.hpp>
+
+#include <algorithm>
+
+#include <engine/task/task_context.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+constexpr std::size_t kSemaphoreInitialCount = 0;
+
+// std::*_heap functions build a max-heap, so the "greatest" entry is the one
+// with the earliest deadline. Sequence keeps FIFO order for equal deadlines.
+template <typename Entry>
+bool IsLaterThan(const Entry& lhs, const Entry& rhs) noexcept {
+    if (lhs.deadline == rhs.deadline) return lhs.sequence > rhs.sequence;
+    return rhs.deadline < lhs.deadline;
+}
+
+}  // namespace
+
+EdfTaskQueue::EdfTaskQueue(const TaskProcessorConfig& config)
+    : queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
+
+void EdfTaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
+    UASSERT(context);
+    const auto deadline = context->GetSchedulingDeadline();
+
+    {
+        const std::lock_guard lock{mutex_};
+        if (deadline.IsReachable()) {
+            deadline_heap_.push_back(DeadlineEntry{deadline, push_sequence_++, context.get()});
+            std::push_heap(deadline_heap_.begin(), deadline_heap_.end(), IsLaterThan<DeadlineEntry>);
+        } else {
+            fifo_.push_back(context.get());
+        }
+    }
+    context.detach();
+
+    size_.fetch_add(1, std::memory_order_relaxed);
+    queue_semaphore_.signal();
+}
+
+boost::intrusive_ptr<impl::TaskContext> EdfTaskQueue::PopBlocking() {
+    queue_semaphore_.wait();
+
+    boost::intrusive_ptr<impl::TaskContext> context{DoPop(), /* add_ref= */ false};
+    if (!context) {
+        // return "stop" token back
+        queue_semaphore_.signal();
+        return context;
+    }
+    size_.fetch_sub(1, std::memory_order_relaxed);
+
+    // Only the tasks that have not run their payload yet are dropped, the
+    // started ones are resumed and handle their deadline themselves
+    if (!context->IsStarted() && !context->IsCritical() && !context->IsCancelRequested() &&
+        context->GetSchedulingDeadline().IsReached()) {
+        context->RequestCancel(TaskCancellationReason::kDeadline);
+        expired_drops_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return context;
+}
+
+void EdfTaskQueue::StopProcessing() {
+    // A semaphore permit without a queued task is a stop signal
+    queue_semaphore_.signal();
+}
+
+std::size_t EdfTaskQueue::GetSizeApproximate() const noexcept { return size_.load(std::memory_order_relaxed); }
+
+void EdfTaskQueue::PrepareWorker(std::size_t) {}
+
+std::uint64_t EdfTaskQueue::GetExpiredDropsCount() const noexcept {
+    return expired_drops_.load(std::memory_order_relaxed);
+}
+
+impl::TaskContext* EdfTaskQueue::DoPop() {
+    const std::lock_guard lock{mutex_};
+
+    const bool take_fifo = !fifo_.empty() && (deadline_heap_.empty() || pops_since_fifo_ + 1 >= kFifoPopPeriod);
+    if (take_fifo) {
+        pops_since_fifo_ = 0;
+        auto* context = fifo_.front();
+        fifo_.pop_front();
+        return context;
+    }
+
+    if (deadline_heap_.empty()) return nullptr;
+
+    ++pops_since_fifo_;
+    std::pop_heap(deadline_heap_.begin(), deadline_heap_.end(), IsLaterThan<DeadlineEntry>);
+    auto* context = deadline_heap_.back().context;
+    deadline_heap_.pop_back();
+    return context;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
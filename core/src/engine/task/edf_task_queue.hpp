@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include <moodycamel/blockingconcurrentqueue.h>
+#include <moodycamel/lightweightsemaphore.h>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+class TaskContext;
+}  // namespace impl
+
+/// Task queue that runs the task with the earliest scheduling deadline first
+/// (EDF, earliest deadline first). Tasks without a deadline are processed in
+/// FIFO order and get at least every kFifoPopPeriod-th pop, so that they are
+/// not starved by a steady stream of tasks with deadlines.
+///
+/// Non-critical tasks that are popped after their deadline and have not
+/// started yet are cancelled with TaskCancellationReason::kDeadline, so that
+/// they unwind without running their payload. Resumed tasks are not touched.
+class EdfTaskQueue final {
+public:
+    static constexpr std::size_t kFifoPopPeriod = 4;
+
+    explicit EdfTaskQueue(const TaskProcessorConfig& config);
+
+    void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
+
+    // Returns nullptr as a stop signal
+    boost::intrusive_ptr<impl::TaskContext> PopBlocking();
+
+    void StopProcessing();
+
+    std::size_t GetSizeApproximate() const noexcept;
+
+    void PrepareWorker(std::size_t index);
+
+    std::uint64_t GetExpiredDropsCount() const noexcept;
+
+private:
+    struct DeadlineEntry final {
+        Deadline deadline;
+        std::uint64_t sequence;
+        impl::TaskContext* context;
+    };
+
+    impl::TaskContext* DoPop();
+
+    mutable std::mutex mutex_;
+    std::vector<DeadlineEntry> deadline_heap_;
+    std::deque<impl::TaskContext*> fifo_;
+    std::uint64_t push_sequence_{0};
+    std::size_t pops_since_fifo_{0};
+
+    moodycamel::LightweightSemaphore queue_semaphore_;
+    std::atomic<std::size_t> size_{0};
+    std::atomic<std::uint64_t> expired_drops_{0};
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
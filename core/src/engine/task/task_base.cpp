@@ -149,7 +149,7 @@ bool IsTaskProcessorThread() noexcept { return GetCurrentTaskContextUnchecked()
 
 TaskProcessor& GetTaskProcessor() { return GetCurrentTaskContext().GetTaskProcessor(); }
 
-std::size_t GetStackSize() { return GetTaskProcessor().GetTaskProcessorPools()->GetCoroPool().GetStackSize(); }
+std::size_t GetStackSize() { return GetTaskProcessor().GetCoroPool().GetStackSize(); }
 
 ev::ThreadControl& GetEventThread() { return GetTaskProcessor().EventThreadPool().NextThread(); }
 
@@ -161,6 +161,8 @@ std::uint64_t GetCreatedTaskCount(TaskProcessor& task_processor) {
     return task_processor.GetTaskCounter().GetCreatedTasks().value;
 }
 
+std::size_t GetWorkerCount(TaskProcessor& task_processor) { return task_processor.GetWorkerCount(); }
+
 }  // namespace impl
 
 }  // namespace engine
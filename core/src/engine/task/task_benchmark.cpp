@@ -1,15 +1,18 @@
 #include <benchmark/benchmark.h>
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <deque>
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <concurrent/impl/latch.hpp>
 #include <engine/impl/standalone.hpp>
+#include <engine/task/task_context.hpp>
 #include <engine/task/task_processor.hpp>
 #include <engine/task/task_processor_config.hpp>
 #include <engine/task/work_stealing_queue/task_queue.hpp>
@@ -194,4 +197,137 @@ void engine_tasks_from_another_task_processor(benchmark::State& state) {
 }
 BENCHMARK(engine_tasks_from_another_task_processor)->RangeMultiplier(2)->Range(2, 32)->Arg(6)->Arg(12);
 
+namespace {
+
+void RunSpawnAndWaitTasks(benchmark::State& state, engine::TaskQueueType queue_type) {
+    engine::RunStandalone([&] {
+        const auto worker_threads = static_cast<std::size_t>(state.range(0));
+
+        engine::TaskProcessorConfig proc_config;
+        proc_config.name = "benchmark";
+        proc_config.thread_name = "benchmark";
+        proc_config.worker_threads = worker_threads;
+        proc_config.task_processor_queue = queue_type;
+        engine::TaskProcessor task_processor(
+            std::move(proc_config), engine::current_task::GetTaskProcessor().GetTaskProcessorPools()
+        );
+
+        // Every task spawns a subtask and waits for it, so workers have to
+        // steal the subtasks from each other
+        std::atomic<bool> keep_running{true};
+        std::vector<engine::TaskWithResult<std::uint64_t>> tasks;
+        tasks.reserve(worker_threads);
+        for (std::size_t i = 0; i < worker_threads - 1; ++i) {
+            tasks.push_back(engine::AsyncNoSpan(task_processor, [&] {
+                std::uint64_t tasks_count = 0;
+                while (keep_running) {
+                    engine::AsyncNoSpan([] {}).Wait();
+                    ++tasks_count;
+                }
+                return tasks_count;
+            }));
+        }
+
+        tasks.push_back(engine::AsyncNoSpan(task_processor, [&] {
+            std::uint64_t tasks_count = 0;
+            for ([[maybe_unused]] auto _ : state) {
+                engine::AsyncNoSpan([] {}).Wait();
+                ++tasks_count;
+            }
+            keep_running = false;
+            return tasks_count;
+        }));
+
+        std::uint64_t tasks_count_total = 0;
+        for (auto& task : tasks) {
+            tasks_count_total += task.Get();
+        }
+        state.counters["tasks"] = benchmark::Counter(tasks_count_total, benchmark::Counter::kIsRate);
+        if (const auto cross_node_steals = task_processor.GetTaskQueueCrossNodeSteals()) {
+            state.counters["cross_node_steals"] = benchmark::Counter(*cross_node_steals, benchmark::Counter::kIsRate);
+        }
+    });
+}
+
+}  // namespace
+
+void engine_spawn_and_wait_global_task_queue(benchmark::State& state) {
+    RunSpawnAndWaitTasks(state, engine::TaskQueueType::kGlobalTaskQueue);
+}
+BENCHMARK(engine_spawn_and_wait_global_task_queue)->RangeMultiplier(2)->Range(2, 32)->Arg(6)->Arg(12);
+
+void engine_spawn_and_wait_work_stealing_task_queue(benchmark::State& state) {
+    RunSpawnAndWaitTasks(state, engine::TaskQueueType::kWorkStealingTaskQueue);
+}
+BENCHMARK(engine_spawn_and_wait_work_stealing_task_queue)->RangeMultiplier(2)->Range(2, 32)->Arg(6)->Arg(12);
+
+void engine_spawn_and_wait_numa_work_stealing_task_queue(benchmark::State& state) {
+    RunSpawnAndWaitTasks(state, engine::TaskQueueType::kNumaWorkStealingTaskQueue);
+}
+BENCHMARK(engine_spawn_and_wait_numa_work_stealing_task_queue)->RangeMultiplier(2)->Range(2, 32)->Arg(6)->Arg(12);
+
+namespace {
+
+constexpr std::size_t kOverloadBurstSize = 1000;
+constexpr auto kOverloadTaskWork = std::chrono::microseconds{10};
+constexpr auto kOverloadTaskBudget = std::chrono::milliseconds{2};
+
+// Every iteration submits a burst of requests that is several times bigger
+// than the task processor can handle within the requests deadline. Goodput is
+// the rate of requests completed before their deadline.
+void RunOverloadedTasks(benchmark::State& state, engine::TaskQueueType queue_type) {
+    engine::RunStandalone([&] {
+        engine::TaskProcessorConfig proc_config;
+        proc_config.name = "benchmark";
+        proc_config.thread_name = "benchmark";
+        proc_config.worker_threads = static_cast<std::size_t>(state.range(0));
+        proc_config.task_processor_queue = queue_type;
+        engine::TaskProcessor task_processor(
+            std::move(proc_config), engine::current_task::GetTaskProcessor().GetTaskProcessorPools()
+        );
+
+        auto& current = engine::current_task::GetCurrentTaskContext();
+        std::atomic<std::uint64_t> on_time{0};
+        std::atomic<std::uint64_t> late{0};
+        std::vector<engine::TaskWithResult<void>> tasks;
+        tasks.reserve(kOverloadBurstSize);
+
+        for ([[maybe_unused]] auto _ : state) {
+            for (std::size_t i = 0; i < kOverloadBurstSize; ++i) {
+                const auto deadline = engine::Deadline::FromDuration(kOverloadTaskBudget);
+                current.SetSchedulingDeadline(deadline);
+                tasks.push_back(engine::AsyncNoSpan(task_processor, [&on_time, &late, deadline] {
+                    const auto work_end = std::chrono::steady_clock::now() + kOverloadTaskWork;
+                    while (std::chrono::steady_clock::now() < work_end) {
+                        // emulates CPU-bound request handling
+                    }
+                    (deadline.IsReached() ? late : on_time).fetch_add(1, std::memory_order_relaxed);
+                }));
+            }
+            current.SetSchedulingDeadline({});
+
+            for (auto& task : tasks) task.Wait();
+            tasks.clear();
+        }
+
+        state.counters["goodput"] = benchmark::Counter(on_time.load(), benchmark::Counter::kIsRate);
+        state.counters["late"] = benchmark::Counter(late.load(), benchmark::Counter::kAvgIterations);
+        if (const auto expired_drops = task_processor.GetTaskQueueExpiredDrops()) {
+            state.counters["expired_drops"] = benchmark::Counter(*expired_drops, benchmark::Counter::kAvgIterations);
+        }
+    });
+}
+
+}  // namespace
+
+void engine_overload_goodput_global_task_queue(benchmark::State& state) {
+    RunOverloadedTasks(state, engine::TaskQueueType::kGlobalTaskQueue);
+}
+BENCHMARK(engine_overload_goodput_global_task_queue)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+void engine_overload_goodput_edf_task_queue(benchmark::State& state) {
+    RunOverloadedTasks(state, engine::TaskQueueType::kEdfTaskQueue);
+}
+BENCHMARK(engine_overload_goodput_edf_task_queue)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
 USERVER_NAMESPACE_END
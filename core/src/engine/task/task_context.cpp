@@ -8,6 +8,7 @@
 
 #include <engine/coro/pool.hpp>
 #include <engine/coro/stack_usage_monitor.hpp>
+#include <logging/impl/thread_log_buffer.hpp>
 #include <logging/log_extra_stacktrace.hpp>
 #include <userver/compiler/impl/tls.hpp>
 #include <userver/compiler/impl/tsan.hpp>
@@ -75,6 +76,11 @@ namespace {
 
 auto ReadableTaskId(const TaskContext* task) noexcept { return logging::HexShort(task ? task->GetTaskId() : 0); }
 
+Deadline GetInheritedSchedulingDeadline() noexcept {
+    const auto* const parent = current_task::GetCurrentTaskContextUnchecked();
+    return parent ? parent->GetSchedulingDeadline() : Deadline{};
+}
+
 class CurrentTaskScope final {
 public:
     explicit CurrentTaskScope(TaskContext& context, EhGlobals& eh_store) : eh_store_(eh_store) {
@@ -113,6 +119,7 @@ TaskContext::TaskContext(
       payload_(&payload),
       finish_waiters_(wait_type),
       cancel_deadline_(deadline),
+      scheduling_deadline_(deadline.IsReachable() ? deadline : GetInheritedSchedulingDeadline()),
       trace_csw_left_(task_processor_.GetTaskTraceMaxCswForNewTask()) {
     UASSERT(payload_);
     LOG_TRACE() << "task with task_id=" << ReadableTaskId(current_task::GetCurrentTaskContextUnchecked())
@@ -217,6 +224,10 @@ void TaskContext::DoStep() {
 
     if (uncaught) std::rethrow_exception(uncaught);
 
+    // The task may be resumed by another thread as soon as it is marked as
+    // sleeping below, so the log records it has buffered in this thread go first.
+    logging::impl::PublishThreadLogBuffers();
+
     switch (yield_reason_) {
         case YieldReason::kTaskCancelled:
         case YieldReason::kTaskComplete: {
@@ -507,9 +518,15 @@ void TaskContext::SetCancelDeadline(Deadline deadline) {
     UASSERT(IsCurrent());
     UASSERT(state_ == Task::State::kRunning);
     cancel_deadline_ = deadline;
+    if (deadline < scheduling_deadline_) scheduling_deadline_ = deadline;
     ArmCancellationTimer();
 }
 
+void TaskContext::SetSchedulingDeadline(Deadline deadline) {
+    UASSERT(IsCurrent());
+    scheduling_deadline_ = deadline;
+}
+
 bool TaskContext::HasLocalStorage() const noexcept { return local_storage_.has_value(); }
 
 task_local::Storage& TaskContext::GetLocalStorage() noexcept {
@@ -161,6 +161,17 @@ public:
 
     void SetCancelDeadline(Deadline deadline);
 
+    // Deadline used for ordering by deadline-aware task queues. Inherited
+    // from the parent task unless the task has its own cancel deadline.
+    Deadline GetSchedulingDeadline() const noexcept { return scheduling_deadline_; }
+
+    // must only be called from this context
+    void SetSchedulingDeadline(Deadline deadline);
+
+    // Whether the task has entered its payload, i.e. it is resumed rather
+    // than started by the next DoStep()
+    bool IsStarted() const noexcept { return static_cast<bool>(coro_); }
+
     bool HasLocalStorage() const noexcept;
     task_local::Storage& GetLocalStorage() noexcept;
 
@@ -221,6 +232,7 @@ private:
 
     ContextTimer deadline_timer_;
     engine::Deadline cancel_deadline_;
+    engine::Deadline scheduling_deadline_;
 
     // {} if not defined
     std::chrono::steady_clock::time_point task_queue_wait_timepoint_;
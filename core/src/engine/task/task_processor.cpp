@@ -83,12 +83,15 @@ void TaskProcessorThreadStartedHook() {
 }
 
 auto MakeTaskQueue(TaskProcessorConfig config) {
-    using ResultType = std::variant<TaskQueue, WorkStealingTaskQueue>;
+    using ResultType = std::variant<TaskQueue, WorkStealingTaskQueue, EdfTaskQueue>;
     switch (config.task_processor_queue) {
         case TaskQueueType::kGlobalTaskQueue:
             return ResultType{std::in_place_index<0>, std::move(config)};
         case TaskQueueType::kWorkStealingTaskQueue:
+        case TaskQueueType::kNumaWorkStealingTaskQueue:
             return ResultType{std::in_place_index<1>, std::move(config)};
+        case TaskQueueType::kEdfTaskQueue:
+            return ResultType{std::in_place_index<2>, std::move(config)};
     }
     UINVARIANT(false, "Unexpected value of TaskQueueType enum");
 }
@@ -99,7 +102,8 @@ TaskProcessor::TaskProcessor(TaskProcessorConfig config, std::shared_ptr<impl::T
     : task_queue_(MakeTaskQueue(config)),
       task_counter_(config.worker_threads),
       config_(std::move(config)),
-      pools_(std::move(pools)) {
+      pools_(std::move(pools)),
+      coro_pool_(pools_->GetCoroPool(config_.coro_stack_size_class)) {
     utils::impl::FinishStaticRegistration();
     try {
         LOG_INFO() << "creating task_processor " << Name() << " "
@@ -172,12 +176,26 @@ void TaskProcessor::Adopt(impl::TaskContext& context) { detached_contexts_->Add(
 
 ev::ThreadPool& TaskProcessor::EventThreadPool() { return pools_->EventThreadPool(); }
 
-impl::CountedCoroutinePtr TaskProcessor::GetCoroutine() { return {pools_->GetCoroPool().GetCoroutine(), *this}; }
+impl::CountedCoroutinePtr TaskProcessor::GetCoroutine() { return {coro_pool_.GetCoroutine(), *this}; }
 
 std::size_t TaskProcessor::GetTaskQueueSize() const {
     return std::visit([](auto&& arg) { return arg.GetSizeApproximate(); }, task_queue_);
 }
 
+std::optional<std::uint64_t> TaskProcessor::GetTaskQueueCrossNodeSteals() const {
+    if (config_.task_processor_queue != TaskQueueType::kNumaWorkStealingTaskQueue) {
+        return std::nullopt;
+    }
+    return std::get<WorkStealingTaskQueue>(task_queue_).GetCrossNodeStealsCount();
+}
+
+std::optional<std::uint64_t> TaskProcessor::GetTaskQueueExpiredDrops() const {
+    if (config_.task_processor_queue != TaskQueueType::kEdfTaskQueue) {
+        return std::nullopt;
+    }
+    return std::get<EdfTaskQueue>(task_queue_).GetExpiredDropsCount();
+}
+
 void TaskProcessor::SetSettings(const TaskProcessorSettings& settings) {
     sensor_task_queue_wait_time_ = settings.sensor_wait_queue_time_limit;
 
@@ -286,18 +304,18 @@ void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
 
     std::visit([index](auto& obj) { obj.PrepareWorker(index); }, task_queue_);
 
-    pools_->GetCoroPool().PrepareLocalCache();
+    coro_pool_.PrepareLocalCache();
 
     utils::SetCurrentThreadName(fmt::format("{}_{}", config_.thread_name, index));
 
     impl::SetLocalTaskCounterData(task_counter_, index);
 
-    pools_->GetCoroPool().RegisterThread();
+    coro_pool_.RegisterThread();
 
     TaskProcessorThreadStartedHook();
 }
 
-void TaskProcessor::FinalizeWorkerThread() noexcept { pools_->GetCoroPool().ClearLocalCache(); }
+void TaskProcessor::FinalizeWorkerThread() noexcept { coro_pool_.ClearLocalCache(); }
 
 void TaskProcessor::ProcessTasks() noexcept {
     while (true) {
@@ -315,7 +333,7 @@ void TaskProcessor::ProcessTasks() noexcept {
             has_failed = true;
         }
 
-        pools_->GetCoroPool().AccountStackUsage();
+        coro_pool_.AccountStackUsage();
 
         if (has_failed || context->IsFinished()) {
             context->FinishDetached();
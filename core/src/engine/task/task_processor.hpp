@@ -4,12 +4,14 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <variant>
 #include <vector>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
+#include <engine/task/edf_task_queue.hpp>
 #include <engine/task/task_counter.hpp>
 #include <engine/task/task_processor_config.hpp>
 #include <engine/task/task_queue.hpp>
@@ -33,6 +35,10 @@ namespace ev {
 class ThreadPool;
 }  // namespace ev
 
+namespace coro {
+class Pool;
+}  // namespace coro
+
 class TaskProcessor final {
 public:
     TaskProcessor(TaskProcessorConfig, std::shared_ptr<impl::TaskProcessorPools>);
@@ -50,6 +56,9 @@ public:
 
     std::shared_ptr<impl::TaskProcessorPools> GetTaskProcessorPools() { return pools_; }
 
+    // Pool of the configured stack size class
+    coro::Pool& GetCoroPool() noexcept { return coro_pool_; }
+
     const std::string& Name() const { return config_.name; }
 
     impl::TaskCounter& GetTaskCounter() noexcept { return task_counter_; }
@@ -58,6 +67,12 @@ public:
 
     std::size_t GetTaskQueueSize() const;
 
+    // Returns std::nullopt if the task queue is not NUMA-aware
+    std::optional<std::uint64_t> GetTaskQueueCrossNodeSteals() const;
+
+    // Returns std::nullopt if the task queue is not deadline-aware
+    std::optional<std::uint64_t> GetTaskQueueExpiredDrops() const;
+
     std::size_t GetWorkerCount() const { return workers_.size(); }
 
     void SetSettings(const TaskProcessorSettings& settings);
@@ -107,11 +122,12 @@ private:
     concurrent::impl::InterferenceShield<impl::DetachedTasksSyncBlock> detached_contexts_{
         impl::DetachedTasksSyncBlock::StopMode::kCancel};
     concurrent::impl::InterferenceShield<OverloadedCache> overloaded_cache_;
-    std::variant<TaskQueue, WorkStealingTaskQueue> task_queue_;
+    std::variant<TaskQueue, WorkStealingTaskQueue, EdfTaskQueue> task_queue_;
     impl::TaskCounter task_counter_;
 
     const TaskProcessorConfig config_;
     const std::shared_ptr<impl::TaskProcessorPools> pools_;
+    coro::Pool& coro_pool_;
     std::vector<std::thread> workers_;
     logging::LoggerPtr task_trace_logger_{nullptr};
 
@@ -49,7 +49,9 @@ TaskQueueType Parse(const yaml_config::YamlConfig& value, formats::parse::To<Tas
     static constexpr utils::TrivialBiMap kMap([](auto selector) {
         return selector()
             .Case(TaskQueueType::kGlobalTaskQueue, "global-task-queue")
-            .Case(TaskQueueType::kWorkStealingTaskQueue, "work-stealing-task-queue");
+            .Case(TaskQueueType::kWorkStealingTaskQueue, "work-stealing-task-queue")
+            .Case(TaskQueueType::kNumaWorkStealingTaskQueue, "numa-work-stealing-task-queue")
+            .Case(TaskQueueType::kEdfTaskQueue, "edf-task-queue");
     });
 
     return utils::ParseFromValueString(value, kMap);
@@ -63,6 +65,8 @@ TaskProcessorConfig Parse(const yaml_config::YamlConfig& value, formats::parse::
     config.os_scheduling = value["os-scheduling"].As<OsScheduling>(config.os_scheduling);
     config.spinning_iterations = value["spinning-iterations"].As<int>(config.spinning_iterations);
     config.task_processor_queue = value["task-processor-queue"].As<TaskQueueType>(config.task_processor_queue);
+    config.coro_stack_size_class =
+        value["coro-stack-size-class"].As<coro::StackSizeClass>(config.coro_stack_size_class);
 
     const auto task_trace = value["task-trace"];
     if (!task_trace.IsMissing()) {
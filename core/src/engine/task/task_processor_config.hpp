@@ -8,6 +8,8 @@
 #include <userver/formats/json_fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
 
+#include <engine/coro/pool_config.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine {
@@ -18,7 +20,7 @@ enum class OsScheduling {
     kIdle,
 };
 
-enum class TaskQueueType { kGlobalTaskQueue, kWorkStealingTaskQueue };
+enum class TaskQueueType { kGlobalTaskQueue, kWorkStealingTaskQueue, kNumaWorkStealingTaskQueue, kEdfTaskQueue };
 
 OsScheduling Parse(const yaml_config::YamlConfig& value, formats::parse::To<OsScheduling>);
 
@@ -33,6 +35,7 @@ struct TaskProcessorConfig {
     OsScheduling os_scheduling{OsScheduling::kNormal};
     int spinning_iterations{1000};
     TaskQueueType task_processor_queue{TaskQueueType::kGlobalTaskQueue};
+    coro::StackSizeClass coro_stack_size_class{coro::StackSizeClass::kDefault};
 
     std::size_t task_trace_every{1000};
     std::size_t task_trace_max_csw{0};
@@ -1,5 +1,6 @@
 #include <engine/task/task_processor_pools.hpp>
 
+#include <stdexcept>
 #include <utility>
 
 #include <engine/task/task_context.hpp>
@@ -10,8 +11,17 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
-TaskProcessorPools::TaskProcessorPools(coro::PoolConfig coro_pool_config, ev::ThreadPoolConfig ev_pool_config)
+TaskProcessorPools::TaskProcessorPools(
+    coro::PoolConfig coro_pool_config,
+    std::optional<coro::PoolConfig> small_stack_coro_pool_config,
+    ev::ThreadPoolConfig ev_pool_config
+)
     : coro_pool_(std::move(coro_pool_config), &TaskContext::CoroFunc),
+      small_stack_coro_pool_(
+          small_stack_coro_pool_config
+              ? std::make_unique<CoroPool>(std::move(*small_stack_coro_pool_config), &TaskContext::CoroFunc)
+              : nullptr
+      ),
       event_thread_pool_(std::move(ev_pool_config), ev::ThreadPool::kUseDefaultEvLoop) {
     const bool old_value = std::exchange(logging::impl::has_background_threads_which_can_log, true);
     UASSERT_MSG(
@@ -26,6 +36,22 @@ TaskProcessorPools::~TaskProcessorPools() {
     UASSERT(old_value);
 }
 
+TaskProcessorPools::CoroPool& TaskProcessorPools::GetCoroPool(coro::StackSizeClass stack_size_class) {
+    switch (stack_size_class) {
+        case coro::StackSizeClass::kDefault:
+            return coro_pool_;
+        case coro::StackSizeClass::kSmall:
+            if (!small_stack_coro_pool_) {
+                throw std::runtime_error(
+                    "Small stack size class of coroutines is requested, but "
+                    "'small_stack_coro_pool' is not configured"
+                );
+            }
+            return *small_stack_coro_pool_;
+    }
+    UINVARIANT(false, "Unexpected value of StackSizeClass enum");
+}
+
 }  // namespace engine::impl
 
 USERVER_NAMESPACE_END
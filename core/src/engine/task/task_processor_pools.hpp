@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+#include <optional>
+
 #include <engine/coro/pool.hpp>
 #include <engine/ev/thread_pool.hpp>
 
@@ -13,15 +16,24 @@ class TaskProcessorPools final {
 public:
     using CoroPool = coro::Pool;
 
-    TaskProcessorPools(coro::PoolConfig coro_pool_config, ev::ThreadPoolConfig ev_pool_config);
+    TaskProcessorPools(
+        coro::PoolConfig coro_pool_config,
+        std::optional<coro::PoolConfig> small_stack_coro_pool_config,
+        ev::ThreadPoolConfig ev_pool_config
+    );
 
     ~TaskProcessorPools();
 
     CoroPool& GetCoroPool() { return coro_pool_; }
+    // Throws if the requested stack size class is not configured
+    CoroPool& GetCoroPool(coro::StackSizeClass stack_size_class);
+    // Returns nullptr if the small stack size class is not configured
+    CoroPool* GetSmallStackCoroPool() { return small_stack_coro_pool_.get(); }
     ev::ThreadPool& EventThreadPool() { return event_thread_pool_; }
 
 private:
     CoroPool coro_pool_;
+    std::unique_ptr<CoroPool> small_stack_coro_pool_;
     ev::ThreadPool event_thread_pool_;
 };
 
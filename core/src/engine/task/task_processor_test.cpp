@@ -1,15 +1,47 @@
 #include <engine/task/task_processor.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include <engine/task/task_context.hpp>
 #include <engine/task/task_processor_config.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task_base.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/utest/utest.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace {
+
+engine::TaskProcessor MakeEdfTaskProcessor() {
+    engine::TaskProcessorConfig config;
+    config.name = "edf";
+    config.thread_name = "edf";
+    config.worker_threads = 1;
+    config.task_processor_queue = engine::TaskQueueType::kEdfTaskQueue;
+    return engine::TaskProcessor(std::move(config), engine::current_task::GetTaskProcessor().GetTaskProcessorPools());
+}
+
+// Occupies the only worker of the task processor until the returned flag is set
+engine::TaskWithResult<void> BlockWorker(engine::TaskProcessor& task_processor, std::atomic<bool>& release) {
+    std::atomic<bool> started{false};
+    auto task = engine::CriticalAsyncNoSpan(task_processor, [&started, &release] {
+        started = true;
+        while (!release) {
+            // busy-wait to keep the worker thread occupied
+        }
+    });
+    while (!started) engine::Yield();
+    return task;
+}
+
+}  // namespace
+
 UTEST(TaskProcessor, Overload) {
     engine::TaskProcessorSettings settings;
     settings.overload_action = engine::TaskProcessorSettings::OverloadAction::kCancel;
@@ -74,4 +106,132 @@ UTEST_MT(TaskProcessor, MetricsAliveAndRunning, 2) {
     EXPECT_EQ(task_counter.GetRunningTasks(), 1);
 }
 
+TEST(TaskProcessor, SmallStackSizeClass) {
+    constexpr std::size_t kSmallStackSize = 64 * 1024;
+    engine::TaskProcessorPoolsConfig pools_config;
+    pools_config.small_coro_stack_size = kSmallStackSize;
+
+    engine::RunStandalone(1, pools_config, [&] {
+        const auto default_stack_size = engine::current_task::GetStackSize();
+        EXPECT_GT(default_stack_size, kSmallStackSize);
+
+        engine::TaskProcessorConfig config;
+        config.name = "small-stack";
+        config.thread_name = "small-stack";
+        config.worker_threads = 2;
+        config.coro_stack_size_class = engine::coro::StackSizeClass::kSmall;
+        engine::TaskProcessor task_processor(
+            std::move(config), engine::current_task::GetTaskProcessor().GetTaskProcessorPools()
+        );
+
+        for (int i = 0; i < 10; ++i) {
+            auto task = engine::AsyncNoSpan(task_processor, [] { return engine::current_task::GetStackSize(); });
+            EXPECT_EQ(task.Get(), kSmallStackSize);
+            auto default_task = engine::AsyncNoSpan([] { return engine::current_task::GetStackSize(); });
+            EXPECT_EQ(default_task.Get(), default_stack_size);
+        }
+    });
+}
+
+TEST(TaskProcessor, SmallStackSizeClassNotConfigured) {
+    engine::RunStandalone([] {
+        engine::TaskProcessorConfig config;
+        config.name = "small-stack";
+        config.thread_name = "small-stack";
+        config.coro_stack_size_class = engine::coro::StackSizeClass::kSmall;
+        EXPECT_THROW(
+            engine::TaskProcessor(std::move(config), engine::current_task::GetTaskProcessor().GetTaskProcessorPools()),
+            std::runtime_error
+        );
+    });
+}
+
+UTEST(TaskProcessor, EdfOrdersByDeadline) {
+    auto task_processor = MakeEdfTaskProcessor();
+    std::atomic<bool> release{false};
+    auto blocker = BlockWorker(task_processor, release);
+
+    auto& current = engine::current_task::GetCurrentTaskContext();
+    std::vector<int> order;
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (const int seconds : {30, 10, 20}) {
+        current.SetSchedulingDeadline(engine::Deadline::FromDuration(std::chrono::seconds{seconds}));
+        tasks.push_back(engine::AsyncNoSpan(task_processor, [&order, seconds] { order.push_back(seconds); }));
+    }
+    current.SetSchedulingDeadline({});
+
+    release = true;
+    blocker.Get();
+    for (auto& task : tasks) task.Get();
+
+    EXPECT_EQ(order, (std::vector<int>{10, 20, 30}));
+    EXPECT_EQ(task_processor.GetTaskQueueExpiredDrops(), 0);
+}
+
+UTEST(TaskProcessor, EdfDoesNotStarveTasksWithoutDeadline) {
+    auto task_processor = MakeEdfTaskProcessor();
+    std::atomic<bool> release{false};
+    auto blocker = BlockWorker(task_processor, release);
+
+    auto& current = engine::current_task::GetCurrentTaskContext();
+    std::vector<int> order;
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (const int id : {-1, -2}) {
+        tasks.push_back(engine::AsyncNoSpan(task_processor, [&order, id] { order.push_back(id); }));
+    }
+    for (int id = 1; id <= 8; ++id) {
+        current.SetSchedulingDeadline(engine::Deadline::FromDuration(std::chrono::seconds{id}));
+        tasks.push_back(engine::AsyncNoSpan(task_processor, [&order, id] { order.push_back(id); }));
+    }
+    current.SetSchedulingDeadline({});
+
+    release = true;
+    blocker.Get();
+    for (auto& task : tasks) task.Get();
+
+    static_assert(engine::EdfTaskQueue::kFifoPopPeriod == 4);
+    EXPECT_EQ(order, (std::vector<int>{1, 2, 3, -1, 4, 5, 6, -2, 7, 8}));
+}
+
+UTEST(TaskProcessor, EdfDropsExpiredTasks) {
+    auto task_processor = MakeEdfTaskProcessor();
+    std::atomic<bool> release{false};
+    auto blocker = BlockWorker(task_processor, release);
+
+    auto& current = engine::current_task::GetCurrentTaskContext();
+    current.SetSchedulingDeadline(engine::Deadline::FromDuration(std::chrono::milliseconds{1}));
+    bool expired_task_started = false;
+    auto expired = engine::AsyncNoSpan(task_processor, [&] { expired_task_started = true; });
+    auto critical = engine::CriticalAsyncNoSpan(task_processor, [] {});
+    current.SetSchedulingDeadline({});
+    auto fresh = engine::AsyncNoSpan(task_processor, [] {});
+
+    engine::SleepFor(std::chrono::milliseconds{10});
+    release = true;
+    blocker.Get();
+
+    expired.Wait();
+    EXPECT_EQ(expired.GetState(), engine::Task::State::kCancelled);
+    EXPECT_FALSE(expired_task_started);
+    EXPECT_NO_THROW(critical.Get());
+    EXPECT_NO_THROW(fresh.Get());
+    EXPECT_EQ(task_processor.GetTaskQueueExpiredDrops(), 1);
+}
+
+UTEST(TaskProcessor, EdfDoesNotDropResumedTasks) {
+    auto task_processor = MakeEdfTaskProcessor();
+
+    auto& current = engine::current_task::GetCurrentTaskContext();
+    current.SetSchedulingDeadline(engine::Deadline::FromDuration(std::chrono::milliseconds{10}));
+    // The task starts before its deadline and is resumed after it
+    auto task = engine::AsyncNoSpan(task_processor, [] {
+        engine::SleepFor(std::chrono::milliseconds{50});
+        return engine::current_task::ShouldCancel();
+    });
+    current.SetSchedulingDeadline({});
+
+    EXPECT_FALSE(task.Get());
+    EXPECT_EQ(task_processor.GetTaskQueueExpiredDrops(), 0);
+}
+
 USERVER_NAMESPACE_END
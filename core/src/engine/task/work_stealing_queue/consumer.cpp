@@ -41,15 +41,27 @@ constexpr std::size_t kFrequencyGlobalQueuePop = 61;
 // frequency of visits to the background
 // queue in stealing process
 constexpr std::size_t kFrequencyStealingBackgroundQueuePop = 10;
+// frequency of stealing from other NUMA nodes,
+// same-node victims are tried on every attempt
+constexpr std::size_t kFrequencyStealingFromAnotherNode = 4;
 }  // namespace
 
-Consumer::Consumer(WorkStealingTaskQueue& owner, ConsumersManager& consumers_manager)
+Consumer::Consumer(WorkStealingTaskQueue& owner, ConsumersManager& consumers_manager, std::size_t index)
     : owner_(owner),
       consumers_manager_(consumers_manager),
       steal_attempts_count_(std::max<std::size_t>(3, kDefaultStealSpins / owner.consumers_count_)),
+      inner_index_(index),
+      node_(owner.GetNodeOf(index)),
+      node_consumers_begin_(owner.GetNodeConsumersBegin(node_)),
+      node_consumers_count_(owner.GetNodeConsumersCount(node_)),
       rnd_(utils::Rand()),
       steps_count_(rnd_()),
-      global_queue_token_(owner_.global_queue_.CreateConsumerToken()),
+      global_queue_(owner.global_queues_[node_]),
+      global_queue_tokens_(utils::GenerateFixedArray(
+          owner.nodes_count_,
+          [&owner](std::size_t node) { return owner.global_queues_[node].CreateConsumerToken(); }
+      )),
+      global_queue_token_(global_queue_tokens_[node_]),
       background_queue_token_(owner.background_queue_.CreateConsumerToken()) {}
 
 void Consumer::Push(impl::TaskContext* ctx) {
@@ -79,7 +91,9 @@ std::size_t Consumer::GetLocalQueueSize() const noexcept {
 
 WorkStealingTaskQueue* Consumer::GetOwner() const noexcept { return &owner_; }
 
-void Consumer::SetIndex(std::size_t index) noexcept { inner_index_ = index; }
+std::uint64_t Consumer::GetCrossNodeStealsCount() const noexcept {
+    return cross_node_steals_.load(std::memory_order_relaxed);
+}
 
 bool Consumer::IsStopped() const noexcept { return consumers_manager_.IsStopped(); }
 
@@ -94,7 +108,7 @@ void Consumer::EmptySurplusQueue(impl::TaskContext* extra) {
 
     // Second, we push the remaining tasks to the global queue
     if (pushed_shift < free_tasks_count) {
-        owner_.global_queue_.PushBulk(
+        global_queue_.PushBulk(
             global_queue_token_, utils::span(steal_buffer_.data() + pushed_shift, free_tasks_count - pushed_shift)
         );
     }
@@ -104,28 +118,24 @@ impl::TaskContext*
 Consumer::StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std::size_t to_steal_count) {
     std::size_t stealed_size = 0;
     for (std::size_t i = 0; i < attempts && to_steal_count > 0 && stealed_size == 0; ++i) {
-        std::size_t start_index = rnd_() % owner_.consumers_count_;
-        for (std::size_t shift = 0; shift < owner_.consumers_count_ && to_steal_count > 0 && stealed_size == 0;
-             ++shift) {
-            std::size_t index = (start_index + shift) % owner_.consumers_count_;
-            Consumer* victim = &owner_.consumers_[index];
-            if (victim == this) {
-                continue;
-            }
-            const std::size_t tasks_count =
-                victim->Steal(utils::span(steal_buffer_.data() + stealed_size, to_steal_count));
-            stealed_size += tasks_count;
-            to_steal_count -= tasks_count;
-        }
+        stealed_size = StealFromConsumers(node_consumers_begin_, node_consumers_count_, to_steal_count);
+        to_steal_count -= stealed_size;
 
         if (stealed_size == 0) {
-            impl::TaskContext* ctx = owner_.global_queue_.TryPop(global_queue_token_);
+            impl::TaskContext* ctx = global_queue_.TryPop(global_queue_token_);
             if (ctx) {
                 steal_buffer_[stealed_size++] = ctx;
                 to_steal_count--;
             }
         }
 
+        const bool is_last_attempt = i + 1 == attempts;
+        if (stealed_size == 0 && owner_.nodes_count_ > 1 &&
+            (is_last_attempt || i % kFrequencyStealingFromAnotherNode == kFrequencyStealingFromAnotherNode - 1)) {
+            stealed_size = StealFromAnotherNode(to_steal_count);
+            to_steal_count -= stealed_size;
+        }
+
         if (stealed_size == 0 && i % kFrequencyStealingBackgroundQueuePop == 0) {
             impl::TaskContext* ctx = owner_.background_queue_.TryPop(background_queue_token_);
             if (ctx) {
@@ -144,6 +154,42 @@ Consumer::StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std:
     return nullptr;
 }
 
+std::size_t Consumer::StealFromConsumers(std::size_t begin, std::size_t count, std::size_t to_steal_count) {
+    std::size_t stealed_size = 0;
+    const std::size_t start_index = rnd_() % count;
+    for (std::size_t shift = 0; shift < count && stealed_size == 0; ++shift) {
+        const std::size_t index = (begin + (start_index + shift) % count) % owner_.consumers_count_;
+        Consumer* victim = &owner_.consumers_[index];
+        if (victim == this) {
+            continue;
+        }
+        stealed_size = victim->Steal(utils::span(steal_buffer_.data(), to_steal_count));
+    }
+    return stealed_size;
+}
+
+std::size_t Consumer::StealFromAnotherNode(std::size_t to_steal_count) {
+    // Consumers of other nodes form a contiguous (modulo consumers_count_) range
+    // right after the consumers of this node
+    std::size_t stealed_size = StealFromConsumers(
+        node_consumers_begin_ + node_consumers_count_, owner_.consumers_count_ - node_consumers_count_, to_steal_count
+    );
+
+    for (std::size_t shift = 1; shift < owner_.nodes_count_ && stealed_size == 0; ++shift) {
+        const std::size_t node = (node_ + shift) % owner_.nodes_count_;
+        impl::TaskContext* ctx = owner_.global_queues_[node].TryPop(global_queue_tokens_[node]);
+        if (ctx) {
+            steal_buffer_[stealed_size++] = ctx;
+        }
+    }
+
+    // Only this consumer modifies the counter
+    cross_node_steals_.store(
+        cross_node_steals_.load(std::memory_order_relaxed) + stealed_size, std::memory_order_relaxed
+    );
+    return stealed_size;
+}
+
 std::size_t Consumer::Steal(utils::span<impl::TaskContext*> buffer) {
     std::size_t can_be_stealed_count = local_queue_.GetSize();
     if (can_be_stealed_count) {
@@ -165,13 +211,13 @@ std::size_t Consumer::Steal(utils::span<impl::TaskContext*> buffer) {
 }
 
 impl::TaskContext* Consumer::TryPopFromOwnerQueue(const bool is_global) {
-    GlobalQueue* queue = &owner_.global_queue_;
+    GlobalQueue* queue = &global_queue_;
     GlobalQueue::Token* token = &global_queue_token_;
     if (!is_global) {
         queue = &owner_.background_queue_;
         token = &background_queue_token_;
     }
-    const std::size_t consumers_count = owner_.consumers_count_;
+    const std::size_t consumers_count = is_global ? node_consumers_count_ : owner_.consumers_count_;
     std::size_t steal_size =
         std::min((queue->GetSizeApproximateDelayed() + consumers_count) / consumers_count, kConsumerStealBufferSize);
     steal_size = queue->PopBulk(*token, utils::span(steal_buffer_.data(), steal_size));
@@ -190,7 +236,7 @@ impl::TaskContext* Consumer::TryPopFromOwnerQueue(const bool is_global) {
 impl::TaskContext* Consumer::ProbabilisticPopFromOwnerQueues() {
     impl::TaskContext* context = nullptr;
     if (steps_count_ % kFrequencyGlobalQueuePop == 0) {
-        context = owner_.global_queue_.TryPop(global_queue_token_);
+        context = global_queue_.TryPop(global_queue_token_);
         if (context) {
             return context;
         }
@@ -1,10 +1,14 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <random>
 
+#include <userver/utils/fixed_array.hpp>
+
 #include <engine/task/work_stealing_queue/global_queue.hpp>
 #include <engine/task/work_stealing_queue/local_queue.hpp>
 
@@ -21,7 +25,7 @@ class ConsumersManager;
 
 class Consumer final {
 public:
-    Consumer(WorkStealingTaskQueue& owner, ConsumersManager& consumers_manager);
+    Consumer(WorkStealingTaskQueue& owner, ConsumersManager& consumers_manager, std::size_t index);
 
     void Push(impl::TaskContext* ctx);
 
@@ -31,18 +35,22 @@ public:
 
     WorkStealingTaskQueue* GetOwner() const noexcept;
 
+    std::uint64_t GetCrossNodeStealsCount() const noexcept;
+
 private:
     friend ConsumersManager;
     friend WorkStealingTaskQueue;
 
-    void SetIndex(std::size_t index) noexcept;
-
     bool IsStopped() const noexcept;
 
     void EmptySurplusQueue(impl::TaskContext* extra);
 
     impl::TaskContext* StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std::size_t to_steal);
 
+    std::size_t StealFromConsumers(std::size_t begin, std::size_t count, std::size_t to_steal_count);
+
+    std::size_t StealFromAnotherNode(std::size_t to_steal_count);
+
     std::size_t Steal(utils::span<impl::TaskContext*> buffer);
 
     impl::TaskContext* TryPopFromOwnerQueue(const bool is_global);
@@ -72,13 +80,21 @@ private:
     WorkStealingTaskQueue& owner_;
     ConsumersManager& consumers_manager_;
     const std::size_t steal_attempts_count_;
-    std::size_t inner_index_{0};
+    const std::size_t inner_index_;
+    const std::size_t node_;
+    const std::size_t node_consumers_begin_;
+    const std::size_t node_consumers_count_;
     // kConsumerStealBufferSize + 1 for extra task in push
     std::array<impl::TaskContext*, kConsumerStealBufferSize + 1> steal_buffer_{};
     std::minstd_rand rnd_;
     std::size_t steps_count_{0};
     std::atomic<std::int32_t> sleep_counter_{0};
-    GlobalQueue::Token global_queue_token_;
+    std::atomic<std::uint64_t> cross_node_steals_{0};
+    // Global queue of the consumer's node
+    GlobalQueue& global_queue_;
+    // One token per node
+    utils::FixedArray<GlobalQueue::Token> global_queue_tokens_;
+    GlobalQueue::Token& global_queue_token_;
     GlobalQueue::Token background_queue_token_;
 #ifndef __linux__
     std::condition_variable cv_;
@@ -0,0 +1,110 @@
+#include <engine/task/work_stealing_queue/numa_topology.hpp>
+
+#include <stdexcept>
+#include <string>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include <fmt/format.h>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+constexpr std::string_view kSysNodePath = "/sys/devices/system/node";
+
+std::vector<int> ReadCpuList(const std::string& path) {
+    return ParseCpuList(utils::text::Trim(fs::blocking::ReadFileContents(path)));
+}
+
+bool IsCpuAllowed([[maybe_unused]] int cpu) {
+#ifdef __linux__
+    static const auto kAllowedCpus = [] {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        if (sched_getaffinity(0, sizeof(cpus), &cpus) != 0) {
+            CPU_ZERO(&cpus);
+        }
+        return cpus;
+    }();
+    return cpu < CPU_SETSIZE && CPU_ISSET(cpu, &kAllowedCpus);
+#else
+    return true;
+#endif
+}
+
+NumaTopology ReadNumaTopology() {
+    NumaTopology topology;
+
+    const auto online_nodes_path = fmt::format("{}/online", kSysNodePath);
+    if (!fs::blocking::FileExists(online_nodes_path)) {
+        return topology;
+    }
+
+    for (const auto node : ReadCpuList(online_nodes_path)) {
+        std::vector<int> cpus;
+        for (const auto cpu : ReadCpuList(fmt::format("{}/node{}/cpulist", kSysNodePath, node))) {
+            if (IsCpuAllowed(cpu)) {
+                cpus.push_back(cpu);
+            }
+        }
+        if (!cpus.empty()) {
+            topology.node_cpus.push_back(std::move(cpus));
+        }
+    }
+
+    return topology;
+}
+
+}  // namespace
+
+std::vector<int> ParseCpuList(std::string_view cpu_list) {
+    std::vector<int> result;
+    if (cpu_list.empty()) {
+        return result;
+    }
+
+    for (const auto range : utils::text::SplitIntoStringViewVector(cpu_list, ",")) {
+        const auto dash_pos = range.find('-');
+        if (dash_pos == std::string_view::npos) {
+            result.push_back(utils::FromString<int>(range));
+            continue;
+        }
+
+        const auto first = utils::FromString<int>(range.substr(0, dash_pos));
+        const auto last = utils::FromString<int>(range.substr(dash_pos + 1));
+        if (first > last) {
+            throw std::runtime_error(fmt::format("Invalid CPU range '{}'", range));
+        }
+        for (int cpu = first; cpu <= last; ++cpu) {
+            result.push_back(cpu);
+        }
+    }
+
+    return result;
+}
+
+const NumaTopology& GetNumaTopology() {
+    static const NumaTopology kTopology = [] {
+        try {
+            return ReadNumaTopology();
+        } catch (const std::exception& ex) {
+            LOG_WARNING() << "Failed to read NUMA topology, NUMA awareness is disabled: " << ex;
+            return NumaTopology{};
+        }
+    }();
+    return kTopology;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+struct NumaTopology final {
+    // CPUs available to the process, grouped by NUMA node. Nodes without
+    // available CPUs are omitted.
+    std::vector<std::vector<int>> node_cpus;
+};
+
+// Parses a list in the Linux sysfs cpulist format, e.g. "0-3,8,10-11"
+std::vector<int> ParseCpuList(std::string_view cpu_list);
+
+// Reads the topology from sysfs once per process. Returns an empty topology
+// if it is not available.
+const NumaTopology& GetNumaTopology();
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
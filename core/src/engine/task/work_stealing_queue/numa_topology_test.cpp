@@ -0,0 +1,27 @@
+#include <engine/task/work_stealing_queue/numa_topology.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(NumaTopology, ParseCpuList) {
+    EXPECT_THAT(engine::ParseCpuList(""), testing::IsEmpty());
+    EXPECT_THAT(engine::ParseCpuList("0"), testing::ElementsAre(0));
+    EXPECT_THAT(engine::ParseCpuList("0-3"), testing::ElementsAre(0, 1, 2, 3));
+    EXPECT_THAT(engine::ParseCpuList("0-1,8,10-11"), testing::ElementsAre(0, 1, 8, 10, 11));
+}
+
+TEST(NumaTopology, ParseCpuListInvalid) {
+    EXPECT_ANY_THROW(engine::ParseCpuList("a"));
+    EXPECT_ANY_THROW(engine::ParseCpuList("3-1"));
+    EXPECT_ANY_THROW(engine::ParseCpuList("1-"));
+}
+
+TEST(NumaTopology, Current) {
+    for (const auto& cpus : engine::GetNumaTopology().node_cpus) {
+        EXPECT_FALSE(cpus.empty());
+    }
+}
+
+USERVER_NAMESPACE_END
@@ -1,9 +1,18 @@
 #include <engine/task/work_stealing_queue/task_queue.hpp>
 
+#include <algorithm>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/rand.hpp>
 
 #include <engine/task/task_context.hpp>
+#include <engine/task/work_stealing_queue/numa_topology.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -13,18 +22,54 @@ namespace {
 // It is only used in worker threads outside of any coroutine,
 // so it does not need to be protected via compiler::ThreadLocal
 thread_local Consumer* localConsumer = nullptr;
+
+std::vector<std::vector<int>> GetNodesCpus(const TaskProcessorConfig& config) {
+    if (config.task_processor_queue != TaskQueueType::kNumaWorkStealingTaskQueue) {
+        return {};
+    }
+
+    auto nodes_cpus = GetNumaTopology().node_cpus;
+    if (nodes_cpus.size() <= 1) {
+        // Nothing to be aware of
+        return {};
+    }
+    // Every node must have at least one consumer
+    if (nodes_cpus.size() > config.worker_threads) {
+        nodes_cpus.resize(config.worker_threads);
+    }
+    return nodes_cpus;
+}
+
+void PinCurrentThread([[maybe_unused]] const std::vector<int>& cpus) {
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (const auto cpu : cpus) {
+        CPU_SET(cpu, &cpu_set);
+    }
+    const auto res = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (res != 0) {
+        LOG_WARNING() << "Failed to pin a worker thread to the CPUs of its NUMA node, error code: " << res;
+    }
+#endif
+}
+
 }  // namespace
 
 WorkStealingTaskQueue::WorkStealingTaskQueue(const TaskProcessorConfig& config)
     : consumers_count_(config.worker_threads),
-      global_queue_(consumers_count_),
+      nodes_cpus_(GetNodesCpus(config)),
+      nodes_count_(std::max<std::size_t>(nodes_cpus_.size(), 1)),
+      global_queues_(utils::GenerateFixedArray(
+          nodes_count_,
+          [this](std::size_t node) { return GlobalQueue{GetNodeConsumersCount(node)}; }
+      )),
       background_queue_(consumers_count_),
-      consumers_(config.worker_threads, *this, consumers_manager_),
-      consumers_manager_(consumers_count_) {
-    for (size_t i = 0; i < consumers_count_; ++i) {
-        consumers_[i].SetIndex(i);
-    }
-}
+      consumers_(utils::GenerateFixedArray(
+          consumers_count_,
+          [this](std::size_t index) { return Consumer{*this, consumers_manager_, index}; }
+      )),
+      consumers_manager_(consumers_count_) {}
 
 void WorkStealingTaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
     DoPush(context.get());
@@ -49,14 +94,27 @@ std::size_t WorkStealingTaskQueue::GetSizeApproximate() const noexcept {
     for (const auto& consumer : consumers_) {
         size += consumer.GetLocalQueueSize();
     }
-    size += global_queue_.GetSizeApproximate();
+    for (const auto& global_queue : global_queues_) {
+        size += global_queue.GetSizeApproximate();
+    }
     size += background_queue_.GetSizeApproximate();
     return size;
 }
 
+std::uint64_t WorkStealingTaskQueue::GetCrossNodeStealsCount() const noexcept {
+    std::uint64_t count{0};
+    for (const auto& consumer : consumers_) {
+        count += consumer.GetCrossNodeStealsCount();
+    }
+    return count;
+}
+
 void WorkStealingTaskQueue::PrepareWorker(std::size_t index) {
     if (index < consumers_count_) {
         localConsumer = &consumers_[index];
+        if (!nodes_cpus_.empty()) {
+            PinCurrentThread(nodes_cpus_[GetNodeOf(index)]);
+        }
     }
 }
 
@@ -69,7 +127,7 @@ void WorkStealingTaskQueue::DoPush(impl::TaskContext* context) {
         } else if (context && context->IsBackground()) {
             background_queue_.Push(context);
         } else {
-            global_queue_.Push(context);
+            GetGlobalQueueForPush().Push(context);
         }
     }
     consumers_manager_.NotifyNewTask();
@@ -81,8 +139,27 @@ impl::TaskContext* WorkStealingTaskQueue::DoPopBlocking() {
     return consumer->PopBlocking();
 }
 
+GlobalQueue& WorkStealingTaskQueue::GetGlobalQueueForPush() {
+    if (nodes_count_ == 1) {
+        return global_queues_[0];
+    }
+    return global_queues_[utils::RandRange(nodes_count_)];
+}
+
 Consumer* WorkStealingTaskQueue::GetConsumer() { return localConsumer; }
 
+std::size_t WorkStealingTaskQueue::GetNodeOf(std::size_t consumer_index) const noexcept {
+    return consumer_index * nodes_count_ / consumers_count_;
+}
+
+std::size_t WorkStealingTaskQueue::GetNodeConsumersBegin(std::size_t node) const noexcept {
+    return (node * consumers_count_ + nodes_count_ - 1) / nodes_count_;
+}
+
+std::size_t WorkStealingTaskQueue::GetNodeConsumersCount(std::size_t node) const noexcept {
+    return GetNodeConsumersBegin(node + 1) - GetNodeConsumersBegin(node);
+}
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
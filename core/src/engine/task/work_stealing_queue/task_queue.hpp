@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <vector>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
@@ -31,18 +33,34 @@ public:
 
     std::size_t GetSizeApproximate() const noexcept;
 
+    // Number of tasks stolen by workers from consumers and global queues of
+    // other NUMA nodes
+    std::uint64_t GetCrossNodeStealsCount() const noexcept;
+
     void PrepareWorker(std::size_t index);
 
 private:
     void DoPush(impl::TaskContext* context);
 
+    GlobalQueue& GetGlobalQueueForPush();
+
+    std::size_t GetNodeOf(std::size_t consumer_index) const noexcept;
+
+    std::size_t GetNodeConsumersBegin(std::size_t node) const noexcept;
+
+    std::size_t GetNodeConsumersCount(std::size_t node) const noexcept;
+
     impl::TaskContext* DoPopBlocking();
 
     Consumer* GetConsumer();
 
     const std::size_t consumers_count_;
+    // CPUs of each node for pinning the workers, empty if the queue is not
+    // NUMA-aware. Consumers are split into contiguous per-node ranges.
+    const std::vector<std::vector<int>> nodes_cpus_;
+    const std::size_t nodes_count_;
 
-    GlobalQueue global_queue_;
+    utils::FixedArray<GlobalQueue> global_queues_;
     GlobalQueue background_queue_;
     utils::FixedArray<Consumer> consumers_;
     ConsumersManager consumers_manager_;
@@ -2,6 +2,9 @@
 
 #include <boost/filesystem.hpp>
 
+#include <compression/gzip.hpp>
+#include <userver/compression/zstd.hpp>
+#include <userver/crypto/hash.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/utils/async.hpp>
@@ -12,6 +15,33 @@ namespace fs {
 
 namespace {
 
+// Compressing smaller files does not pay off
+constexpr std::size_t kMinSizeToPrecompress = 256;
+// Files are compressed once and served many times, so spend more CPU
+constexpr int kGzipLevel = 9;
+constexpr int kZstdLevel = 15;
+
+std::string KeepIfSmaller(std::string compressed, std::size_t original_size) {
+    if (compressed.size() >= original_size) return {};
+    return compressed;
+}
+
+// Hashing and compression are CPU heavy for large files, so they are done on
+// the fs task processor together with the read
+FileInfoWithData ReadFileInfoWithDataBlocking(const std::string& path, utils::Flags<SettingsReadFile> flags) {
+    FileInfoWithData info{};
+    info.extension = boost::filesystem::path(path).extension().string();
+    info.data = fs::blocking::ReadFileContents(path);
+    info.last_modified = std::chrono::system_clock::from_time_t(boost::filesystem::last_write_time(path));
+    info.etag = '"' + crypto::hash::Blake2b128(info.data) + '"';
+
+    if ((flags & SettingsReadFile::kPrecompress) && info.data.size() >= kMinSizeToPrecompress) {
+        info.gzip_data = KeepIfSmaller(compression::gzip::Compress(info.data, kGzipLevel), info.data.size());
+        info.zstd_data = KeepIfSmaller(compression::zstd::Compress(info.data, kZstdLevel), info.data.size());
+    }
+    return info;
+}
+
 bool IsHiddenFile(const boost::filesystem::path& path) {
     auto name = path.filename().native();
     UASSERT(!name.empty());
@@ -27,6 +57,13 @@ std::string GetLexicallyRelative(std::string_view path, std::string_view dir) {
     return std::string{rel};
 }
 
+FileInfoWithDataConstPtr
+ReadFileInfoWithData(engine::TaskProcessor& async_tp, const std::string& path, utils::Flags<SettingsReadFile> flags) {
+    return std::make_shared<const FileInfoWithData>(
+        engine::AsyncNoSpan(async_tp, &ReadFileInfoWithDataBlocking, path, flags).Get()
+    );
+}
+
 std::string ReadFileContents(engine::TaskProcessor& async_tp, const std::string& path) {
     return engine::AsyncNoSpan(async_tp, &fs::blocking::ReadFileContents, path).Get();
 }
@@ -45,11 +82,8 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
         // only files
         if (it->status().type() != boost::filesystem::regular_file) continue;
         if ((flags & SettingsReadFile::kSkipHidden) && IsHiddenFile(it->path())) continue;
-        FileInfoWithData info{};
-        info.extension = it->path().extension().string();
-        info.data = ReadFileContents(async_tp, it->path().string());
         data[GetLexicallyRelative(it->path().string(), path)] =
-            std::make_shared<const FileInfoWithData>(std::move(info));
+            ReadFileInfoWithData(async_tp, it->path().string(), flags);
     }
     return data;
 }
@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <compression/gzip.hpp>
+#include <userver/compression/zstd.hpp>
+#include <userver/engine/task/current_task.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/fs/read.hpp>
+#include <userver/utest/utest.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -9,4 +15,42 @@ TEST(Fs, GetLexicallyRelative) {
     EXPECT_EQ(fs::GetLexicallyRelative("/path/to/file", "/path"), "/to/file");
 }
 
+UTEST(Fs, ReadFileInfoWithData) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file.txt";
+    fs::blocking::RewriteFileContents(path, "data");
+
+    auto& tp = engine::current_task::GetTaskProcessor();
+    const auto info = fs::ReadFileInfoWithData(tp, path, {fs::SettingsReadFile::kPrecompress});
+    EXPECT_EQ(info->data, "data");
+    EXPECT_EQ(info->extension, ".txt");
+    EXPECT_EQ(info->etag.front(), '"');
+    EXPECT_EQ(info->etag.back(), '"');
+    EXPECT_NE(info->last_modified, std::chrono::system_clock::time_point{});
+    // too small to compress
+    EXPECT_TRUE(info->gzip_data.empty());
+    EXPECT_TRUE(info->zstd_data.empty());
+
+    fs::blocking::RewriteFileContents(path, "other");
+    EXPECT_NE(fs::ReadFileInfoWithData(tp, path, {})->etag, info->etag);
+}
+
+UTEST(Fs, ReadFileInfoWithDataPrecompressed) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file.js";
+    const std::string data(4096, 'a');
+    fs::blocking::RewriteFileContents(path, data);
+
+    auto& tp = engine::current_task::GetTaskProcessor();
+    const auto info = fs::ReadFileInfoWithData(tp, path, {fs::SettingsReadFile::kPrecompress});
+    EXPECT_EQ(info->data, data);
+    EXPECT_EQ(compression::gzip::Decompress(info->gzip_data, data.size()), data);
+    EXPECT_EQ(compression::zstd::Decompress(info->zstd_data, data.size()), data);
+
+    const auto plain = fs::ReadFileInfoWithData(tp, path, {});
+    EXPECT_TRUE(plain->gzip_data.empty());
+    EXPECT_TRUE(plain->zstd_data.empty());
+    EXPECT_EQ(plain->etag, info->etag);
+}
+
 USERVER_NAMESPACE_END
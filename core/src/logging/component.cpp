@@ -97,7 +97,10 @@ void Logging::Init(const ComponentConfig& config, const ComponentContext& contex
         }
 
         logger->StartConsumerTask(
-            context.GetTaskProcessor(tp_name), logger_config.message_queue_size, logger_config.queue_overflow_behavior
+            context.GetTaskProcessor(tp_name),
+            logger_config.message_queue_size,
+            logger_config.queue_overflow_behavior,
+            logger_config.thread_buffer_size
         );
 
         auto insertion_result = loggers_.emplace(logger_config.logger_name, std::move(logger));
@@ -297,6 +300,15 @@ properties:
                     enum:
                       - discard
                       - block
+                thread_buffer_size:
+                    type: integer
+                    description: |
+                        the size in bytes of a per task processor thread buffer for log records, must be a power of 2.
+                        Records of a task are passed through the buffer in bulk once the task is switched out,
+                        bypassing the message queue. When the buffer is full, the message queue and
+                        overflow_behavior are used. The buffers are disabled if the option is missing
+                    minimum: 16
+                    defaultDescription: disabled
                 fs-task-processor:
                     type: string
                     description: task processor for disk I/O operations for this logger
@@ -1,5 +1,9 @@
 #include "config.hpp"
 
+#include <stdexcept>
+
+#include <fmt/format.h>
+
 #include <userver/logging/level_serialization.hpp>
 #include <userver/utils/trivial_map.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
@@ -44,6 +48,14 @@ LoggerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Logg
     config.queue_overflow_behavior =
         value["overflow_behavior"].As<QueueOverflowBehavior>(config.queue_overflow_behavior);
 
+    const auto thread_buffer_size = value["thread_buffer_size"];
+    config.thread_buffer_size = thread_buffer_size.As<size_t>(config.thread_buffer_size);
+    if (config.thread_buffer_size != 0 && (config.thread_buffer_size & (config.thread_buffer_size - 1)) != 0) {
+        throw std::runtime_error(fmt::format(
+            "Invalid value {} of {}, must be a power of 2", config.thread_buffer_size, thread_buffer_size.GetPath()
+        ));
+    }
+
     config.fs_task_processor = value["fs-task-processor"].As<std::optional<std::string>>();
 
     config.testsuite_capture = value["testsuite-capture"].As<std::optional<TestsuiteCaptureConfig>>();
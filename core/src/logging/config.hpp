@@ -37,6 +37,9 @@ struct LoggerConfig final {
     // must be a power of 2
     size_t message_queue_size = kDefaultMessageQueueSize;
     QueueOverflowBehavior queue_overflow_behavior = QueueOverflowBehavior::kDiscard;
+    // per task processor thread, 0 (missing in the static config) disables the
+    // thread buffers, must be a power of 2 not less than 16
+    size_t thread_buffer_size = 0;
 
     std::optional<std::string> fs_task_processor;
 
@@ -1,13 +1,65 @@
 #include "fd_sink.hpp"
 
+#include <sys/uio.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <system_error>
+
+#include <boost/container/small_vector.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+namespace {
+
+constexpr std::size_t kMaxIovecs = std::min<std::size_t>(IOV_MAX, 256);
+
+void WriteAll(int fd, iovec* iov, std::size_t count) {
+    while (count > 0) {
+        const auto written = ::writev(fd, iov, static_cast<int>(count));
+        if (written < 0) {
+            if (errno == EAGAIN || errno == EINTR) continue;
+
+            const auto code = std::make_error_code(std::errc{errno});
+            throw std::system_error(code, "calling ::writev");
+        }
+
+        // Skip the fully written buffers and adjust the partially written one
+        auto left = static_cast<std::size_t>(written);
+        while (count > 0 && left >= iov->iov_len) {
+            left -= iov->iov_len;
+            ++iov;
+            --count;
+        }
+        if (count > 0) {
+            iov->iov_base = static_cast<char*>(iov->iov_base) + left;
+            iov->iov_len -= left;
+        }
+    }
+}
+
+}  // namespace
+
 FdSink::FdSink(fs::blocking::FileDescriptor fd) : fd_{std::move(fd)} {}
 
 void FdSink::Write(std::string_view log) { fd_.Write(log); }
 
+void FdSink::WriteBatch(utils::span<const std::string_view> logs) {
+    boost::container::small_vector<iovec, kMaxIovecs> iovecs;
+    for (std::size_t begin = 0; begin < logs.size(); begin += kMaxIovecs) {
+        const auto end = std::min(logs.size(), begin + kMaxIovecs);
+        iovecs.clear();
+        for (auto i = begin; i < end; ++i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+            iovecs.push_back(iovec{const_cast<char*>(logs[i].data()), logs[i].size()});
+        }
+        WriteAll(fd_.GetNative(), iovecs.data(), iovecs.size());
+    }
+}
+
 void FdSink::Flush() {
     if (fd_.IsOpen()) {
         fd_.FSync();
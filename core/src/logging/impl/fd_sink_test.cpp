@@ -1,5 +1,6 @@
 #include "fd_sink.hpp"
 
+#include <fmt/format.h>
 #include <gmock/gmock.h>
 
 #include <userver/engine/async.hpp>
@@ -72,4 +73,32 @@ UTEST(FdSink, PipeSinkLogMulti) {
     read_task.Get();
 }
 
+UTEST(FdSink, PipeSinkLogBatch) {
+    engine::io::Pipe fd_pipe{};
+
+    constexpr std::size_t kMessagesCount = 1000;
+    std::vector<std::string> messages;
+    std::vector<std::string> expected;
+    for (std::size_t i = 0; i < kMessagesCount; ++i) {
+        messages.push_back(fmt::format("message {}\n", i));
+        if (i % 2 == 0) expected.push_back(fmt::format("message {}", i));
+    }
+
+    auto read_task = engine::AsyncNoSpan([&fd_pipe, &expected] {
+        const auto result = test::ReadFromFd(fs::blocking::FileDescriptor::AdoptFd(fd_pipe.reader.Release()));
+        EXPECT_EQ(result, expected);
+    });
+    {
+        auto sink = logging::impl::FdSink{fs::blocking::FileDescriptor::AdoptFd(fd_pipe.writer.Release())};
+        sink.SetLevel(logging::Level::kWarning);
+
+        std::vector<logging::impl::LogMessage> batch;
+        for (std::size_t i = 0; i < kMessagesCount; ++i) {
+            batch.push_back({messages[i], i % 2 == 0 ? logging::Level::kError : logging::Level::kInfo});
+        }
+        EXPECT_NO_THROW(sink.LogBatch(batch));
+    }
+    read_task.Get();
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,91 @@
+#include <logging/impl/thread_log_buffer.hpp>
+
+#include <cstring>
+#include <limits>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace {
+
+constexpr std::uint32_t kSkipToStart = std::numeric_limits<std::uint32_t>::max();
+constexpr std::size_t kRecordAlignment = 8;
+
+constexpr std::size_t AlignUp(std::size_t size) noexcept {
+    return (size + kRecordAlignment - 1) & ~(kRecordAlignment - 1);
+}
+
+}  // namespace
+
+ThreadLogBuffer::ThreadLogBuffer(std::size_t capacity)
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    : capacity_(capacity), data_(new char[capacity]) {
+    static_assert(kMinCapacity >= sizeof(RecordHeader) * 2);
+    UINVARIANT(
+        capacity >= kMinCapacity && (capacity & (capacity - 1)) == 0,
+        "Log buffer size must be a power of 2 not less than 16"
+    );
+}
+
+ThreadLogBuffer::~ThreadLogBuffer() = default;
+
+bool ThreadLogBuffer::TryPush(Level level, std::string_view record) noexcept {
+    static_assert(sizeof(RecordHeader) == kRecordAlignment);
+    const auto record_size = AlignUp(sizeof(RecordHeader) + record.size());
+    // Bigger records may not fit even into an empty buffer because of wrapping
+    if (record_size > capacity_ / 2) return false;
+
+    const auto tail = tail_->load(std::memory_order_acquire);
+
+    auto offset = static_cast<std::size_t>(head_ & (capacity_ - 1));
+    // Records are never split, wrap around if it does not fit till the end
+    const auto skip = (capacity_ - offset < record_size) ? capacity_ - offset : 0;
+    if (head_ + skip + record_size - tail > capacity_) return false;
+
+    if (skip != 0) {
+        const RecordHeader skip_header{kSkipToStart, 0};
+        std::memcpy(data_.get() + offset, &skip_header, sizeof(skip_header));
+        offset = 0;
+    }
+
+    const RecordHeader header{static_cast<std::uint32_t>(record.size()), static_cast<std::uint32_t>(level)};
+    std::memcpy(data_.get() + offset, &header, sizeof(header));
+    std::memcpy(data_.get() + offset + sizeof(header), record.data(), record.size());
+
+    head_ += skip + record_size;
+    return true;
+}
+
+void ThreadLogBuffer::Peek(std::uint64_t end, std::vector<LogMessage>& messages) const {
+    auto position = tail_->load(std::memory_order_relaxed);
+    UASSERT(position <= end);
+
+    while (position != end) {
+        const auto offset = static_cast<std::size_t>(position & (capacity_ - 1));
+        RecordHeader header{};
+        std::memcpy(&header, data_.get() + offset, sizeof(header));
+
+        if (header.size == kSkipToStart) {
+            position += capacity_ - offset;
+            continue;
+        }
+
+        messages.push_back(LogMessage{
+            std::string_view{data_.get() + offset + sizeof(header), header.size},
+            static_cast<Level>(header.level),
+        });
+        position += AlignUp(sizeof(header) + header.size);
+    }
+}
+
+void ThreadLogBuffer::Release(std::uint64_t end) noexcept {
+    UASSERT(end >= tail_->load(std::memory_order_relaxed));
+    tail_->store(end, std::memory_order_release);
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include <logging/impl/base_sink.hpp>
+#include <userver/compiler/impl/constexpr.hpp>
+#include <userver/concurrent/impl/interference_shield.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+/// A single-producer single-consumer ring buffer of preformatted log records.
+///
+/// The producer copies records into the ring and passes the positions of the
+/// pushed records to the consumer by other means, for example through a queue
+/// that synchronizes the producer with the consumer. The consumer takes the
+/// records up to such a position at once and releases them after writing them
+/// to sinks.
+class ThreadLogBuffer final {
+public:
+    /// @param capacity in bytes, must be a power of 2 and at least kMinCapacity
+    explicit ThreadLogBuffer(std::size_t capacity);
+
+    ThreadLogBuffer(ThreadLogBuffer&&) = delete;
+    ThreadLogBuffer& operator=(ThreadLogBuffer&&) = delete;
+    ~ThreadLogBuffer();
+
+    static constexpr std::size_t kMinCapacity = 16;
+
+    /// Producer only. Records bigger than a half of the capacity never fit.
+    /// @returns `false` if there is not enough free space
+    bool TryPush(Level level, std::string_view record) noexcept;
+
+    /// Producer only. The position right after the last pushed record.
+    std::uint64_t GetPushedPosition() const noexcept { return head_; }
+
+    /// Consumer only. Appends views of the records up to `end`, a position
+    /// obtained from GetPushedPosition, to `messages`. The views stay valid
+    /// until Release.
+    void Peek(std::uint64_t end, std::vector<LogMessage>& messages) const;
+
+    /// Consumer only. Frees the space up to `end`.
+    void Release(std::uint64_t end) noexcept;
+
+private:
+    struct RecordHeader {
+        std::uint32_t size;
+        std::uint32_t level;
+    };
+
+    const std::size_t capacity_;
+    const std::unique_ptr<char[]> data_;
+
+    // Only accessed by the producer
+    std::uint64_t head_{0};
+    concurrent::impl::InterferenceShield<std::atomic<std::uint64_t>> tail_{0};
+};
+
+/// @cond
+// Set when the current thread buffers a record for a logger
+extern USERVER_IMPL_CONSTINIT thread_local bool has_unpublished_thread_log_records;
+
+void DoPublishThreadLogBuffers() noexcept;
+/// @endcond
+
+/// Passes the records buffered by the current thread to the consumers of their
+/// loggers. Called by the engine each time a task is switched out, before the
+/// task can be resumed by another thread, so that the records of a task are
+/// consumed in order. Only checks a thread-local flag if the thread has
+/// buffered nothing.
+inline void PublishThreadLogBuffers() noexcept {
+    if (has_unpublished_thread_log_records) DoPublishThreadLogBuffers();
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
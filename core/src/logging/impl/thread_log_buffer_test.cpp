@@ -0,0 +1,109 @@
+#include <logging/impl/thread_log_buffer.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using logging::impl::LogMessage;
+using logging::impl::ThreadLogBuffer;
+
+std::vector<std::string> Consume(ThreadLogBuffer& buffer, std::uint64_t end) {
+    std::vector<LogMessage> messages;
+    buffer.Peek(end, messages);
+
+    std::vector<std::string> result;
+    for (const auto& message : messages) result.emplace_back(message.payload);
+    buffer.Release(end);
+    return result;
+}
+
+std::vector<std::string> ConsumeAll(ThreadLogBuffer& buffer) { return Consume(buffer, buffer.GetPushedPosition()); }
+
+}  // namespace
+
+TEST(ThreadLogBuffer, Basic) {
+    ThreadLogBuffer buffer{256};
+    EXPECT_TRUE(ConsumeAll(buffer).empty());
+
+    EXPECT_TRUE(buffer.TryPush(logging::Level::kInfo, "first"));
+    EXPECT_TRUE(buffer.TryPush(logging::Level::kError, "second"));
+
+    std::vector<LogMessage> messages;
+    const auto end = buffer.GetPushedPosition();
+    buffer.Peek(end, messages);
+    ASSERT_EQ(messages.size(), 2);
+    EXPECT_EQ(messages[0].payload, "first");
+    EXPECT_EQ(messages[0].level, logging::Level::kInfo);
+    EXPECT_EQ(messages[1].payload, "second");
+    EXPECT_EQ(messages[1].level, logging::Level::kError);
+    buffer.Release(end);
+
+    EXPECT_TRUE(buffer.TryPush(logging::Level::kInfo, "third"));
+    EXPECT_EQ(ConsumeAll(buffer), std::vector<std::string>{"third"});
+}
+
+TEST(ThreadLogBuffer, PartialConsume) {
+    ThreadLogBuffer buffer{256};
+    EXPECT_TRUE(buffer.TryPush(logging::Level::kInfo, "first"));
+    const auto first_end = buffer.GetPushedPosition();
+    EXPECT_TRUE(buffer.TryPush(logging::Level::kInfo, "second"));
+
+    EXPECT_EQ(Consume(buffer, first_end), std::vector<std::string>{"first"});
+    EXPECT_EQ(ConsumeAll(buffer), std::vector<std::string>{"second"});
+}
+
+TEST(ThreadLogBuffer, Full) {
+    ThreadLogBuffer buffer{128};
+    EXPECT_FALSE(buffer.TryPush(logging::Level::kInfo, std::string(100, 'x')));
+
+    const std::string record(48, 'x');
+    EXPECT_TRUE(buffer.TryPush(logging::Level::kInfo, record));
+    EXPECT_TRUE(buffer.TryPush(logging::Level::kInfo, record));
+    EXPECT_FALSE(buffer.TryPush(logging::Level::kInfo, record));
+
+    EXPECT_EQ(ConsumeAll(buffer).size(), 2);
+    EXPECT_TRUE(buffer.TryPush(logging::Level::kInfo, record));
+}
+
+TEST(ThreadLogBuffer, WrapAround) {
+    ThreadLogBuffer buffer{128};
+    for (int i = 0; i < 100; ++i) {
+        const auto record = std::to_string(i) + std::string(i % 30, '.');
+        ASSERT_TRUE(buffer.TryPush(logging::Level::kInfo, record));
+        EXPECT_EQ(ConsumeAll(buffer), std::vector<std::string>{record});
+    }
+}
+
+TEST(ThreadLogBuffer, ProducerConsumer) {
+    constexpr int kRecords = 20'000;
+    ThreadLogBuffer buffer{1024};
+    std::atomic<std::uint64_t> published{0};
+
+    std::thread producer([&buffer, &published] {
+        for (int i = 0; i < kRecords; ++i) {
+            const auto record = std::to_string(i);
+            while (!buffer.TryPush(logging::Level::kInfo, record)) {
+                std::this_thread::yield();
+            }
+            published.store(buffer.GetPushedPosition());
+        }
+    });
+
+    int expected = 0;
+    while (expected < kRecords) {
+        for (const auto& record : Consume(buffer, published.load())) {
+            ASSERT_EQ(record, std::to_string(expected));
+            ++expected;
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(Consume(buffer, published.load()).empty());
+}
+
+USERVER_NAMESPACE_END
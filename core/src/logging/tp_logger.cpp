@@ -1,9 +1,16 @@
 #include "tp_logger.hpp"
 
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+#include <boost/container/small_vector.hpp>
 #include <fmt/format.h>
 
 #include <engine/task/task_context.hpp>
+#include <userver/compiler/thread_local.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/logging/logger.hpp>
@@ -15,6 +22,50 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+struct impl::async::ThreadBuffer final : public std::enable_shared_from_this<ThreadBuffer> {
+    ThreadBuffer(TpLogger& logger, std::uint64_t logger_id, std::size_t size)
+        : logger(&logger), logger_id(logger_id), buffer(size) {}
+
+    // Reset by the destructor of the logger, which then waits for the
+    // `publishers` that have already seen the logger. The records published
+    // after that are dropped.
+    std::atomic<TpLogger*> logger;
+    std::atomic<std::size_t> publishers{0};
+    const std::uint64_t logger_id;
+    ThreadLogBuffer buffer;
+
+    // Only accessed by the owning thread.
+    std::uint64_t published_position{0};
+    bool is_unpublished{false};
+};
+
+namespace {
+
+std::atomic<std::uint64_t> next_logger_id{0};
+
+struct LocalThreadBuffers final {
+    // A buffer per logger, owned by the thread and by the queued records.
+    std::vector<std::shared_ptr<impl::async::ThreadBuffer>> buffers;
+    // The buffers with records that are not passed to the consumer yet.
+    std::vector<impl::async::ThreadBuffer*> unpublished;
+};
+
+compiler::ThreadLocal local_thread_buffers = [] { return LocalThreadBuffers{}; };
+
+// Must be called by the owning thread. Returns nullptr if there is nothing to
+// publish.
+impl::async::ActionNode* MakeRecordsNode(impl::async::ThreadBuffer& thread_buffer) {
+    const auto end = thread_buffer.buffer.GetPushedPosition();
+    if (end == thread_buffer.published_position) return nullptr;
+
+    auto node = std::make_unique<impl::async::ActionNode>();
+    node->action = impl::async::ThreadBufferRecords{thread_buffer.shared_from_this(), end};
+    thread_buffer.published_position = end;
+    return node.release();
+}
+
+}  // namespace
+
 struct TpLogger::ActionVisitor final {
     TpLogger& logger;
 
@@ -27,6 +78,10 @@ struct TpLogger::ActionVisitor final {
         // The consumer thread will check state_ later.
     }
 
+    void operator()(impl::async::ThreadBufferRecords&& records) const noexcept {
+        logger.ConsumeThreadBufferRecords(std::move(records));
+    }
+
     void operator()(impl::async::ReopenCoro&& reopen) const noexcept {
         try {
             logger.BackendReopen(reopen.reopen_mode);
@@ -46,18 +101,25 @@ struct TpLogger::ActionVisitor final {
 };
 
 TpLogger::TpLogger(Format format, std::string logger_name)
-    : impl::TextLogger(format), logger_name_(std::move(logger_name)) {
+    : impl::TextLogger(format), logger_name_(std::move(logger_name)), id_(next_logger_id.fetch_add(1)) {
     SetLevel(logging::Level::kInfo);
 }
 
 void TpLogger::StartConsumerTask(
     engine::TaskProcessor& task_processor,
     std::size_t max_queue_size,
-    QueueOverflowBehavior overflow_policy
+    QueueOverflowBehavior overflow_policy,
+    std::size_t thread_buffer_size
 ) {
     UINVARIANT(max_queue_size != 0 && max_queue_size <= (std::size_t{1} << 31), "Invalid max queue size");
+    const bool is_power_of_2 = (thread_buffer_size & (thread_buffer_size - 1)) == 0;
+    UINVARIANT(
+        thread_buffer_size == 0 || (thread_buffer_size >= ThreadLogBuffer::kMinCapacity && is_power_of_2),
+        "Thread buffer size must be a power of 2 not less than 16, or 0"
+    );
     max_queue_size_.store(max_queue_size);
     overflow_policy_.store(overflow_policy);
+    thread_buffer_size_.store(thread_buffer_size);
 
     auto expected = State::kSync;
     const bool success = state_.compare_exchange_strong(expected, State::kAsync);
@@ -86,6 +148,25 @@ TpLogger::~TpLogger() {
         "We may be in non coroutine context, async logger must be in "
         "sync mode and consuming task must be stopped"
     );
+
+    // The published records of the thread buffers were consumed when the
+    // consumer task stopped, or synchronously after that. The records that
+    // are not published yet are dropped by their threads.
+    const std::lock_guard lock{thread_buffers_mutex_};
+    for (const auto& weak_thread_buffer : thread_buffers_) {
+        if (const auto thread_buffer = weak_thread_buffer.lock()) {
+            thread_buffer->logger.store(nullptr);
+            // A publisher may be suspended while consuming its records
+            // synchronously, it is resumed by the engine
+            while (thread_buffer->publishers.load() != 0) {
+                if (engine::current_task::IsTaskProcessorThread()) {
+                    engine::Yield();
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    }
 }
 
 void TpLogger::StopConsumerTask() {
@@ -94,6 +175,9 @@ void TpLogger::StopConsumerTask() {
         return;
     }
 
+    // Records of the current task go before the stop, the ones published by
+    // other threads later are consumed synchronously.
+    PublishThreadBuffers();
     DoPush(stop_node_);
 
     const engine::TaskCancellationBlocker block_cancel;
@@ -107,6 +191,8 @@ void TpLogger::Flush() {
     }
 
     if (engine::current_task::IsTaskProcessorThread()) {
+        PublishThreadBuffers();
+
         impl::async::FlushCoro action{};
         auto future = action.promise.get_future();
 
@@ -136,6 +222,10 @@ void TpLogger::Log(Level level, impl::formatters::LoggerItemRef item) {
         return;
     }
 
+    if (TryPushToThreadBuffer(level, msg.log_line)) {
+        return;
+    }
+
     if (TryWaitFreeQueueCapacity()) {
         // The queue might have concurrently become full, in which case the size
         // will temporarily go over the max size. The actual number of log actions
@@ -171,6 +261,8 @@ void TpLogger::Reopen(ReopenMode reopen_mode) {
     }
 
     UASSERT(engine::current_task::IsTaskProcessorThread());
+    PublishThreadBuffers();
+
     impl::async::ReopenCoro action{reopen_mode, {}};
     auto future = action.promise.get_future();
 
@@ -205,6 +297,111 @@ void TpLogger::BackendPerform(impl::async::Action&& action) noexcept {
     }
 }
 
+bool TpLogger::TryPushToThreadBuffer(Level level, std::string_view record) {
+    // Only tasks publish the buffers on context switches
+    if (thread_buffer_size_.load() == 0 || !engine::current_task::GetCurrentTaskContextUnchecked()) {
+        return false;
+    }
+
+    impl::async::ActionNode* records_node = nullptr;
+    {
+        auto local_buffers = local_thread_buffers.Use();
+        auto& buffers = local_buffers->buffers;
+
+        const auto it = std::find_if(buffers.begin(), buffers.end(), [this](const auto& thread_buffer) {
+            return thread_buffer->logger_id == id_;
+        });
+        impl::async::ThreadBuffer* thread_buffer = (it != buffers.end()) ? it->get() : nullptr;
+
+        if (state_.load() == State::kAsync) {
+            if (!thread_buffer) {
+                buffers.erase(
+                    std::remove_if(
+                        buffers.begin(),
+                        buffers.end(),
+                        [](const auto& other) { return !other->logger.load() && !other->is_unpublished; }
+                    ),
+                    buffers.end()
+                );
+                thread_buffer = buffers.emplace_back(MakeThreadBuffer()).get();
+            }
+
+            if (thread_buffer->buffer.TryPush(level, record)) {
+                if (!std::exchange(thread_buffer->is_unpublished, true)) {
+                    local_buffers->unpublished.push_back(thread_buffer);
+                    has_unpublished_thread_log_records = true;
+                }
+                return true;
+            }
+        }
+
+        // The record goes through the queue, the records buffered before it
+        // must be consumed first.
+        if (thread_buffer) records_node = MakeRecordsNode(*thread_buffer);
+    }
+
+    if (records_node) DoPush(*records_node);
+    return false;
+}
+
+std::shared_ptr<impl::async::ThreadBuffer> TpLogger::MakeThreadBuffer() {
+    auto thread_buffer = std::make_shared<impl::async::ThreadBuffer>(*this, id_, thread_buffer_size_.load());
+
+    const std::lock_guard lock{thread_buffers_mutex_};
+    // Forget the buffers of the exited threads
+    thread_buffers_.erase(
+        std::remove_if(
+            thread_buffers_.begin(),
+            thread_buffers_.end(),
+            [](const auto& weak_thread_buffer) { return weak_thread_buffer.expired(); }
+        ),
+        thread_buffers_.end()
+    );
+    thread_buffers_.push_back(thread_buffer);
+    return thread_buffer;
+}
+
+void TpLogger::PublishThreadBuffers() noexcept {
+    boost::container::small_vector<std::pair<std::shared_ptr<impl::async::ThreadBuffer>, impl::async::ActionNode*>, 4>
+        nodes;
+    {
+        auto local_buffers = local_thread_buffers.Use();
+        for (auto* thread_buffer : local_buffers->unpublished) {
+            thread_buffer->is_unpublished = false;
+            if (auto* node = MakeRecordsNode(*thread_buffer)) {
+                nodes.emplace_back(thread_buffer->shared_from_this(), node);
+            }
+        }
+        local_buffers->unpublished.clear();
+        has_unpublished_thread_log_records = false;
+    }
+
+    // A stopped logger consumes the queue synchronously, which may switch the
+    // coroutine, so the thread-local scope must be left first.
+    for (const auto& [thread_buffer, node] : nodes) {
+        thread_buffer->publishers.fetch_add(1);
+        if (auto* logger = thread_buffer->logger.load()) {
+            logger->DoPush(*node);
+        } else {
+            // The logger is destroyed
+            const std::unique_ptr<impl::async::ActionNode> dropped{node};
+        }
+        thread_buffer->publishers.fetch_sub(1);
+    }
+}
+
+void TpLogger::ConsumeThreadBufferRecords(impl::async::ThreadBufferRecords&& records) noexcept {
+    auto& buffer = records.thread_buffer->buffer;
+    try {
+        thread_buffer_batch_.clear();
+        buffer.Peek(records.end, thread_buffer_batch_);
+        BackendLogBatch(thread_buffer_batch_);
+    } catch (const std::exception& e) {
+        UASSERT_MSG(false, fmt::format("Exception while doing an async logging: {}", e.what()));
+    }
+    buffer.Release(records.end);
+}
+
 bool TpLogger::HasFreeQueueCapacity() noexcept {
     return produced_->load() - consumed_->load() < max_queue_size_.load();
 }
@@ -291,6 +488,22 @@ void TpLogger::BackendLog(impl::async::Log&& action) const {
     }
 }
 
+void TpLogger::BackendLogBatch(utils::span<const LogMessage> messages) const {
+    for (const auto& sink : GetSinks()) {
+        try {
+            sink->LogBatch(messages);
+        } catch (const std::exception& e) {
+            UASSERT_MSG(false, "While writing log messages caught an exception: " + std::string(e.what()));
+        }
+    }
+
+    if (std::any_of(messages.begin(), messages.end(), [this](const LogMessage& message) {
+            return ShouldFlush(message.level);
+        })) {
+        BackendFlush();
+    }
+}
+
 void TpLogger::BackendFlush() const {
     for (const auto& sink : GetSinks()) {
         try {
@@ -320,6 +533,13 @@ void TpLogger::BackendReopen(ReopenMode reopen_mode) const {
     stats_.has_reopening_error.store(false);
 }
 
+// Written only in the scope of local_thread_buffers, which rules out coroutine
+// switches, so the TLS address can not be cached across them.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+USERVER_IMPL_CONSTINIT thread_local bool has_unpublished_thread_log_records = false;
+
+void DoPublishThreadLogBuffers() noexcept { TpLogger::PublishThreadBuffers(); }
+
 }  // namespace logging::impl
 
 USERVER_NAMESPACE_END
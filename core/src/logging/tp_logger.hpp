@@ -4,6 +4,7 @@
 #include <future>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -20,6 +21,7 @@
 #include <logging/config.hpp>
 #include <logging/impl/base_sink.hpp>
 #include <logging/impl/reopen_mode.hpp>
+#include <logging/impl/thread_log_buffer.hpp>
 #include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/concurrent/impl/intrusive_hooks.hpp>
 #include <userver/logging/impl/log_stats.hpp>
@@ -53,7 +55,15 @@ struct ReopenCoro {
 
 struct Stop {};
 
-using Action = std::variant<Stop, Log, FlushCoro, FlushThreaded, ReopenCoro>;
+struct ThreadBuffer;
+
+// The records of a thread buffer up to `end`, published by the producing thread.
+struct ThreadBufferRecords {
+    std::shared_ptr<ThreadBuffer> thread_buffer;
+    std::uint64_t end{0};
+};
+
+using Action = std::variant<Stop, Log, FlushCoro, FlushThreaded, ReopenCoro, ThreadBufferRecords>;
 
 struct ActionNode final : public concurrent::impl::SinglyLinkedBaseHook {
     Action action{Stop{}};
@@ -67,10 +77,15 @@ public:
     TpLogger(Format format, std::string logger_name);
     ~TpLogger() override;
 
+    /// @param thread_buffer_size if not 0, the records from tasks are passed
+    /// to the consumer via per-thread buffers of this size, falling back to the
+    /// queue when a buffer is full. The buffered records of a task reach the
+    /// consumer once the task is switched out.
     void StartConsumerTask(
         engine::TaskProcessor& task_processor,
         std::size_t max_queue_size,
-        QueueOverflowBehavior overflow_policy
+        QueueOverflowBehavior overflow_policy,
+        std::size_t thread_buffer_size = 0
     );
 
     void StopConsumerTask();
@@ -87,6 +102,9 @@ public:
 
     impl::LogStatistics& GetStatistics() noexcept;
 
+    /// @see PublishThreadLogBuffers
+    static void PublishThreadBuffers() noexcept;
+
 protected:
     bool DoShouldLog(Level level) const noexcept override;
 
@@ -112,11 +130,17 @@ private:
     void CleanUpQueue(Queue::Consumer&& consumer) noexcept;
     void AccountLogConsumed() noexcept;
     void BackendPerform(impl::async::Action&& action) noexcept;
+    bool TryPushToThreadBuffer(Level level, std::string_view record);
+    std::shared_ptr<impl::async::ThreadBuffer> MakeThreadBuffer();
+    void ConsumeThreadBufferRecords(impl::async::ThreadBufferRecords&& records) noexcept;
     void BackendLog(impl::async::Log&& action) const;
+    void BackendLogBatch(utils::span<const LogMessage> messages) const;
     void BackendFlush() const;
     void BackendReopen(ReopenMode reopen_mode) const;
 
     const std::string logger_name_;
+    // Identifies the logger in the thread-local lists of thread buffers.
+    const std::uint64_t id_;
     std::vector<impl::SinkPtr> sinks_;
     mutable impl::LogStatistics stats_{};
 
@@ -134,6 +158,14 @@ private:
     Queue queue_;
     concurrent::impl::InterferenceShield<std::atomic<QueueSize>> produced_{0};
     concurrent::impl::InterferenceShield<std::atomic<QueueSize>> consumed_{0};
+
+    std::atomic<std::size_t> thread_buffer_size_{0};
+    // The buffers are owned by their threads, the logger detaches them on
+    // destruction.
+    std::mutex thread_buffers_mutex_;
+    std::vector<std::weak_ptr<impl::async::ThreadBuffer>> thread_buffers_;
+    // Only used by the current queue consumer.
+    std::vector<LogMessage> thread_buffer_batch_;
 };
 
 }  // namespace logging::impl
@@ -1,5 +1,9 @@
 #include <logging/tp_logger.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
 #include <benchmark/benchmark.h>
 
 #include <logging/impl/null_sink.hpp>
@@ -31,9 +35,12 @@ protected:
 
     void TearDown(const benchmark::State&) override { guard_.reset(); }
 
-    auto StartAsyncLoggerScope() {
+    auto StartAsyncLoggerScope(std::size_t thread_buffer_size = 0) {
         tp_logger_->StartConsumerTask(
-            engine::current_task::GetTaskProcessor(), 1 << 30, logging::QueueOverflowBehavior::kDiscard
+            engine::current_task::GetTaskProcessor(),
+            1 << 30,
+            logging::QueueOverflowBehavior::kDiscard,
+            thread_buffer_size
         );
         return utils::FastScopeGuard([this]() noexcept { tp_logger_->StopConsumerTask(); });
     }
@@ -60,6 +67,49 @@ BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogString)->RangeMultiplier(2)->Range(8,
 
 namespace {
 
+constexpr std::size_t kThreadBufferSize = 1 << 20;
+
+// Reports the throughput and the latency of LOG_INFO as seen by the producers
+void LogStringLatency(benchmark::State& state) {
+    const auto msg = Launder(std::string(state.range(0), '*'));
+    std::vector<std::chrono::steady_clock::duration> latencies;
+    latencies.reserve(1 << 20);
+
+    for ([[maybe_unused]] auto _ : state) {
+        const auto start = std::chrono::steady_clock::now();
+        LOG_INFO() << msg;
+        if (latencies.size() < latencies.capacity()) {
+            latencies.push_back(std::chrono::steady_clock::now() - start);
+        }
+    }
+
+    if (latencies.empty()) return;
+    const auto p99 = latencies.begin() + latencies.size() * 99 / 100;
+    std::nth_element(latencies.begin(), p99, latencies.end());
+    state.counters["records"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+    state.counters["p99-ns"] = std::chrono::duration_cast<std::chrono::nanoseconds>(*p99).count();
+}
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogStringQueue)(benchmark::State& state) {
+    engine::RunStandalone(2, [&] {
+        auto scope = StartAsyncLoggerScope();
+        LogStringLatency(state);
+    });
+}
+BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogStringQueue)->RangeMultiplier(8)->Range(8, 8 << 10);
+
+BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogStringThreadBuffers)(benchmark::State& state) {
+    engine::RunStandalone(2, [&] {
+        auto scope = StartAsyncLoggerScope(kThreadBufferSize);
+        LogStringLatency(state);
+    });
+}
+BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogStringThreadBuffers)->RangeMultiplier(8)->Range(8, 8 << 10);
+
+namespace {
+
 __attribute__((noinline)) void LogDebug() { LOG_DEBUG() << 42; }
 
 __attribute__((noinline)) void LogInfo() { LOG_INFO() << 42; }
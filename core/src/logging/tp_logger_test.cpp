@@ -3,6 +3,7 @@
 #include <gmock/gmock.h>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/statistics/storage.hpp>
@@ -44,7 +45,8 @@ public:
 
     std::shared_ptr<logging::impl::TpLogger> StartAsyncLogger(
         std::size_t queue_size_max = 10,
-        QueueOverflowBehavior on_overflow = QueueOverflowBehavior::kDiscard
+        QueueOverflowBehavior on_overflow = QueueOverflowBehavior::kDiscard,
+        std::size_t thread_buffer_size = 0
     ) {
         UASSERT_MSG(
             engine::current_task::IsTaskProcessorThread(), "Misconfigured test. Should be run in coroutine environment"
@@ -56,7 +58,9 @@ public:
             writer = logger->GetStatistics();
         });
 
-        logger->StartConsumerTask(engine::current_task::GetTaskProcessor(), queue_size_max, on_overflow);
+        logger->StartConsumerTask(
+            engine::current_task::GetTaskProcessor(), queue_size_max, on_overflow, thread_buffer_size
+        );
 
         // Tracing should not break the TpLogger
         logger->SetLevel(logging::Level::kTrace);
@@ -742,4 +746,98 @@ UTEST_F_MT(LoggingTestCoro, TpLoggerLogMultipleStdThreadFlushSyncCancelMT, 4) {
     EXPECT_EQ(GetRecordsCount(), message_count);
 }
 
+UTEST_F_MT(LoggingTestCoro, TpLoggerThreadBuffersMT, 4) {
+    const std::size_t message_count = kLoggingTestIterations * (GetThreadCount() - 1);
+    auto logger = StartAsyncLogger(10, QueueOverflowBehavior::kDiscard, 1 << 16);
+    LogTestMT(logger, GetThreadCount(), kTestLogging);
+    EXPECT_EQ(GetRecordsCount(), message_count);
+}
+
+UTEST_F_MT(LoggingTestCoro, TpLoggerThreadBuffersFlushMT, 4) {
+    const std::size_t message_count = kLoggingTestIterations * GetThreadCount();
+    auto logger = StartAsyncLogger(GetThreadCount() * 2 /* flush */, QueueOverflowBehavior::kDiscard, 1 << 16);
+    LogTestMT(logger, GetThreadCount(), kTestLogFlush);
+    EXPECT_EQ(GetRecordsCount(), message_count);
+}
+
+UTEST_F_MT(LoggingTestCoro, TpLoggerThreadBuffersSyncCancelMT, 4) {
+    const std::size_t message_count = kLoggingTestIterations * (GetThreadCount() - 1);
+    auto logger = StartAsyncLogger(message_count * 10, QueueOverflowBehavior::kDiscard, 1 << 16);
+    LogTestMT(logger, GetThreadCount(), kTestLogSyncCancel);
+    EXPECT_EQ(GetRecordsCount(), message_count);
+}
+
+UTEST_F_MT(LoggingTestCoro, TpLoggerThreadBuffersStdThreadFlushMT, 4) {
+    const std::size_t message_count = kLoggingTestIterations * GetThreadCount();
+    auto logger = StartAsyncLogger(message_count * 10, QueueOverflowBehavior::kDiscard, 1 << 16);
+    LogTestMT(logger, GetThreadCount(), kTestLogStdThreadFlush);
+    EXPECT_EQ(GetRecordsCount(), message_count);
+}
+
+UTEST_F_MT(LoggingTestCoro, TpLoggerThreadBuffersTaskOrderMT, 4) {
+    // The tasks are switched out after each record and are resumed by random
+    // threads, the records of each task must still be written in order
+    constexpr std::size_t kTaskCount = 8;
+    auto logger = StartAsyncLogger(10, QueueOverflowBehavior::kDiscard, 1 << 16);
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kTaskCount);
+    for (std::size_t task_index = 0; task_index < kTaskCount; ++task_index) {
+        tasks.push_back(engine::AsyncNoSpan([&logger, task_index] {
+            for (std::size_t i = 0; i < kLoggingTestIterations; ++i) {
+                LOG_INFO_TO(logger) << i << " at " << task_index;
+                engine::Yield();
+            }
+        }));
+    }
+    for (auto& task : tasks) {
+        task.Get();
+    }
+    logger->StopConsumerTask();
+
+    const auto logs = GetStreamString();
+    for (std::size_t task_index = 0; task_index < kTaskCount; ++task_index) {
+        std::size_t previous_position = 0;
+        for (std::size_t i = 0; i < kLoggingTestIterations; ++i) {
+            const auto position = logs.find(fmt::format("text={} at {}", i, task_index));
+            ASSERT_NE(position, std::string::npos);
+            EXPECT_GT(position, previous_position) << i << " at " << task_index;
+            previous_position = position;
+        }
+    }
+}
+
+UTEST_F_MT(LoggingTestCoro, TpLoggerThreadBuffersOverflowBlockingMT, 4) {
+    // The records do not fit into the tiny buffers and go through the queue
+    const std::size_t message_count = kLoggingTestIterations * (GetThreadCount() - 1);
+    auto logger = StartAsyncLogger(2, QueueOverflowBehavior::kBlock, 64);
+    LogTestMT(logger, GetThreadCount(), kTestLogging);
+    EXPECT_EQ(GetRecordsCount(), message_count);
+}
+
+UTEST_MT(TpLogger, ThreadBuffersOutliveLogger, 2) {
+    auto logger = MakeNamedStreamLogger("short-lived", logging::Format::kTskv).logger;
+    logger->StartConsumerTask(engine::current_task::GetTaskProcessor(), 10, QueueOverflowBehavior::kDiscard, 1 << 16);
+
+    std::atomic<bool> logged{false};
+    std::atomic<bool> logger_destroyed{false};
+    // The record stays unpublished in the buffer of the other thread until the
+    // task is switched out
+    auto task = engine::AsyncNoSpan([&logger_ref = *logger, &logged, &logger_destroyed] {
+        LOG_INFO_TO(logger_ref) << "buffered";
+        logged = true;
+        while (!logger_destroyed) {
+            // busy-wait to keep the record unpublished
+        }
+    });
+    while (!logged) engine::Yield();
+
+    logger->StopConsumerTask();
+    logger.reset();
+    logger_destroyed = true;
+
+    // The record is dropped on the context switch, the logger is not touched
+    UEXPECT_NO_THROW(task.Get());
+}
+
 USERVER_NAMESPACE_END
@@ -9,6 +9,8 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/rcu/sharded_rcu_map.hpp>
 #include <userver/utils/async.hpp>
 #include <utils/impl/parallelize_benchmark.hpp>
 
@@ -133,4 +135,57 @@ void rcu_of_shared_ptr(benchmark::State& state) {
 }
 BENCHMARK(rcu_of_shared_ptr)->RangeMultiplier(2)->Range(1, 32);
 
+namespace {
+
+// Every thread reads random keys and replaces a key (erase + insert) in
+// `write_percent` of operations.
+template <typename Map>
+void RcuMapMixedReadWrite(benchmark::State& state) {
+    const auto threads = static_cast<std::size_t>(state.range(0));
+    const auto size = static_cast<std::uint64_t>(state.range(1));
+    const auto write_percent = static_cast<std::uint64_t>(state.range(2));
+
+    engine::RunStandalone(threads, [&] {
+        Map map;
+        for (std::uint64_t i = 0; i < size; ++i) map.Emplace(i, i);
+
+        std::atomic<std::uint64_t> seed{0};
+        RunParallelBenchmark(state, [&](auto& range) {
+            std::uint64_t key = seed.fetch_add(1) * 7919;
+            std::uint64_t op = 0;
+            for ([[maybe_unused]] auto _ : range) {
+                key = (key + 104729) % size;
+                if (++op % 100 < write_percent) {
+                    map.Erase(key);
+                    map.Emplace(key, key);
+                } else {
+                    benchmark::DoNotOptimize(map.Get(key));
+                }
+            }
+        });
+    });
+}
+
+template <typename Map>
+void RcuMapMixedReadWriteArgs(benchmark::internal::Benchmark* b) {
+    for (const long threads : {1, 4}) {
+        for (const long size : {1'000, 10'000, 100'000}) {
+            for (const long write_percent : {0, 1, 10}) {
+                b->Args({threads, size, write_percent});
+            }
+        }
+    }
+}
+
+using RcuMapU64 = rcu::RcuMap<std::uint64_t, std::uint64_t>;
+using ShardedRcuMapU64 = rcu::ShardedRcuMap<std::uint64_t, std::uint64_t>;
+
+}  // namespace
+
+void rcu_map_mixed_read_write(benchmark::State& state) { RcuMapMixedReadWrite<RcuMapU64>(state); }
+BENCHMARK(rcu_map_mixed_read_write)->Apply(RcuMapMixedReadWriteArgs<RcuMapU64>);
+
+void sharded_rcu_map_mixed_read_write(benchmark::State& state) { RcuMapMixedReadWrite<ShardedRcuMapU64>(state); }
+BENCHMARK(sharded_rcu_map_mixed_read_write)->Apply(RcuMapMixedReadWriteArgs<ShardedRcuMapU64>);
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,166 @@
+#include <userver/rcu/sharded_rcu_map.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using StringMap = rcu::ShardedRcuMap<std::string, int>;
+
+}  // namespace
+
+UTEST(ShardedRcuMap, Empty) {
+    StringMap map;
+    const auto& cmap = map;
+
+    EXPECT_EQ(map.GetShardCount(), StringMap::kDefaultShardCount);
+    EXPECT_EQ(0, map.SizeApprox());
+    EXPECT_EQ(map.begin(), map.end());
+    EXPECT_EQ(cmap.begin(), cmap.end());
+    EXPECT_TRUE(map.GetSnapshot().empty());
+    map.Clear();
+    EXPECT_TRUE(map.GetSnapshot().empty());
+}
+
+UTEST(ShardedRcuMap, Modify) {
+    StringMap map;
+    const auto& cmap = map;
+
+    UEXPECT_THROW(cmap["any"], rcu::MissingKeyException);
+    EXPECT_FALSE(map.Get("any"));
+    EXPECT_FALSE(cmap.Get("any"));
+    EXPECT_FALSE(map.Erase("any"));
+    EXPECT_FALSE(map.Pop("any"));
+
+    UEXPECT_NO_THROW(*map["any"] = 1);
+    EXPECT_EQ(1, *cmap["any"]);
+    EXPECT_EQ(1, *map.Get("any"));
+    EXPECT_TRUE(map.Erase("any"));
+    EXPECT_FALSE(map.Erase("any"));
+
+    EXPECT_TRUE(map.Insert("any", std::make_shared<int>(3)).inserted);
+    EXPECT_FALSE(map.Insert("any", std::make_shared<int>(0)).inserted);
+    EXPECT_EQ(*map.Pop("any"), 3);
+
+    EXPECT_TRUE(map.Emplace("any", 4).inserted);
+    EXPECT_FALSE(map.Emplace("any", 0).inserted);
+    EXPECT_EQ(*map.Pop("any"), 4);
+
+    EXPECT_TRUE(map.TryEmplace("any", 5).inserted);
+    EXPECT_EQ(*map.TryEmplace("any", 0).value, 5);
+
+    map.InsertOrAssign("any", std::make_shared<int>(6));
+    EXPECT_EQ(*cmap["any"], 6);
+    EXPECT_EQ(map.SizeApprox(), 1);
+}
+
+UTEST(ShardedRcuMap, IterationCoversAllShards) {
+    constexpr int kKeys = 1000;
+    rcu::ShardedRcuMap<int, int> map{7};
+
+    std::unordered_map<int, std::shared_ptr<int>> raw;
+    for (int i = 0; i < kKeys; ++i) raw.emplace(i, std::make_shared<int>(i * 2));
+    map.Assign(std::move(raw));
+    EXPECT_EQ(map.SizeApprox(), kKeys);
+
+    std::vector<char> seen(kKeys, false);
+    for (const auto& [key, value] : map) {
+        ASSERT_TRUE(key >= 0 && key < kKeys);
+        EXPECT_FALSE(std::exchange(seen[key], true));
+        EXPECT_EQ(*value, key * 2);
+    }
+    EXPECT_EQ(std::count(seen.begin(), seen.end(), true), kKeys);
+
+    const auto snapshot = map.GetSnapshot();
+    EXPECT_EQ(snapshot.size(), kKeys);
+    EXPECT_EQ(*snapshot.at(42), 84);
+
+    for (int i = 0; i < kKeys; i += 2) EXPECT_TRUE(map.Erase(i));
+    EXPECT_EQ(map.SizeApprox(), kKeys / 2);
+    EXPECT_EQ(snapshot.size(), kKeys);
+
+    map.Clear();
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+UTEST(ShardedRcuMap, IterStability) {
+    rcu::ShardedRcuMap<int, int> map;
+    for (int i = 0; i < 100; ++i) *map[i] = i;
+
+    auto it = map.begin();
+    map.Clear();
+    for (int i = 100; i < 200; ++i) *map[i] = i;
+
+    std::size_t count = 0;
+    for (; it != map.end(); ++it) {
+        EXPECT_LT(it->first, 100);
+        ++count;
+    }
+    EXPECT_EQ(count, 100);
+}
+
+UTEST_MT(ShardedRcuMap, ConcurrentUpdates, 4) {
+    rcu::ShardedRcuMap<int, std::atomic<int>> map;
+    std::array<engine::TaskWithResult<void>, 4> workers;
+    std::atomic<bool> stop_flag{false};
+
+    for (std::size_t i = 0; i < workers.size(); ++i) {
+        workers[i] = utils::Async("writer", [i, &map, &stop_flag] {
+            const auto first_key = static_cast<int>(i * 1000);
+            while (!stop_flag) {
+                for (int key = first_key; key < first_key + 100; ++key) {
+                    ASSERT_TRUE(map.Emplace(key, key).inserted);
+                }
+                for (int key = first_key; key < first_key + 100; ++key) {
+                    ASSERT_EQ(*map.Pop(key), key);
+                }
+            }
+        });
+    }
+
+    auto reader = utils::Async("reader", [&map, &stop_flag] {
+        while (!stop_flag) {
+            for (const auto& [key, value] : map) {
+                ASSERT_EQ(*value, key);
+            }
+        }
+    });
+
+    engine::SleepFor(std::chrono::milliseconds(100));
+    stop_flag = true;
+    for (auto& w : workers) w.Get();
+    reader.Get();
+
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+UTEST(ShardedRcuMap, SampleShardedRcuMap) {
+    /// [Sample rcu::ShardedRcuMap usage]
+    struct ClientState {
+        std::atomic<int> requests{0};
+    };
+    rcu::ShardedRcuMap<std::string, ClientState> clients;
+
+    // Inserting a new key copies only a single shard of the map
+    clients["client-1"]->requests++;
+    clients["client-2"]->requests++;
+    clients["client-1"]->requests++;
+
+    ASSERT_EQ(clients["client-1"]->requests.load(), 2);
+    ASSERT_EQ(clients["client-2"]->requests.load(), 1);
+    /// [Sample rcu::ShardedRcuMap usage]
+}
+
+USERVER_NAMESPACE_END
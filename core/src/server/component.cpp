@@ -213,6 +213,11 @@ properties:
                         type: integer
                         description: delay in microseconds of the start of abort check routine
                         defaultDescription: 20ms
+                    max_pipelined_requests:
+                        type: integer
+                        description: max count of HTTP/1.1 pipelined requests of a single connection that are handled concurrently; responses are still sent in the order of requests
+                        defaultDescription: 1
+                        minimum: 1
                     http-version:
                         type: string
                         description: HTTP protocol version - 1.1 or 2
@@ -253,7 +253,11 @@ void HttpHandlerBase::HandleHttpRequest(http::HttpRequest& http_request, request
         HandleRequestStream(http_request, context);
     } else {
         // !IsBodyStreamed()
-        response.SetData(HandleRequest(http_request, context));
+        auto data = HandleRequest(http_request, context);
+        // The handler may have already provided a shared body
+        if (!data.empty() || !response.HasSharedData()) {
+            response.SetData(std::move(data));
+        }
     }
 }
 
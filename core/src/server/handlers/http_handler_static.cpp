@@ -1,9 +1,19 @@
 #include <userver/server/handlers/http_handler_static.hpp>
 
+#include <memory>
+#include <string_view>
+
+#include <fmt/format.h>
+
+#include <server/http/http_cached_date.hpp>
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+#include <userver/utils/text_light.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -32,6 +42,89 @@ const dynamic_config::Key<dynamic_config::ValueDict<std::string>> kContentTypeMa
 )"},
 };
 
+std::string_view TrimView(std::string_view value) {
+    while (!value.empty() && utils::text::IsAsciiSpace(value.front())) value.remove_prefix(1);
+    while (!value.empty() && utils::text::IsAsciiSpace(value.back())) value.remove_suffix(1);
+    return value;
+}
+
+std::string_view RemoveWeakPrefix(std::string_view etag) {
+    if (utils::text::StartsWith(etag, "W/")) etag.remove_prefix(2);
+    return etag;
+}
+
+// RFC 9110, 13.1.2. If-None-Match uses the weak comparison
+bool IsEtagMatched(std::string_view if_none_match, std::string_view etag) {
+    for (const auto item : utils::text::SplitIntoStringViewVector(if_none_match, ",")) {
+        const auto trimmed = TrimView(item);
+        if (trimmed == "*" || RemoveWeakPrefix(trimmed) == RemoveWeakPrefix(etag)) return true;
+    }
+    return false;
+}
+
+// RFC 9110, 13.1.3. Like nginx does by default, only the exact match of
+// If-Modified-Since with Last-Modified is considered
+bool IsNotModified(const http::HttpRequest& request, std::string_view etag, std::string_view last_modified) {
+    const auto& if_none_match = request.GetHeader(USERVER_NAMESPACE::http::headers::kIfNoneMatch);
+    if (!if_none_match.empty()) {
+        return IsEtagMatched(if_none_match, etag);
+    }
+
+    const auto& if_modified_since = request.GetHeader(USERVER_NAMESPACE::http::headers::kIfModifiedSince);
+    return !if_modified_since.empty() && TrimView(if_modified_since) == last_modified;
+}
+
+bool IsZeroQuality(std::string_view params) {
+    for (const auto param : utils::text::SplitIntoStringViewVector(params, ";")) {
+        auto trimmed = TrimView(param);
+        if (!utils::text::ICaseStartsWith(trimmed, "q=")) continue;
+        trimmed.remove_prefix(2);
+        return trimmed.find_first_not_of("0.") == std::string_view::npos;
+    }
+    return false;
+}
+
+// RFC 9110, 12.5.3
+bool IsEncodingAccepted(std::string_view accept_encoding, std::string_view encoding) {
+    const utils::StrIcaseEqual equal;
+    for (const auto item : utils::text::SplitIntoStringViewVector(accept_encoding, ",")) {
+        const auto params_pos = item.find(';');
+        const auto coding = TrimView(item.substr(0, params_pos));
+        if (!equal(coding, encoding)) continue;
+        return params_pos == std::string_view::npos || !IsZeroQuality(item.substr(params_pos + 1));
+    }
+    return false;
+}
+
+struct Representation {
+    std::shared_ptr<const std::string> data;
+    // empty for the identity encoding
+    std::string_view encoding;
+};
+
+// Returns the best representation of the file that the client accepts, its
+// data shares the ownership with `file`.
+Representation SelectRepresentation(const http::HttpRequest& request, const fs::FileInfoWithDataConstPtr& file) {
+    const auto& accept_encoding = request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding);
+    if (!file->zstd_data.empty() && IsEncodingAccepted(accept_encoding, "zstd")) {
+        return {{file, &file->zstd_data}, "zstd"};
+    }
+    if (!file->gzip_data.empty() && IsEncodingAccepted(accept_encoding, "gzip")) {
+        return {{file, &file->gzip_data}, "gzip"};
+    }
+    return {{file, &file->data}, {}};
+}
+
+// RFC 9110, 8.8.3.3. Representations with different content codings must have
+// different strong validators, so the coding is appended to the file ETag
+std::string MakeEtag(std::string_view file_etag, std::string_view encoding) {
+    if (encoding.empty()) return std::string{file_etag};
+
+    UASSERT(file_etag.size() >= 2 && file_etag.back() == '"');
+    file_etag.remove_suffix(1);
+    return fmt::format("{}-{}\"", file_etag, encoding);
+}
+
 }  // namespace
 
 HttpHandlerStatic::HttpHandlerStatic(
@@ -47,14 +140,37 @@ HttpHandlerStatic::HttpHandlerStatic(
 
 std::string HttpHandlerStatic::HandleRequestThrow(const http::HttpRequest& request, request::RequestContext&) const {
     LOG_DEBUG() << "Handler: " << request.GetRequestPath();
+    auto& response = request.GetHttpResponse();
     const auto file = storage_.TryGetFile(request.GetRequestPath());
-    if (file) {
-        const auto config = config_.GetSnapshot();
-        request.GetHttpResponse().SetContentType(config[kContentTypeMap][file->extension]);
-        return file->data;
+    if (!file) {
+        response.SetStatusNotFound();
+        return "File not found";
+    }
+
+    const auto config = config_.GetSnapshot();
+    response.SetContentType(config[kContentTypeMap][file->extension]);
+
+    auto representation = SelectRepresentation(request, file);
+    if (!file->gzip_data.empty() || !file->zstd_data.empty()) {
+        response.SetHeader(USERVER_NAMESPACE::http::headers::kVary, std::string{"Accept-Encoding"});
+    }
+
+    auto etag = MakeEtag(file->etag, representation.encoding);
+    auto last_modified = http::impl::MakeHttpDate(file->last_modified);
+    const bool not_modified = IsNotModified(request, etag, last_modified);
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kETag, std::move(etag));
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kLastModified, std::move(last_modified));
+    if (not_modified) {
+        response.SetStatus(http::HttpStatus::kNotModified);
+        return {};
+    }
+
+    if (!representation.encoding.empty()) {
+        response.SetContentEncoding(std::string{representation.encoding});
     }
-    request.GetHttpResponse().SetStatusNotFound();
-    return "File not found";
+    // The file is shared with the response without copying
+    response.SetSharedData(std::move(representation.data));
+    return {};
 }
 
 yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
@@ -62,7 +178,8 @@ yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
 type: object
 description: |
     Handler that returns HTTP 200 if file exist
-    and returns file data with mapped content/type
+    and returns file data with mapped content/type.
+    Supports conditional requests and precompressed files
 additionalProperties: false
 properties:
     fs-cache-component:
@@ -1,9 +1,14 @@
 #include <benchmark/benchmark.h>
 
 #include <fmt/compile.h>
+#include <array>
+#include <memory>
 #include <sstream>
 
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
 #include <userver/http/common_headers.hpp>
+#include <userver/internal/net/net_listener.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/http/http_status.hpp>
 #include <userver/utils/small_string.hpp>
@@ -135,8 +140,42 @@ void HttpResponseSetHeaderBenchmark(benchmark::State& state) {
     }
 }
 
+// Emulates serving a large cached file, e.g. by server::handlers::HttpHandlerStatic
+void HttpResponseLargeBody(benchmark::State& state, bool shared) {
+    engine::RunStandalone(2, [&] {
+        const auto deadline = engine::Deadline::FromDuration(std::chrono::seconds{60});
+        const auto file = std::make_shared<const std::string>(static_cast<std::size_t>(state.range(0)), 'a');
+
+        server::request::ResponseDataAccounter accounter;
+        const auto request = server::http::HttpRequestBuilder{accounter}.Build();
+
+        auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(deadline);
+        auto reader = engine::AsyncNoSpan([&deadline, client = std::move(client)]() mutable {
+            std::array<char, 64 * 1024> buffer{};
+            while (client.RecvSome(buffer.data(), buffer.size(), deadline) != 0) {
+            }
+        });
+
+        for ([[maybe_unused]] auto _ : state) {
+            server::http::HttpResponse response{*request, accounter};
+            if (shared) {
+                response.SetSharedData(file);
+            } else {
+                response.SetData(*file);
+            }
+            response.SendResponse(server);
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+
+        server.Close();
+        reader.Get();
+    });
+}
+
 }  // namespace
 
+BENCHMARK_CAPTURE(HttpResponseLargeBody, copy, false)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK_CAPTURE(HttpResponseLargeBody, shared, true)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
 BENCHMARK(http_headers_serialization_inplace);
 BENCHMARK(http_headers_serialization_no_ostreams);
 BENCHMARK(http_headers_serialization_ostreams);
@@ -41,6 +41,47 @@ UTEST(HttpResponse, Smoke) {
     EXPECT_EQ(reply.substr(reply.size() - 4 - kBody.size()), fmt::format("\r\n\r\n{}", kBody));
 }
 
+UTEST(HttpResponse, SharedData) {
+    const auto test_deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    server::request::ResponseDataAccounter accounter;
+    auto request = server::http::HttpRequestBuilder{accounter}.Build();
+    server::http::HttpResponse response{*request, accounter};
+
+    const auto body = std::make_shared<const std::string>("shared data");
+    response.SetSharedData(body);
+    EXPECT_TRUE(response.HasSharedData());
+    EXPECT_EQ(&response.GetData(), body.get());
+
+    auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+    auto send_task = engine::AsyncNoSpan(
+        [](auto&& response, auto&& socket) { response.SendResponse(socket); }, std::ref(response), std::move(server)
+    );
+
+    std::string buffer(4096, '\0');
+    const auto reply_size = client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+    buffer.resize(reply_size);
+
+    EXPECT_THAT(buffer, testing::EndsWith("\r\n\r\n" + *body));
+    EXPECT_EQ(*body, "shared data");
+}
+
+UTEST(HttpResponse, SharedDataReplacedBySetData) {
+    server::request::ResponseDataAccounter accounter;
+    auto request = server::http::HttpRequestBuilder{accounter}.Build();
+    server::http::HttpResponse response{*request, accounter};
+
+    response.SetSharedData(std::make_shared<const std::string>("shared data"));
+    response.SetData("own data");
+    EXPECT_FALSE(response.HasSharedData());
+    EXPECT_EQ(response.GetData(), "own data");
+
+    response.SetSharedData(std::make_shared<const std::string>("shared data"));
+    EXPECT_EQ(response.ExtractData(), "shared data");
+    EXPECT_FALSE(response.HasSharedData());
+    response.SetSendFailed(std::chrono::steady_clock::now());
+}
+
 UTEST(HttpResponse, AccounterLifetimeIfNotSent) {
     auto accounter = std::make_unique<server::request::ResponseDataAccounter>();
     const auto request = server::http::HttpRequestBuilder{*accounter}.Build();
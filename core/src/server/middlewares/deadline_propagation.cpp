@@ -1,5 +1,6 @@
 #include <server/middlewares/deadline_propagation.hpp>
 
+#include <engine/task/task_context.hpp>
 #include <server/handlers/http_server_settings.hpp>
 #include <server/request/internal_request_context.hpp>
 
@@ -166,6 +167,9 @@ void DeadlinePropagation::SetupInheritedDeadline(
 
     if (config_snapshot[handlers::kCancelHandleRequestByDeadline]) {
         engine::current_task::SetDeadline(deadline);
+        // Lets deadline-aware task queues order the request task and its
+        // subtasks, they also drop the subtasks that expire in the queue
+        engine::current_task::GetCurrentTaskContext().SetSchedulingDeadline(deadline);
     }
 }
 
@@ -2,6 +2,7 @@
 
 #include <array>
 #include <system_error>
+#include <utility>
 #include <vector>
 
 #include <server/http/http2_session.hpp>
@@ -97,6 +98,19 @@ void Connection::ListenForRequests() noexcept {
         while (is_accepting_requests_) {
             auto deadline = engine::Deadline::FromDuration(config_.keepalive_timeout);
 
+            if (pending_data_size_ == 0 && !in_flight_requests_.empty()) {
+                // Pick up the rest of the pipeline (if any) to start its handlers
+                // before waiting for the in-flight ones.
+                if (!ReadSome()) {
+                    // The peer is gone, the in-flight handlers are cancelled below
+                    LOG_DEBUG() << "Peer " << Getpeername() << " on fd " << Fd() << " closed the pipelined connection";
+                    return;
+                }
+                if (pending_data_size_ != 0) continue;
+
+                FinishPipelinedRequests();
+            }
+
             if (pending_data_size_ == 0) {
                 if (!WaitOnSocket(deadline)) {
                     return;
@@ -125,12 +139,18 @@ void Connection::ListenForRequests() noexcept {
             pending_data_size_ = 0;
 
             for (auto&& request : pending_requests_) {
-                ProcessRequest(std::move(request));
+                if (IsPipeliningEnabled() && !request->IsUpgradeWebsocket()) {
+                    StartPipelinedRequest(std::move(request));
+                } else {
+                    FinishPipelinedRequests();
+                    ProcessRequest(std::move(request));
+                }
             }
             pending_requests_.resize(0);
             if (should_stop_accepting_requests) is_accepting_requests_ = false;
         }
 
+        FinishPipelinedRequests();
         LOG_TRACE() << "Gracefully stopping ListenForRequests()";
     } catch (const engine::io::IoTimeout&) {
         LOG_INFO() << "Closing idle connection on timeout";
@@ -145,6 +165,8 @@ void Connection::ListenForRequests() noexcept {
     } catch (const std::exception& ex) {
         LOG_ERROR() << "Error while receiving from peer " << Getpeername() << " on fd " << Fd() << ": " << ex;
     }
+
+    CancelPipelinedRequests();
 }
 
 bool Connection::WaitOnSocket(engine::Deadline deadline) {
@@ -156,15 +178,16 @@ bool Connection::WaitOnSocket(engine::Deadline deadline) {
             auto* session = static_cast<http::Http2Session*>(parser_.get());
             auto& streaming_event = session->GetStreamingEvent();
             while (true) {
-                auto notified_event = engine::CriticalAsyncNoSpan([&streaming_event] {
-                    [[maybe_unused]] const auto res = streaming_event.WaitForEvent();
-                });
-                const auto indx = engine::WaitAnyUntil(deadline, peer_socket_->GetReadableBase(), notified_event);
+                const auto indx = engine::WaitAnyUntil(deadline, peer_socket_->GetReadableBase(), streaming_event);
                 if (!indx) {
                     return false;
                 }
                 const auto index = indx.value();
                 if (index == 1) {
+                    // WaitAny does not consume the signal. Reset it before
+                    // draining the events, so that the events pushed after
+                    // HandleStreamingEvents wake us up again.
+                    streaming_event.Reset();
                     session->HandleStreamingEvents();
                 } else {
                     UASSERT(index == 0);
@@ -216,6 +239,62 @@ void Connection::ProcessRequest(std::shared_ptr<http::HttpRequest>&& request_ptr
     if (request_ptr->IsUpgradeWebsocket()) request_ptr->DoUpgrade(std::move(peer_socket_), std::move(remote_address_));
 }
 
+bool Connection::IsPipeliningEnabled() const noexcept {
+    return config_.max_pipelined_requests > 1 && config_.http_version == USERVER_NAMESPACE::http::HttpVersion::k11;
+}
+
+void Connection::StartPipelinedRequest(std::shared_ptr<http::HttpRequest>&& request_ptr) {
+    if (request_ptr->IsFinal()) {
+        is_accepting_requests_ = false;
+    }
+
+    if (in_flight_requests_.size() >= config_.max_pipelined_requests) {
+        FinishOldestPipelinedRequest();
+    }
+
+    stats_->active_request_count.Add(1);
+
+    auto task = request_handler_.StartRequestTask(request_ptr);
+    in_flight_requests_.push_back({std::move(request_ptr), std::move(task)});
+}
+
+void Connection::FinishOldestPipelinedRequest() {
+    UASSERT(!in_flight_requests_.empty());
+    auto in_flight = std::move(in_flight_requests_.front());
+    in_flight_requests_.pop_front();
+
+    WaitForRequestTask(*in_flight.request, in_flight.task);
+    SendResponse(*in_flight.request);
+}
+
+void Connection::FinishPipelinedRequests() {
+    while (!in_flight_requests_.empty()) {
+        FinishOldestPipelinedRequest();
+    }
+}
+
+void Connection::CancelPipelinedRequests() noexcept {
+    if (in_flight_requests_.empty()) return;
+
+    LOG_DEBUG() << "Cancelling " << in_flight_requests_.size() << " pipelined request(s) on fd " << Fd();
+    for (auto& in_flight : in_flight_requests_) {
+        in_flight.task.RequestCancel();
+    }
+
+    is_response_chain_valid_ = false;
+    while (!in_flight_requests_.empty()) {
+        auto in_flight = std::move(in_flight_requests_.front());
+        in_flight_requests_.pop_front();
+
+        in_flight.task.SyncCancel();
+        try {
+            SendResponse(*in_flight.request);
+        } catch (const std::exception& ex) {
+            LOG_ERROR() << "Error while finalizing a cancelled pipelined request: " << ex;
+        }
+    }
+}
+
 bool Connection::ReadSome() {
     if (pending_data_size_ == pending_data_.size()) return true;
 
@@ -241,18 +320,22 @@ bool Connection::ReadSome() {
 
 engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<http::HttpRequest>& request) noexcept {
     auto request_task = request_handler_.StartRequestTask(request);
+    WaitForRequestTask(*request, request_task);
+    return request_task;
+}
 
+void Connection::WaitForRequestTask(http::HttpRequest& request, engine::TaskWithResult<void>& request_task) noexcept {
     if (engine::current_task::IsCancelRequested()) {
-        // We could've packed all remaining requests into a vector and cancel them
-        // in parallel. But pipelining is almost never used so why bother.
+        // In pipelined mode the rest of the in-flight requests are cancelled in
+        // parallel by CancelPipelinedRequests().
         request_task.SyncCancel();
         LOG_DEBUG() << "Request processing interrupted";
         is_response_chain_valid_ = false;
-        return request_task;  // avoids throwing and catching exception down below
+        return;  // avoids throwing and catching exception down below
     }
 
     try {
-        auto& response = request->GetHttpResponse();
+        auto& response = request.GetHttpResponse();
         if (response.IsBodyStreamed()) {
             // TODO: wait for TCP connection closure too
             response.WaitForHeadersEnd();
@@ -291,7 +374,7 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<h
         auto lvl =
             reason == engine::TaskCancellationReason::kUserRequest ? logging::Level::kWarning : logging::Level::kError;
         LOG_LIMITED(lvl) << "Handler task was cancelled with reason: " << ToString(reason);
-        auto& response = request->GetHttpResponse();
+        auto& response = request.GetHttpResponse();
         if (!response.IsReady()) {
             response.SetReady();
             response.SetStatusServiceUnavailable();
@@ -301,9 +384,8 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<h
         is_response_chain_valid_ = false;
     } catch (const std::exception& e) {
         LOG_WARNING() << "Request failed with unhandled exception: " << e;
-        request->MarkAsInternalServerError();
+        request.MarkAsInternalServerError();
     }
-    return request_task;
 }
 
 void Connection::SendResponse(http::HttpRequest& request) {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <string>
 
@@ -48,7 +49,14 @@ private:
     void ProcessRequest(std::shared_ptr<http::HttpRequest>&& request_ptr);
     bool WaitOnSocket(engine::Deadline deadline);
 
+    bool IsPipeliningEnabled() const noexcept;
+    void StartPipelinedRequest(std::shared_ptr<http::HttpRequest>&& request_ptr);
+    void FinishOldestPipelinedRequest();
+    void FinishPipelinedRequests();
+    void CancelPipelinedRequests() noexcept;
+
     engine::TaskWithResult<void> HandleQueueItem(const std::shared_ptr<http::HttpRequest>& request) noexcept;
+    void WaitForRequestTask(http::HttpRequest& request, engine::TaskWithResult<void>& request_task) noexcept;
     void SendResponse(http::HttpRequest& request);
 
     std::string Getpeername() const;
@@ -69,6 +77,16 @@ private:
     using HttpRequestPtr = std::shared_ptr<http::HttpRequest>;
     std::vector<HttpRequestPtr> pending_requests_;
 
+    // Requests with already started handler tasks, in the order of arrival.
+    // Responses are sent strictly from the front of the queue, so the queue
+    // works as a reorder buffer bounded by
+    // ConnectionConfig::max_pipelined_requests.
+    struct InFlightRequest {
+        HttpRequestPtr request;
+        engine::TaskWithResult<void> task;
+    };
+    std::deque<InFlightRequest> in_flight_requests_;
+
     engine::io::Sockaddr remote_address_;
     std::string peer_name_;
 
@@ -0,0 +1,118 @@
+#include <server/net/connection.hpp>
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <string_view>
+
+#include <benchmark/benchmark.h>
+
+#include <server/http/request_handler_base.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/server/request/request_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr auto kDeadlineMaxTime = std::chrono::seconds{60};
+constexpr auto kHandlerDelay = std::chrono::microseconds{200};
+
+// Emulates a handler that mostly waits for some I/O
+class SleepingRequestHandler final : public server::http::RequestHandlerBase {
+public:
+    engine::TaskWithResult<void> StartRequestTask(std::shared_ptr<server::http::HttpRequest> request) const override {
+        return engine::AsyncNoSpan([request = std::move(request)] {
+            engine::SleepFor(kHandlerDelay);
+            auto& response = request->GetHttpResponse();
+            response.SetStatusOk();
+            response.SetData("ok");
+        });
+    }
+
+    const server::http::HandlerInfoIndex& GetHandlerInfoIndex() const override { return handler_info_index_; }
+
+    const logging::TextLoggerPtr& LoggerAccess() const noexcept override { return no_logger_; }
+    const logging::TextLoggerPtr& LoggerAccessTskv() const noexcept override { return no_logger_; }
+
+private:
+    logging::TextLoggerPtr no_logger_;
+    server::http::HandlerInfoIndex handler_info_index_;
+};
+
+std::size_t CountResponses(std::string_view data) {
+    std::size_t count = 0;
+    for (auto pos = data.find("\r\n\r\nok"); pos != std::string_view::npos; pos = data.find("\r\n\r\nok", pos + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+void RunPipelinedRequests(benchmark::State& state, std::size_t max_pipelined_requests) {
+    engine::RunStandalone(2, [&] {
+        const auto deadline = engine::Deadline::FromDuration(kDeadlineMaxTime);
+        const auto pipeline_depth = static_cast<std::size_t>(state.range(0));
+
+        server::net::ConnectionConfig config;
+        config.max_pipelined_requests = max_pipelined_requests;
+        const server::request::HttpRequestConfig handler_defaults{};
+        auto stats = std::make_shared<server::net::Stats>();
+        server::request::ResponseDataAccounter data_accounter;
+        const SleepingRequestHandler handler;
+
+        auto [server_socket, client] = internal::net::TcpListener{}.MakeSocketPair(deadline);
+        auto connection_task = engine::AsyncNoSpan([&, server_socket = std::move(server_socket)]() mutable {
+            server::net::Connection connection(
+                config,
+                handler_defaults,
+                std::make_unique<engine::io::Socket>(std::move(server_socket)),
+                {},
+                handler,
+                stats,
+                data_accounter
+            );
+            connection.Process();
+        });
+
+        std::string requests;
+        for (std::size_t i = 0; i < pipeline_depth; ++i) {
+            requests += "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n";
+        }
+
+        std::string responses;
+        std::array<char, 4096> buf{};
+        for ([[maybe_unused]] auto _ : state) {
+            [[maybe_unused]] const auto sent = client.SendAll(requests.data(), requests.size(), deadline);
+
+            responses.clear();
+            while (CountResponses(responses) < pipeline_depth) {
+                const auto received = client.RecvSome(buf.data(), buf.size(), deadline);
+                if (received == 0) {
+                    state.SkipWithError("Connection closed");
+                    break;
+                }
+                responses.append(buf.data(), received);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * pipeline_depth);
+
+        connection_task.SyncCancel();
+    });
+}
+
+}  // namespace
+
+void connection_pipelined_requests_sequential(benchmark::State& state) { RunPipelinedRequests(state, 1); }
+BENCHMARK(connection_pipelined_requests_sequential)->RangeMultiplier(2)->Range(1, 32);
+
+void connection_pipelined_requests_concurrent(benchmark::State& state) {
+    RunPipelinedRequests(state, static_cast<std::size_t>(state.range(0)));
+}
+BENCHMARK(connection_pipelined_requests_concurrent)->RangeMultiplier(2)->Range(1, 32);
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,9 @@
 #include <server/net/connection.hpp>
 
+#include <array>
+#include <string_view>
+#include <vector>
+
 #include <fmt/format.h>
 
 #include <server/handlers/http_handler_base_statistics.hpp>
@@ -8,7 +12,9 @@
 #include <userver/clients/http/client.hpp>
 #include <userver/engine/io/sockaddr.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/internal/net/net_listener.hpp>
 #include <userver/server/http/http_request.hpp>
+#include <userver/utils/from_string.hpp>
 
 #include <userver/utest/http_client.hpp>
 #include <userver/utest/utest.hpp>
@@ -23,7 +29,7 @@ constexpr auto kAcceptTimeout = utest::kMaxTestWaitTime;
 
 class TestHttprequestHandler : public server::http::RequestHandlerBase {
 public:
-    enum class Behaviors { kNoop, kHang };
+    enum class Behaviors { kNoop, kHang, kSleepAndEchoUrl };
 
     explicit TestHttprequestHandler(Behaviors behavior = Behaviors::kNoop) : behavior_(behavior) {}
 
@@ -40,6 +46,22 @@ public:
                     ASSERT_TRUE(engine::current_task::IsCancelRequested());
                     ++asyncs_finished;
                 });
+            case Behaviors::kSleepAndEchoUrl:
+                // URL is expected to be '/<milliseconds to sleep>'
+                return engine::AsyncNoSpan([this, http_request = std::move(http_request)]() {
+                    const auto in_flight = ++asyncs_in_flight;
+                    if (in_flight > max_asyncs_in_flight) max_asyncs_in_flight = in_flight;
+
+                    const auto& url = http_request->GetUrl();
+                    engine::SleepFor(std::chrono::milliseconds{utils::FromString<int>(url.substr(1))});
+
+                    auto& response = http_request->GetHttpResponse();
+                    response.SetStatusOk();
+                    response.SetData(url);
+
+                    --asyncs_in_flight;
+                    ++asyncs_finished;
+                });
         }
 
         UINVARIANT(false, "Unexpected behavior");
@@ -52,6 +74,10 @@ public:
 
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
     mutable std::atomic<std::size_t> asyncs_finished{0};
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+    mutable std::atomic<std::size_t> asyncs_in_flight{0};
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+    mutable std::atomic<std::size_t> max_asyncs_in_flight{0};
 
 private:
     const Behaviors behavior_;
@@ -95,6 +121,55 @@ net::ListenerConfig CreateConfig(
     return config;
 }
 
+// Returns bodies of all the complete responses in `data`
+std::vector<std::string> ParseResponseBodies(std::string_view data) {
+    constexpr std::string_view kContentLength = "Content-Length: ";
+
+    std::vector<std::string> bodies;
+    while (true) {
+        const auto headers_end = data.find("\r\n\r\n");
+        if (headers_end == std::string_view::npos) break;
+
+        const auto headers = data.substr(0, headers_end);
+        const auto length_pos = headers.find(kContentLength);
+        if (length_pos == std::string_view::npos) break;
+        const auto value_pos = length_pos + kContentLength.size();
+        const auto value_end = headers.find("\r\n", value_pos);
+        const auto length = utils::FromString<std::size_t>(
+            headers.substr(value_pos, value_end == std::string_view::npos ? value_end : value_end - value_pos)
+        );
+
+        const auto body_pos = headers_end + 4;
+        if (data.size() < body_pos + length) break;
+        bodies.emplace_back(data.substr(body_pos, length));
+        data.remove_prefix(body_pos + length);
+    }
+    return bodies;
+}
+
+// Sends all the requests in a single write and returns the response bodies
+// in the order they were received.
+std::vector<std::string> SendPipelinedRequests(engine::io::Socket& client, const std::vector<int>& delays_ms) {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    std::string requests;
+    for (const auto delay : delays_ms) {
+        requests += fmt::format("GET /{} HTTP/1.1\r\nHost: localhost\r\n\r\n", delay);
+    }
+    [[maybe_unused]] const auto sent = client.SendAll(requests.data(), requests.size(), deadline);
+
+    std::string responses;
+    std::vector<std::string> bodies;
+    std::array<char, 4096> buf{};
+    while (bodies.size() < delays_ms.size()) {
+        const auto received = client.RecvSome(buf.data(), buf.size(), deadline);
+        if (received == 0) break;
+        responses.append(buf.data(), received);
+        bodies = ParseResponseBodies(responses);
+    }
+    return bodies;
+}
+
 // The param tells which http protocol to use.
 class ServerNetConnection : public testing::TestWithParam<USERVER_NAMESPACE::http::HttpVersion> {};
 
@@ -355,4 +430,108 @@ UTEST_P(ServerNetConnection, CancelMultipleInFlight) {
     FAIL() << "Failed to simulate cancellation of multiple requests";
 }
 
+UTEST(ServerNetConnectionPipelining, RequestsSequential) {
+    net::ListenerConfig config = CreateConfig();
+    const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    auto [server_socket, client] = internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+
+    auto stats = std::make_shared<net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    TestHttprequestHandler handler{TestHttprequestHandler::Behaviors::kSleepAndEchoUrl};
+
+    auto task = engine::AsyncNoSpan([&, server_socket = std::move(server_socket)]() mutable {
+        net::Connection connection(
+            config.connection_config,
+            config.handler_defaults,
+            std::make_unique<engine::io::Socket>(std::move(server_socket)),
+            {},
+            handler,
+            stats,
+            data_accounter
+        );
+
+        connection.Process();
+    });
+
+    const auto bodies = SendPipelinedRequests(client, {30, 20, 10});
+    EXPECT_EQ(bodies, (std::vector<std::string>{"/30", "/20", "/10"}));
+    EXPECT_EQ(handler.asyncs_finished, 3);
+    EXPECT_EQ(handler.max_asyncs_in_flight, 1);
+
+    task.SyncCancel();
+}
+
+UTEST(ServerNetConnectionPipelining, RequestsConcurrent) {
+    constexpr std::size_t kMaxPipelinedRequests = 4;
+    net::ListenerConfig config = CreateConfig();
+    config.connection_config.max_pipelined_requests = kMaxPipelinedRequests;
+    const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    auto [server_socket, client] = internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+
+    auto stats = std::make_shared<net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    TestHttprequestHandler handler{TestHttprequestHandler::Behaviors::kSleepAndEchoUrl};
+
+    auto task = engine::AsyncNoSpan([&, server_socket = std::move(server_socket)]() mutable {
+        net::Connection connection(
+            config.connection_config,
+            config.handler_defaults,
+            std::make_unique<engine::io::Socket>(std::move(server_socket)),
+            {},
+            handler,
+            stats,
+            data_accounter
+        );
+
+        connection.Process();
+    });
+
+    // Later requests finish first, but the responses must keep the order
+    const auto bodies = SendPipelinedRequests(client, {60, 50, 40, 30, 20, 10});
+    EXPECT_EQ(bodies, (std::vector<std::string>{"/60", "/50", "/40", "/30", "/20", "/10"}));
+    EXPECT_EQ(handler.asyncs_finished, 6);
+    EXPECT_EQ(handler.max_asyncs_in_flight, kMaxPipelinedRequests);
+
+    // Keep-alive still works after the pipeline is drained
+    EXPECT_EQ(SendPipelinedRequests(client, {1}), std::vector<std::string>{"/1"});
+
+    task.SyncCancel();
+    EXPECT_EQ(stats->active_request_count.NonNegativeRead(), 0);
+}
+
+UTEST(ServerNetConnectionPipelining, PeerClosedCancelsInFlight) {
+    net::ListenerConfig config = CreateConfig();
+    config.connection_config.max_pipelined_requests = 4;
+    const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    auto [server_socket, client] = internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+
+    // The peer sends a pipeline and goes away without waiting for the responses
+    const std::string requests = "GET /1 HTTP/1.1\r\nHost: localhost\r\n\r\nGET /2 HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    [[maybe_unused]] const auto sent = client.SendAll(requests.data(), requests.size(), test_deadline);
+    client.Close();
+
+    auto stats = std::make_shared<net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    TestHttprequestHandler handler{TestHttprequestHandler::Behaviors::kHang};
+
+    auto task = engine::AsyncNoSpan([&, server_socket = std::move(server_socket)]() mutable {
+        net::Connection connection(
+            config.connection_config,
+            config.handler_defaults,
+            std::make_unique<engine::io::Socket>(std::move(server_socket)),
+            {},
+            handler,
+            stats,
+            data_accounter
+        );
+
+        connection.Process();
+    });
+
+    task.WaitFor(utest::kMaxTestWaitTime / 2);
+    ASSERT_TRUE(task.IsFinished()) << "in-flight handlers of a closed connection were not cancelled";
+    EXPECT_EQ(handler.asyncs_finished, 2);
+    EXPECT_EQ(stats->active_request_count.NonNegativeRead(), 0);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,80 @@
+#include <memory>
+#include <string>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/logging/impl/logger_base.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/ugrpc/tests/service.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+namespace {
+
+constexpr std::size_t kNameSize = 4096;
+
+class ArenaTestService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& /*context*/, sample::ugrpc::GreetingRequest&& request) override {
+        sample::ugrpc::GreetingResponse response;
+        response.set_name(std::to_string(request.name().size()));
+        return response;
+    }
+};
+
+class ArenaTestServer final : public tests::ServiceBase {
+public:
+    explicit ArenaTestServer(bool use_arena) {
+        if (use_arena) {
+            server::ArenaConfig arena;
+            arena.initial_block_size = 2 * kNameSize;
+            SetServiceArena(std::move(arena));
+        }
+        RegisterService(service_);
+        StartServer();
+    }
+
+    ~ArenaTestServer() override { StopServer(); }
+
+private:
+    ArenaTestService service_;
+};
+
+class NoopLogger final : public logging::impl::TextLogger {
+public:
+    NoopLogger() noexcept : TextLogger(logging::Format::kRaw) { SetLevel(logging::Level::kInfo); }
+    void Log(logging::Level, logging::impl::formatters::LoggerItemRef) override {}
+    void Flush() override {}
+};
+
+}  // namespace
+
+// Arg(0) - requests are parsed into the heap, Arg(1) - into per-call arenas
+void UnaryRPCArena(benchmark::State& state) {
+    const logging::DefaultLoggerGuard logger_guard{std::make_shared<NoopLogger>()};
+
+    engine::RunStandalone(2, [&] {
+        ArenaTestServer server{state.range(0) != 0};
+        auto client = server.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+        sample::ugrpc::GreetingRequest request;
+        request.set_name(std::string(kNameSize, 'x'));
+
+        for ([[maybe_unused]] auto _ : state) {
+            auto response = client.SayHello(request);
+            benchmark::DoNotOptimize(response);
+        }
+    });
+}
+
+BENCHMARK(UnaryRPCArena)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
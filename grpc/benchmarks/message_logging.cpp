@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <userver/logging/level.hpp>
+#include <userver/utils/log.hpp>
+
+#include <ugrpc/impl/logging.hpp>
+
+#include <tests/protobuf.pb.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+namespace {
+
+constexpr std::size_t kMaxSize = 512;
+
+sample::ugrpc::MessageWithDifferentTypes MakeMessage(std::size_t items) {
+    sample::ugrpc::MessageWithDifferentTypes message;
+    message.set_required_string("some-string-value");
+    for (std::size_t i = 0; i < items; ++i) {
+        message.add_repeated_primitive("repeated-value-" + std::to_string(i));
+        message.add_repeated_message()->set_required_int(i);
+    }
+    return message;
+}
+
+}  // namespace
+
+void MessageForLogging(benchmark::State& state) {
+    const auto message = MakeMessage(state.range(0));
+    impl::MessageLoggingOptions options;
+    options.log_level = logging::Level::kCritical;
+    options.max_size = kMaxSize;
+
+    for ([[maybe_unused]] auto _ : state) {
+        auto result = impl::GetMessageForLogging(message, options);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK(MessageForLogging)->RangeMultiplier(16)->Range(1, 1 << 16);
+
+// The previous approach, for comparison: the whole message is rendered
+void MessageForLoggingFullDebugString(benchmark::State& state) {
+    const auto message = MakeMessage(state.range(0));
+
+    for ([[maybe_unused]] auto _ : state) {
+        auto result = utils::log::ToLimitedUtf8(message.Utf8DebugString(), kMaxSize);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK(MessageForLoggingFullDebugString)->RangeMultiplier(16)->Range(1, 1 << 16);
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,54 @@
+#include <utility>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/current_task.hpp>
+#include <userver/ugrpc/tests/service.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+namespace {
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& /*context*/, sample::ugrpc::GreetingRequest&& request) override {
+        sample::ugrpc::GreetingResponse response;
+        response.set_name("Hello " + request.name());
+        return response;
+    }
+};
+
+}  // namespace
+
+// Sequential unary RPCs, i.e. the latency of a call.
+// Arg(0) - the server completion queues are polled by dedicated threads,
+// Arg(1) - by tasks on the task processor of the service.
+void UnaryRPCQueuePolling(benchmark::State& state) {
+    engine::RunStandalone(4, [&] {
+        server::ServerConfig config;
+        if (state.range(0)) {
+            config.completion_queue_task_processor = &engine::current_task::GetTaskProcessor();
+        }
+        tests::Service<UnitTestService> service{std::move(config)};
+        auto client = service.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+        sample::ugrpc::GreetingRequest request;
+        request.set_name("userver");
+        for ([[maybe_unused]] auto _ : state) {
+            auto response = client.SayHello(request);
+            benchmark::DoNotOptimize(response);
+        }
+    });
+}
+
+BENCHMARK(UnaryRPCQueuePolling)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 
 #include <grpcpp/completion_queue.h>
 
+#include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/utils/fixed_array.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -24,7 +25,12 @@ public:
     grpc::CompletionQueue& NextQueue();
 
 protected:
-    explicit CompletionQueuePoolBase(utils::FixedArray<std::unique_ptr<grpc::CompletionQueue>> queues);
+    // The queues are polled by tasks on 'polling_task_processor' if set,
+    // by dedicated threads otherwise
+    explicit CompletionQueuePoolBase(
+        utils::FixedArray<std::unique_ptr<grpc::CompletionQueue>> queues,
+        engine::TaskProcessor* polling_task_processor = nullptr
+    );
 
     // protected to prevent destruction via pointer to base.
     ~CompletionQueuePoolBase();
@@ -3,14 +3,24 @@
 #include <grpcpp/completion_queue.h>
 
 #include <userver/engine/single_use_event.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::impl {
 
+/// Delivers the events of a completion queue to the waiting tasks until the
+/// queue is shut down
 class QueueRunner final {
 public:
+    /// Polls the queue from a dedicated thread
     explicit QueueRunner(grpc::CompletionQueue& queue);
+
+    /// Polls the queue from a task on `task_processor`, so that the tasks woken
+    /// by the events may start on the polling thread without a handoff to
+    /// another thread. The worker thread is blocked while waiting for events.
+    QueueRunner(grpc::CompletionQueue& queue, engine::TaskProcessor& task_processor);
+
     ~QueueRunner();
 
 private:
@@ -52,6 +52,9 @@ public:
 
     void AccountCancelled() noexcept;
 
+    // Bytes allocated by the per-call protobuf arena of a finished call
+    void AccountArena(std::size_t space_allocated) noexcept;
+
     friend void DumpMetric(utils::statistics::Writer& writer, const MethodStatistics& stats);
 
     std::uint64_t GetStarted() const noexcept;
@@ -78,6 +81,9 @@ private:
 
     RateCounter deadline_updated_{0};
     RateCounter deadline_cancelled_{0};
+
+    RateCounter arena_calls_{0};
+    RateCounter arena_bytes_{0};
 };
 
 struct MethodStatisticsSnapshot final {
@@ -101,6 +107,9 @@ struct MethodStatisticsSnapshot final {
 
     Rate deadline_updated{0};
     Rate deadline_cancelled{0};
+
+    Rate arena_calls{0};
+    Rate arena_bytes{0};
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const MethodStatisticsSnapshot& stats);
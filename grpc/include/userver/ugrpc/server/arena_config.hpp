@@ -0,0 +1,36 @@
+#pragma once
+
+/// @file userver/ugrpc/server/arena_config.hpp
+/// @brief @copybrief ugrpc::server::ArenaConfig
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server {
+
+/// @brief Per-call protobuf arena settings of a service.
+///
+/// If enabled, each unary call gets its own `google::protobuf::Arena`. Request
+/// messages are parsed into the arena, handlers and middlewares may create
+/// their messages on it through @ref ugrpc::server::CallAnyBase::GetArena.
+///
+/// The memory of the arena is freed only when the call ends, even if the
+/// messages on it are destroyed earlier. Streaming calls never get an arena,
+/// because the memory of their messages would accumulate until the end of
+/// the stream.
+struct ArenaConfig final {
+    /// Size of the first block of the arena, should fit the messages of a
+    /// typical call to avoid further allocations.
+    std::size_t initial_block_size{1024};
+
+    /// Names of the methods to use the arena for, e.g. `SayHello`.
+    /// All the unary methods of the service if empty.
+    std::vector<std::string> methods{};
+};
+
+}  // namespace ugrpc::server
+
+USERVER_NAMESPACE_END
@@ -81,6 +81,14 @@ public:
     /// @endcode
     utils::AnyStorage<StorageContext>& GetStorageContext() { return params_.storage_context; }
 
+    /// @brief Returns the per-call protobuf arena, `nullptr` if the arena is
+    /// disabled for the method or the call is streaming, see
+    /// ugrpc::server::ArenaConfig
+    ///
+    /// The request messages of the call are allocated on the arena. Messages
+    /// created on it live until the end of the call.
+    google::protobuf::Arena* GetArena() { return params_.arena; }
+
     /// @brief Useful for generic error reporting via @ref FinishWithError
     virtual bool IsFinished() const = 0;
 
@@ -3,6 +3,7 @@
 /// @file userver/ugrpc/server/call_context.hpp
 /// @brief @copybrief ugrpc::server::CallContext
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/server_context.h>
 
 #include <userver/tracing/span.hpp>
@@ -61,6 +62,17 @@ public:
     /// @endcode
     utils::AnyStorage<StorageContext>& GetStorageContext();
 
+    /// @brief Returns the per-call protobuf arena, `nullptr` if the arena is
+    /// disabled for the method or the call is streaming, see
+    /// ugrpc::server::ArenaConfig
+    ///
+    /// Messages created on the arena live until the end of the call:
+    ///
+    /// @code
+    /// auto* item = google::protobuf::Arena::Create<sample::Item>(context.GetArena());
+    /// @endcode
+    google::protobuf::Arena* GetArena();
+
 protected:
     /// @cond
     const CallAnyBase& GetCall() const;
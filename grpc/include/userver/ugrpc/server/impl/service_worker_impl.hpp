@@ -7,6 +7,7 @@
 #include <type_traits>
 #include <utility>
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/impl/service_type.h>
 #include <grpcpp/server_context.h>
@@ -74,6 +75,9 @@ void ParseGenericCallName(
     std::string_view& method_name
 );
 
+std::optional<google::protobuf::ArenaOptions>
+MakeArenaOptions(const ServiceSettings& settings, std::string_view method_name);
+
 /// Per-gRPC-service data
 template <typename GrpcppService>
 struct ServiceData final {
@@ -103,6 +107,10 @@ struct MethodData final {
     // Remove name of the service and slash
     std::string_view method_name{GetMethodName(service_data.metadata, method_id)};
     ugrpc::impl::MethodStatistics& statistics{service_data.service_statistics.GetMethodStatistics(method_id)};
+    // Streaming calls may live indefinitely, so their arenas would only grow
+    std::optional<google::protobuf::ArenaOptions> arena_options{
+        CallTraits::kCallCategory == CallCategory::kUnary ? MakeArenaOptions(service_data.settings, method_name)
+                                                          : std::nullopt};
 };
 
 template <typename GrpcppService, typename CallTraits>
@@ -111,6 +119,12 @@ public:
     explicit CallData(const MethodData<GrpcppService, CallTraits>& method_data)
         : wait_token_(method_data.service_data.wait_tokens.GetToken()), method_data_(method_data) {
         UASSERT(method_data.method_id < GetMethodsCount(method_data.service_data.metadata));
+        if (method_data_.arena_options) {
+            arena_.emplace(*method_data_.arena_options);
+            if constexpr (!std::is_same_v<InitialRequest, NoInitialRequest>) {
+                initial_request_ = google::protobuf::Arena::Create<InitialRequest>(&*arena_);
+            }
+        }
     }
 
     void operator()() && {
@@ -127,7 +141,7 @@ public:
 
         // the request for an incoming RPC must be performed synchronously
         method_data_.service_data.async_service.template Prepare<CallTraits>(
-            method_data_.method_id, context_, initial_request_, raw_responder_, queue, queue, prepare_.GetTag()
+            method_data_.method_id, context_, *initial_request_, raw_responder_, queue, queue, prepare_.GetTag()
         );
 
         // Note: we ignore task cancellations here. Even if notify_when_done has
@@ -198,7 +212,8 @@ private:
                 *access_tskv_logger,
                 span_->Get(),
                 storage_context,
-                middlewares},
+                middlewares,
+                arena_ ? &*arena_ : nullptr},
             raw_responder_
         );
 
@@ -211,7 +226,7 @@ private:
                 CallContext context{responder};
                 if constexpr (CallTraits::kCallCategory == CallCategory::kUnary) {
                     auto result =
-                        (method_data_.service.*(method_data_.service_method))(context, std::move(initial_request_));
+                        (method_data_.service.*(method_data_.service_method))(context, std::move(*initial_request_));
                     Finalize(responder, std::move(result));
                 } else if constexpr (CallTraits::kCallCategory == CallCategory::kInputStream) {
                     auto result = (method_data_.service.*(method_data_.service_method))(context, responder);
@@ -219,7 +234,7 @@ private:
                 } else if constexpr (CallTraits::kCallCategory == CallCategory::kOutputStream) {
                     auto result =
                         (method_data_.service.*(method_data_.service_method)
-                        )(context, std::move(initial_request_), responder);
+                        )(context, std::move(*initial_request_), responder);
                     Finalize(responder, std::move(result));
                 } else if constexpr (CallTraits::kCallCategory == CallCategory::kBidirectionalStream) {
                     auto result = (method_data_.service.*(method_data_.service_method))(context, responder);
@@ -233,7 +248,7 @@ private:
         try {
             ::google::protobuf::Message* initial_request = nullptr;
             if constexpr (!std::is_same_v<InitialRequest, NoInitialRequest>) {
-                initial_request = &initial_request_;
+                initial_request = initial_request_;
             }
 
             MiddlewareCallContext middleware_context(
@@ -255,6 +270,10 @@ private:
         } catch (const std::exception& ex) {
             ReportHandlerError(ex, call_name, span_->Get(), statistics_scope);
         }
+
+        if (arena_) {
+            method_data_.statistics.AccountArena(arena_->SpaceAllocated());
+        }
     }
 
     // 'wait_token_' must be the first field, because its lifetime keeps
@@ -264,7 +283,11 @@ private:
     MethodData<GrpcppService, CallTraits> method_data_;
 
     typename CallTraits::ContextType context_{};
-    InitialRequest initial_request_{};
+    // Per-call protobuf arena, must outlive the messages allocated on it
+    std::optional<google::protobuf::Arena> arena_{};
+    InitialRequest heap_initial_request_{};
+    // Points either to 'heap_initial_request_' or to a message on 'arena_'
+    InitialRequest* initial_request_{&heap_initial_request_};
     RawCall raw_responder_{&context_};
     ugrpc::impl::AsyncMethodInvocation prepare_;
     std::optional<tracing::InPlaceSpan> span_{};
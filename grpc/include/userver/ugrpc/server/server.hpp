@@ -60,6 +60,14 @@ struct ServerConfig final {
     /// of worker threads for best RPS.
     std::size_t completion_queue_num{2};
 
+    /// If set, the completion queues are polled by tasks on this task processor
+    /// instead of dedicated threads. The RPC tasks woken by the events may then
+    /// start on the polling thread without a handoff to another thread. The
+    /// polling tasks block their worker threads while waiting for events, so
+    /// the task processor must have more worker threads than completion queues,
+    /// otherwise the server constructor throws.
+    engine::TaskProcessor* completion_queue_task_processor{nullptr};
+
     /// Optional grpc-core channel args
     /// @see https://grpc.github.io/grpc/core/group__grpc__arg__keys.html
     std::unordered_map<std::string, std::string> channel_args{};
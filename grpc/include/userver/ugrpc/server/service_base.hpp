@@ -3,8 +3,11 @@
 /// @file userver/ugrpc/server/service_base.hpp
 /// @brief @copybrief ugrpc::server::ServiceBase
 
+#include <optional>
+
 #include <userver/engine/task/task_processor_fwd.hpp>
 
+#include <userver/ugrpc/server/arena_config.hpp>
 #include <userver/ugrpc/server/call_context.hpp>
 #include <userver/ugrpc/server/impl/service_worker.hpp>
 #include <userver/ugrpc/server/middlewares/fwd.hpp>
@@ -20,6 +23,9 @@ struct ServiceConfig final {
 
     /// Server middlewares to use for the gRPC service.
     Middlewares middlewares;
+
+    /// Per-call protobuf arena settings, the arena is not used if not set.
+    std::optional<ArenaConfig> arena{};
 };
 
 /// @brief The type-erased base class for all gRPC service implementations
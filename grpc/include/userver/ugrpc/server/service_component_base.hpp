@@ -38,6 +38,8 @@ struct ServiceInfo final {
 /// disable-user-pipeline-middlewares | flag to disable `groups::User` middlewares from pipeline | false
 /// disable-all-pipeline-middlewares | flag to disable all middlewares from pipline | false
 /// middlewares | middlewares names to use | `{}` (use server defaults)
+/// arena.initial-block-size | size of the first block of a per-call protobuf arena | 1024
+/// arena.methods | names of the methods to use per-call protobuf arenas for | all the methods if `arena` is set
 
 // clang-format on
 
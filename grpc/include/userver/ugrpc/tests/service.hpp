@@ -63,6 +63,10 @@ public:
     /// Server middlewares can be modified before the first RegisterService call.
     void SetServerMiddlewares(server::Middlewares middlewares);
 
+    /// Per-call protobuf arena of the services can be set before the first
+    /// RegisterService call, see ugrpc::server::ArenaConfig.
+    void SetServiceArena(std::optional<server::ArenaConfig> arena);
+
     /// Client middlewares can be modified before the first RegisterService call.
     void SetClientMiddlewareFactories(client::MiddlewareFactories middleware_factories);
 
@@ -93,6 +97,7 @@ private:
     std::optional<std::string> unix_socket_path_;
     server::Server server_;
     server::Middlewares server_middlewares_;
+    std::optional<server::ArenaConfig> service_arena_;
     client::MiddlewareFactories client_middleware_factories_;
     bool middlewares_change_allowed_{true};
     testsuite::GrpcControl testsuite_;
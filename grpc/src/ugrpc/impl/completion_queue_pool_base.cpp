@@ -11,8 +11,12 @@ namespace ugrpc::impl {
 
 static_assert(std::has_virtual_destructor_v<grpc::CompletionQueue>);
 
-CompletionQueuePoolBase::CompletionQueuePoolBase(utils::FixedArray<std::unique_ptr<grpc::CompletionQueue>> queues)
+CompletionQueuePoolBase::CompletionQueuePoolBase(
+    utils::FixedArray<std::unique_ptr<grpc::CompletionQueue>> queues,
+    engine::TaskProcessor* polling_task_processor
+)
     : queues_(std::move(queues)), queue_runners_(utils::GenerateFixedArray(queues_.size(), [&](std::size_t idx) {
+          if (polling_task_processor) return QueueRunner{*queues_[idx], *polling_task_processor};
           return QueueRunner{*queues_[idx]};
       })) {}
 
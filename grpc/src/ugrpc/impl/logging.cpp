@@ -1,37 +1,39 @@
 #include <ugrpc/impl/logging.hpp>
 
-#include <memory>
+#include <string_view>
+
+#include <fmt/format.h>
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/log.hpp>
+#include <userver/utils/text_light.hpp>
 
+#include <ugrpc/impl/message_printer.hpp>
 #include <ugrpc/impl/protobuf_utils.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::impl {
 
-namespace {
-
-std::string ToLimitedString(const google::protobuf::Message& message, std::size_t max_size) {
-    return utils::log::ToLimitedUtf8(message.Utf8DebugString(), max_size);
-}
-
-}  // namespace
-
 std::string GetMessageForLogging(const google::protobuf::Message& message, MessageLoggingOptions options) {
     if (!logging::ShouldLog(options.log_level)) {
         return "hidden by log level";
     }
 
-    if (!options.trim_secrets || !HasSecrets(message)) {
-        return ToLimitedString(message, options.max_size);
+    // Secret fields are skipped while printing, no need to copy the message
+    const bool skip_secrets = options.trim_secrets && HasSecrets(message);
+    const auto printed = ToLimitedDebugString(message, options.max_size, skip_secrets);
+    if (!printed.truncated) {
+        return utils::log::ToLimitedUtf8(printed.text, options.max_size);
     }
 
-    std::unique_ptr<google::protobuf::Message> trimmed{message.New()};
-    trimmed->CopyFrom(message);
-    TrimSecrets(*trimmed);
-    return ToLimitedString(*trimmed, options.max_size);
+    // The total size is unknown, the rest of the message is not rendered
+    std::string_view view = printed.text;
+    utils::text::utf8::TrimViewTruncatedEnding(view);
+    if (!utils::text::IsUtf8(view)) {
+        return "<Non utf-8, truncated>";
+    }
+    return fmt::format("{}...(truncated)", view);
 }
 
 }  // namespace ugrpc::impl
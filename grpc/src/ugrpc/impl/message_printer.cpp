@@ -0,0 +1,253 @@
+#include <ugrpc/impl/message_printer.hpp>
+
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <google/protobuf/descriptor.h>
+
+#include <userver/utils/assert.hpp>
+
+#include <ugrpc/impl/protobuf_utils.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+namespace {
+
+using google::protobuf::FieldDescriptor;
+
+// Descriptors return std::string or absl::string_view depending on the
+// protobuf version
+template <typename String>
+std::string_view ToStringView(const String& value) {
+    return {value.data(), value.size()};
+}
+
+class LimitedPrinter final {
+public:
+    LimitedPrinter(std::size_t max_size, bool skip_secrets) : max_size_(max_size), skip_secrets_(skip_secrets) {}
+
+    void PrintMessage(const google::protobuf::Message& message, std::size_t depth) {
+        const auto* reflection = message.GetReflection();
+        UINVARIANT(reflection, "reflection is nullptr");
+
+        // Only the set fields, ordered by the field number
+        std::vector<const FieldDescriptor*> fields;
+        reflection->ListFields(message, &fields);
+
+        for (const auto* field : fields) {
+            if (truncated_) return;
+            if (skip_secrets_ && GetFieldOptions(*field).secret()) continue;
+
+            if (field->is_repeated()) {
+                const int size = reflection->FieldSize(message, field);
+                for (int i = 0; i < size && !truncated_; ++i) {
+                    PrintField(message, *reflection, *field, i, depth);
+                }
+            } else {
+                PrintField(message, *reflection, *field, -1, depth);
+            }
+        }
+    }
+
+    LimitedDebugString Extract() && { return {std::move(text_), truncated_}; }
+
+private:
+    // 'index' is -1 for singular fields
+    void PrintField(
+        const google::protobuf::Message& message,
+        const google::protobuf::Reflection& reflection,
+        const FieldDescriptor& field,
+        int index,
+        std::size_t depth
+    ) {
+        PrintIndent(depth);
+        PrintFieldName(field);
+
+        if (field.cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+            Append(" {\n");
+            PrintMessage(
+                index < 0 ? reflection.GetMessage(message, &field)
+                          : reflection.GetRepeatedMessage(message, &field, index),
+                depth + 1
+            );
+            PrintIndent(depth);
+            Append("}\n");
+            return;
+        }
+
+        Append(": ");
+        PrintValue(message, reflection, field, index);
+        Append("\n");
+    }
+
+    void PrintFieldName(const FieldDescriptor& field) {
+        if (field.is_extension()) {
+            Append("[");
+            Append(ToStringView(field.full_name()));
+            Append("]");
+        } else if (field.type() == FieldDescriptor::TYPE_GROUP) {
+            Append(ToStringView(field.message_type()->name()));
+        } else {
+            Append(ToStringView(field.name()));
+        }
+    }
+
+    void PrintValue(
+        const google::protobuf::Message& message,
+        const google::protobuf::Reflection& reflection,
+        const FieldDescriptor& field,
+        int index
+    ) {
+        const bool repeated = index >= 0;
+        switch (field.cpp_type()) {
+            case FieldDescriptor::CPPTYPE_INT32:
+                return AppendNumber(
+                    repeated ? reflection.GetRepeatedInt32(message, &field, index)
+                             : reflection.GetInt32(message, &field)
+                );
+            case FieldDescriptor::CPPTYPE_INT64:
+                return AppendNumber(
+                    repeated ? reflection.GetRepeatedInt64(message, &field, index)
+                             : reflection.GetInt64(message, &field)
+                );
+            case FieldDescriptor::CPPTYPE_UINT32:
+                return AppendNumber(
+                    repeated ? reflection.GetRepeatedUInt32(message, &field, index)
+                             : reflection.GetUInt32(message, &field)
+                );
+            case FieldDescriptor::CPPTYPE_UINT64:
+                return AppendNumber(
+                    repeated ? reflection.GetRepeatedUInt64(message, &field, index)
+                             : reflection.GetUInt64(message, &field)
+                );
+            case FieldDescriptor::CPPTYPE_DOUBLE:
+                return AppendFloat(
+                    repeated ? reflection.GetRepeatedDouble(message, &field, index)
+                             : reflection.GetDouble(message, &field)
+                );
+            case FieldDescriptor::CPPTYPE_FLOAT:
+                return AppendFloat(
+                    repeated ? reflection.GetRepeatedFloat(message, &field, index)
+                             : reflection.GetFloat(message, &field)
+                );
+            case FieldDescriptor::CPPTYPE_BOOL: {
+                const bool value =
+                    repeated ? reflection.GetRepeatedBool(message, &field, index) : reflection.GetBool(message, &field);
+                return Append(value ? "true" : "false");
+            }
+            case FieldDescriptor::CPPTYPE_ENUM: {
+                const int value = repeated ? reflection.GetRepeatedEnumValue(message, &field, index)
+                                           : reflection.GetEnumValue(message, &field);
+                const auto* value_descriptor = field.enum_type()->FindValueByNumber(value);
+                if (!value_descriptor) return AppendNumber(value);
+                return Append(ToStringView(value_descriptor->name()));
+            }
+            case FieldDescriptor::CPPTYPE_STRING: {
+                std::string scratch;
+                const std::string& value = repeated
+                                               ? reflection.GetRepeatedStringReference(message, &field, index, &scratch)
+                                               : reflection.GetStringReference(message, &field, &scratch);
+                Append("\"");
+                AppendEscaped(value, field.type() == FieldDescriptor::TYPE_STRING);
+                return Append("\"");
+            }
+            case FieldDescriptor::CPPTYPE_MESSAGE:
+                UINVARIANT(false, "Messages are printed by PrintField");
+        }
+    }
+
+    template <typename Integer>
+    void AppendNumber(Integer value) {
+        const fmt::format_int formatted{value};
+        Append({formatted.data(), formatted.size()});
+    }
+
+    template <typename Float>
+    void AppendFloat(Float value) {
+        // The shortest representation that round-trips, same as protobuf does
+        char buffer[32];
+        const auto result = fmt::format_to_n(buffer, sizeof(buffer), "{}", value);
+        Append({buffer, result.size});
+    }
+
+    // Same escaping as CEscape, or Utf8SafeCEscape if 'utf8' is set
+    void AppendEscaped(std::string_view value, bool utf8) {
+        // The escaped value is never shorter, the rest would not fit anyway
+        value = value.substr(0, max_size_ - text_.size() + 1);
+
+        std::size_t plain_begin = 0;
+        for (std::size_t i = 0; i < value.size() && !truncated_; ++i) {
+            const auto byte = static_cast<unsigned char>(value[i]);
+            std::string_view escaped;
+            char octal[4];
+            switch (byte) {
+                case '\n':
+                    escaped = "\\n";
+                    break;
+                case '\r':
+                    escaped = "\\r";
+                    break;
+                case '\t':
+                    escaped = "\\t";
+                    break;
+                case '"':
+                    escaped = "\\\"";
+                    break;
+                case '\'':
+                    escaped = "\\'";
+                    break;
+                case '\\':
+                    escaped = "\\\\";
+                    break;
+                default:
+                    if ((byte >= 0x20 && byte < 0x7f) || (utf8 && byte >= 0x80)) continue;
+                    octal[0] = '\\';
+                    octal[1] = static_cast<char>('0' + (byte >> 6));
+                    octal[2] = static_cast<char>('0' + ((byte >> 3) & 7));
+                    octal[3] = static_cast<char>('0' + (byte & 7));
+                    escaped = {octal, sizeof(octal)};
+            }
+            Append(value.substr(plain_begin, i - plain_begin));
+            Append(escaped);
+            plain_begin = i + 1;
+        }
+        Append(value.substr(plain_begin));
+    }
+
+    void PrintIndent(std::size_t depth) {
+        for (std::size_t i = 0; i < depth; ++i) Append("  ");
+    }
+
+    void Append(std::string_view data) {
+        if (truncated_) return;
+        const auto left = max_size_ - text_.size();
+        if (data.size() > left) {
+            text_.append(data.substr(0, left));
+            truncated_ = true;
+            return;
+        }
+        text_.append(data);
+    }
+
+    const std::size_t max_size_;
+    const bool skip_secrets_;
+    std::string text_;
+    bool truncated_{false};
+};
+
+}  // namespace
+
+LimitedDebugString
+ToLimitedDebugString(const google::protobuf::Message& message, std::size_t max_size, bool skip_secrets) {
+    LimitedPrinter printer{max_size, skip_secrets};
+    printer.PrintMessage(message, 0);
+    return std::move(printer).Extract();
+}
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include <google/protobuf/message.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+struct LimitedDebugString final {
+    std::string text;
+    bool truncated{false};
+};
+
+/// Renders the message in the same format as `Utf8DebugString`, but stops
+/// once `max_size` bytes are rendered, so that the cost does not depend on
+/// the size of the message.
+///
+/// Only the set fields are visited. Fields marked as secret are skipped if
+/// `skip_secrets` is set. Map entries are printed in the storage order,
+/// unknown fields are omitted.
+LimitedDebugString
+ToLimitedDebugString(const google::protobuf::Message& message, std::size_t max_size, bool skip_secrets);
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
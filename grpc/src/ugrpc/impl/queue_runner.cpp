@@ -1,7 +1,10 @@
 #include <userver/ugrpc/impl/queue_runner.hpp>
 
+#include <chrono>
 #include <thread>
 
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/thread_name.hpp>
 
@@ -28,12 +31,49 @@ void ProcessQueue(grpc::CompletionQueue& queue, engine::SingleUseEvent& completi
     completion.Send();
 }
 
+// Events are handled in batches, then the woken tasks get a chance to run
+constexpr std::size_t kMaxEventsInBatch = 64;
+// The longest time the polling task blocks its worker thread for
+constexpr auto kMaxBlockingTime = std::chrono::milliseconds{1};
+
+void PollQueue(grpc::CompletionQueue& queue, engine::SingleUseEvent& completion) noexcept {
+    void* tag = nullptr;
+    bool ok = false;
+    bool is_shutdown = false;
+
+    while (!is_shutdown) {
+        auto deadline = std::chrono::system_clock::now() + kMaxBlockingTime;
+        for (std::size_t i = 0; i < kMaxEventsInBatch; ++i) {
+            const auto status = queue.AsyncNext(&tag, &ok, deadline);
+            if (status == grpc::CompletionQueue::SHUTDOWN) {
+                is_shutdown = true;
+                break;
+            }
+            if (status == grpc::CompletionQueue::TIMEOUT) break;
+
+            auto* call = static_cast<EventBase*>(tag);
+            UASSERT(call != nullptr);
+            call->Notify(ok);
+            // Only take the events that are already there
+            deadline = {};
+        }
+        engine::Yield();
+    }
+
+    completion.Send();
+}
+
 }  // namespace
 
 QueueRunner::QueueRunner(grpc::CompletionQueue& queue) : queue_(queue) {
     std::thread([this] { ProcessQueue(queue_, completion_); }).detach();
 }
 
+QueueRunner::QueueRunner(grpc::CompletionQueue& queue, engine::TaskProcessor& task_processor) : queue_(queue) {
+    // The queue must be drained before its destruction, the task must not be cancelled before start
+    engine::CriticalAsyncNoSpan(task_processor, [this] { PollQueue(queue_, completion_); }).Detach();
+}
+
 QueueRunner::~QueueRunner() {
     queue_.Shutdown();
     completion_.WaitNonCancellable();
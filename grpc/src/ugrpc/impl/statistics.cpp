@@ -38,6 +38,11 @@ void MethodStatistics::AccountDeadlinePropagated() noexcept { ++deadline_updated
 
 void MethodStatistics::AccountCancelled() noexcept { ++cancelled_; }
 
+void MethodStatistics::AccountArena(std::size_t space_allocated) noexcept {
+    ++arena_calls_;
+    arena_bytes_ += utils::statistics::Rate{space_allocated};
+}
+
 void DumpMetric(utils::statistics::Writer& writer, const MethodStatistics& stats) {
     writer = MethodStatisticsSnapshot{stats};
 }
@@ -107,6 +112,12 @@ void DumpMetric(utils::statistics::Writer& writer, const MethodStatisticsSnapsho
 
     writer["deadline-propagated"] = stats.deadline_updated;
     writer["cancelled-by-deadline-propagation"] = deadline_cancelled_value;
+
+    // Only the services with per-call protobuf arenas have these
+    if (stats.arena_calls) {
+        writer["arena"]["calls"] = stats.arena_calls;
+        writer["arena"]["bytes"] = stats.arena_bytes;
+    }
 }
 
 MethodStatisticsSnapshot::MethodStatisticsSnapshot(const StatisticsDomain domain) : domain(domain) {}
@@ -120,7 +131,9 @@ MethodStatisticsSnapshot::MethodStatisticsSnapshot(const MethodStatistics& stats
       internal_errors(stats.internal_errors_.Load()),
       cancelled(stats.cancelled_.Load()),
       deadline_updated(stats.deadline_updated_.Load()),
-      deadline_cancelled(stats.deadline_cancelled_.Load()) {
+      deadline_cancelled(stats.deadline_cancelled_.Load()),
+      arena_calls(stats.arena_calls_.Load()),
+      arena_bytes(stats.arena_bytes_.Load()) {
     // For the 'active' metric, it is important to load the 'started' value after
     // loading the 'started_renamed' and 'total_requests' values.
     // More details in DumpMetric for MethodStatisticsSnapshot
@@ -139,6 +152,8 @@ void MethodStatisticsSnapshot::Add(const MethodStatisticsSnapshot& other) {
     cancelled += other.cancelled;
     deadline_updated += other.deadline_updated;
     deadline_cancelled += other.deadline_cancelled;
+    arena_calls += other.arena_calls;
+    arena_bytes += other.arena_bytes;
 }
 
 void DumpMetricWithLabels(
@@ -52,6 +52,16 @@ ParseTaskProcessor(const yaml_config::YamlConfig& field, const components::Compo
     return context.GetTaskProcessor(field.As<std::string>());
 }
 
+std::optional<ArenaConfig> ParseArenaConfig(const yaml_config::YamlConfig& value) {
+    if (value.IsMissing()) {
+        return std::nullopt;
+    }
+    ArenaConfig config;
+    config.initial_block_size = value["initial-block-size"].As<std::size_t>(config.initial_block_size);
+    config.methods = value["methods"].As<std::vector<std::string>>({});
+    return config;
+}
+
 }  // namespace
 
 ServiceDefaults
@@ -71,6 +81,7 @@ server::ServiceConfig ParseServiceConfig(
             value[kTaskProcessorKey], defaults.task_processor, context, ParseTaskProcessor
         ),
         /*middlewares=*/{},
+        /*arena=*/ParseArenaConfig(value["arena"]),
     };
 }
 
@@ -79,6 +90,10 @@ ServerConfig ParseServerConfig(const yaml_config::YamlConfig& value, const compo
     config.unix_socket_path = value["unix-socket-path"].As<std::optional<std::string>>();
     config.port = value["port"].As<std::optional<int>>();
     config.completion_queue_num = value["completion-queue-count"].As<std::size_t>(2);
+    const auto polling_task_processor = value["completion-queue-task-processor"].As<std::optional<std::string>>();
+    if (polling_task_processor) {
+        config.completion_queue_task_processor = &context.GetTaskProcessor(*polling_task_processor);
+    }
     config.channel_args = value["channel-args"].As<decltype(config.channel_args)>({});
     config.native_log_level = value["native-log-level"].As<logging::Level>(logging::Level::kError);
     config.enable_channelz = value["enable-channelz"].As<bool>(false);
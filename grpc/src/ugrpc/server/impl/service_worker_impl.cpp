@@ -1,5 +1,6 @@
 #include <userver/ugrpc/server/impl/service_worker_impl.hpp>
 
+#include <algorithm>
 #include <chrono>
 
 #include <grpc/support/time.h>
@@ -146,6 +147,23 @@ void ParseGenericCallName(
     method_name = generic_call_name.substr(slash_pos + 1);
 }
 
+std::optional<google::protobuf::ArenaOptions>
+MakeArenaOptions(const ServiceSettings& settings, std::string_view method_name) {
+    if (!settings.arena) {
+        return std::nullopt;
+    }
+    const auto& methods = settings.arena->methods;
+    if (!methods.empty() && std::find(methods.begin(), methods.end(), method_name) == methods.end()) {
+        return std::nullopt;
+    }
+
+    google::protobuf::ArenaOptions options;
+    options.start_block_size = settings.arena->initial_block_size;
+    // The first block is the one to fit a typical call, do not shrink the next ones
+    options.max_block_size = std::max(options.max_block_size, options.start_block_size);
+    return options;
+}
+
 }  // namespace ugrpc::server::impl
 
 USERVER_NAMESPACE_END
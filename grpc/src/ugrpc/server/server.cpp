@@ -6,6 +6,7 @@
 #include <limits>
 #include <memory>
 #include <optional>
+#include <stdexcept>
 #include <vector>
 
 #include <fmt/format.h>
@@ -13,6 +14,7 @@
 #include <grpcpp/server.h>
 
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/task/current_task.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/fixed_array.hpp>
@@ -143,9 +145,22 @@ Server::Impl::Impl(
         grpc::channelz::experimental::InitChannelzService();
 #endif
     }
+    if (config.completion_queue_task_processor) {
+        // Each polling task blocks its worker thread almost all the time, the
+        // RPC tasks would starve without spare workers
+        const auto worker_count = engine::impl::GetWorkerCount(*config.completion_queue_task_processor);
+        if (worker_count <= config.completion_queue_num) {
+            throw std::runtime_error(fmt::format(
+                "The task processor to poll {} gRPC completion queues from has {} worker threads, it must have more "
+                "worker threads than completion queues",
+                config.completion_queue_num,
+                worker_count
+            ));
+        }
+    }
     server_builder_.emplace();
     ApplyChannelArgs(*server_builder_, config);
-    completion_queues_.emplace(config.completion_queue_num, *server_builder_);
+    completion_queues_.emplace(config.completion_queue_num, *server_builder_, config.completion_queue_task_processor);
 
     if (config.unix_socket_path) AddListeningUnixSocket(*config.unix_socket_path, config.tls);
 
@@ -196,6 +211,7 @@ impl::ServiceSettings Server::Impl::MakeServiceSettings(ServiceConfig&& config)
         std::move(config.middlewares),
         access_tskv_logger_,
         config_source_,
+        std::move(config.arena),
     };
 }
 
@@ -56,6 +56,15 @@ properties:
             completion queue count to create. Should be ~2 times less than worker
             threads for best RPS.
         minimum: 1
+    completion-queue-task-processor:
+        type: string
+        description: |
+            poll the completion queues from tasks on this task processor instead
+            of dedicated threads, the RPC tasks then may start without a handoff
+            to another thread. Each polling task blocks a worker thread while
+            waiting for events, the task processor must have more worker threads
+            than completion queues or the startup fails.
+        defaultDescription: dedicated threads are used
     channel-args:
         type: object
         description: a map of channel arguments, see gRPC Core docs
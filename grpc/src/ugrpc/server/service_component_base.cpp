@@ -95,6 +95,25 @@ properties:
                     type: boolean
                     description: enable middleware in the list
         properties: {}
+    arena:
+        type: object
+        description: |
+            allocate request messages of the unary calls on per-call protobuf
+            arenas, the arenas are not used if the option is missing
+        additionalProperties: false
+        properties:
+            initial-block-size:
+                type: integer
+                description: size of the first block of an arena in bytes
+                defaultDescription: 1024
+                minimum: 1
+            methods:
+                type: array
+                description: names of the methods to use the arena for
+                defaultDescription: all the unary methods of the service
+                items:
+                    type: string
+                    description: method name, e.g. SayHello
 )");
 }
 
@@ -34,6 +34,7 @@ server::ServiceConfig ServiceBase::MakeServiceConfig() {
     return server::ServiceConfig{
         engine::current_task::GetTaskProcessor(),
         server_middlewares_,
+        service_arena_,
     };
 }
 
@@ -81,6 +82,11 @@ void ServiceBase::SetServerMiddlewares(server::Middlewares middlewares) {
     server_middlewares_ = std::move(middlewares);
 }
 
+void ServiceBase::SetServiceArena(std::optional<server::ArenaConfig> arena) {
+    UINVARIANT(middlewares_change_allowed_, "Set service arena after RegisterService call is not allowed");
+    service_arena_ = std::move(arena);
+}
+
 void ServiceBase::SetClientMiddlewareFactories(client::MiddlewareFactories middleware_factories) {
     UINVARIANT(
         middlewares_change_allowed_,
@@ -0,0 +1,117 @@
+#include <userver/utest/utest.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/arena.h>
+
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class UnitTestServiceWithArena final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& context, sample::ugrpc::GreetingRequest&& request) override {
+        auto* arena = context.GetArena();
+        const bool request_on_arena = arena && request.GetArena() == arena;
+
+        sample::ugrpc::GreetingResponse response;
+        if (arena) {
+            auto* greeting = google::protobuf::Arena::Create<sample::ugrpc::GreetingResponse>(arena);
+            greeting->set_name("Hello " + request.name());
+            response.set_name(greeting->name());
+        } else {
+            response.set_name("Hello " + request.name());
+        }
+        response.set_greeting(request_on_arena ? "arena" : "heap");
+        return response;
+    }
+
+    ChatResult Chat(CallContext& context, ChatReaderWriter& stream) override {
+        sample::ugrpc::StreamGreetingRequest request;
+        sample::ugrpc::StreamGreetingResponse response;
+        while (stream.Read(request)) {
+            response.set_name(context.GetArena() ? "arena" : "heap");
+            stream.Write(response);
+        }
+        return grpc::Status::OK;
+    }
+};
+
+class GrpcArena : public ugrpc::tests::ServiceFixtureBase {
+protected:
+    explicit GrpcArena(std::vector<std::string> methods = {}) {
+        ugrpc::server::ArenaConfig arena;
+        arena.methods = std::move(methods);
+        SetServiceArena(std::move(arena));
+        RegisterService(service_);
+        StartServer();
+    }
+
+    ~GrpcArena() override { StopServer(); }
+
+    std::optional<utils::statistics::Rate> GetArenaCalls() {
+        const auto stats = GetStatistics(
+            "grpc.server.by-destination", {{"grpc_destination", "sample.ugrpc.UnitTestService/SayHello"}}
+        );
+        const auto metric = stats.SingleMetricOptional("arena.calls");
+        return metric ? std::make_optional(metric->AsRate()) : std::nullopt;
+    }
+
+private:
+    UnitTestServiceWithArena service_;
+};
+
+class GrpcArenaOtherMethod : public GrpcArena {
+protected:
+    GrpcArenaOtherMethod() : GrpcArena({"Chat"}) {}
+};
+
+}  // namespace
+
+UTEST_F(GrpcArena, RequestOnArena) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    sample::ugrpc::GreetingRequest out;
+    out.set_name("userver");
+
+    const auto in = client.SayHello(out);
+    EXPECT_EQ(in.name(), "Hello userver");
+    EXPECT_EQ(in.greeting(), "arena");
+
+    GetServer().StopServing();
+    EXPECT_EQ(GetArenaCalls(), 1);
+}
+
+UTEST_F(GrpcArenaOtherMethod, NoArena) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    sample::ugrpc::GreetingRequest out;
+    out.set_name("userver");
+
+    const auto in = client.SayHello(out);
+    EXPECT_EQ(in.name(), "Hello userver");
+    EXPECT_EQ(in.greeting(), "heap");
+
+    GetServer().StopServing();
+    EXPECT_EQ(GetArenaCalls(), std::nullopt);
+}
+
+UTEST_F(GrpcArena, NoArenaForStream) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    auto stream = client.Chat();
+
+    sample::ugrpc::StreamGreetingRequest request;
+    sample::ugrpc::StreamGreetingResponse response;
+    ASSERT_TRUE(stream.Write(request));
+    ASSERT_TRUE(stream.Read(response));
+    EXPECT_EQ(response.name(), "heap");
+    ASSERT_TRUE(stream.WritesDone());
+    EXPECT_FALSE(stream.Read(response));
+}
+
+USERVER_NAMESPACE_END
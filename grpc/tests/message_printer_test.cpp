@@ -0,0 +1,116 @@
+#include <ugrpc/impl/message_printer.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <tests/protobuf.pb.h>
+#include <tests/secret_fields.pb.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kNoLimit = 1 << 20;
+
+sample::ugrpc::MessageWithDifferentTypes MakeMessage() {
+    sample::ugrpc::MessageWithDifferentTypes message;
+    message.set_required_string("text \"quoted\"\n");
+    message.set_optional_int(0);
+    message.mutable_required_nested()->set_required_int(42);
+    message.mutable_optional_recursive()->mutable_required_nested()->set_required_string("deep");
+    message.add_repeated_primitive("first");
+    message.add_repeated_primitive("\x01");
+    message.set_oneof_int(7);
+    return message;
+}
+
+constexpr std::string_view kExpected =
+    "required_string: \"text \\\"quoted\\\"\\n\"\n"
+    "optional_int: 0\n"
+    "required_nested {\n"
+    "  required_int: 42\n"
+    "}\n"
+    "optional_recursive {\n"
+    "  required_nested {\n"
+    "    required_string: \"deep\"\n"
+    "  }\n"
+    "}\n"
+    "repeated_primitive: \"first\"\n"
+    "repeated_primitive: \"\\001\"\n"
+    "oneof_int: 7\n";
+
+}  // namespace
+
+TEST(MessagePrinter, TextFormat) {
+    const auto printed = ugrpc::impl::ToLimitedDebugString(MakeMessage(), kNoLimit, false);
+    EXPECT_EQ(printed.text, kExpected);
+    EXPECT_FALSE(printed.truncated);
+}
+
+TEST(MessagePrinter, Utf8) {
+    sample::ugrpc::MessageWithDifferentTypes message;
+    message.set_required_string("привет");
+    const auto printed = ugrpc::impl::ToLimitedDebugString(message, kNoLimit, false);
+    EXPECT_EQ(printed.text, "required_string: \"привет\"\n");
+}
+
+TEST(MessagePrinter, Empty) {
+    const auto printed = ugrpc::impl::ToLimitedDebugString(sample::ugrpc::MessageWithDifferentTypes{}, 0, false);
+    EXPECT_EQ(printed.text, "");
+    EXPECT_FALSE(printed.truncated);
+}
+
+TEST(MessagePrinter, ExactLimit) {
+    const auto message = MakeMessage();
+    const auto printed = ugrpc::impl::ToLimitedDebugString(message, kExpected.size(), false);
+    EXPECT_EQ(printed.text, kExpected);
+    EXPECT_FALSE(printed.truncated);
+}
+
+TEST(MessagePrinter, Truncated) {
+    const auto message = MakeMessage();
+    for (std::size_t limit = 0; limit < kExpected.size(); ++limit) {
+        const auto printed = ugrpc::impl::ToLimitedDebugString(message, limit, false);
+        EXPECT_EQ(printed.text, kExpected.substr(0, limit));
+        EXPECT_TRUE(printed.truncated);
+    }
+}
+
+TEST(MessagePrinter, LargeMessage) {
+    sample::ugrpc::MessageWithDifferentTypes message;
+    message.set_required_string(std::string(1 << 20, 'x'));
+    for (int i = 0; i < 10000; ++i) {
+        message.add_repeated_primitive("value");
+    }
+
+    const auto printed = ugrpc::impl::ToLimitedDebugString(message, 512, false);
+    EXPECT_EQ(printed.text.size(), 512);
+    EXPECT_EQ(printed.text.substr(0, 18), "required_string: \"");
+    EXPECT_TRUE(printed.truncated);
+}
+
+TEST(MessagePrinter, SkipSecrets) {
+    sample::ugrpc::SendRequest request;
+    request.mutable_creds()->set_login("login-value");
+    request.mutable_creds()->set_password("password-value");
+    request.set_dest("dest-value");
+
+    EXPECT_EQ(
+        ugrpc::impl::ToLimitedDebugString(request, kNoLimit, true).text,
+        "creds {\n"
+        "  login: \"login-value\"\n"
+        "}\n"
+        "dest: \"dest-value\"\n"
+    );
+    EXPECT_EQ(
+        ugrpc::impl::ToLimitedDebugString(request, kNoLimit, false).text,
+        "creds {\n"
+        "  login: \"login-value\"\n"
+        "  password: \"password-value\"\n"
+        "}\n"
+        "dest: \"dest-value\"\n"
+    );
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,88 @@
+#include <userver/utest/utest.hpp>
+
+#include <stdexcept>
+#include <string>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/get_all.hpp>
+#include <userver/engine/task/current_task.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& /*context*/, sample::ugrpc::GreetingRequest&& request) override {
+        sample::ugrpc::GreetingResponse response;
+        response.set_name("Hello " + request.name());
+        return response;
+    }
+
+    ChatResult Chat(CallContext& /*context*/, ChatReaderWriter& stream) override {
+        sample::ugrpc::StreamGreetingRequest request;
+        sample::ugrpc::StreamGreetingResponse response;
+        while (stream.Read(request)) {
+            response.set_number(request.number());
+            stream.Write(response);
+        }
+        return grpc::Status::OK;
+    }
+};
+
+ugrpc::server::ServerConfig MakeServerConfig(std::size_t completion_queue_num = 1) {
+    ugrpc::server::ServerConfig config;
+    config.completion_queue_num = completion_queue_num;
+    config.completion_queue_task_processor = &engine::current_task::GetTaskProcessor();
+    return config;
+}
+
+class GrpcQueuePolling : public ugrpc::tests::ServiceFixture<UnitTestService> {
+protected:
+    GrpcQueuePolling() : ugrpc::tests::ServiceFixture<UnitTestService>(MakeServerConfig()) {}
+};
+
+}  // namespace
+
+UTEST_F_MT(GrpcQueuePolling, Unary, 2) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    auto tasks = utils::GenerateFixedArray(8, [&client](std::size_t i) {
+        return engine::AsyncNoSpan([&client, i] {
+            sample::ugrpc::GreetingRequest out;
+            out.set_name(std::to_string(i));
+            for (int j = 0; j < 10; ++j) {
+                EXPECT_EQ(client.SayHello(out).name(), "Hello " + std::to_string(i));
+            }
+        });
+    });
+    engine::GetAll(tasks);
+}
+
+UTEST_F_MT(GrpcQueuePolling, Stream, 2) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    auto stream = client.Chat();
+
+    sample::ugrpc::StreamGreetingRequest request;
+    sample::ugrpc::StreamGreetingResponse response;
+    for (int i = 0; i < 10; ++i) {
+        request.set_number(i);
+        ASSERT_TRUE(stream.Write(request));
+        ASSERT_TRUE(stream.Read(response));
+        EXPECT_EQ(response.number(), i);
+    }
+    ASSERT_TRUE(stream.WritesDone());
+    EXPECT_FALSE(stream.Read(response));
+}
+
+UTEST_MT(GrpcQueuePolling, NotEnoughWorkers, 2) {
+    // The polling tasks would occupy all the worker threads
+    UEXPECT_THROW(ugrpc::tests::Service<UnitTestService>{MakeServerConfig(2)}, std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
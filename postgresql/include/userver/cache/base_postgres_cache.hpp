@@ -20,6 +20,7 @@
 
 #include <userver/storages/postgres/cluster.hpp>
 #include <userver/storages/postgres/component.hpp>
+#include <userver/storages/postgres/copy_out.hpp>
 #include <userver/storages/postgres/io/chrono.hpp>
 
 #include <userver/compiler/demangle.hpp>
@@ -66,6 +67,25 @@ namespace components {
 /// incremental-update-op-timeout | timeout for an incremental update | 1s
 /// update-correction | incremental update window adjustment | - (0 for caches with defined GetLastKnownUpdated)
 /// chunk-size | number of rows to request from PostgreSQL via portals, 0 to fetch all rows in one request without portals | 1000
+/// full-update-use-copy | read full updates with `COPY (...) TO STDOUT (FORMAT binary)`, see @ref pg_cc_copy | false
+///
+/// @section pg_cc_copy Full updates with COPY
+///
+/// With `full-update-use-copy: true` the full update query is wrapped into
+/// `COPY (<query>) TO STDOUT (FORMAT binary)` and the rows are decoded one by
+/// one straight into RawValueType as they arrive, without portals and
+/// intermediate result sets. This lowers peak memory usage and parsing overhead
+/// for large caches. The number of received bytes is reported in the
+/// `documents.read_bytes` metric.
+///
+/// COPY does not describe the result columns, so the columns of the query must
+/// have exactly the database types the fields of RawValueType are mapped to.
+/// Queries with `$N` parameters cannot be used with COPY, the cache fails to
+/// start if `full-update-use-copy` is set for such a query. Incremental updates
+/// always use the regular query.
+///
+/// A row with values that fail to convert is skipped and accounted as a parse
+/// failure. A broken COPY stream or a lost connection fails the whole update.
 ///
 /// @section pg_cc_cache_policy Cache policy
 ///
@@ -97,6 +117,14 @@ namespace components {
 ///
 /// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Custom Container With Write Notification Example
 ///
+/// For big caches with incremental updates consider using
+/// cache::PersistentMap as a CacheContainer. With it, an incremental update
+/// does not copy the whole container, but only the parts of it that are
+/// modified by the update, and the old and the new snapshots of the cache share
+/// the unchanged data:
+///
+/// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Persistent Container Example
+///
 /// @section pg_cc_forward_declaration Forward Declaration
 ///
 /// To forward declare a cache you can forward declare a trait and
@@ -370,6 +398,73 @@ inline constexpr std::string_view kFetchStage = "fetch";
 inline constexpr std::string_view kParseStage = "parse";
 
 inline constexpr std::size_t kDefaultChunkSize = 1000;
+
+constexpr bool IsIdentifierChar(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '$';
+}
+
+// Looks for $1-like parameter placeholders. '$' may also be a part of an
+// identifier or of a dollar quote, e.g. `$$text$$` or `$tag$text$tag$`. A
+// placeholder-like text inside of a literal is still taken for a parameter.
+constexpr bool HasParameterPlaceholders(std::string_view statement) {
+    for (std::size_t pos = statement.find('$'); pos != std::string_view::npos; pos = statement.find('$', pos + 1)) {
+        const bool is_digit_next = pos + 1 < statement.size() && statement[pos + 1] >= '0' && statement[pos + 1] <= '9';
+        if (is_digit_next && (pos == 0 || !IsIdentifierChar(statement[pos - 1]))) return true;
+    }
+    return false;
+}
+
+// Reads the rows of a full update with COPY, `store` converts and stores a row.
+// A row with values that fail to convert is skipped. Errors of the COPY stream
+// and of the connection are rethrown, as well as a column count mismatch that
+// fails every row: the update must not be committed with a part of the data.
+template <typename PostgreCachePolicy, typename Copy, typename Store>
+std::size_t CopyRows(
+    Copy& copy,
+    cache::UpdateStatisticsScope& stats_scope,
+    tracing::ScopeTime& scope,
+    std::size_t cpu_relax_iterations,
+    Store&& store
+) {
+    utils::CpuRelax relax{cpu_relax_iterations, &scope};
+    std::size_t rows = 0;
+    while (true) {
+        // ReadRow both receives and decodes a row, the parse stage only
+        // accounts converting and storing the value
+        scope.Reset(std::string{kFetchStage});
+        const auto bytes_before = copy.BytesRead();
+        RawValueType<PostgreCachePolicy> value{};
+        bool has_row = false;
+        try {
+            has_row = copy.ReadRow(value);
+        } catch (const storages::postgres::InvalidTupleSizeRequested&) {
+            throw;
+        } catch (const storages::postgres::ResultSetError& e) {
+            // The row is consumed, the rest of the data is still valid
+            stats_scope.IncreaseDocumentsReadCount(1);
+            stats_scope.IncreaseDocumentsParseFailures(1);
+            LOG_ERROR() << "Error parsing data row in cache '" << PostgreCachePolicy::kName << "' to '"
+                        << compiler::GetTypeName<RawValueType<PostgreCachePolicy>>() << "': " << e.what();
+            continue;
+        }
+        stats_scope.IncreaseDocumentsReadBytes(copy.BytesRead() - bytes_before);
+        if (!has_row) break;
+        stats_scope.IncreaseDocumentsReadCount(1);
+        ++rows;
+
+        scope.Reset(std::string{kParseStage});
+        relax.Relax();
+        try {
+            store(std::move(value));
+        } catch (const std::exception& e) {
+            stats_scope.IncreaseDocumentsParseFailures(1);
+            LOG_ERROR() << "Error parsing data row in cache '" << PostgreCachePolicy::kName << "' to '"
+                        << compiler::GetTypeName<ValueType<PostgreCachePolicy>>() << "': " << e.what();
+        }
+    }
+    return rows;
+}
+
 }  // namespace pg_cache::detail
 
 /// @ingroup userver_components
@@ -420,8 +515,15 @@ private:
         cache::UpdateStatisticsScope& stats_scope,
         tracing::ScopeTime& scope
     );
+    std::size_t CopyResults(
+        storages::postgres::CopyOut& copy,
+        CachedData& data_cache,
+        cache::UpdateStatisticsScope& stats_scope,
+        tracing::ScopeTime& scope
+    );
 
     static storages::postgres::Query GetAllQuery();
+    static storages::postgres::Query GetCopyAllQuery();
     static storages::postgres::Query GetDeltaQuery();
 
     std::chrono::milliseconds ParseCorrection(const ComponentConfig& config);
@@ -432,6 +534,7 @@ private:
     const std::chrono::milliseconds full_update_timeout_;
     const std::chrono::milliseconds incremental_update_timeout_;
     const std::size_t chunk_size_;
+    const bool full_update_use_copy_;
     std::size_t cpu_relax_iterations_parse_{0};
     std::size_t cpu_relax_iterations_copy_{0};
 };
@@ -448,7 +551,8 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config, co
       incremental_update_timeout_{config["incremental-update-op-timeout"].As<std::chrono::milliseconds>(
           pg_cache::detail::kDefaultIncrementalUpdateTimeout
       )},
-      chunk_size_{config["chunk-size"].As<size_t>(pg_cache::detail::kDefaultChunkSize)} {
+      chunk_size_{config["chunk-size"].As<size_t>(pg_cache::detail::kDefaultChunkSize)},
+      full_update_use_copy_{config["full-update-use-copy"].As<bool>(false)} {
     UINVARIANT(
         !chunk_size_ || storages::postgres::Portal::IsSupportedByDriver(),
         "Either set 'chunk-size' to 0, or enable PostgreSQL portals by building "
@@ -462,6 +566,12 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config, co
             config.Name() + "' cache"
         );
     }
+    if (full_update_use_copy_ && pg_cache::detail::HasParameterPlaceholders(GetAllQuery().Statement())) {
+        throw std::logic_error(
+            "'full-update-use-copy' is requested in config for '" + config.Name() +
+            "' cache, but COPY cannot be used with a full update query that has parameters"
+        );
+    }
     if (correction_.count() < 0) {
         throw std::logic_error(
             "Refusing to set forward (negative) update correction requested in "
@@ -502,6 +612,12 @@ storages::postgres::Query PostgreCache<PostgreCachePolicy>::GetAllQuery() {
     }
 }
 
+template <typename PostgreCachePolicy>
+storages::postgres::Query PostgreCache<PostgreCachePolicy>::GetCopyAllQuery() {
+    const auto query = GetAllQuery();
+    return {fmt::format("COPY ({}) TO STDOUT (FORMAT binary)", query.Statement()), query.GetName()};
+}
+
 template <typename PostgreCachePolicy>
 storages::postgres::Query PostgreCache<PostgreCachePolicy>::GetDeltaQuery() {
     if constexpr (kIncrementalUpdates) {
@@ -572,7 +688,16 @@ void PostgreCache<PostgreCachePolicy>::Update(
     size_t changes = 0;
     // Iterate clusters
     for (auto& cluster : clusters_) {
-        if (chunk_size_ > 0) {
+        if (type == cache::UpdateType::kFull && full_update_use_copy_) {
+            auto trx = cluster->Begin(
+                kClusterHostTypeFlags,
+                pg::Transaction::RO,
+                pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff}
+            );
+            auto copy = trx.MakeCopyOut(GetCopyAllQuery());
+            changes += CopyResults(copy, data_cache, stats_scope, scope);
+            trx.Commit();
+        } else if (chunk_size_ > 0) {
             auto trx = cluster->Begin(
                 kClusterHostTypeFlags,
                 pg::Transaction::RO,
@@ -676,6 +801,29 @@ void PostgreCache<PostgreCachePolicy>::CacheResults(
     }
 }
 
+template <typename PostgreCachePolicy>
+std::size_t PostgreCache<PostgreCachePolicy>::CopyResults(
+    storages::postgres::CopyOut& copy,
+    CachedData& data_cache,
+    cache::UpdateStatisticsScope& stats_scope,
+    tracing::ScopeTime& scope
+) {
+    return pg_cache::detail::CopyRows<PostgreCachePolicy>(
+        copy,
+        stats_scope,
+        scope,
+        cpu_relax_iterations_parse_,
+        [&data_cache](RawValueType&& value) {
+            using pg_cache::detail::CacheInsertOrAssign;
+            CacheInsertOrAssign(
+                *data_cache,
+                pg_cache::detail::ExtractValue<PostgreCachePolicy>(std::move(value)),
+                PostgreCachePolicy::kKeyMember
+            );
+        }
+    );
+}
+
 template <typename PostgreCachePolicy>
 typename PostgreCache<PostgreCachePolicy>::CachedData
 PostgreCache<PostgreCachePolicy>::GetDataSnapshot(cache::UpdateType type, tracing::ScopeTime& scope) {
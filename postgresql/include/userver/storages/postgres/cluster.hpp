@@ -18,6 +18,7 @@
 #include <userver/storages/postgres/detail/non_transaction.hpp>
 #include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/parameter_store.hpp>
 #include <userver/storages/postgres/query.hpp>
 #include <userver/storages/postgres/query_queue.hpp>
 #include <userver/storages/postgres/statistics.hpp>
@@ -170,6 +171,10 @@ public:
     [[nodiscard]] QueryQueue CreateQueryQueue(ClusterHostTypeFlags flags, TimeoutDuration acquire_timeout);
 
     /// @name Single-statement query in an auto-commit transaction
+    ///
+    /// With `multiplexed_connections` pool setting the statements of concurrent
+    /// tasks share a few pipelined connections instead of taking
+    /// a connection each, see @ref components::Postgres.
     /// @{
 
     /// @brief Execute a statement at host of specified type.
@@ -215,6 +220,54 @@ public:
     );
     /// @}
 
+    /// @name Single-statement query with a cached result
+    ///
+    /// Returns the cached result of an earlier execution of the same statement
+    /// with the same arguments and host selection flags, otherwise executes
+    /// the statement like Execute does and caches the result for
+    /// `options.ttl`. The cache is limited by the approximate memory usage of
+    /// the results and is configured with the `result_cache_max_size_bytes`
+    /// and `result_cache_invalidation_channel` options of
+    /// @ref components::Postgres. Every statement is executed if the cache is
+    /// disabled.
+    ///
+    /// The cluster listens on the invalidation channel on the master host.
+    /// A notification with a tag of ResultCacheOptions as the payload drops
+    /// the cached results with the tag, a notification without a payload
+    /// drops all the results. Nothing is cached while the cluster is not
+    /// listening on the channel, e.g. after a loss of the master connection.
+    ///
+    /// @code
+    /// // In a trigger or in the transaction that modifies the data
+    /// trx.Execute("select pg_notify('result_cache', 'countries')");
+    ///
+    /// // In the handlers
+    /// const pg::ResultCacheOptions kCountriesCache{std::chrono::minutes{5}, {"countries"}};
+    /// auto res = cluster->ExecuteCached(pg::ClusterHostType::kMaster, kCountriesCache,
+    ///                                   "select name from countries where code = $1", code);
+    /// @endcode
+    ///
+    /// @warning A result read from a lagging slave after the invalidation
+    /// notification is cached until its TTL expires. Use
+    /// ClusterHostType::kMaster for the data that must be invalidated
+    /// promptly.
+    /// @{
+
+    /// @brief Execute a statement with a cached result. The arguments must be
+    /// of the types supported by storages::postgres::ParameterStore.
+    template <typename... Args>
+    ResultSet
+    ExecuteCached(ClusterHostTypeFlags, const ResultCacheOptions& options, const Query& query, const Args&... args);
+
+    /// @brief Execute a statement with stored arguments and a cached result.
+    ResultSet ExecuteCached(
+        ClusterHostTypeFlags flags,
+        const ResultCacheOptions& options,
+        const Query& query,
+        const ParameterStore& store
+    );
+    /// @}
+
     /// @brief Listen for notifications on channel
     /// @warning Each NotifyScope owns a single connection taken from the pool,
     /// which effectively decreases the number of usable connections
@@ -251,6 +304,14 @@ public:
 private:
     detail::NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
 
+    bool IsQueryMultiplexingEnabled() const;
+    ResultSet ExecuteMultiplexed(
+        ClusterHostTypeFlags,
+        OptionalCommandControl,
+        const Query& query,
+        detail::QueryParamsWriter params_writer
+    );
+
     OptionalCommandControl GetQueryCmdCtl(const std::string& query_name) const;
     OptionalCommandControl GetHandlersCmdCtl(OptionalCommandControl cmd_ctl) const;
 
@@ -273,10 +334,29 @@ ResultSet Cluster::Execute(
         statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
     }
     statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+    if (IsQueryMultiplexingEnabled()) {
+        detail::StaticQueryParameters<sizeof...(args)> params;
+        return ExecuteMultiplexed(flags, statement_cmd_ctl, query, [&](const UserTypes& types) {
+            params.Write(types, args...);
+            return detail::QueryParameters{params};
+        });
+    }
     auto ntrx = Start(flags, statement_cmd_ctl);
     return ntrx.Execute(statement_cmd_ctl, query, args...);
 }
 
+template <typename... Args>
+ResultSet Cluster::ExecuteCached(
+    ClusterHostTypeFlags flags,
+    const ResultCacheOptions& options,
+    const Query& query,
+    const Args&... args
+) {
+    ParameterStore store;
+    (store.PushBack(args), ...);
+    return ExecuteCached(flags, options, query, store);
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
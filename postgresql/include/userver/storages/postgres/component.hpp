@@ -65,6 +65,40 @@ namespace components {
 /// Note, however, that client-size lag detection is not precise in nature
 /// and can only provide the precision of couple seconds.
 ///
+/// ## Host selection
+///
+/// Requests that do not specify a strategy flag in ClusterHostTypeFlags are
+/// distributed among the suitable hosts according to `host_selection_strategy`:
+/// * `round-robin` uses the hosts in turn;
+/// * `power-of-two-choices` compares two random hosts by the number of
+///   acquired and awaited connections and the smoothed query latency, and uses
+///   the less loaded one. A slow replica gets less traffic without being
+///   excluded completely: a host that was not used for a second is selected
+///   once to refresh its latency.
+///
+/// The number of times an instance was chosen and its smoothed query latency
+/// are reported in `host-selection` metrics of the instance.
+///
+/// ## Query multiplexing
+///
+/// With `multiplexed_connections` greater than zero, single statements of
+/// storages::postgres::Cluster::Execute do not take a connection each. Instead
+/// statements of concurrent tasks are queued and sent in batches of up to
+/// `max_multiplexed_batch_size` statements over at most
+/// `multiplexed_connections` pipelined connections per host, one network
+/// round-trip per batch. The task that finds a free multiplexed connection
+/// sends the batch and routes the results to the waiting tasks. An error of
+/// a statement is reported to its task only, the statement timeouts of
+/// CommandControl are applied to each statement separately.
+///
+/// Multiplexing requires pipeline mode (`pipeline_enabled`) and prepared
+/// statements, otherwise the batch is executed statement by statement over the
+/// connection. Transactions, portals and QueryQueue are not affected.
+///
+/// The number of multiplexed statements and batches and the multiplexed
+/// connections in use are reported in `multiplexing` metrics of the instance,
+/// to be compared with `connections.used` and `transactions.total`.
+///
 /// ## Secdist format
 ///
 /// A PosgreSQL alias in secdist is described as a JSON array of objects
@@ -134,7 +168,12 @@ namespace components {
 /// max_pool_size           | maximum number of created connections for "connlimit_mode: manual"            | 15
 /// max_queue_size          | maximum number of clients waiting for a connection                            | 200
 /// connecting_limit        | limit for concurrent establishing connections number per pool (0 - unlimited) | 0
+/// multiplexed_connections | number of pipelined connections shared by concurrent single statements (0 - disabled) | 0
+/// max_multiplexed_batch_size | maximum number of statements sent in one multiplexed batch                | 64
 /// connlimit_mode          | max_connections setup mode (manual or auto), also see @ref scripts/docs/en/userver/pg_connlimit_mode_auto.md | auto
+/// host_selection_strategy | how to choose a host among the suitable ones (round-robin or power-of-two-choices) | round-robin
+/// result_cache_max_size_bytes | approximate memory limit of the ExecuteCached results per shard (0 - disabled) | 0
+/// result_cache_invalidation_channel | channel of the result cache invalidation notifications                | --
 /// error-injection         | artificial error injection settings, error_injection::Settings                | --
 
 // clang-format on
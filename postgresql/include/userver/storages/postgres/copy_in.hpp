@@ -0,0 +1,130 @@
+#pragma once
+
+/// @file userver/storages/postgres/copy_in.hpp
+/// @brief Streaming bulk insert with COPY FROM STDIN
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/pg_types.hpp>
+#include <userver/storages/postgres/io/row_types.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Streams rows into a table with `COPY ... FROM STDIN` in PostgreSQL
+/// binary COPY format.
+///
+/// Rows are encoded with the same io formatters that are used for query
+/// parameters, so any tuple, aggregate or introspected struct usable with
+/// Transaction::Execute is usable here. Each row is written as a sequence of
+/// its fields, so the row type must match the column list of the COPY
+/// statement. A type that is not a row type is written as a single column.
+///
+/// Encoded rows are accumulated in a buffer and sent to the server in chunks
+/// of about `chunk_size` bytes. Sending a chunk suspends the coroutine only
+/// until the data is written to the socket, the server is not waited for
+/// until Finish is called.
+///
+/// The statement must be a `COPY ... FROM STDIN` with binary format, e.g.
+/// `COPY my_table (id, name) FROM STDIN (FORMAT binary)`, otherwise
+/// LogicError is thrown on construction.
+///
+/// If the object is destroyed without a successful Finish call, the COPY is
+/// aborted and no rows are inserted.
+///
+/// @snippet storages/postgres/tests/copy_in_pgtest.cpp CopyIn
+class CopyIn {
+public:
+    /// Default size of a chunk of encoded rows sent to the server at once
+    static constexpr std::size_t kDefaultChunkSize = 64 * 1024;
+
+    CopyIn(
+        detail::Connection* conn,
+        const Query& query,
+        OptionalCommandControl cmd_ctl = {},
+        std::size_t chunk_size = kDefaultChunkSize
+    );
+
+    CopyIn(CopyIn&&) noexcept;
+    CopyIn& operator=(CopyIn&&) noexcept;
+
+    CopyIn(const CopyIn&) = delete;
+    CopyIn& operator=(const CopyIn&) = delete;
+
+    ~CopyIn();
+
+    /// Encode a row, sending the buffered rows if the chunk is full.
+    template <typename Row>
+    void WriteRow(const Row& row);
+
+    /// Encode all rows of a container, sending full chunks along the way.
+    template <typename Container>
+    void WriteRows(const Container& rows);
+
+    /// Send the rest of the rows, finish the COPY and wait for the server to
+    /// process it.
+    /// @returns number of rows inserted
+    std::size_t Finish();
+
+    /// Number of rows written so far, including the ones not yet sent
+    std::size_t RowsWritten() const noexcept { return rows_written_; }
+
+private:
+    using Buffer = std::vector<char>;
+
+    template <typename Tuple, std::size_t... Indexes>
+    void WriteFields(const UserTypes& types, const Tuple& fields, std::index_sequence<Indexes...>);
+
+    void SendBuffer();
+    void Abort() noexcept;
+
+    detail::Connection* conn_{nullptr};
+    const UserTypes* types_{nullptr};
+    std::size_t chunk_size_;
+    Buffer buffer_;
+    std::size_t rows_written_{0};
+};
+
+template <typename Row>
+void CopyIn::WriteRow(const Row& row) {
+    UASSERT_MSG(conn_, "Attempt to write into a finished or moved-out COPY");
+    const auto& types = *types_;
+    if constexpr (io::traits::kIsRowType<Row>) {
+        using RowType = io::RowType<Row>;
+        io::WriteBuffer(types, buffer_, static_cast<Smallint>(RowType::size));
+        WriteFields(types, RowType::GetTuple(row), typename RowType::IndexSequence{});
+    } else {
+        io::WriteBuffer(types, buffer_, static_cast<Smallint>(1));
+        io::WriteRawBinary(types, buffer_, row);
+    }
+    ++rows_written_;
+    if (buffer_.size() >= chunk_size_) {
+        SendBuffer();
+    }
+}
+
+template <typename Container>
+void CopyIn::WriteRows(const Container& rows) {
+    for (const auto& row : rows) {
+        WriteRow(row);
+    }
+}
+
+template <typename Tuple, std::size_t... Indexes>
+void CopyIn::WriteFields(const UserTypes& types, const Tuple& fields, std::index_sequence<Indexes...>) {
+    (io::WriteRawBinary(types, buffer_, std::get<Indexes>(fields)), ...);
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
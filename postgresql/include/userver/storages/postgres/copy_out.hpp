@@ -0,0 +1,119 @@
+#pragma once
+
+/// @file userver/storages/postgres/copy_out.hpp
+/// @brief Streaming read of a query result with COPY TO STDOUT
+
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/pg_types.hpp>
+#include <userver/storages/postgres/io/row_types.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Streams rows of a table or a query with `COPY ... TO STDOUT` in
+/// PostgreSQL binary COPY format.
+///
+/// Each row is decoded with the same io parsers that are used for
+/// ResultSet, straight from the network buffer and without building an
+/// intermediate result. Any tuple, aggregate or introspected struct usable with
+/// ResultSet::AsContainer and kRowTag is usable here, fields must match the
+/// columns of the COPY statement in order. A type that is not a row type is
+/// read from a single column.
+///
+/// As COPY does not describe the columns, the buffer categories are taken
+/// from the C++ types and the column types are not checked: the statement
+/// must produce columns of exactly the types the C++ fields are mapped to.
+/// Cast columns explicitly in the statement if in doubt.
+///
+/// The statement must be a `COPY ... TO STDOUT` with binary format, e.g.
+/// `COPY (SELECT id, name FROM my_table) TO STDOUT (FORMAT binary)`, otherwise
+/// LogicError is thrown on construction.
+///
+/// If the object is destroyed before all the rows are read, the statement is
+/// cancelled.
+///
+/// @snippet storages/postgres/tests/copy_out_pgtest.cpp CopyOut
+class CopyOut {
+public:
+    CopyOut(detail::Connection* conn, const Query& query, OptionalCommandControl cmd_ctl = {});
+
+    CopyOut(CopyOut&&) noexcept;
+    CopyOut& operator=(CopyOut&&) noexcept;
+
+    CopyOut(const CopyOut&) = delete;
+    CopyOut& operator=(const CopyOut&) = delete;
+
+    ~CopyOut();
+
+    /// Receive and decode the next row.
+    /// @returns false if there are no more rows, `row` is left intact then
+    /// @throws ResultSetError if the values of the row fail to convert, the row
+    /// is consumed and the next one may be read
+    /// @throws InvalidCopyData if the data stream is broken
+    template <typename Row>
+    bool ReadRow(Row& row);
+
+    /// Number of rows read so far
+    std::size_t RowsRead() const noexcept { return rows_read_; }
+
+    /// Number of bytes of COPY data received so far
+    std::size_t BytesRead() const noexcept { return bytes_read_; }
+
+private:
+    template <typename Tuple, std::size_t... Indexes>
+    void ReadFields(io::FieldBuffer& buffer, Tuple&& fields, std::index_sequence<Indexes...>);
+
+    /// Receive the next row and consume its field count
+    io::FieldBuffer NextRow(std::size_t expected_fields);
+    void CheckRowConsumed(const io::FieldBuffer& buffer) const;
+    void Abort() noexcept;
+
+    detail::Connection* conn_{nullptr};
+    const io::TypeBufferCategory* categories_{nullptr};
+    bool header_read_{false};
+    std::size_t rows_read_{0};
+    std::size_t bytes_read_{0};
+};
+
+template <typename Row>
+bool CopyOut::ReadRow(Row& row) {
+    if constexpr (io::traits::kIsRowType<Row>) {
+        using RowType = io::RowType<Row>;
+        auto buffer = NextRow(RowType::size);
+        if (!buffer.buffer) return false;
+        ReadFields(buffer, RowType::GetTuple(row), typename RowType::IndexSequence{});
+        CheckRowConsumed(buffer);
+    } else {
+        auto buffer = NextRow(1);
+        if (!buffer.buffer) return false;
+        buffer.ReadRaw(row, *categories_, io::traits::kTypeBufferCategory<Row>);
+        CheckRowConsumed(buffer);
+    }
+    ++rows_read_;
+    return true;
+}
+
+template <typename Tuple, std::size_t... Indexes>
+void CopyOut::ReadFields(io::FieldBuffer& buffer, Tuple&& fields, std::index_sequence<Indexes...>) {
+    (buffer.ReadRaw(
+         std::get<Indexes>(fields),
+         *categories_,
+         io::traits::kTypeBufferCategory<std::decay_t<decltype(std::get<Indexes>(fields))>>
+     ),
+     ...);
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -9,6 +9,7 @@
 #include <userver/storages/postgres/io/supported_types.hpp>
 
 #include <userver/storages/postgres/null.hpp>
+#include <userver/utils/function_ref.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -44,6 +45,11 @@ private:
     const int* formats_ = nullptr;
 };
 
+/// @brief Writes the parameters of a statement using the user types of the
+/// connection the statement is sent over, the returned QueryParameters refer to
+/// the buffers owned by the writer
+using QueryParamsWriter = USERVER_NAMESPACE::utils::function_ref<QueryParameters(const UserTypes&)>;
+
 template <std::size_t ParamsCount>
 class StaticQueryParameters {
 public:
@@ -156,6 +156,7 @@ std::string OidPrettyPrint(Oid oid);
  *       - ConnectionTimeoutError
  *     - ConnectionBusy
  *     - ConnectionInterrupted
+ *     - InvalidCopyData
  *     - PoolError
  *     - ClusterError
  *     - InvalidConfig
@@ -270,6 +271,13 @@ class ConnectionInterrupted : public RuntimeError {
     using RuntimeError::RuntimeError;
 };
 
+/// @brief The data stream of `COPY ... TO STDOUT` is broken: the header is
+/// invalid, the file trailer is missing or there is data after it. Unlike
+/// ResultSetError of a single row, the rest of the stream cannot be read.
+class InvalidCopyData : public RuntimeError {
+    using RuntimeError::RuntimeError;
+};
+
 //@}
 
 //@{
@@ -114,6 +114,17 @@ template <>
 struct CppToSystemPg<double> : PredefinedOid<PredefinedOids::kFloat8> {};
 //@}
 
+namespace traits {
+template <>
+struct IsFixedWidthBinary<float> : std::true_type {
+    static constexpr bool kNetworkByteOrder = true;
+};
+template <>
+struct IsFixedWidthBinary<double> : std::true_type {
+    static constexpr bool kNetworkByteOrder = true;
+};
+}  // namespace traits
+
 }  // namespace storages::postgres::io
 
 USERVER_NAMESPACE_END
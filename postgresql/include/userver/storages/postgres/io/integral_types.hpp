@@ -206,6 +206,21 @@ struct CppToSystemPg<detail::AltInteger>
 
 //@}
 
+namespace traits {
+template <>
+struct IsFixedWidthBinary<Smallint> : std::true_type {
+    static constexpr bool kNetworkByteOrder = true;
+};
+template <>
+struct IsFixedWidthBinary<Integer> : std::true_type {
+    static constexpr bool kNetworkByteOrder = true;
+};
+template <>
+struct IsFixedWidthBinary<Bigint> : std::true_type {
+    static constexpr bool kNetworkByteOrder = true;
+};
+}  // namespace traits
+
 }  // namespace storages::postgres::io
 
 USERVER_NAMESPACE_END
@@ -52,6 +52,15 @@ template <typename T>
 inline constexpr bool kIsSpecialMapping = IsSpecialMapping<T>::value;
 //@}
 
+/// @brief Mark C++ type which binary representation is exactly `sizeof(T)`
+/// bytes of the value, in network byte order if `kNetworkByteOrder` is true.
+/// Columns of such types are decoded without per-field parsing, see
+/// ResultSet::AsColumn.
+template <typename T>
+struct IsFixedWidthBinary : std::false_type {};
+template <typename T>
+inline constexpr bool kIsFixedWidthBinary = IsFixedWidthBinary<T>::value;
+
 //@{
 /** @name Detect iostream operators */
 template <typename T, typename = USERVER_NAMESPACE::utils::void_t<>>
@@ -36,6 +36,13 @@ struct BufferParser<boost::uuids::uuid> : detail::BufferParserBase<boost::uuids:
 template <>
 struct CppToSystemPg<boost::uuids::uuid> : PredefinedOid<PredefinedOids::kUuid> {};
 
+namespace traits {
+template <>
+struct IsFixedWidthBinary<boost::uuids::uuid> : std::true_type {
+    static constexpr bool kNetworkByteOrder = false;
+};
+}  // namespace traits
+
 }  // namespace storages::postgres::io
 
 USERVER_NAMESPACE_END
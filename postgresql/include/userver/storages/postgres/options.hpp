@@ -9,6 +9,7 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <userver/congestion_control/controllers/linear.hpp>
 #include <userver/storages/postgres/postgres_fwd.hpp>
@@ -153,6 +154,10 @@ inline constexpr std::size_t kDefaultPoolMaxQueueSize = 200;
 /// Default limit for concurrent establishing connections number
 inline constexpr std::size_t kDefaultConnectingLimit = 0;
 
+/// Default limit of single statements sent in one pipelined batch of
+/// a multiplexed connection
+inline constexpr std::size_t kDefaultMaxMultiplexedBatchSize = 64;
+
 /// @brief PostgreSQL topology options
 ///
 /// Dynamic option @ref POSTGRES_TOPOLOGY_SETTINGS
@@ -181,9 +186,19 @@ struct PoolSettings {
     /// Limits number of concurrent establishing connections (0 - unlimited)
     std::size_t connecting_limit{kDefaultConnectingLimit};
 
+    /// Number of pipelined connections shared by concurrent single statements
+    /// of storages::postgres::Cluster::Execute (0 - statements are not
+    /// multiplexed and each one takes a connection of its own)
+    std::size_t multiplexed_connections{0};
+
+    /// Maximum number of statements sent in one batch over a multiplexed
+    /// connection
+    std::size_t max_multiplexed_batch_size{kDefaultMaxMultiplexedBatchSize};
+
     bool operator==(const PoolSettings& rhs) const {
         return min_size == rhs.min_size && max_size == rhs.max_size && max_queue_size == rhs.max_queue_size &&
-               connecting_limit == rhs.connecting_limit;
+               connecting_limit == rhs.connecting_limit && multiplexed_connections == rhs.multiplexed_connections &&
+               max_multiplexed_batch_size == rhs.max_multiplexed_batch_size;
     }
 };
 
@@ -291,6 +306,40 @@ enum class ConnlimitMode {
     kAuto,
 };
 
+/// Strategy of choosing a host among the suitable ones
+enum class HostSelectionStrategy {
+    /// Use the hosts in turn
+    kRoundRobin = 0,
+    /// Compare two random hosts by the number of outstanding requests and the
+    /// smoothed query latency and use the less loaded one
+    kPowerOfTwoChoices,
+};
+
+/// @brief Settings of the result cache of
+/// storages::postgres::Cluster::ExecuteCached
+struct ResultCacheSettings {
+    /// Approximate memory limit of the cached results (0 - the cache is
+    /// disabled and ExecuteCached executes every statement)
+    std::size_t max_size_bytes{0};
+
+    /// Channel of the invalidation notifications, the notifications are not
+    /// listened to if the channel is empty
+    std::string invalidation_channel;
+};
+
+/// @brief Options of a statement executed with
+/// storages::postgres::Cluster::ExecuteCached
+struct ResultCacheOptions {
+    /// Time the cached result is served for
+    std::chrono::milliseconds ttl{0};
+
+    /// Tags of the data the result depends on. A notification on the
+    /// invalidation channel with a tag as the payload drops the cached
+    /// results with the tag, a notification without a payload drops all the
+    /// cached results.
+    std::vector<std::string> tags{};
+};
+
 /// Settings for storages::postgres::Cluster
 struct ClusterSettings {
     /// settings for statements metrics
@@ -316,6 +365,13 @@ struct ClusterSettings {
 
     /// congestion control settings
     congestion_control::v2::LinearController::StaticConfig cc_config;
+
+    /// host selection strategy for requests without an explicit
+    /// ClusterHostType strategy flag
+    HostSelectionStrategy host_selection_strategy = HostSelectionStrategy::kRoundRobin;
+
+    /// settings of the result cache of storages::postgres::Cluster::ExecuteCached
+    ResultCacheSettings result_cache_settings;
 };
 
 }  // namespace storages::postgres
@@ -11,6 +11,7 @@
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -174,6 +175,21 @@ namespace storages::postgres {
 ///
 /// @todo Interface for copying a ResultSet to an output iterator.
 ///
+/// @par Extracting columns of a result set
+///
+/// Analytical queries that return many rows of a few scalar columns can be
+/// extracted column by column into contiguous vectors. The columns of
+/// `smallint`, `integer`, `bigint`, `real`, `double precision` and `uuid`
+/// types are copied as a whole without parsing every field, text columns are
+/// copied into strings directly. Columns of other types and types that need
+/// a conversion are extracted field by field.
+///
+/// @code
+/// auto res = trx.Execute("select id, score, name from table");
+/// std::vector<std::int64_t> ids = res.AsColumn<std::int64_t>(0);
+/// auto [ids, scores, names] = res.AsColumns<std::int64_t, double, std::string>();
+/// @endcode
+///
 /// @par Non-select query results
 ///
 /// @todo Process non-select result and provide interface. Do the docs.
@@ -712,12 +728,44 @@ public:
     std::optional<T> AsOptionalSingleRow(RowTag) const;
     template <typename T>
     std::optional<T> AsOptionalSingleRow(FieldTag) const;
+
+    /// @brief Extract a column into a vector of values.
+    /// Fixed-width binary columns are copied without per-field parsing,
+    /// for more information see @ref pg_process_results
+    /// @throws FieldIndexOutOfBounds if column index is out of bounds
+    template <typename T>
+    std::vector<T> AsColumn(size_type column) const;
+
+    /// @brief Extract all the columns into vectors of values, one per column.
+    /// @throws InvalidTupleSizeRequested if the number of columns is not equal
+    /// to the number of types
+    template <typename... T>
+    std::tuple<std::vector<T>...> AsColumns() const;
     //@}
 private:
     friend class detail::ConnectionImpl;
     void FillBufferCategories(const UserTypes& types);
     void SetBufferCategoriesFrom(const ResultSet&);
 
+    // Copies the values of a column of the `type_oid` type into `out` storage
+    // of `Size() * width` bytes and then converts them from network byte order
+    // in one pass. Returns false without a complete copy if the column has
+    // another type, a null value or a value of other width.
+    bool ReadFixedWidthColumn(
+        size_type column,
+        Oid type_oid,
+        std::size_t width,
+        bool network_byte_order,
+        void* out
+    ) const;
+    // Returns false without modifying `out` if the column is not of a text type
+    bool ReadTextColumn(size_type column, std::vector<std::string>& out) const;
+
+    template <typename T>
+    void ReadColumnByFields(size_type column, std::vector<T>& out) const;
+    template <typename... T, std::size_t... Indexes>
+    std::tuple<std::vector<T>...> AsColumnsImpl(std::index_sequence<Indexes...>) const;
+
     template <typename T, typename Tag>
     friend class TypedResultSet;
     friend class ConnectionImpl;
@@ -1025,6 +1073,57 @@ std::optional<T> ResultSet::AsOptionalSingleRow(FieldTag) const {
     return IsEmpty() ? std::nullopt : std::optional<T>{AsSingleRow<T>(kFieldTag)};
 }
 
+template <typename T>
+std::vector<T> ResultSet::AsColumn(size_type column) const {
+    detail::AssertSaneTypeToDeserialize<T>();
+    detail::AssertRowTypeIsMappedToPgOrIsCompositeType<T>();
+    if (column >= FieldCount()) {
+        throw FieldIndexOutOfBounds{column};
+    }
+
+    std::vector<T> values;
+    if constexpr (io::traits::kIsFixedWidthBinary<T>) {
+        values.resize(Size());
+        if (ReadFixedWidthColumn(
+                column,
+                static_cast<Oid>(io::CppToSystemPg<T>::value),
+                sizeof(T),
+                io::traits::IsFixedWidthBinary<T>::kNetworkByteOrder,
+                values.data()
+            )) {
+            return values;
+        }
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        if (ReadTextColumn(column, values)) {
+            return values;
+        }
+    }
+    ReadColumnByFields(column, values);
+    return values;
+}
+
+template <typename... T>
+std::tuple<std::vector<T>...> ResultSet::AsColumns() const {
+    if (FieldCount() != sizeof...(T)) {
+        throw InvalidTupleSizeRequested{FieldCount(), sizeof...(T)};
+    }
+    return AsColumnsImpl<T...>(std::index_sequence_for<T...>{});
+}
+
+template <typename... T, std::size_t... Indexes>
+std::tuple<std::vector<T>...> ResultSet::AsColumnsImpl(std::index_sequence<Indexes...>) const {
+    return std::tuple<std::vector<T>...>{AsColumn<T>(Indexes)...};
+}
+
+template <typename T>
+void ResultSet::ReadColumnByFields(size_type column, std::vector<T>& out) const {
+    const auto size = Size();
+    out.resize(size);
+    for (size_type row = 0; row < size; ++row) {
+        (*this)[row][column].To(out[row]);
+    }
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
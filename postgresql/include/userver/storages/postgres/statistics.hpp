@@ -3,6 +3,7 @@
 /// @file userver/storages/postgres/statistics.hpp
 /// @brief Statistics helpers
 
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -101,6 +102,20 @@ struct InstanceTopologyStatistics {
     MmaAccumulator replication_lag;
 };
 
+/// @brief Template statistics storage of statements multiplexed over
+/// pipelined connections
+template <typename Counter>
+struct MultiplexingStatistics {
+    /// Number of statements executed over multiplexed connections
+    Counter queries_total = 0;
+    /// Number of batches sent over multiplexed connections
+    Counter batches_total = 0;
+    /// Number of multiplexed connections in use
+    Counter connections_used = 0;
+    /// Maximum number of multiplexed connections
+    Counter connections_max = 0;
+};
+
 /// @brief Template instance statistics storage
 template <typename Counter, typename PercentileAccumulator, typename MmaAccumulator>
 struct InstanceStatisticsTemplate {
@@ -110,10 +125,16 @@ struct InstanceStatisticsTemplate {
     TransactionStatistics<Counter, PercentileAccumulator> transaction;
     /// Topology statistics
     InstanceTopologyStatistics<MmaAccumulator> topology;
+    /// Query multiplexing statistics
+    MultiplexingStatistics<Counter> multiplexing;
     /// Error caused by pool exhaustion
     Counter pool_exhaust_errors = 0;
     /// Error caused by queue size overflow
     Counter queue_size_errors = 0;
+    /// Number of times the instance was chosen by the cluster host selection
+    Counter selected_total = 0;
+    /// Smoothed query execution time in microseconds
+    Counter query_latency_ewma_us = 0;
     /// Connect time percentile
     PercentileAccumulator connection_percentile;
     /// Acquire connection percentile
@@ -188,8 +209,15 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
         topology.roundtrip_time = topology_stats.roundtrip_time.GetStatsForPeriod();
         topology.replication_lag = topology_stats.replication_lag.GetStatsForPeriod();
 
+        multiplexing.queries_total = stats.multiplexing.queries_total;
+        multiplexing.batches_total = stats.multiplexing.batches_total;
+        multiplexing.connections_used = stats.multiplexing.connections_used;
+        multiplexing.connections_max = stats.multiplexing.connections_max;
+
         pool_exhaust_errors = stats.pool_exhaust_errors;
         queue_size_errors = stats.queue_size_errors;
+        selected_total = stats.selected_total;
+        query_latency_ewma_us = stats.query_latency_ewma_us;
         connection_percentile = stats.connection_percentile.GetStatsForPeriod();
         acquire_percentile = stats.acquire_percentile.GetStatsForPeriod();
 
@@ -218,6 +246,23 @@ struct InstanceStatsDescriptor {
     InstanceStatisticsNonatomic stats;
 };
 
+/// @brief Statistics of the result cache of
+/// storages::postgres::Cluster::ExecuteCached
+struct ResultCacheStatistics {
+    /// Statements served from the cache
+    USERVER_NAMESPACE::utils::statistics::Rate hits;
+    /// Statements executed because there was no cached result
+    USERVER_NAMESPACE::utils::statistics::Rate misses;
+    /// Results dropped by the invalidation notifications
+    USERVER_NAMESPACE::utils::statistics::Rate invalidated;
+    /// Results dropped to fit the memory limit
+    USERVER_NAMESPACE::utils::statistics::Rate evicted;
+    /// Number of the cached results
+    std::size_t entries{0};
+    /// Approximate memory used by the cached results
+    std::size_t size_bytes{0};
+};
+
 /// @brief Cluster statistics storage
 struct ClusterStatistics {
     /// Connlimit mode auto is on
@@ -230,6 +275,8 @@ struct ClusterStatistics {
     std::vector<InstanceStatsDescriptor> slaves;
     /// Unknown/unreachable instances statistics
     std::vector<InstanceStatsDescriptor> unknown;
+    /// Result cache statistics, not set if the cache is disabled
+    std::optional<ResultCacheStatistics> result_cache;
 };
 
 // InstanceStatisticsNonatomic values support for utils::statistics::Writer
@@ -238,6 +285,9 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const Inst
 /// @brief InstanceStatsDescriptor values support for utils::statistics::Writer
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const InstanceStatsDescriptor& value);
 
+/// @brief ResultCacheStatistics values support for utils::statistics::Writer
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const ResultCacheStatistics& value);
+
 /// @brief ClusterStatistics values support for utils::statistics::Writer
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const ClusterStatistics& value);
 
@@ -6,6 +6,8 @@
 #include <memory>
 #include <string>
 
+#include <userver/storages/postgres/copy_in.hpp>
+#include <userver/storages/postgres/copy_out.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
@@ -101,6 +103,27 @@ namespace storages::postgres {
 /// trx.Commit();
 /// @endcode
 ///
+/// @par Bulk insert with COPY
+///
+/// Large amounts of rows are inserted faster with `COPY ... FROM STDIN` than
+/// with INSERT statements. Transaction::MakeCopyIn returns a
+/// storages::postgres::CopyIn stream that encodes rows in binary COPY format
+/// and sends them to the server in chunks.
+///
+/// @code
+/// auto trx = cluster->Begin(/* transaction options */);
+/// auto copy = trx.MakeCopyIn("COPY foobar (foo, bar) FROM STDIN (FORMAT binary)");
+/// for (const auto& [foo, bar] : rows) {
+///     copy.WriteRow(std::make_tuple(foo, bar));
+/// }
+/// auto inserted = copy.Finish();
+/// trx.Commit();
+/// @endcode
+///
+/// Symmetrically, Transaction::MakeCopyOut returns a storages::postgres::CopyOut
+/// stream that reads the result of `COPY ... TO STDOUT` in binary COPY format
+/// and decodes it row by row without materializing a ResultSet.
+///
 /// @see Transaction
 /// @see ResultSet
 ///
@@ -293,6 +316,41 @@ public:
     /// and per-statement command control.
     Portal MakePortal(OptionalCommandControl statement_cmd_ctl, const Query& query, const ParameterStore& store);
 
+    /// Start streaming rows into a table with `COPY ... FROM STDIN`.
+    ///
+    /// The statement must use binary format, e.g.
+    /// `COPY foobar (foo, bar) FROM STDIN (FORMAT binary)`.
+    /// Until the returned stream is finished or destroyed no other statements
+    /// can be executed in the transaction.
+    ///
+    /// @see storages::postgres::CopyIn
+    CopyIn MakeCopyIn(const Query& query, OptionalCommandControl statement_cmd_ctl = {});
+
+    /// Start streaming rows of a table or a query with `COPY ... TO STDOUT`.
+    ///
+    /// The statement must use binary format, e.g.
+    /// `COPY (SELECT foo, bar FROM foobar) TO STDOUT (FORMAT binary)`.
+    /// Until all the rows are read or the returned stream is destroyed no other
+    /// statements can be executed in the transaction.
+    ///
+    /// @see storages::postgres::CopyOut
+    CopyOut MakeCopyOut(const Query& query, OptionalCommandControl statement_cmd_ctl = {});
+
+    /// Insert all rows of a container with `COPY ... FROM STDIN`.
+    ///
+    /// The statement must use binary format, each element of the container is
+    /// written as a row, see storages::postgres::CopyIn for row type
+    /// requirements.
+    ///
+    /// Suspends coroutine for execution.
+    /// @returns number of rows inserted
+    template <typename Container>
+    std::size_t CopyInRows(
+        const Query& query,
+        const Container& rows,
+        OptionalCommandControl statement_cmd_ctl = {}
+    );
+
     /// Set a connection parameter
     /// https://www.postgresql.org/docs/current/sql-set.html
     /// The parameter is set for this transaction only
@@ -330,6 +388,14 @@ private:
     detail::ConnectionPtr conn_;
 };
 
+template <typename Container>
+std::size_t
+Transaction::CopyInRows(const Query& query, const Container& rows, OptionalCommandControl statement_cmd_ctl) {
+    auto copy = MakeCopyIn(query, std::move(statement_cmd_ctl));
+    copy.WriteRows(rows);
+    return copy.Finish();
+}
+
 template <typename Container>
 void Transaction::ExecuteBulk(const Query& query, const Container& args, std::size_t chunk_rows) {
     auto split = io::SplitContainer(args, chunk_rows);
@@ -28,6 +28,10 @@ properties:
         type: integer
         description: number of rows to request from PostgreSQL, 0 to fetch all rows in one request
         defaultDescription: 1000
+    full-update-use-copy:
+        type: boolean
+        description: read full updates with binary COPY TO STDOUT instead of a query, not applicable to queries with parameters
+        defaultDescription: false
     pgcomponent:
         type: string
         description: PostgreSQL component name
@@ -4,7 +4,11 @@
 
 #include <boost/functional/hash.hpp>
 
+#include <userver/cache/persistent_map.hpp>
 #include <userver/components/minimal_server_component_list.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
 #include <userver/utils/projected_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -245,6 +249,12 @@ struct PostgresExamplePolicy5 {
 
 static_assert(pg_cache::detail::kHasGetQuery<PostgresExamplePolicy5>);
 
+static_assert(pg_cache::detail::HasParameterPlaceholders("SELECT a FROM t WHERE updated > $1"));
+static_assert(pg_cache::detail::HasParameterPlaceholders("SELECT $1::INTEGER"));
+static_assert(!pg_cache::detail::HasParameterPlaceholders("SELECT a, b FROM t"));
+static_assert(!pg_cache::detail::HasParameterPlaceholders("SELECT a FROM t WHERE price = '$'"));
+static_assert(!pg_cache::detail::HasParameterPlaceholders("SELECT $$text$$, $tag$text$tag$, a$1 FROM t"));
+
 /*! [Pg Cache Policy Custom Container With Write Notification Example] */
 class UserSpecificCacheWithWriteNotification {
 public:
@@ -277,6 +287,20 @@ struct PostgresExamplePolicy7 {
     using CacheContainer = utils::ProjectedUnorderedSet<ValueType, kKeyMember>;
 };
 
+/*! [Pg Cache Policy Persistent Container Example] */
+struct PostgresExamplePolicy8 {
+    static constexpr std::string_view kName = "my-pg-cache";
+    using ValueType = MyStructure;
+    static constexpr auto kKeyMember = &MyStructure::id;
+    static constexpr const char* kQuery = "select id, bar, updated from test.my_data";
+    static constexpr const char* kUpdatedField = "updated";
+    using UpdatedFieldType = storages::postgres::TimePointTz;
+
+    // Incremental updates copy only the modified parts of the container
+    using CacheContainer = cache::PersistentMap<int, MyStructure>;
+};
+/*! [Pg Cache Policy Persistent Container Example] */
+
 // Instantiation test
 using MyCache1 = PostgreCache<PostgresExamplePolicy>;
 using MyCache2 = PostgreCache<PostgresExamplePolicy2>;
@@ -286,6 +310,7 @@ using MyTrivialCache = PostgreCache<PostgresTrivialPolicy>;
 using MyCache5 = PostgreCache<PostgresExamplePolicy5>;
 using MyCache6 = PostgreCache<PostgresExamplePolicy6>;
 using MyCache7 = PostgreCache<PostgresExamplePolicy7>;
+using MyCache8 = PostgreCache<PostgresExamplePolicy8>;
 
 // NB: field access required for actual instantiation
 static_assert(MyCache1::kIncrementalUpdates);
@@ -295,6 +320,7 @@ static_assert(MyCache4::kIncrementalUpdates);
 static_assert(MyCache5::kIncrementalUpdates);
 static_assert(MyCache6::kIncrementalUpdates);
 static_assert(MyCache7::kIncrementalUpdates);
+static_assert(MyCache8::kIncrementalUpdates);
 
 namespace pg = storages::postgres;
 static_assert(MyCache1::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
@@ -304,6 +330,7 @@ static_assert(MyCache4::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
 static_assert(MyCache5::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
 static_assert(MyCache6::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
 static_assert(MyCache7::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
+static_assert(MyCache8::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
 
 // Update() instantiation test
 [[maybe_unused]] void
@@ -316,6 +343,7 @@ VerifyUpdateCompiles(const components::ComponentConfig& config, const components
     MyCache5 cache5{config, context};
     MyCache6 cache6{config, context};
     MyCache7 cache7{config, context};
+    MyCache8 cache8{config, context};
 }
 
 inline auto SampleOfComponentRegistration() {
@@ -326,4 +354,60 @@ inline auto SampleOfComponentRegistration() {
 
 }  // namespace components::example
 
+namespace {
+
+// Plays back the rows of a COPY data stream, std::nullopt is a row with values
+// that fail to convert
+class FakeCopyOut {
+public:
+    FakeCopyOut(std::vector<std::optional<int>> ids, bool has_trailer)
+        : ids_(std::move(ids)), has_trailer_(has_trailer) {}
+
+    bool ReadRow(example::MyStructure& row) {
+        if (next_ == ids_.size()) {
+            if (!has_trailer_) throw storages::postgres::InvalidCopyData{"COPY data ended without the file trailer"};
+            return false;
+        }
+        bytes_read_ += 10;
+        const auto id = ids_[next_++];
+        if (!id) throw storages::postgres::InvalidInputBufferSize{"invalid value"};
+        row.id = *id;
+        return true;
+    }
+
+    std::size_t BytesRead() const noexcept { return bytes_read_; }
+
+private:
+    const std::vector<std::optional<int>> ids_;
+    const bool has_trailer_;
+    std::size_t next_{0};
+    std::size_t bytes_read_{0};
+};
+
+std::size_t CopyIds(FakeCopyOut& copy, std::vector<int>& ids) {
+    cache::impl::Statistics stats;
+    cache::UpdateStatisticsScope stats_scope{stats, cache::UpdateType::kFull};
+    tracing::Span span{"copy"};
+    auto scope = span.CreateScopeTime();
+    return components::pg_cache::detail::CopyRows<example::PostgresExamplePolicy>(
+        copy, stats_scope, scope, 0, [&ids](example::MyStructure&& value) { ids.push_back(value.id); }
+    );
+}
+
+}  // namespace
+
+UTEST(PostgreCacheCopy, SkipsRowsThatFailToConvert) {
+    FakeCopyOut copy{{1, std::nullopt, 3}, true};
+    std::vector<int> ids;
+    EXPECT_EQ(CopyIds(copy, ids), 2);
+    EXPECT_EQ(ids, (std::vector<int>{1, 3}));
+}
+
+UTEST(PostgreCacheCopy, FailsOnTruncatedStream) {
+    FakeCopyOut copy{{1, std::nullopt, 3}, false};
+    std::vector<int> ids;
+    UEXPECT_THROW(CopyIds(copy, ids), storages::postgres::InvalidCopyData);
+    EXPECT_EQ(ids, (std::vector<int>{1, 3}));
+}
+
 USERVER_NAMESPACE_END
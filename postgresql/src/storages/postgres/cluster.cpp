@@ -2,6 +2,7 @@
 
 #include <storages/postgres/detail/cluster_impl.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
+#include <storages/postgres/detail/result_cache.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -102,6 +103,17 @@ detail::NonTransaction Cluster::Start(ClusterHostTypeFlags flags, OptionalComman
     return pimpl_->Start(flags, cmd_ctl);
 }
 
+bool Cluster::IsQueryMultiplexingEnabled() const { return pimpl_->IsQueryMultiplexingEnabled(); }
+
+ResultSet Cluster::ExecuteMultiplexed(
+    ClusterHostTypeFlags flags,
+    OptionalCommandControl statement_cmd_ctl,
+    const Query& query,
+    detail::QueryParamsWriter params_writer
+) {
+    return pimpl_->ExecuteMultiplexed(flags, statement_cmd_ctl, query, params_writer);
+}
+
 OptionalCommandControl Cluster::GetQueryCmdCtl(const std::string& query_name) const {
     return pimpl_->GetQueryCmdCtl(query_name);
 }
@@ -124,10 +136,33 @@ ResultSet Cluster::Execute(
         statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
     }
     statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+    if (IsQueryMultiplexingEnabled()) {
+        return ExecuteMultiplexed(flags, statement_cmd_ctl, query, [&store](const UserTypes&) {
+            return detail::QueryParameters{store.GetInternalData()};
+        });
+    }
     auto ntrx = Start(flags, statement_cmd_ctl);
     return ntrx.Execute(statement_cmd_ctl, query.Statement(), store);
 }
 
+ResultSet Cluster::ExecuteCached(
+    ClusterHostTypeFlags flags,
+    const ResultCacheOptions& options,
+    const Query& query,
+    const ParameterStore& store
+) {
+    auto* cache = pimpl_->GetResultCache();
+    if (!cache) return Execute(flags, query, store);
+
+    auto key = detail::ResultCache::MakeKey(flags, query, store);
+    if (auto cached = cache->Get(key)) return *std::move(cached);
+
+    const auto token = cache->StartFill();
+    auto result = Execute(flags, query, store);
+    cache->Put(token, std::move(key), options, result, detail::ResultCache::EstimateSize(result));
+    return result;
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include <boost/uuid/uuid.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/io/uuid.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+#include <storages/postgres/util_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+using namespace pg::bench;
+
+constexpr pg::CommandControl kBulkCmdCtl{std::chrono::seconds{10}, std::chrono::seconds{5}};
+constexpr std::int64_t kColumnsCount = 4;
+
+using BenchRow = std::tuple<pg::Bigint, pg::Integer, double, boost::uuids::uuid>;
+
+// Only the decoding is measured, the result set is fetched once
+pg::ResultSet FetchRows(pg::detail::Connection& conn, std::int64_t count) {
+    return conn.Execute(
+        kBulkCmdCtl,
+        "select i::bigint, i::integer, i * 0.5::double precision, md5(i::text)::uuid from generate_series(1, $1) as i",
+        count
+    );
+}
+
+void ReportCells(benchmark::State& state) {
+    state.SetItemsProcessed(state.iterations() * state.range(0) * kColumnsCount);
+    state.SetLabel("items are cells");
+}
+
+BENCHMARK_DEFINE_F(PgConnection, DecodeRowWise)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        const auto res = FetchRows(GetConnection(), state.range(0));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(res.AsContainer<std::vector<BenchRow>>(pg::kRowTag));
+        }
+        ReportCells(state);
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, DecodeRowWise)->Arg(1000)->Arg(100000);
+
+BENCHMARK_DEFINE_F(PgConnection, DecodeColumnar)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        const auto res = FetchRows(GetConnection(), state.range(0));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(res.AsColumns<pg::Bigint, pg::Integer, double, boost::uuids::uuid>());
+        }
+        ReportCells(state);
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, DecodeColumnar)->Arg(1000)->Arg(100000);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
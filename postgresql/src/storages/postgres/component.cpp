@@ -40,6 +40,13 @@ storages::postgres::ConnlimitMode ParseConnlimitMode(const std::string& value) {
     UINVARIANT(false, "Unknown connlimit mode: " + value);
 }
 
+storages::postgres::HostSelectionStrategy ParseHostSelectionStrategy(const std::string& value) {
+    if (value == "round-robin") return storages::postgres::HostSelectionStrategy::kRoundRobin;
+    if (value == "power-of-two-choices") return storages::postgres::HostSelectionStrategy::kPowerOfTwoChoices;
+
+    UINVARIANT(false, "Unknown host selection strategy: " + value);
+}
+
 }  // namespace
 
 Postgres::Postgres(const ComponentConfig& config, const ComponentContext& context)
@@ -83,6 +90,13 @@ Postgres::Postgres(const ComponentConfig& config, const ComponentContext& contex
                                                                       : storages::postgres::InitMode::kAsync;
     initial_settings_.db_name = db_name_;
     initial_settings_.connlimit_mode = ParseConnlimitMode(config["connlimit_mode"].As<std::string>("auto"));
+    initial_settings_.host_selection_strategy =
+        ParseHostSelectionStrategy(config["host_selection_strategy"].As<std::string>("round-robin"));
+
+    initial_settings_.result_cache_settings.max_size_bytes =
+        config["result_cache_max_size_bytes"].As<std::size_t>(0);
+    initial_settings_.result_cache_settings.invalidation_channel =
+        config["result_cache_invalidation_channel"].As<std::string>({});
 
     initial_settings_.topology_settings.max_replication_lag =
         config["max_replication_lag"].As<std::chrono::milliseconds>(storages::postgres::kDefaultMaxReplicationLag);
@@ -317,12 +331,35 @@ properties:
         type: integer
         description: limit for concurrent establishing connections number per pool (0 - unlimited)
         defaultDescription: 0
+    multiplexed_connections:
+        type: integer
+        description: number of pipelined connections shared by concurrent single statements (0 - disabled)
+        defaultDescription: 0
+    max_multiplexed_batch_size:
+        type: integer
+        description: maximum number of statements sent in one multiplexed batch
+        defaultDescription: 64
     connlimit_mode:
         type: string
         enum:
          - auto
          - manual
         description: how to learn the `max_pool_size`
+    host_selection_strategy:
+        type: string
+        enum:
+         - round-robin
+         - power-of-two-choices
+        description: how to choose a host among the suitable ones when no strategy is requested explicitly
+        defaultDescription: round-robin
+    result_cache_max_size_bytes:
+        type: integer
+        description: approximate memory limit of the ExecuteCached results per shard (0 - disabled)
+        defaultDescription: 0
+        minimum: 0
+    result_cache_invalidation_channel:
+        type: string
+        description: channel of the result cache invalidation notifications, not listened to if not set
 )");
 }
 
@@ -0,0 +1,79 @@
+#include <userver/storages/postgres/copy_in.hpp>
+
+#include <string_view>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+// 11-byte signature, 32-bit flags field and 32-bit header extension length
+// https://www.postgresql.org/docs/current/sql-copy.html, "Binary Format"
+constexpr std::string_view kBinaryCopyHeader{"PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0", 19};
+
+}  // namespace
+
+CopyIn::CopyIn(detail::Connection* conn, const Query& query, OptionalCommandControl cmd_ctl, std::size_t chunk_size)
+    : conn_{conn}, chunk_size_{chunk_size} {
+    UASSERT(conn_);
+    if (!cmd_ctl) {
+        cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+    }
+    conn_->CopyInStart(query, std::move(cmd_ctl));
+    types_ = &conn_->GetUserTypes();
+
+    buffer_.reserve(chunk_size_ + chunk_size_ / 4);
+    buffer_.insert(buffer_.end(), kBinaryCopyHeader.begin(), kBinaryCopyHeader.end());
+}
+
+CopyIn::CopyIn(CopyIn&& other) noexcept
+    : conn_{std::exchange(other.conn_, nullptr)},
+      types_{other.types_},
+      chunk_size_{other.chunk_size_},
+      buffer_{std::move(other.buffer_)},
+      rows_written_{other.rows_written_} {}
+
+CopyIn& CopyIn::operator=(CopyIn&& other) noexcept {
+    if (this != &other) {
+        Abort();
+        conn_ = std::exchange(other.conn_, nullptr);
+        types_ = other.types_;
+        chunk_size_ = other.chunk_size_;
+        buffer_ = std::move(other.buffer_);
+        rows_written_ = other.rows_written_;
+    }
+    return *this;
+}
+
+CopyIn::~CopyIn() { Abort(); }
+
+std::size_t CopyIn::Finish() {
+    if (!conn_) {
+        throw LogicError{"COPY is already finished"};
+    }
+    // File trailer is a 16-bit word containing -1
+    io::WriteBuffer(*types_, buffer_, static_cast<Smallint>(-1));
+    SendBuffer();
+
+    auto* conn = std::exchange(conn_, nullptr);
+    return conn->CopyInEnd().RowsAffected();
+}
+
+void CopyIn::SendBuffer() {
+    conn_->CopyInPutData(std::string_view{buffer_.data(), buffer_.size()});
+    buffer_.clear();
+}
+
+void CopyIn::Abort() noexcept {
+    if (auto* conn = std::exchange(conn_, nullptr)) {
+        conn->CopyInAbort("COPY was not finished by the client");
+    }
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,134 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/copy_in.hpp>
+#include <userver/storages/postgres/io/array_types.hpp>
+
+#include <storages/postgres/util_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+using namespace pg::bench;
+
+// Bulk inserts take much longer than the roundtrips of kBenchCmdCtl
+constexpr pg::CommandControl kBulkCmdCtl{std::chrono::seconds{10}, std::chrono::seconds{5}};
+
+struct BenchRow final {
+    int id{};
+    std::string name;
+    double value{};
+};
+
+std::vector<BenchRow> MakeRows(std::size_t count) {
+    std::vector<BenchRow> rows;
+    rows.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto id = static_cast<int>(i);
+        rows.push_back({id, "name-" + std::to_string(i), id * 0.5});
+    }
+    return rows;
+}
+
+void PrepareTable(pg::detail::Connection& conn) {
+    conn.Execute(
+        kBulkCmdCtl, "create temporary table if not exists copy_in_bench(id integer, name text, value double precision)"
+    );
+}
+
+void TruncateTable(benchmark::State& state, pg::detail::Connection& conn) {
+    state.PauseTiming();
+    conn.Execute(kBulkCmdCtl, "truncate copy_in_bench");
+    state.ResumeTiming();
+}
+
+BENCHMARK_DEFINE_F(PgConnection, InsertRowByRow)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        auto& conn = GetConnection();
+        PrepareTable(conn);
+        const auto rows = MakeRows(state.range(0));
+
+        for (auto _ : state) {
+            conn.Begin({}, pg::detail::SteadyClock::now());
+            for (const auto& row : rows) {
+                conn.Execute(
+                    kBulkCmdCtl, "insert into copy_in_bench values($1, $2, $3)", row.id, row.name, row.value
+                );
+            }
+            conn.Commit();
+            TruncateTable(state, conn);
+        }
+        state.SetItemsProcessed(state.iterations() * rows.size());
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, InsertRowByRow)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(PgConnection, InsertUnnest)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        auto& conn = GetConnection();
+        PrepareTable(conn);
+        const auto rows = MakeRows(state.range(0));
+
+        for (auto _ : state) {
+            // Same column-wise encoding as Transaction::ExecuteDecomposeBulk
+            std::vector<int> ids;
+            std::vector<std::string> names;
+            std::vector<double> values;
+            ids.reserve(rows.size());
+            names.reserve(rows.size());
+            values.reserve(rows.size());
+            for (const auto& row : rows) {
+                ids.push_back(row.id);
+                names.push_back(row.name);
+                values.push_back(row.value);
+            }
+            conn.Execute(
+                kBulkCmdCtl,
+                "insert into copy_in_bench select * from unnest($1::integer[], $2::text[], $3::double precision[])",
+                ids,
+                names,
+                values
+            );
+            TruncateTable(state, conn);
+        }
+        state.SetItemsProcessed(state.iterations() * rows.size());
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, InsertUnnest)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(PgConnection, CopyInBinary)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        auto& conn = GetConnection();
+        PrepareTable(conn);
+        const auto rows = MakeRows(state.range(0));
+
+        for (auto _ : state) {
+            pg::CopyIn copy{&conn, "COPY copy_in_bench (id, name, value) FROM STDIN (FORMAT binary)", kBulkCmdCtl};
+            copy.WriteRows(rows);
+            benchmark::DoNotOptimize(copy.Finish());
+            TruncateTable(state, conn);
+        }
+        state.SetItemsProcessed(state.iterations() * rows.size());
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, CopyInBinary)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,119 @@
+#include <userver/storages/postgres/copy_out.hpp>
+
+#include <cstring>
+#include <string_view>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+// 11-byte signature, 32-bit flags field and 32-bit header extension length
+// https://www.postgresql.org/docs/current/sql-copy.html, "Binary Format"
+constexpr std::string_view kBinaryCopySignature{"PGCOPY\n\377\r\n\0", 11};
+constexpr std::size_t kBinaryCopyHeaderSize = kBinaryCopySignature.size() + 2 * sizeof(Integer);
+
+io::FieldBuffer MakeBuffer(std::string_view data) {
+    return {false, io::BufferCategory::kPlainBuffer, data.size(), reinterpret_cast<const std::uint8_t*>(data.data())};
+}
+
+}  // namespace
+
+CopyOut::CopyOut(detail::Connection* conn, const Query& query, OptionalCommandControl cmd_ctl) : conn_{conn} {
+    UASSERT(conn_);
+    if (!cmd_ctl) {
+        cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+    }
+    conn_->CopyOutStart(query, std::move(cmd_ctl));
+    categories_ = &conn_->GetUserTypes().GetTypeBufferCategories();
+}
+
+CopyOut::CopyOut(CopyOut&& other) noexcept
+    : conn_{std::exchange(other.conn_, nullptr)},
+      categories_{other.categories_},
+      header_read_{other.header_read_},
+      rows_read_{other.rows_read_},
+      bytes_read_{other.bytes_read_} {}
+
+CopyOut& CopyOut::operator=(CopyOut&& other) noexcept {
+    if (this != &other) {
+        Abort();
+        conn_ = std::exchange(other.conn_, nullptr);
+        categories_ = other.categories_;
+        header_read_ = other.header_read_;
+        rows_read_ = other.rows_read_;
+        bytes_read_ = other.bytes_read_;
+    }
+    return *this;
+}
+
+CopyOut::~CopyOut() { Abort(); }
+
+io::FieldBuffer CopyOut::NextRow(std::size_t expected_fields) {
+    if (!conn_) return {};
+
+    auto data = conn_->CopyOutGetData();
+    if (data.empty()) {
+        // Statement finished without the file trailer
+        conn_ = nullptr;
+        throw InvalidCopyData{"COPY data ended without the file trailer"};
+    }
+    bytes_read_ += data.size();
+
+    if (!header_read_) {
+        if (data.size() < kBinaryCopyHeaderSize || data.substr(0, kBinaryCopySignature.size()) != kBinaryCopySignature) {
+            throw InvalidCopyData{"Invalid binary COPY header"};
+        }
+        auto header = MakeBuffer(data.substr(kBinaryCopySignature.size()));
+        Integer flags{0};
+        Integer extension_size{0};
+        header.Read(flags, io::BufferCategory::kPlainBuffer);
+        header.Read(extension_size, io::BufferCategory::kPlainBuffer);
+        if (extension_size < 0 || data.size() < kBinaryCopyHeaderSize + extension_size) {
+            throw InvalidCopyData{"Invalid binary COPY header extension"};
+        }
+        data.remove_prefix(kBinaryCopyHeaderSize + extension_size);
+        header_read_ = true;
+        if (data.empty()) {
+            // Header was sent in a message of its own
+            return NextRow(expected_fields);
+        }
+    }
+
+    auto buffer = MakeBuffer(data);
+    Smallint field_count{0};
+    buffer.Read(field_count, io::BufferCategory::kPlainBuffer);
+    if (field_count == -1) {
+        // File trailer, the next call returns the end of data and finishes the
+        // statement
+        auto* conn = std::exchange(conn_, nullptr);
+        if (!conn->CopyOutGetData().empty()) {
+            throw InvalidCopyData{"Unexpected COPY data after the file trailer"};
+        }
+        return {};
+    }
+    if (field_count < 0 || static_cast<std::size_t>(field_count) != expected_fields) {
+        throw InvalidTupleSizeRequested{static_cast<std::size_t>(field_count), expected_fields};
+    }
+    return buffer;
+}
+
+void CopyOut::CheckRowConsumed(const io::FieldBuffer& buffer) const {
+    if (buffer.length != 0) {
+        throw InvalidBinaryBuffer{fmt::format("{} unconsumed bytes in a COPY row", buffer.length)};
+    }
+}
+
+void CopyOut::Abort() noexcept {
+    if (auto* conn = std::exchange(conn_, nullptr)) {
+        conn->CopyOutAbort();
+    }
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/copy_out.hpp>
+#include <userver/storages/postgres/portal.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+#include <storages/postgres/util_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+using namespace pg::bench;
+
+// Reading large tables takes much longer than the roundtrips of kBenchCmdCtl
+constexpr pg::CommandControl kBulkCmdCtl{std::chrono::seconds{10}, std::chrono::seconds{5}};
+constexpr std::uint32_t kPortalChunkSize = 1000;
+
+struct BenchRow final {
+    int id{};
+    std::string name;
+    double value{};
+};
+
+void PrepareTable(pg::detail::Connection& conn, std::int64_t count) {
+    conn.Execute(
+        kBulkCmdCtl, "create temporary table if not exists copy_out_bench(id integer, name text, value double precision)"
+    );
+    conn.Execute(kBulkCmdCtl, "truncate copy_out_bench");
+    conn.Execute(
+        kBulkCmdCtl,
+        "insert into copy_out_bench select i, 'name-' || i, i * 0.5 from generate_series(1, $1) as i",
+        count
+    );
+}
+
+BENCHMARK_DEFINE_F(PgConnection, ReadPortal)(benchmark::State& state) {
+    if (!pg::Portal::IsSupportedByDriver()) {
+        state.SkipWithError("Portals are not supported by the driver");
+        return;
+    }
+    RunStandalone(state, [this, &state] {
+        auto& conn = GetConnection();
+        PrepareTable(conn, state.range(0));
+
+        for (auto _ : state) {
+            conn.Begin({}, pg::detail::SteadyClock::now());
+            pg::Portal portal{&conn, "select id, name, value from copy_out_bench", {}, kBulkCmdCtl};
+            std::vector<BenchRow> rows;
+            while (portal) {
+                auto res = portal.Fetch(kPortalChunkSize);
+                for (auto row : res.AsSetOf<BenchRow>(pg::kRowTag)) {
+                    rows.push_back(std::move(row));
+                }
+            }
+            benchmark::DoNotOptimize(rows);
+            conn.Commit();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, ReadPortal)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(PgConnection, ReadCopyOutBinary)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        auto& conn = GetConnection();
+        PrepareTable(conn, state.range(0));
+
+        std::size_t bytes = 0;
+        for (auto _ : state) {
+            pg::CopyOut copy{&conn, "COPY copy_out_bench (id, name, value) TO STDOUT (FORMAT binary)", kBulkCmdCtl};
+            std::vector<BenchRow> rows;
+            BenchRow row;
+            while (copy.ReadRow(row)) {
+                rows.push_back(std::move(row));
+            }
+            benchmark::DoNotOptimize(rows);
+            bytes += copy.BytesRead();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(bytes);
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, ReadCopyOutBinary)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -4,10 +4,14 @@
 
 #include <userver/dynamic_config/value.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/utils/algo.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 
+#include <storages/postgres/detail/host_selection.hpp>
 #include <storages/postgres/detail/topology/hot_standby.hpp>
 #include <storages/postgres/detail/topology/standalone.hpp>
 #include <storages/postgres/postgres_config.hpp>
@@ -22,6 +26,8 @@ namespace storages::postgres::detail {
 
 namespace {
 
+constexpr std::chrono::seconds kResultCacheRelistenDelay{1};
+
 ClusterHostType Fallback(ClusterHostType ht) {
     switch (ht) {
         case ClusterHostType::kMaster:
@@ -41,6 +47,8 @@ ClusterHostType Fallback(ClusterHostType ht) {
 size_t SelectDsnIndex(
     const topology::TopologyBase::DsnIndices& indices,
     ClusterHostTypeFlags flags,
+    HostSelectionStrategy default_strategy,
+    const std::vector<std::shared_ptr<ConnectionPool>>& host_pools,
     std::atomic<uint32_t>& rr_host_idx
 ) {
     UASSERT(!indices.empty());
@@ -52,7 +60,15 @@ size_t SelectDsnIndex(
     LOG_TRACE() << "Applying " << strategy_flags << " strategy";
 
     size_t idx_pos = 0;
-    if (!strategy_flags || strategy_flags == ClusterHostType::kRoundRobin) {
+    if (!strategy_flags && default_strategy == HostSelectionStrategy::kPowerOfTwoChoices) {
+        const auto now = SteadyClock::now();
+        idx_pos = SelectPowerOfTwoChoices(indices.size(), [&](std::size_t pos) {
+            const auto& pool = host_pools.at(indices[pos]);
+            return HostSelectionScore(
+                pool->GetOutstandingRequestsApprox(), pool->GetQueryLatencyEwma(), now - pool->GetLastSelectedTime()
+            );
+        });
+    } else if (!strategy_flags || strategy_flags == ClusterHostType::kRoundRobin) {
         if (indices.size() != 1) {
             idx_pos = rr_host_idx.fetch_add(1, std::memory_order_relaxed) % indices.size();
         }
@@ -85,6 +101,8 @@ ClusterImpl::ClusterImpl(
       default_cmd_ctls_(default_cmd_ctls),
       testsuite_pg_ctl_(testsuite_pg_ctl),
       ei_settings_(ei_settings),
+      host_selection_strategy_(cluster_settings.host_selection_strategy),
+      query_multiplexing_enabled_(cluster_settings.pool_settings.multiplexed_connections > 0),
       rr_host_idx_(0),
       connlimit_watchdog_(*this, testsuite_tasks, shard_number, [this]() { OnConnlimitChanged(); }) {
     CreateTopology(dsns);
@@ -97,6 +115,19 @@ ClusterImpl::ClusterImpl(
     } else {
         connlimit_mode_auto_enabled_ = false;
     }
+
+    const auto& cache_settings = cluster_settings.result_cache_settings;
+    if (cache_settings.max_size_bytes > 0) {
+        const bool listen = !cache_settings.invalidation_channel.empty();
+        result_cache_ = std::make_unique<ResultCache>(cache_settings.max_size_bytes, listen);
+        if (listen) {
+            result_cache_listener_ = USERVER_NAMESPACE::utils::CriticalAsync(
+                bg_task_processor_,
+                "pg_result_cache_listener",
+                [this, channel = cache_settings.invalidation_channel] { ListenResultCacheInvalidations(channel); }
+            );
+        }
+    }
 }
 
 void ClusterImpl::CreateTopology(const DsnList& dsns) {
@@ -169,7 +200,10 @@ void ClusterImpl::CreateTopology(const DsnList& dsns) {
     *existing_td = std::move(data);
 }
 
-ClusterImpl::~ClusterImpl() { connlimit_watchdog_.Stop(); }
+ClusterImpl::~ClusterImpl() {
+    if (result_cache_listener_.IsValid()) result_cache_listener_.SyncCancel();
+    connlimit_watchdog_.Stop();
+}
 
 ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
     auto cluster_stats = std::make_unique<ClusterStatistics>();
@@ -241,6 +275,8 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
         cluster_stats->unknown.push_back(std::move(desc));
     }
 
+    if (result_cache_) cluster_stats->result_cache = result_cache_->GetStatistics();
+
     return cluster_stats;
 }
 
@@ -266,7 +302,7 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(ClusterHostTypeFlags flags)
         if (alive_dsn_indices->empty()) {
             throw ClusterUnavailable("None of cluster hosts are available");
         }
-        dsn_index = SelectDsnIndex(*alive_dsn_indices, flags, rr_host_idx_);
+        dsn_index = SelectDsnIndex(*alive_dsn_indices, flags, host_selection_strategy_, host_pools, rr_host_idx_);
     } else {
         auto host_role = static_cast<ClusterHostType>(role_flags.GetValue());
         auto dsn_indices_by_type = topology->GetDsnIndicesByType();
@@ -285,11 +321,14 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(ClusterHostTypeFlags flags)
             );
         }
         LOG_TRACE() << "Starting transaction on " << host_role;
-        dsn_index = SelectDsnIndex(dsn_indices_it->second, flags, rr_host_idx_);
+        dsn_index =
+            SelectDsnIndex(dsn_indices_it->second, flags, host_selection_strategy_, host_pools, rr_host_idx_);
     }
 
     UASSERT(dsn_index < host_pools.size());
-    return host_pools.at(dsn_index);
+    auto& pool = host_pools.at(dsn_index);
+    pool->AccountSelected();
+    return pool;
 }
 
 Transaction
@@ -317,10 +356,51 @@ NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags, OptionalCommandCon
     return FindPool(flags)->Start(cmd_ctl);
 }
 
+bool ClusterImpl::IsQueryMultiplexingEnabled() const { return query_multiplexing_enabled_.load(); }
+
+ResultSet ClusterImpl::ExecuteMultiplexed(
+    ClusterHostTypeFlags flags,
+    OptionalCommandControl cmd_ctl,
+    const Query& query,
+    QueryParamsWriter params_writer
+) {
+    if (!(flags & kClusterHostRolesMask)) {
+        throw LogicError("Host role must be specified for execution of a single statement");
+    }
+    LOG_TRACE() << "Requested multiplexed statement on " << flags;
+    return FindPool(flags)->ExecuteMultiplexed(query, params_writer, cmd_ctl);
+}
+
 NotifyScope ClusterImpl::Listen(std::string_view channel, OptionalCommandControl cmd_ctl) {
     return FindPool(ClusterHostType::kMaster)->Listen(channel, cmd_ctl);
 }
 
+void ClusterImpl::ListenResultCacheInvalidations(const std::string& channel) {
+    UASSERT(result_cache_);
+    while (!engine::current_task::ShouldCancel()) {
+        try {
+            auto scope = Listen(channel, {});
+            // The notifications sent while nobody was listening are lost
+            result_cache_->Resume();
+            LOG_INFO() << "Listening for the result cache invalidations on channel '" << channel << "'";
+            while (true) {
+                const auto notification = scope.WaitNotify(engine::Deadline{});
+                if (notification.payload) {
+                    result_cache_->Invalidate(*notification.payload);
+                } else {
+                    result_cache_->InvalidateAll();
+                }
+            }
+        } catch (const std::exception& ex) {
+            result_cache_->Suspend();
+            if (engine::current_task::ShouldCancel()) break;
+            LOG_WARNING() << "Result cache is suspended, failed to listen for the invalidations on channel '"
+                          << channel << "': " << ex;
+            engine::InterruptibleSleepFor(kResultCacheRelistenDelay);
+        }
+    }
+}
+
 QueryQueue ClusterImpl::CreateQueryQueue(ClusterHostTypeFlags flags, TimeoutDuration acquire_timeout) {
     return QueryQueue{
         GetDefaultCommandControl(), FindPool(flags)->Acquire(engine::Deadline::FromDuration(acquire_timeout))};
@@ -370,6 +450,7 @@ void ClusterImpl::SetPoolSettings(const PoolSettings& new_settings) {
     for (const auto& pool : td->host_pools) {
         pool->SetSettings(cluster_settings->pool_settings);
     }
+    query_multiplexing_enabled_ = cluster_settings->pool_settings.multiplexed_connections > 0;
 }
 
 void ClusterImpl::SetTopologySettings(const TopologySettings& settings) {
@@ -7,6 +7,7 @@
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/error_injection/settings.hpp>
 #include <userver/testsuite/postgres_control.hpp>
 #include <userver/testsuite/tasks.hpp>
@@ -14,6 +15,7 @@
 #include <storages/postgres/connlimit_watchdog.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
 #include <storages/postgres/detail/pool.hpp>
+#include <storages/postgres/detail/result_cache.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
 #include <storages/postgres/detail/topology/base.hpp>
 #include <userver/storages/postgres/cluster_types.hpp>
@@ -51,8 +53,20 @@ public:
 
     NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
 
+    bool IsQueryMultiplexingEnabled() const;
+
+    ResultSet ExecuteMultiplexed(
+        ClusterHostTypeFlags,
+        OptionalCommandControl,
+        const Query& query,
+        QueryParamsWriter params_writer
+    );
+
     NotifyScope Listen(std::string_view channel, OptionalCommandControl);
 
+    /// Returns nullptr if the result cache is disabled
+    ResultCache* GetResultCache() noexcept { return result_cache_.get(); }
+
     QueryQueue CreateQueryQueue(ClusterHostTypeFlags flags, TimeoutDuration acquire_timeout);
 
     void SetDefaultCommandControl(CommandControl, DefaultCommandControlSource);
@@ -94,6 +108,8 @@ private:
 
     void CreateTopology(const DsnList& dsns);
 
+    void ListenResultCacheInvalidations(const std::string& channel);
+
     rcu::Variable<ClusterSettings> cluster_settings_;
     concurrent::Variable<TopologyData, engine::SharedMutex> topology_data_;
     clients::dns::Resolver* resolver_{};
@@ -103,9 +119,14 @@ private:
     const testsuite::PostgresControl testsuite_pg_ctl_;
     const error_injection::Settings ei_settings_;
 
+    const HostSelectionStrategy host_selection_strategy_;
+    std::atomic<bool> query_multiplexing_enabled_;
     std::atomic<uint32_t> rr_host_idx_;
     std::atomic<bool> connlimit_mode_auto_enabled_;
     ConnlimitWatchdog connlimit_watchdog_;
+
+    std::unique_ptr<ResultCache> result_cache_;
+    engine::TaskWithResult<void> result_cache_listener_;
 };
 
 }  // namespace storages::postgres::detail
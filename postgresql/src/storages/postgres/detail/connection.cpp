@@ -136,6 +136,11 @@ std::vector<ResultSet> Connection::GatherPipeline(TimeoutDuration timeout, const
     return pimpl_->GatherPipeline(timeout, descriptions);
 }
 
+std::vector<Connection::PipelineResult>
+Connection::GatherPipelineResults(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
+    return pimpl_->GatherPipelineResults(timeout, descriptions);
+}
+
 ResultSet Connection::Execute(const Query& query, const ParameterStore& store) {
     return Execute(query, detail::QueryParameters{store.GetInternalData()});
 }
@@ -182,6 +187,24 @@ void Connection::Unlisten(std::string_view channel, OptionalCommandControl cmd_c
 
 Notification Connection::WaitNotify(engine::Deadline deadline) { return pimpl_->WaitNotify(deadline); }
 
+void Connection::CopyInStart(const Query& query, OptionalCommandControl cmd_ctl) {
+    pimpl_->CopyInStart(query, std::move(cmd_ctl));
+}
+
+void Connection::CopyInPutData(std::string_view data) { pimpl_->CopyInPutData(data); }
+
+ResultSet Connection::CopyInEnd() { return pimpl_->CopyInEnd(); }
+
+void Connection::CopyInAbort(const char* error_message) noexcept { pimpl_->CopyInAbort(error_message); }
+
+void Connection::CopyOutStart(const Query& query, OptionalCommandControl cmd_ctl) {
+    pimpl_->CopyOutStart(query, std::move(cmd_ctl));
+}
+
+std::string_view Connection::CopyOutGetData() { return pimpl_->CopyOutGetData(); }
+
+void Connection::CopyOutAbort() noexcept { pimpl_->CopyOutAbort(); }
+
 TimeoutDuration Connection::GetIdleDuration() const { return pimpl_->GetIdleDuration(); }
 
 void Connection::Ping() { pimpl_->Ping(); }
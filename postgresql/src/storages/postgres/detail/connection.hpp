@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <exception>
 #include <string>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
@@ -230,6 +231,17 @@ public:
 
     std::vector<ResultSet> GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
 
+    struct PipelineResult final {
+        ResultSet result{nullptr};
+        /// Query execution error, the result is empty then
+        std::exception_ptr error;
+    };
+    /// Gather the results of pipelined queries without failing all of them on
+    /// a single query error. The results missing due to a connection failure
+    /// are not returned.
+    std::vector<PipelineResult>
+    GatherPipelineResults(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+
     template <typename... T>
     ResultSet Execute(const Query& query, const T&... args) {
         detail::StaticQueryParameters<sizeof...(args)> params;
@@ -241,7 +253,7 @@ public:
     ResultSet Execute(CommandControl statement_cmd_ctl, const Query& query, const T&... args) {
         detail::StaticQueryParameters<sizeof...(args)> params;
         params.Write(GetUserTypes(), args...);
-        return Execute(query, params, OptionalCommandControl{statement_cmd_ctl});
+        return Execute(query, detail::QueryParameters{params}, OptionalCommandControl{statement_cmd_ctl});
     }
 
     ResultSet Execute(const Query& query, const ParameterStore& store);
@@ -285,6 +297,33 @@ public:
     void Unlisten(std::string_view channel, OptionalCommandControl);
 
     Notification WaitNotify(engine::Deadline deadline);
+
+    /// @brief Send a `COPY ... FROM STDIN (FORMAT binary)` statement and wait
+    /// for the server to accept the data.
+    /// Until CopyInEnd or CopyInAbort is called the connection accepts only
+    /// CopyInPutData calls.
+    void CopyInStart(const Query& query, OptionalCommandControl);
+    /// @brief Send a chunk of COPY data, suspends until the data is written to
+    /// the socket
+    void CopyInPutData(std::string_view data);
+    /// @brief Finish the COPY and wait for its result
+    ResultSet CopyInEnd();
+    /// @brief Abort the COPY, the statement fails with the message on the server
+    /// side. Does nothing if there is no COPY in progress.
+    void CopyInAbort(const char* error_message) noexcept;
+
+    /// @brief Send a `COPY ... TO STDOUT (FORMAT binary)` statement and wait
+    /// for the server to start sending the data.
+    /// Until CopyOutGetData returns an empty view or CopyOutAbort is called the
+    /// connection accepts only CopyOutGetData calls.
+    void CopyOutStart(const Query& query, OptionalCommandControl);
+    /// @brief Get the next COPY data message, suspends until it is received.
+    /// The view is valid until the next call. Returns an empty view and
+    /// finishes the statement when there is no more data.
+    std::string_view CopyOutGetData();
+    /// @brief Cancel the COPY and discard the rest of the data. Does nothing if
+    /// there is no COPY in progress.
+    void CopyOutAbort() noexcept;
     //@}
 
     /// Get duration since last network operation
@@ -95,6 +95,28 @@ private:
     bool completed_{false};
 };
 
+class CountCopy {
+public:
+    CountCopy(Connection::Statistics& stats, SteadyClock::time_point start_time)
+        : stats_(stats), start_time_(start_time) {}
+
+    ~CountCopy() {
+        auto now = SteadyClock::now();
+        if (!completed_) {
+            ++stats_.error_execute_total;
+        }
+        stats_.sum_query_duration += now - start_time_;
+        stats_.last_execute_finish = now;
+    }
+
+    void AccountResult(ResultSet&) { completed_ = true; }
+
+private:
+    Connection::Statistics& stats_;
+    bool completed_{false};
+    SteadyClock::time_point start_time_;
+};
+
 struct TrackTrxEnd {
     TrackTrxEnd(Connection::Statistics& stats) : stats_(stats) {}
     ~TrackTrxEnd() { stats_.trx_end_time = SteadyClock::now(); }
@@ -532,6 +554,162 @@ Notification ConnectionImpl::WaitNotify(engine::Deadline deadline) {
     return conn_wrapper_.WaitNotify(deadline);
 }
 
+void ConnectionImpl::StartCopy(const Query& query, OptionalCommandControl statement_cmd_ctl, CopyDirection direction) {
+    CheckBusy();
+    UASSERT_MSG(!copy_, "Another COPY is in progress on the connection");
+
+    const auto network_timeout = ExecuteTimeout(statement_cmd_ctl);
+    auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+    SetStatementTimeout(std::move(statement_cmd_ctl));
+    CheckDeadlineReached(deadline);
+
+    auto span = MakeQuerySpan(query, {network_timeout, GetStatementTimeout()});
+    auto scope = span.CreateScopeTime();
+
+    bool reenter_pipeline = false;
+    if (IsPipelineActive()) {
+        // libpq does not allow COPY in pipeline mode. Commands that were sent
+        // without waiting for their results (BEGIN, SET) must complete first.
+        conn_wrapper_.WaitResult(deadline, scope, nullptr);
+        conn_wrapper_.ExitPipelineMode();
+        reenter_pipeline = true;
+    }
+
+    const auto start_time = SteadyClock::now();
+    ++stats_.execute_total;
+    try {
+        conn_wrapper_.SendQuery(query.Statement(), scope);
+        if (direction == CopyDirection::kIn) {
+            conn_wrapper_.WaitCopyIn(deadline, scope);
+        } else {
+            conn_wrapper_.WaitCopyOut(deadline, scope);
+        }
+    } catch (const ConnectionTimeoutError&) {
+        ++stats_.execute_timeout;
+        ++stats_.error_execute_total;
+        span.AddTag(tracing::kErrorFlag, true);
+        throw;
+    } catch (const std::exception&) {
+        ++stats_.error_execute_total;
+        span.AddTag(tracing::kErrorFlag, true);
+        if (reenter_pipeline) ReenterPipelineAfterCopy();
+        throw;
+    }
+    copy_.emplace(CopyState{query, network_timeout, start_time, direction, reenter_pipeline});
+}
+
+void ConnectionImpl::CopyInStart(const Query& query, OptionalCommandControl statement_cmd_ctl) {
+    StartCopy(query, std::move(statement_cmd_ctl), CopyDirection::kIn);
+}
+
+void ConnectionImpl::CopyInPutData(std::string_view data) {
+    UASSERT_MSG(copy_ && copy_->direction == CopyDirection::kIn, "CopyInPutData called without CopyInStart");
+    try {
+        conn_wrapper_.PutCopyData(data, testsuite_pg_ctl_.MakeExecuteDeadline(copy_->network_timeout));
+    } catch (const ConnectionTimeoutError& e) {
+        ++stats_.execute_timeout;
+        LOG_LIMITED_WARNING() << "Statement `" << copy_->query.Statement() << "` network timeout error: " << e
+                              << ". Network timeout was " << copy_->network_timeout.count() << "ms";
+        throw;
+    }
+}
+
+ResultSet ConnectionImpl::CopyInEnd() {
+    UASSERT_MSG(copy_ && copy_->direction == CopyDirection::kIn, "CopyInEnd called without CopyInStart");
+    return FinishCopy();
+}
+
+void ConnectionImpl::CopyInAbort(const char* error_message) noexcept {
+    if (!copy_) return;
+    UASSERT(copy_->direction == CopyDirection::kIn);
+    const auto state = std::move(*copy_);
+    copy_.reset();
+
+    CountCopy count_copy(stats_, state.start_time);
+    try {
+        const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(state.network_timeout);
+        conn_wrapper_.PutCopyEnd(error_message, deadline);
+        // The statement fails with the error message, consume the error
+        conn_wrapper_.DiscardInput(deadline);
+    } catch (const std::exception& e) {
+        LOG_LIMITED_WARNING() << "Failed to abort COPY `" << state.query.Statement() << "`: " << e;
+    }
+    if (state.reenter_pipeline) ReenterPipelineAfterCopy();
+}
+
+void ConnectionImpl::CopyOutStart(const Query& query, OptionalCommandControl statement_cmd_ctl) {
+    StartCopy(query, std::move(statement_cmd_ctl), CopyDirection::kOut);
+}
+
+std::string_view ConnectionImpl::CopyOutGetData() {
+    UASSERT_MSG(copy_ && copy_->direction == CopyDirection::kOut, "CopyOutGetData called without CopyOutStart");
+    try {
+        copy_out_data_ = conn_wrapper_.GetCopyData(testsuite_pg_ctl_.MakeExecuteDeadline(copy_->network_timeout));
+    } catch (const ConnectionTimeoutError& e) {
+        ++stats_.execute_timeout;
+        LOG_LIMITED_WARNING() << "Statement `" << copy_->query.Statement() << "` network timeout error: " << e
+                              << ". Network timeout was " << copy_->network_timeout.count() << "ms";
+        throw;
+    }
+    if (copy_out_data_) {
+        return {copy_out_data_.buffer.get(), copy_out_data_.size};
+    }
+    // No more data, the statement result follows
+    FinishCopy();
+    return {};
+}
+
+void ConnectionImpl::CopyOutAbort() noexcept {
+    if (!copy_) return;
+    UASSERT(copy_->direction == CopyDirection::kOut);
+    const auto state = std::move(*copy_);
+    copy_.reset();
+    copy_out_data_ = {};
+
+    CountCopy count_copy(stats_, state.start_time);
+    try {
+        // There is no way to stop COPY TO STDOUT from the client side except
+        // for cancelling the statement
+        Cancel();
+        conn_wrapper_.DiscardInput(testsuite_pg_ctl_.MakeExecuteDeadline(state.network_timeout));
+    } catch (const std::exception& e) {
+        LOG_LIMITED_WARNING() << "Failed to abort COPY `" << state.query.Statement() << "`: " << e;
+        conn_wrapper_.MarkAsBroken();
+    }
+    if (state.reenter_pipeline) ReenterPipelineAfterCopy();
+}
+
+ResultSet ConnectionImpl::FinishCopy() {
+    const auto state = std::move(*copy_);
+    copy_.reset();
+
+    auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(state.network_timeout);
+    auto span = MakeQuerySpan(state.query, {state.network_timeout, GetStatementTimeout()});
+    auto scope = span.CreateScopeTime();
+    CountCopy count_copy(stats_, state.start_time);
+    ScopeGuard pipeline_guard{[this, reenter = state.reenter_pipeline] {
+        if (reenter) ReenterPipelineAfterCopy();
+    }};
+
+    if (state.direction == CopyDirection::kIn) {
+        conn_wrapper_.PutCopyEnd(nullptr, deadline);
+    }
+    return WaitResult(state.query.Statement(), deadline, state.network_timeout, count_copy, span, scope, nullptr);
+}
+
+void ConnectionImpl::ReenterPipelineAfterCopy() noexcept {
+    // If the connection is still busy (e.g. after a timeout) it will be put
+    // back into pipeline mode by Cleanup
+    if (!IsConnected() || IsBroken() || GetConnectionState() == ConnectionState::kTranActive || IsPipelineActive()) {
+        return;
+    }
+    try {
+        conn_wrapper_.EnterPipelineMode();
+    } catch (const std::exception& e) {
+        LOG_LIMITED_WARNING() << "Failed to reenter pipeline mode after COPY: " << e;
+    }
+}
+
 void ConnectionImpl::CancelAndCleanup(TimeoutDuration timeout) {
     auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
 
@@ -893,22 +1071,39 @@ ConnectionImpl::GatherPipeline(TimeoutDuration timeout, const std::vector<Result
     const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
     CheckDeadlineReached(deadline);
 
-    std::vector<const PGresult*> native_descriptions(descriptions.size(), nullptr);
-    if (IsOmitDescribeInExecuteEnabled()) {
-        for (std::size_t i = 0; i < descriptions.size(); ++i) {
-            native_descriptions[i] = descriptions[i].pimpl_->handle_.get();
-        }
+    auto result = conn_wrapper_.GatherPipeline(deadline, GetNativeDescriptions(descriptions));
+
+    for (auto& single_result : result) {
+        FillBufferCategories(single_result);
     }
 
-    auto result = conn_wrapper_.GatherPipeline(deadline, native_descriptions);
+    return result;
+}
+
+std::vector<Connection::PipelineResult>
+ConnectionImpl::GatherPipelineResults(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
+    CheckDeadlineReached(deadline);
+
+    auto result = conn_wrapper_.GatherPipelineResults(deadline, GetNativeDescriptions(descriptions));
 
     for (auto& single_result : result) {
-        FillBufferCategories(single_result);
+        if (!single_result.error) FillBufferCategories(single_result.result);
     }
 
     return result;
 }
 
+std::vector<const PGresult*> ConnectionImpl::GetNativeDescriptions(const std::vector<ResultSet>& descriptions) const {
+    std::vector<const PGresult*> native_descriptions(descriptions.size(), nullptr);
+    if (IsOmitDescribeInExecuteEnabled()) {
+        for (std::size_t i = 0; i < descriptions.size(); ++i) {
+            native_descriptions[i] = descriptions[i].pimpl_->handle_.get();
+        }
+    }
+    return native_descriptions;
+}
+
 ResultSet ConnectionImpl::ExecuteCommandNoPrepare(const Query& query, engine::Deadline deadline) {
     static const QueryParameters kNoParams;
     return ExecuteCommandNoPrepare(query, kNoParams, deadline);
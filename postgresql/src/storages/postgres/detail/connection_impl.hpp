@@ -90,6 +90,8 @@ public:
         tracing::ScopeTime& scope
     );
     std::vector<ResultSet> GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+    std::vector<Connection::PipelineResult>
+    GatherPipelineResults(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
 
     void Begin(
         const TransactionOptions& options,
@@ -120,6 +122,15 @@ public:
     void Unlisten(std::string_view channel, OptionalCommandControl);
     Notification WaitNotify(engine::Deadline deadline);
 
+    void CopyInStart(const Query& query, OptionalCommandControl statement_cmd_ctl);
+    void CopyInPutData(std::string_view data);
+    ResultSet CopyInEnd();
+    void CopyInAbort(const char* error_message) noexcept;
+
+    void CopyOutStart(const Query& query, OptionalCommandControl statement_cmd_ctl);
+    std::string_view CopyOutGetData();
+    void CopyOutAbort() noexcept;
+
     void CancelAndCleanup(TimeoutDuration timeout);
     bool Cleanup(TimeoutDuration timeout);
 
@@ -186,6 +197,7 @@ private:
 
     void LoadUserTypes(engine::Deadline deadline);
     void FillBufferCategories(ResultSet& res);
+    std::vector<const PGresult*> GetNativeDescriptions(const std::vector<ResultSet>& descriptions) const;
 
     template <typename Counter>
     ResultSet WaitResult(
@@ -200,6 +212,12 @@ private:
 
     void Cancel();
 
+    enum class CopyDirection { kIn, kOut };
+
+    void StartCopy(const Query& query, OptionalCommandControl statement_cmd_ctl, CopyDirection direction);
+    ResultSet FinishCopy();
+    void ReenterPipelineAfterCopy() noexcept;
+
     void ReportStatement(const std::string& name);
 
     bool IsOmitDescribeInExecuteEnabled() const;
@@ -222,6 +240,16 @@ private:
     TimeoutDuration current_statement_timeout_{};
     const error_injection::Settings ei_settings_;
 
+    struct CopyState {
+        Query query;
+        TimeoutDuration network_timeout{};
+        SteadyClock::time_point start_time;
+        CopyDirection direction{CopyDirection::kIn};
+        bool reenter_pipeline{false};
+    };
+    std::optional<CopyState> copy_;
+    PGConnectionWrapper::CopyData copy_out_data_;
+
     std::unordered_set<std::string> statements_reported_;
     engine::Mutex statements_mutex_;
 };
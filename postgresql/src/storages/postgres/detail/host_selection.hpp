@@ -0,0 +1,63 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Weight of a new sample in the smoothed query latency, 1/2^kLatencyEwmaShift
+inline constexpr int kLatencyEwmaShift = 3;
+
+/// Exponentially weighted moving average step for integer latencies
+inline std::uint32_t UpdateLatencyEwma(std::uint32_t ewma, std::uint32_t sample) {
+    if (ewma == 0) return sample;
+    const auto diff = static_cast<std::int64_t>(sample) - static_cast<std::int64_t>(ewma);
+    return static_cast<std::uint32_t>(static_cast<std::int64_t>(ewma) + diff / (1 << kLatencyEwmaShift));
+}
+
+/// Expected time for a new request to complete on a host: every outstanding
+/// request and the new one are assumed to take the smoothed query latency.
+/// Hosts without latency samples yet are scored by the outstanding requests only.
+inline std::uint64_t HostLoadScore(std::size_t outstanding, std::chrono::microseconds latency_ewma) {
+    const auto latency = static_cast<std::uint64_t>(latency_ewma.count() > 0 ? latency_ewma.count() : 1);
+    return (static_cast<std::uint64_t>(outstanding) + 1) * latency;
+}
+
+/// A host that was not selected for this long is preferred by the selection
+/// once. Otherwise a host that was slow once would never be selected again and
+/// its smoothed latency, updated only by the queries, would never recover.
+inline constexpr std::chrono::seconds kHostProbeInterval{1};
+
+/// HostLoadScore of a host that is probed if it was not selected for
+/// kHostProbeInterval
+inline std::uint64_t HostSelectionScore(
+    std::size_t outstanding,
+    std::chrono::microseconds latency_ewma,
+    std::chrono::steady_clock::duration since_selected
+) {
+    if (since_selected >= kHostProbeInterval) return 0;
+    return HostLoadScore(outstanding, latency_ewma);
+}
+
+/// Picks two distinct random positions out of `size` and returns the one with
+/// the lower `score(position)`
+template <typename ScoreFunc>
+std::size_t SelectPowerOfTwoChoices(std::size_t size, ScoreFunc&& score) {
+    UASSERT(size > 0);
+    if (size == 1) return 0;
+
+    const auto first = USERVER_NAMESPACE::utils::RandRange(size);
+    auto second = USERVER_NAMESPACE::utils::RandRange(size - 1);
+    if (second >= first) ++second;
+    return score(second) < score(first) ? second : first;
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -577,7 +577,116 @@ Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
     return result;
 }
 
+bool PGConnectionWrapper::WaitCopyStart(Deadline deadline, tracing::ScopeTime& scope, ExecStatusType status) {
+    scope.Reset(scopes::kLibpqWaitCopy);
+    Flush(deadline);
+    auto handle = MakeResultHandle(ReadResult(deadline, nullptr));
+    if (handle && PQresultStatus(handle.get()) == status) {
+        return PQbinaryTuples(handle.get());
+    }
+
+    // An error or a statement that is not a COPY in the expected direction,
+    // read the rest of the results and let MakeResult throw an appropriate
+    // exception
+    while (auto* pg_res = ReadResult(deadline, nullptr)) {
+        handle = MakeResultHandle(pg_res);
+    }
+    MakeResult(std::move(handle));
+    throw LogicError{
+        status == PGRES_COPY_IN ? "Statement is not a COPY FROM STDIN" : "Statement is not a COPY TO STDOUT"};
+}
+
+void PGConnectionWrapper::WaitCopyIn(Deadline deadline, tracing::ScopeTime& scope) {
+    if (WaitCopyStart(deadline, scope, PGRES_COPY_IN)) {
+        return;
+    }
+    PutCopyEnd("only binary COPY format is supported", deadline);
+    DiscardInput(deadline);
+    throw LogicError{"COPY FROM STDIN must use binary format, add `(FORMAT binary)` to the statement"};
+}
+
+void PGConnectionWrapper::WaitCopyOut(Deadline deadline, tracing::ScopeTime& scope) {
+    if (WaitCopyStart(deadline, scope, PGRES_COPY_OUT)) {
+        return;
+    }
+    DiscardInput(deadline);
+    throw LogicError{"COPY TO STDOUT must use binary format, add `(FORMAT binary)` to the statement"};
+}
+
+void PGConnectionWrapper::PutCopyData(std::string_view data, Deadline deadline) {
+    // PQputCopyData returns 0 when the connection is in non-blocking mode and
+    // the data could not be queued because the output buffer is full
+    int put_res = 0;
+    while ((put_res = PQputCopyData(conn_, data.data(), static_cast<int>(data.size()))) == 0) {
+        Flush(deadline);
+    }
+    if (put_res < 0) {
+        HandleSocketPostClose();
+        throw CommandError(PQerrorMessage(conn_));
+    }
+    UpdateLastUse();
+    Flush(deadline);
+}
+
+void PGConnectionWrapper::PutCopyEnd(const char* error_message, Deadline deadline) {
+    int put_res = 0;
+    while ((put_res = PQputCopyEnd(conn_, error_message)) == 0) {
+        Flush(deadline);
+    }
+    if (put_res < 0) {
+        HandleSocketPostClose();
+        throw CommandError(PQerrorMessage(conn_));
+    }
+    UpdateLastUse();
+    Flush(deadline);
+}
+
+PGConnectionWrapper::CopyData PGConnectionWrapper::GetCopyData(Deadline deadline) {
+    CopyData data;
+    while (true) {
+        char* buffer = nullptr;
+        const int get_res = PQgetCopyData(conn_, &buffer, /* async = */ 1);
+        if (get_res > 0) {
+            data.buffer.reset(buffer);
+            data.size = get_res;
+            return data;
+        }
+        if (get_res == -1) {
+            // COPY is done
+            return data;
+        }
+        if (get_res < -1) {
+            HandleSocketPostClose();
+            throw CommandError(PQerrorMessage(conn_));
+        }
+        if (!WaitSocketReadable(deadline)) {
+            if (engine::current_task::ShouldCancel()) {
+                throw ConnectionInterrupted("Task cancelled while waiting for COPY data");
+            }
+            PGCW_LOG_LIMITED_WARNING() << "Timeout while waiting for COPY data from PostgreSQL connection";
+            throw ConnectionTimeoutError("Timed out while waiting for COPY data");
+        }
+        CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+        UpdateLastUse();
+    }
+}
+
 std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
+    Deadline deadline,
+    const std::vector<const PGresult*>& descriptions
+) {
+    auto results = GatherPipelineResults(deadline, descriptions);
+
+    std::vector<ResultSet> result{};
+    result.reserve(results.size());
+    for (auto& single_result : results) {
+        if (single_result.error) std::rethrow_exception(single_result.error);
+        result.push_back(std::move(single_result.result));
+    }
+    return result;
+}
+
+std::vector<Connection::PipelineResult> PGConnectionWrapper::GatherPipelineResults(
     [[maybe_unused]] Deadline deadline,
     const std::vector<const PGresult*>& descriptions
 ) {
@@ -588,7 +697,8 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
 #else
     Flush(deadline);
 
-    std::vector<ResultSet> result{};
+    std::vector<Connection::PipelineResult> result{};
+    result.reserve(descriptions.size());
     const PGresult* current_description = descriptions.front();
 
     std::size_t null_res_counter{0};
@@ -623,7 +733,12 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
                 return first_field_name != nullptr && std::string_view{first_field_name} == kSetConfigQueryResultName;
             }();
             if (!is_set_config_response) {
-                result.push_back(MakeResult(std::move(handle)));
+                auto& single_result = result.emplace_back();
+                try {
+                    single_result.result = MakeResult(std::move(handle));
+                } catch (const Error&) {
+                    single_result.error = std::current_exception();
+                }
             }
         }
 
@@ -648,6 +763,16 @@ void PGConnectionWrapper::DiscardInput(Deadline deadline) {
         while (auto* pg_res = ReadResult(deadline, nullptr)) {
             null_res_counter = 0;
             handle = MakeResultHandle(pg_res);
+            // Would get PGRES_COPY_* over and over until the COPY is ended
+            if (PQresultStatus(pg_res) == PGRES_COPY_IN) {
+                PutCopyEnd("COPY was interrupted", deadline);
+                continue;
+            }
+            if (PQresultStatus(pg_res) == PGRES_COPY_OUT) {
+                while (GetCopyData(deadline)) {
+                }
+                continue;
+            }
 #if LIBPQ_HAS_PIPELINING
             if (PQresultStatus(pg_res) == PGRES_PIPELINE_SYNC) {
                 HandlePipelineSync();
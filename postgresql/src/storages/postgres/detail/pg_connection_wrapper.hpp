@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <memory>
 #include <string_view>
 
 #include <libpq-fe.h>
@@ -30,6 +31,14 @@ public:
     using Duration = Deadline::TimePoint::clock::duration;
     using ResultHandle = detail::ResultWrapper::ResultHandle;
 
+    /// Data row of COPY TO STDOUT, allocated by libpq
+    struct CopyData {
+        std::unique_ptr<char, void (*)(void*)> buffer{nullptr, &PQfreemem};
+        std::size_t size{0};
+
+        explicit operator bool() const { return buffer != nullptr; }
+    };
+
     PGConnectionWrapper(
         engine::TaskProcessor& tp,
         concurrent::BackgroundTaskStorageCore& bts,
@@ -116,8 +125,37 @@ public:
     /// @brief Wait for notification
     Notification WaitNotify(Deadline deadline);
 
+    /// @brief Wait for the server to enter COPY FROM STDIN binary mode after
+    /// a COPY statement was sent.
+    /// @throws LogicError if the statement is not a binary COPY FROM STDIN
+    void WaitCopyIn(Deadline deadline, tracing::ScopeTime&);
+
+    /// @brief Wrapper for PQputCopyData, suspends until the data is flushed
+    void PutCopyData(std::string_view data, Deadline deadline);
+
+    /// @brief Wrapper for PQputCopyEnd, the result of the COPY command should
+    /// be obtained with WaitResult afterwards.
+    /// @param error_message if not null, the COPY is aborted with this message
+    void PutCopyEnd(const char* error_message, Deadline deadline);
+
+    /// @brief Wait for the server to enter COPY TO STDOUT binary mode after
+    /// a COPY statement was sent.
+    /// @throws LogicError if the statement is not a binary COPY TO STDOUT
+    void WaitCopyOut(Deadline deadline, tracing::ScopeTime&);
+
+    /// @brief Wrapper for PQgetCopyData, suspends until a data row is received.
+    /// Returns an empty CopyData when the COPY is done, the result of the COPY
+    /// command should be obtained with WaitResult afterwards.
+    CopyData GetCopyData(Deadline deadline);
+
     std::vector<ResultSet> GatherPipeline(Deadline deadline, const std::vector<const PGresult*>& descriptions);
 
+    /// @brief Read the results of all the pipelined queries. A query error is
+    /// stored into the corresponding result and does not affect the others,
+    /// the results missing due to a connection failure are not returned.
+    std::vector<Connection::PipelineResult>
+    GatherPipelineResults(Deadline deadline, const std::vector<const PGresult*>& descriptions);
+
     /// Consume input from connection
     void ConsumeInput(Deadline deadline, const PGresult* description);
 
@@ -167,6 +205,10 @@ private:
 
     void Flush(Deadline deadline);
 
+    /// @return true if the server entered a COPY mode with `status` in binary
+    /// format, false if it is in the expected mode but in text format
+    bool WaitCopyStart(Deadline deadline, tracing::ScopeTime&, ExecStatusType status);
+
     PGresult* ReadResult(Deadline deadline, const PGresult* description);
 
     ResultSet MakeResult(ResultHandle&& handle);
@@ -2,6 +2,7 @@
 
 #include <storages/postgres/deadline.hpp>
 #include <storages/postgres/detail/cc_config.hpp>
+#include <storages/postgres/detail/host_selection.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
 
 #include <userver/dynamic_config/value.hpp>
@@ -102,6 +103,7 @@ ConnectionPool::ConnectionPool(
       ei_settings_(std::move(ei_settings)),
       cancel_limit_{std::max(std::size_t{1}, settings.max_size / kCancelRatio), {1, kCancelPeriod}},
       sts_{statement_metrics_settings},
+      multiplexer_{stats_.multiplexing},
       config_source_(config_source),
       cc_sensor_(*this),
       cc_limiter_(*this),
@@ -114,6 +116,7 @@ ConnectionPool::ConnectionPool(
           config_source,
           [](const dynamic_config::Snapshot& config) { return config[kCcConfig]; }
       ) {
+    multiplexer_.SetSettings(settings.multiplexed_connections, settings.max_multiplexed_batch_size);
     if (USERVER_NAMESPACE::utils::impl::kPgCcExperiment.IsEnabled()) {
         cc_controller_.Start();
     }
@@ -254,6 +257,18 @@ void ConnectionPool::AccountConnectionStats(Connection::Statistics conn_stats) {
     stats_.transaction.execute_timeout += conn_stats.execute_timeout;
     stats_.transaction.duplicate_prepared_statements += conn_stats.duplicate_prepared_statements;
 
+    if (conn_stats.execute_total > 0) {
+        const auto latency_us = static_cast<std::uint32_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(conn_stats.sum_query_duration).count() /
+            conn_stats.execute_total
+        );
+        // Lost updates under contention are fine for a smoothed value
+        query_latency_ewma_us_.store(
+            UpdateLatencyEwma(query_latency_ewma_us_.load(std::memory_order_relaxed), latency_us),
+            std::memory_order_relaxed
+        );
+    }
+
     stats_.transaction.total_percentile.GetCurrentCounter().Account(
         std::chrono::duration_cast<std::chrono::milliseconds>(conn_stats.trx_end_time - conn_stats.trx_start_time)
             .count()
@@ -316,9 +331,27 @@ const InstanceStatistics& ConnectionPool::GetStatistics() const {
     stats_.connection.waiting = wait_count_.load(std::memory_order_relaxed);
     stats_.connection.maximum = settings->max_size;
     stats_.connection.max_queue_size = settings->max_queue_size;
+    stats_.query_latency_ewma_us = query_latency_ewma_us_.load(std::memory_order_relaxed);
     return stats_;
 }
 
+std::size_t ConnectionPool::GetOutstandingRequestsApprox() const {
+    return stats_.connection.used.Load() + wait_count_.load(std::memory_order_relaxed);
+}
+
+std::chrono::microseconds ConnectionPool::GetQueryLatencyEwma() const {
+    return std::chrono::microseconds{query_latency_ewma_us_.load(std::memory_order_relaxed)};
+}
+
+void ConnectionPool::AccountSelected() {
+    ++stats_.selected_total;
+    last_selected_time_.store(SteadyClock::now().time_since_epoch().count(), std::memory_order_relaxed);
+}
+
+SteadyClock::time_point ConnectionPool::GetLastSelectedTime() const {
+    return SteadyClock::time_point{SteadyClock::duration{last_selected_time_.load(std::memory_order_relaxed)}};
+}
+
 Transaction ConnectionPool::Begin(const TransactionOptions& options, OptionalCommandControl trx_cmd_ctl) {
     const auto trx_start_time = detail::SteadyClock::now();
     const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(trx_cmd_ctl));
@@ -335,6 +368,20 @@ NonTransaction ConnectionPool::Start(OptionalCommandControl cmd_ctl) {
     return NonTransaction{std::move(conn), start_time};
 }
 
+bool ConnectionPool::IsMultiplexingEnabled() const { return multiplexer_.IsEnabled(); }
+
+ResultSet ConnectionPool::ExecuteMultiplexed(
+    const Query& query,
+    QueryParamsWriter params_writer,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    const auto cmd_ctl = statement_cmd_ctl.value_or(GetDefaultCommandControl());
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(cmd_ctl.execute);
+    return multiplexer_.Execute(query, params_writer, cmd_ctl.statement, deadline, [this](engine::Deadline deadline) {
+        return Acquire(deadline);
+    });
+}
+
 NotifyScope ConnectionPool::Listen(std::string_view channel, OptionalCommandControl cmd_ctl) {
     const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(cmd_ctl));
     auto conn = Acquire(deadline);
@@ -363,6 +410,8 @@ void ConnectionPool::SetSettings(const PoolSettings& settings) {
     if (reader->connecting_limit != settings.connecting_limit)
         connecting_semaphore_.SetCapacity(settings.connecting_limit ? settings.connecting_limit : kUnlimitedConnecting);
 
+    multiplexer_.SetSettings(settings.multiplexed_connections, settings.max_multiplexed_batch_size);
+
     auto writer = settings_.StartWrite();
     *writer = settings;
     writer->max_size = max_connections;
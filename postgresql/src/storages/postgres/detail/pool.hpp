@@ -31,6 +31,7 @@
 
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
+#include <storages/postgres/detail/query_multiplexer.hpp>
 #include <storages/postgres/detail/size_guard.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
 
@@ -84,6 +85,17 @@ public:
 
     [[nodiscard]] NonTransaction Start(OptionalCommandControl cmd_ctl = {});
 
+    /// Whether single statements are multiplexed over pipelined connections
+    bool IsMultiplexingEnabled() const;
+
+    /// Execute a single statement in a batch with the statements of
+    /// concurrent tasks, see QueryMultiplexer
+    ResultSet ExecuteMultiplexed(
+        const Query& query,
+        QueryParamsWriter params_writer,
+        OptionalCommandControl statement_cmd_ctl = {}
+    );
+
     NotifyScope Listen(std::string_view channel, OptionalCommandControl cmd_ctl = {});
 
     CommandControl GetDefaultCommandControl() const;
@@ -102,6 +114,18 @@ public:
 
     const Dsn& GetDsn() const;
 
+    /// Number of acquired connections and requests waiting for a connection
+    std::size_t GetOutstandingRequestsApprox() const;
+
+    /// Smoothed query execution time, zero if no queries were executed yet
+    std::chrono::microseconds GetQueryLatencyEwma() const;
+
+    /// Account that the pool was chosen by the cluster host selection
+    void AccountSelected();
+
+    /// Time of the last AccountSelected call, the epoch if it was never called
+    SteadyClock::time_point GetLastSelectedTime() const;
+
 private:
     using SizeGuard = postgres::SizeGuard<std::atomic<size_t>>;
 
@@ -157,12 +181,15 @@ private:
     engine::Semaphore size_semaphore_;
     engine::Semaphore connecting_semaphore_;
     std::atomic<size_t> wait_count_;
+    std::atomic<std::uint32_t> query_latency_ewma_us_{0};
+    std::atomic<SteadyClock::rep> last_selected_time_{0};
     DefaultCommandControls default_cmd_ctls_;
     testsuite::PostgresControl testsuite_pg_ctl_;
     const error_injection::Settings ei_settings_;
     RecentCounter recent_conn_errors_;
     USERVER_NAMESPACE::utils::TokenBucket cancel_limit_;
     detail::StatementStatsStorage sts_;
+    QueryMultiplexer multiplexer_;
     dynamic_config::Source config_source_;
 
     // Congestion control stuff
@@ -0,0 +1,268 @@
+#include <storages/postgres/detail/query_multiplexer.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/statement_stats.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+constexpr std::string_view kBatchSpanName = "pg_multiplexed_batch";
+
+TimeoutDuration TimeLeft(engine::Deadline deadline) {
+    return std::chrono::duration_cast<TimeoutDuration>(deadline.TimeLeft());
+}
+
+}  // namespace
+
+QueryMultiplexer::QueryMultiplexer(Statistics& stats) : stats_{stats} {}
+
+QueryMultiplexer::~QueryMultiplexer() { UASSERT(pending_.empty()); }
+
+void QueryMultiplexer::SetSettings(std::size_t max_connections, std::size_t max_batch_size) {
+    UASSERT(max_batch_size > 0);
+    max_connections_ = max_connections;
+    max_batch_size_ = max_batch_size;
+    stats_.connections_max = max_connections;
+}
+
+bool QueryMultiplexer::IsEnabled() const { return max_connections_.load() > 0; }
+
+ResultSet QueryMultiplexer::Execute(
+    const Query& query,
+    QueryParamsWriter params_writer,
+    TimeoutDuration statement_timeout,
+    engine::Deadline deadline,
+    ConnectionAcquirer acquire
+) {
+    Request request{query, params_writer, statement_timeout, deadline};
+    {
+        const std::lock_guard lock{mutex_};
+        pending_.push_back(&request);
+        // Statements queued while the multiplexing is being turned off still
+        // need someone to send them
+        if (leaders_ < std::max<std::size_t>(max_connections_.load(), 1)) {
+            ++leaders_;
+            request.is_leader = true;
+        }
+    }
+
+    bool deadline_reached = false;
+    while (true) {
+        std::unique_lock lock{mutex_};
+        if (request.state == RequestState::kDone) {
+            if (request.is_leader) ReleaseLeadership();
+            break;
+        }
+
+        if (request.is_leader) {
+            auto batch = TakeBatch();
+            if (batch.empty()) {
+                // Our statement is being sent by another leader
+                request.is_leader = false;
+                ReleaseLeadership();
+                continue;
+            }
+            lock.unlock();
+            RunBatch(batch, acquire);
+            continue;
+        }
+        lock.unlock();
+
+        if (deadline_reached) {
+            // The statement is already sent, the result arrives within the
+            // network timeout of the batch
+            const engine::TaskCancellationBlocker block_cancel;
+            [[maybe_unused]] const auto signaled = request.event.WaitForEvent();
+            continue;
+        }
+        if (request.event.WaitForEventUntil(request.deadline)) continue;
+
+        lock.lock();
+        if (request.state == RequestState::kQueued && !request.is_leader) {
+            pending_.erase(std::find(pending_.begin(), pending_.end(), &request));
+            lock.unlock();
+            if (engine::current_task::ShouldCancel()) {
+                throw ConnectionInterrupted("Task cancelled while waiting for a multiplexed connection");
+            }
+            throw ConnectionTimeoutError("Timed out while waiting for a multiplexed connection");
+        }
+        deadline_reached = true;
+    }
+
+    if (request.error) std::rethrow_exception(request.error);
+    UASSERT(request.result);
+    return std::move(*request.result);
+}
+
+QueryMultiplexer::Batch QueryMultiplexer::TakeBatch() {
+    const auto max_batch_size = max_batch_size_.load();
+    Batch batch;
+    batch.reserve(std::min(pending_.size(), max_batch_size));
+    while (!pending_.empty() && batch.size() < max_batch_size) {
+        auto* request = pending_.front();
+        pending_.pop_front();
+        request->state = RequestState::kInFlight;
+        batch.push_back(request);
+    }
+    return batch;
+}
+
+void QueryMultiplexer::ReleaseLeadership() {
+    for (auto* request : pending_) {
+        if (!request->is_leader) {
+            request->is_leader = true;
+            request->event.Send();
+            return;
+        }
+    }
+    UASSERT(leaders_ > 0);
+    --leaders_;
+}
+
+void QueryMultiplexer::Complete(const Batch& batch) {
+    // The waiting task may destroy its request as soon as it sees the state,
+    // so the event is sent under the lock
+    const std::lock_guard lock{mutex_};
+    for (auto* request : batch) {
+        UASSERT(request->state == RequestState::kInFlight);
+        UASSERT(request->result || request->error);
+        request->state = RequestState::kDone;
+        request->event.Send();
+    }
+}
+
+void QueryMultiplexer::RunBatch(const Batch& batch, ConnectionAcquirer acquire) {
+    // The results of the other tasks must not depend on cancellation of
+    // the leader, the deadlines of the statements limit the batch
+    const engine::TaskCancellationBlocker block_cancel;
+
+    auto deadline = batch.front()->deadline;
+    for (const auto* request : batch) {
+        if (deadline < request->deadline) deadline = request->deadline;
+    }
+
+    ++stats_.batches_total;
+    stats_.queries_total += batch.size();
+
+    try {
+        auto conn = acquire(deadline);
+        ++stats_.connections_used;
+        const USERVER_NAMESPACE::utils::ScopeGuard used_guard{[this] { --stats_.connections_used; }};
+
+        conn->Start(SteadyClock::now());
+        std::vector<StatementStats> statement_stats;
+        statement_stats.reserve(batch.size());
+        for (const auto* request : batch) statement_stats.emplace_back(request->query, conn);
+
+        if (conn->IsPipelineActive() && conn->ArePreparedStatementsEnabled()) {
+            RunPipelined(*conn, batch);
+        } else {
+            RunSequentially(*conn, batch);
+        }
+        conn->Finish();
+
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+            if (batch[i]->error) {
+                statement_stats[i].AccountStatementError();
+            } else {
+                statement_stats[i].AccountStatementExecution();
+            }
+        }
+    } catch (const std::exception&) {
+        for (auto* request : batch) {
+            if (!request->result && !request->error) request->error = std::current_exception();
+        }
+    }
+
+    Complete(batch);
+}
+
+void QueryMultiplexer::RunPipelined(Connection& conn, const Batch& batch) {
+    tracing::Span span{std::string{kBatchSpanName}};
+    span.AddTag("batch_size", batch.size());
+    auto scope = span.CreateScopeTime();
+
+    // Statements are prepared before anything is pipelined, as preparation
+    // waits for its own reply
+    std::vector<std::optional<Connection::PreparedStatementMeta>> prepared(batch.size());
+    std::vector<QueryParameters> params(batch.size());
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        auto& request = *batch[i];
+        try {
+            params[i] = request.params_writer(conn.GetUserTypes());
+            prepared[i].emplace(conn.PrepareStatement(request.query, params[i], TimeLeft(request.deadline)));
+        } catch (const std::exception&) {
+            request.error = std::current_exception();
+        }
+    }
+
+    Batch sent;
+    sent.reserve(batch.size());
+    std::vector<ResultSet> descriptions;
+    descriptions.reserve(batch.size());
+    auto deadline = engine::Deadline::Passed();
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        auto& request = *batch[i];
+        if (request.error) continue;
+        try {
+            conn.AddIntoPipeline(
+                CommandControl{TimeLeft(request.deadline), request.statement_timeout},
+                prepared[i]->statement_name,
+                params[i],
+                prepared[i]->description,
+                scope
+            );
+        } catch (const std::exception&) {
+            request.error = std::current_exception();
+            continue;
+        }
+        sent.push_back(&request);
+        descriptions.push_back(std::move(prepared[i]->description));
+        if (deadline < request.deadline) deadline = request.deadline;
+    }
+    if (sent.empty()) return;
+
+    auto results = conn.GatherPipelineResults(TimeLeft(deadline), descriptions);
+    for (std::size_t i = 0; i < sent.size(); ++i) {
+        if (i >= results.size()) {
+            sent[i]->error = std::make_exception_ptr(
+                ConnectionError{"Multiplexed connection failed before the statement result was received"}
+            );
+        } else if (results[i].error) {
+            sent[i]->error = std::move(results[i].error);
+        } else {
+            sent[i]->result.emplace(std::move(results[i].result));
+        }
+    }
+}
+
+void QueryMultiplexer::RunSequentially(Connection& conn, const Batch& batch) {
+    for (auto* request : batch) {
+        try {
+            const auto params = request->params_writer(conn.GetUserTypes());
+            request->result.emplace(conn.Execute(
+                request->query,
+                params,
+                OptionalCommandControl{CommandControl{TimeLeft(request->deadline), request->statement_timeout}}
+            ));
+        } catch (const std::exception&) {
+            request->error = std::current_exception();
+        }
+    }
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <optional>
+#include <vector>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+#include <userver/storages/postgres/statistics.hpp>
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+class Connection;
+class ConnectionPtr;
+
+/// @brief Executes single statements of concurrent tasks in batches over
+/// a limited number of pipelined connections.
+///
+/// There is no dedicated task. A task that finds fewer than `max_connections`
+/// leaders becomes a leader itself: it acquires a connection and sends the
+/// queued statements in batches, one network round-trip per batch, until its
+/// own statement is done. Then it hands the leadership over to a queued task.
+/// Other tasks wait for their results to be routed to them.
+class QueryMultiplexer final {
+public:
+    using Statistics = MultiplexingStatistics<USERVER_NAMESPACE::utils::statistics::RelaxedCounter<uint32_t>>;
+    using ConnectionAcquirer = USERVER_NAMESPACE::utils::function_ref<ConnectionPtr(engine::Deadline)>;
+
+    explicit QueryMultiplexer(Statistics& stats);
+
+    QueryMultiplexer(const QueryMultiplexer&) = delete;
+    QueryMultiplexer& operator=(const QueryMultiplexer&) = delete;
+
+    ~QueryMultiplexer();
+
+    void SetSettings(std::size_t max_connections, std::size_t max_batch_size);
+
+    bool IsEnabled() const;
+
+    /// Execute the statement in a batch with the statements of the other tasks.
+    /// @param statement_timeout server-side timeout of the statement
+    /// @param deadline time to wait for the batch and to receive the result
+    /// @param acquire used to get a connection when the task becomes a leader
+    ResultSet Execute(
+        const Query& query,
+        QueryParamsWriter params_writer,
+        TimeoutDuration statement_timeout,
+        engine::Deadline deadline,
+        ConnectionAcquirer acquire
+    );
+
+private:
+    enum class RequestState { kQueued, kInFlight, kDone };
+
+    struct Request {
+        const Query& query;
+        QueryParamsWriter params_writer;
+        TimeoutDuration statement_timeout;
+        engine::Deadline deadline;
+
+        std::optional<ResultSet> result{};
+        std::exception_ptr error{};
+
+        engine::SingleConsumerEvent event{};
+        // Guarded by mutex_
+        RequestState state{RequestState::kQueued};
+        bool is_leader{false};
+    };
+    using Batch = std::vector<Request*>;
+
+    Batch TakeBatch();
+    void ReleaseLeadership();
+    void Complete(const Batch& batch);
+
+    void RunBatch(const Batch& batch, ConnectionAcquirer acquire);
+    void RunPipelined(Connection& conn, const Batch& batch);
+    static void RunSequentially(Connection& conn, const Batch& batch);
+
+    Statistics& stats_;
+    std::atomic<std::size_t> max_connections_{0};
+    std::atomic<std::size_t> max_batch_size_{kDefaultMaxMultiplexedBatchSize};
+
+    engine::Mutex mutex_;
+    std::deque<Request*> pending_;
+    std::size_t leaders_{0};
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,184 @@
+#include <storages/postgres/detail/result_cache.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// PGresAttValue of a field and the terminating zero of the value
+constexpr std::size_t kFieldOverhead = sizeof(int) + sizeof(char*) + 1;
+// Column description
+constexpr std::size_t kColumnOverhead = 64;
+// PGresult bookkeeping, entry of the LRU and of the index
+constexpr std::size_t kEntryOverhead = 512;
+
+template <typename T>
+void AppendRaw(std::string& key, T value) {
+    key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+}  // namespace
+
+ResultCache::ResultCache(std::size_t max_size_bytes, bool suspended)
+    : max_size_bytes_{max_size_bytes}, suspended_{suspended} {
+    UINVARIANT(max_size_bytes_ > 0, "Result cache size limit must be positive");
+}
+
+std::string ResultCache::MakeKey(ClusterHostTypeFlags flags, const Query& query, const ParameterStore& store) {
+    const auto& params = store.GetInternalData();
+    const auto& statement = query.Statement();
+
+    std::size_t key_size = sizeof(flags.GetValue()) + sizeof(std::size_t) + statement.size();
+    for (std::size_t i = 0; i < params.Size(); ++i) {
+        key_size += sizeof(Oid) + sizeof(int) + std::max(params.ParamLengthsBuffer()[i], 0);
+    }
+
+    std::string key;
+    key.reserve(key_size);
+    AppendRaw(key, flags.GetValue());
+    // The statement length separates the statement from the parameters
+    AppendRaw(key, statement.size());
+    key.append(statement);
+    for (std::size_t i = 0; i < params.Size(); ++i) {
+        const auto length = params.ParamLengthsBuffer()[i];
+        AppendRaw(key, params.ParamTypesBuffer()[i]);
+        AppendRaw(key, length);
+        if (length > 0) key.append(params.ParamBuffers()[i], length);
+    }
+    UASSERT(key.size() == key_size);
+    return key;
+}
+
+std::size_t ResultCache::EstimateSize(const ResultSet& result) {
+    std::size_t size = result.FieldCount() * kColumnOverhead + result.Size() * result.FieldCount() * kFieldOverhead;
+    for (const auto& row : result) {
+        for (const auto& field : row) {
+            size += field.Length();
+        }
+    }
+    return size;
+}
+
+std::optional<ResultSet> ResultCache::Get(std::string_view key) {
+    const std::lock_guard lock{mutex_};
+    const auto it = index_.find(key);
+    if (it == index_.end()) {
+        ++misses_;
+        return std::nullopt;
+    }
+    const auto entry = it->second;
+    if (entry->expires_at <= std::chrono::steady_clock::now()) {
+        ++misses_;
+        Erase(entry);
+        return std::nullopt;
+    }
+    ++hits_;
+    entries_.splice(entries_.begin(), entries_, entry);
+    return entry->result;
+}
+
+ResultCache::FillToken ResultCache::StartFill() const {
+    const std::lock_guard lock{mutex_};
+    return generation_;
+}
+
+void ResultCache::Put(
+    FillToken token,
+    std::string key,
+    const ResultCacheOptions& options,
+    ResultSet result,
+    std::size_t result_size_bytes
+) {
+    std::size_t size_bytes = result_size_bytes + key.size() * 2 + kEntryOverhead;
+    for (const auto& tag : options.tags) size_bytes += tag.size() + sizeof(std::string);
+    if (size_bytes > max_size_bytes_ || options.ttl <= std::chrono::milliseconds::zero()) return;
+
+    const auto expires_at = std::chrono::steady_clock::now() + options.ttl;
+
+    const std::lock_guard lock{mutex_};
+    // Something was invalidated while the statement was executed, the result
+    // may be stale
+    if (token != generation_ || suspended_) return;
+
+    // The result of a concurrent execution of the same statement
+    if (const auto it = index_.find(key); it != index_.end()) Erase(it->second);
+
+    entries_.push_front(Entry{std::move(key), std::move(result), expires_at, options.tags, size_bytes});
+    index_.emplace(entries_.front().key, entries_.begin());
+    size_bytes_ += size_bytes;
+
+    while (size_bytes_ > max_size_bytes_) {
+        UASSERT(!entries_.empty());
+        ++evicted_;
+        Erase(std::prev(entries_.end()));
+    }
+}
+
+void ResultCache::Invalidate(std::string_view tag) {
+    const std::lock_guard lock{mutex_};
+    ++generation_;
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        const auto next = std::next(it);
+        if (std::find(it->tags.begin(), it->tags.end(), tag) != it->tags.end()) {
+            ++invalidated_;
+            Erase(it);
+        }
+        it = next;
+    }
+}
+
+void ResultCache::InvalidateAll() {
+    const std::lock_guard lock{mutex_};
+    ClearLocked();
+}
+
+void ResultCache::Suspend() {
+    const std::lock_guard lock{mutex_};
+    suspended_ = true;
+    ClearLocked();
+}
+
+void ResultCache::Resume() {
+    const std::lock_guard lock{mutex_};
+    suspended_ = false;
+    ClearLocked();
+}
+
+ResultCacheStatistics ResultCache::GetStatistics() const {
+    ResultCacheStatistics stats;
+    stats.hits = hits_.Load();
+    stats.misses = misses_.Load();
+    stats.invalidated = invalidated_.Load();
+    stats.evicted = evicted_.Load();
+
+    const std::lock_guard lock{mutex_};
+    stats.entries = entries_.size();
+    stats.size_bytes = size_bytes_;
+    return stats;
+}
+
+void ResultCache::ClearLocked() {
+    ++generation_;
+    invalidated_ += USERVER_NAMESPACE::utils::statistics::Rate{entries_.size()};
+    index_.clear();
+    entries_.clear();
+    size_bytes_ = 0;
+}
+
+void ResultCache::Erase(EntryList::iterator it) {
+    UASSERT(size_bytes_ >= it->size_bytes);
+    size_bytes_ -= it->size_bytes;
+    index_.erase(it->key);
+    entries_.erase(it);
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/storages/postgres/cluster_types.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+#include <userver/storages/postgres/statistics.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// LRU cache of statement results limited by their approximate memory usage.
+///
+/// A result is stored only if nothing was invalidated while the statement
+/// was executed, so a result read before a change can not outlive the
+/// invalidation notification of that change.
+class ResultCache final {
+public:
+    /// Invalidation generation captured before the statement execution
+    using FillToken = std::uint64_t;
+
+    /// A suspended cache stores nothing until Resume is called
+    ResultCache(std::size_t max_size_bytes, bool suspended);
+
+    /// Key of the statement result: host selection flags, statement text and
+    /// the serialized parameters
+    static std::string MakeKey(ClusterHostTypeFlags flags, const Query& query, const ParameterStore& store);
+
+    /// Approximate memory used by the result
+    static std::size_t EstimateSize(const ResultSet& result);
+
+    /// Returns a cached result that is not expired
+    std::optional<ResultSet> Get(std::string_view key);
+
+    /// Must be called before the execution of a statement whose result is
+    /// stored with Put
+    FillToken StartFill() const;
+
+    void Put(
+        FillToken token,
+        std::string key,
+        const ResultCacheOptions& options,
+        ResultSet result,
+        std::size_t result_size_bytes
+    );
+
+    /// Drops the results with the tag
+    void Invalidate(std::string_view tag);
+
+    /// Drops all the results
+    void InvalidateAll();
+
+    /// Drops all the results and stops storing the new ones, used while the
+    /// invalidation notifications are not received
+    void Suspend();
+
+    /// Drops all the results and starts storing the new ones
+    void Resume();
+
+    ResultCacheStatistics GetStatistics() const;
+
+private:
+    struct Entry {
+        std::string key;
+        ResultSet result;
+        std::chrono::steady_clock::time_point expires_at;
+        std::vector<std::string> tags;
+        std::size_t size_bytes;
+    };
+    using EntryList = std::list<Entry>;
+
+    // Must be called with the mutex locked
+    void Erase(EntryList::iterator it);
+    void ClearLocked();
+
+    using RateCounter = USERVER_NAMESPACE::utils::statistics::RateCounter;
+
+    const std::size_t max_size_bytes_;
+
+    mutable engine::Mutex mutex_;
+    // Most recently used entries go first
+    EntryList entries_;
+    std::unordered_map<std::string_view, EntryList::iterator> index_;
+    std::size_t size_bytes_{0};
+    FillToken generation_{0};
+    bool suspended_;
+
+    RateCounter hits_{};
+    RateCounter misses_{};
+    RateCounter invalidated_{};
+    RateCounter evicted_{};
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
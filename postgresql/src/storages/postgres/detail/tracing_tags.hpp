@@ -40,6 +40,8 @@ const std::string kLibpqSendQueryPrepared = "libpq_send_query_prepared";
 const std::string kPqSendPortalBind = "pq_send_portal_bind";
 /// libpq-missing send execute portal
 const std::string kPqSendPortalExecute = "pq_send_portal_execute";
+/// libpq wait for COPY FROM STDIN or COPY TO STDOUT to start
+const std::string kLibpqWaitCopy = "libpq_wait_copy";
 
 }  // namespace storages::postgres::scopes
 
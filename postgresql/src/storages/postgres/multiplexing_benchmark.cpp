@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <storages/postgres/default_command_controls.hpp>
+#include <storages/postgres/detail/pool.hpp>
+#include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/async.hpp>
+
+#include <storages/postgres/util_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+using namespace pg::bench;
+
+constexpr std::size_t kQueriesPerTask = 100;
+constexpr std::size_t kMaxQueueSize = 10000;
+constexpr pg::CommandControl kMultiplexingCmdCtl{std::chrono::seconds{5}, std::chrono::seconds{1}};
+
+const pg::ConnectionSettings kPipelineSettings{
+    pg::ConnectionSettings::kCachePreparedStatements,
+    pg::ConnectionSettings::kUserTypesEnabled,
+    pg::ConnectionSettings::kCheckUnused,
+    pg::kDefaultMaxPreparedCacheSize,
+    pg::PipelineMode::kEnabled,
+};
+
+std::shared_ptr<pg::detail::ConnectionPool> MakePool(std::size_t max_size, std::size_t multiplexed_connections) {
+    pg::PoolSettings settings{0, max_size, kMaxQueueSize};
+    settings.multiplexed_connections = multiplexed_connections;
+    return pg::detail::ConnectionPool::Create(
+        GetDsnFromEnv(),
+        nullptr,
+        engine::current_task::GetTaskProcessor(),
+        "",
+        pg::InitMode::kSync,
+        settings,
+        kPipelineSettings,
+        {},
+        pg::DefaultCommandControls(kMultiplexingCmdCtl, {}, {}),
+        {},
+        {},
+        {},
+        dynamic_config::GetDefaultSource()
+    );
+}
+
+template <typename Func>
+void RunConcurrently(std::size_t tasks_count, const Func& func) {
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(tasks_count);
+    for (std::size_t i = 0; i < tasks_count; ++i) {
+        tasks.push_back(utils::Async("multiplexing_bench", [&func] {
+            for (std::size_t query = 0; query < kQueriesPerTask; ++query) {
+                func(static_cast<int>(query));
+            }
+        }));
+    }
+    for (auto& task : tasks) task.Get();
+}
+
+void ReportConnections(benchmark::State& state, const pg::detail::ConnectionPool& pool) {
+    // Connections are opened on demand, so the number of opened connections is
+    // the number of connections the workload needs
+    const auto connections = pool.GetStatistics().connection.open_total.Load();
+    const auto queries = static_cast<double>(state.iterations() * state.range(0) * kQueriesPerTask);
+    state.counters["connections"] = connections;
+    state.counters["queries_per_connection"] =
+        benchmark::Counter(connections ? queries / connections : 0, benchmark::Counter::kIsRate);
+    state.SetItemsProcessed(static_cast<std::int64_t>(queries));
+}
+
+BENCHMARK_DEFINE_F(PgConnection, PoolSingleStatements)(benchmark::State& state) {
+    RunStandalone(state, 4, [&state] {
+        const auto tasks_count = static_cast<std::size_t>(state.range(0));
+        auto pool = MakePool(tasks_count, 0);
+
+        for (auto _ : state) {
+            RunConcurrently(tasks_count, [&pool](int value) {
+                auto ntrx = pool->Start();
+                benchmark::DoNotOptimize(ntrx.Execute("select $1::integer", value));
+            });
+        }
+        ReportConnections(state, *pool);
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, PoolSingleStatements)->Arg(16)->Arg(64)->Arg(256)->UseRealTime();
+
+BENCHMARK_DEFINE_F(PgConnection, MultiplexedSingleStatements)(benchmark::State& state) {
+    RunStandalone(state, 4, [&state] {
+        const auto tasks_count = static_cast<std::size_t>(state.range(0));
+        auto pool = MakePool(tasks_count, state.range(1));
+
+        for (auto _ : state) {
+            RunConcurrently(tasks_count, [&pool](int value) {
+                pg::detail::StaticQueryParameters<1> params;
+                benchmark::DoNotOptimize(pool->ExecuteMultiplexed("select $1::integer", [&](const pg::UserTypes& types) {
+                    params.Write(types, value);
+                    return pg::detail::QueryParameters{params};
+                }));
+            });
+        }
+        ReportConnections(state, *pool);
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, MultiplexedSingleStatements)
+    ->Args({16, 1})
+    ->Args({64, 1})
+    ->Args({64, 2})
+    ->Args({256, 2})
+    ->Args({256, 4})
+    ->UseRealTime();
+
+}  // namespace
+
+USERVER_NAMESPACE_END
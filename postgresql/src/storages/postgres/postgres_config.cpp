@@ -103,9 +103,19 @@ PoolSettings ParsePoolSettings(const ConfigType& config) {
     result.max_size = config["max_pool_size"].template As<size_t>(result.max_size);
     result.max_queue_size = config["max_queue_size"].template As<size_t>(result.max_queue_size);
     result.connecting_limit = config["connecting_limit"].template As<size_t>(result.connecting_limit);
+    result.multiplexed_connections =
+        config["multiplexed_connections"].template As<size_t>(result.multiplexed_connections);
+    result.max_multiplexed_batch_size =
+        config["max_multiplexed_batch_size"].template As<size_t>(result.max_multiplexed_batch_size);
 
     if (result.max_size == 0) throw InvalidConfig{"max_pool_size must be greater than 0"};
     if (result.max_size < result.min_size) throw InvalidConfig{"max_pool_size cannot be less than min_pool_size"};
+    if (result.max_multiplexed_batch_size == 0) {
+        throw InvalidConfig{"max_multiplexed_batch_size must be greater than 0"};
+    }
+    if (result.multiplexed_connections > result.max_size) {
+        throw InvalidConfig{"multiplexed_connections cannot be greater than max_pool_size"};
+    }
 
     return result;
 }
@@ -1,7 +1,10 @@
 #include <userver/storages/postgres/result_set.hpp>
 
+#include <cstdint>
+#include <cstring>
 #include <string_view>
 
+#include <boost/endian/conversion.hpp>
 #include <fmt/format.h>
 
 #include <storages/postgres/detail/result_wrapper.hpp>
@@ -33,6 +36,28 @@ constexpr std::string_view kUnknownTypeErrorMessageTemplate =
     "the type and probably altering a table was run while the service is up, "
     "the only way to fix this is to restart the service.";
 
+template <typename UInt>
+void NetworkToNativeInplace(char* data, std::size_t count) {
+    // The loop has no dependencies between the iterations and is vectorized
+    for (std::size_t i = 0; i < count; ++i) {
+        UInt value;
+        std::memcpy(&value, data + i * sizeof(UInt), sizeof(UInt));
+        boost::endian::big_to_native_inplace(value);
+        std::memcpy(data + i * sizeof(UInt), &value, sizeof(UInt));
+    }
+}
+
+bool IsTextType(Oid type_oid) {
+    switch (static_cast<io::PredefinedOids>(type_oid)) {
+        case io::PredefinedOids::kText:
+        case io::PredefinedOids::kVarchar:
+        case io::PredefinedOids::kBpchar:
+            return true;
+        default:
+            return false;
+    }
+}
+
 }  // namespace
 
 //----------------------------------------------------------------------------
@@ -220,6 +245,56 @@ void ResultSet::FillBufferCategories(const UserTypes& types) { pimpl_->FillBuffe
 
 void ResultSet::SetBufferCategoriesFrom(const ResultSet& dsc) { pimpl_->SetTypeBufferCategories(*dsc.pimpl_); }
 
+bool ResultSet::ReadFixedWidthColumn(
+    size_type column,
+    Oid type_oid,
+    std::size_t width,
+    bool network_byte_order,
+    void* out
+) const {
+    if (pimpl_->GetFieldTypeOid(column) != type_oid) return false;
+
+    const auto size = Size();
+    auto* data = static_cast<char*>(out);
+    for (size_type row = 0; row < size; ++row) {
+        const auto buffer = pimpl_->GetFieldBuffer(row, column);
+        if (buffer.is_null || buffer.length != width) return false;
+        std::memcpy(data + row * width, buffer.buffer, width);
+    }
+
+    if (!network_byte_order) return true;
+    switch (width) {
+        case 2:
+            NetworkToNativeInplace<std::uint16_t>(data, size);
+            return true;
+        case 4:
+            NetworkToNativeInplace<std::uint32_t>(data, size);
+            return true;
+        case 8:
+            NetworkToNativeInplace<std::uint64_t>(data, size);
+            return true;
+        default:
+            break;
+    }
+    UINVARIANT(false, fmt::format("Unexpected width {} of a network byte order type", width));
+    return false;
+}
+
+bool ResultSet::ReadTextColumn(size_type column, std::vector<std::string>& out) const {
+    if (!IsTextType(pimpl_->GetFieldTypeOid(column))) return false;
+
+    const auto size = Size();
+    std::vector<std::string> values;
+    values.reserve(size);
+    for (size_type row = 0; row < size; ++row) {
+        const auto buffer = pimpl_->GetFieldBuffer(row, column);
+        if (buffer.is_null) return false;
+        values.emplace_back(reinterpret_cast<const char*>(buffer.buffer), buffer.length);
+    }
+    out = std::move(values);
+    return true;
+}
+
 Row::size_type Row::IndexOfName(const std::string& name) const { return res_->IndexOfName(name); }
 
 FieldView Row::GetFieldView(size_type index) const { return FieldView{*res_, row_index_, index}; }
@@ -48,6 +48,16 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const Inst
         errors.ValueWithLabels(stats.queue_size_errors, {kPostgresqlError, "queue"});
         errors.ValueWithLabels(stats.connection.error_timeout, {kPostgresqlError, "connection-timeout"});
     }
+    if (auto selection = writer["host-selection"]) {
+        selection["selected"] = stats.selected_total;
+        selection["query-latency-ewma-us"] = stats.query_latency_ewma_us;
+    }
+    if (auto multiplexing = writer["multiplexing"]) {
+        multiplexing["queries"] = stats.multiplexing.queries_total;
+        multiplexing["batches"] = stats.multiplexing.batches_total;
+        multiplexing["connections"]["used"] = stats.multiplexing.connections_used;
+        multiplexing["connections"]["max"] = stats.multiplexing.connections_max;
+    }
     writer["prepared-per-connection"] = stats.connection.prepared_statements;
     writer["roundtrip-time"] = stats.topology.roundtrip_time;
     writer["replication-lag"] = stats.topology.replication_lag;
@@ -66,6 +76,15 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const Inst
     }
 }
 
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const ResultCacheStatistics& value) {
+    writer["hits"] = value.hits;
+    writer["misses"] = value.misses;
+    writer["invalidated"] = value.invalidated;
+    writer["evicted"] = value.evicted;
+    writer["entries"] = value.entries;
+    writer["size-bytes"] = value.size_bytes;
+}
+
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const ClusterStatistics& value) {
     constexpr std::string_view kPostgresqlClusterHostType = "postgresql_cluster_host_type";
     writer["connlimit-mode-auto-enabled"] = value.connlimit_mode_auto_on;
@@ -77,6 +96,9 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const Clus
     for (const auto& item : value.unknown) {
         writer.ValueWithLabels(item, {kPostgresqlClusterHostType, "unknown"});
     }
+    if (value.result_cache) {
+        writer["result-cache"] = *value.result_cache;
+    }
 }
 
 }  // namespace storages::postgres
@@ -1,15 +1,20 @@
 #include <storages/postgres/tests/util_pgtest.hpp>
 
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include <userver/utest/utest.hpp>
 
 #include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/host_selection.hpp>
 #include <storages/postgres/postgres_config.hpp>
 #include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/storages/postgres/cluster.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
+#include <userver/utils/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -41,21 +46,28 @@ pg::Cluster CreateCluster(
     engine::TaskProcessor& bg_task_processor,
     size_t max_size,
     testsuite::TestsuiteTasks& testsuite_tasks,
-    pg::ConnectionSettings conn_settings = kCachePreparedStatements
+    pg::ConnectionSettings conn_settings = kCachePreparedStatements,
+    size_t multiplexed_connections = 0,
+    pg::ResultCacheSettings result_cache_settings = {},
+    pg::HostSelectionStrategy host_selection_strategy = pg::HostSelectionStrategy::kRoundRobin
 ) {
     auto source = dynamic_config::GetDefaultSource();
+    pg::PoolSettings pool_settings{0, max_size, max_size};
+    pool_settings.multiplexed_connections = multiplexed_connections;
     return pg::Cluster(
         dsns,
         nullptr,
         bg_task_processor,
         {{},
          {utest::kMaxTestWaitTime},
-         {0, max_size, max_size},
+         pool_settings,
          conn_settings,
          storages::postgres::InitMode::kAsync,
          "",
          {},
-         {}},
+         {},
+         host_selection_strategy,
+         std::move(result_cache_settings)},
         {kTestCmdCtl, {}, {}},
         {},
         {},
@@ -65,6 +77,16 @@ pg::Cluster CreateCluster(
     );
 }
 
+// Distinguishes the connections to the same server as different hosts
+pg::Dsn WithApplicationName(const pg::Dsn& dsn, std::string_view application_name) {
+    const auto& conninfo = dsn.GetUnderlying();
+    if (conninfo.rfind("postgres", 0) != 0) {
+        return pg::Dsn{fmt::format("{} application_name={}", conninfo, application_name)};
+    }
+    const auto separator = conninfo.find('?') == std::string::npos ? '?' : '&';
+    return pg::Dsn{fmt::format("{}{}application_name={}", conninfo, separator, application_name)};
+}
+
 }  // namespace
 
 class PostgreCluster : public PostgreSQLBase {};
@@ -370,6 +392,79 @@ UTEST_F(PostgreCluster, NonTransactionExecuteWithParameterStoreMove) {
     }
 }
 
+UTEST_F(PostgreCluster, MultiplexedSingleQuery) {
+    constexpr int kTasksCount = 100;
+
+    testsuite::TestsuiteTasks testsuite_tasks{true};
+    auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 2, testsuite_tasks, kPipelineEnabled, 1);
+
+    UEXPECT_THROW(cluster.Execute({}, "select 1"), pg::LogicError);
+
+    std::vector<engine::TaskWithResult<int>> tasks;
+    tasks.reserve(kTasksCount);
+    for (int i = 0; i < kTasksCount; ++i) {
+        tasks.push_back(utils::Async("multiplexed", [&cluster, i] {
+            return cluster.Execute(pg::ClusterHostType::kMaster, "select $1::integer", i).AsSingleRow<int>();
+        }));
+    }
+    for (int i = 0; i < kTasksCount; ++i) {
+        EXPECT_EQ(tasks[i].Get(), i);
+    }
+
+    auto res = cluster.Execute(pg::ClusterHostType::kMaster, "select $1", pg::ParameterStore{}.PushBack(1));
+    EXPECT_EQ(1, res.AsSingleRow<int>());
+
+    const auto stats = cluster.GetStatistics();
+    const auto& multiplexing = stats->master.stats.multiplexing;
+    EXPECT_EQ(multiplexing.queries_total, kTasksCount + 1);
+    EXPECT_GE(multiplexing.batches_total, 1);
+    EXPECT_LE(multiplexing.batches_total, kTasksCount + 1);
+    EXPECT_EQ(multiplexing.connections_used, 0);
+    EXPECT_EQ(multiplexing.connections_max, 1);
+}
+
+UTEST_F(PostgreCluster, MultiplexedErrorIsolation) {
+    constexpr int kTasksCount = 20;
+
+    testsuite::TestsuiteTasks testsuite_tasks{true};
+    auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 2, testsuite_tasks, kPipelineEnabled, 1);
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kTasksCount + 1);
+    // A statement exceeding its own statement timeout fails alone
+    tasks.push_back(utils::Async("multiplexed_timeout", [&cluster] {
+        UEXPECT_THROW(
+            cluster.Execute(
+                pg::ClusterHostType::kMaster,
+                kTestCmdCtl.WithStatementTimeout(std::chrono::milliseconds{50}),
+                "select pg_sleep(1)"
+            ),
+            pg::QueryCancelled
+        );
+    }));
+    for (int i = 0; i < kTasksCount; ++i) {
+        tasks.push_back(utils::Async("multiplexed", [&cluster, i] {
+            // Every other statement fails with division by zero
+            const auto divisor = i % 2;
+            if (divisor == 0) {
+                UEXPECT_THROW(
+                    cluster.Execute(pg::ClusterHostType::kMaster, "select $1::integer / $2", i, divisor),
+                    pg::DataException
+                );
+            } else {
+                const auto res = cluster.Execute(pg::ClusterHostType::kMaster, "select $1::integer / $2", i, divisor);
+                EXPECT_EQ(res.AsSingleRow<int>(), i);
+            }
+        }));
+    }
+    for (auto& task : tasks) {
+        UEXPECT_NO_THROW(task.Get());
+    }
+
+    // The connection is still usable
+    EXPECT_EQ(cluster.Execute(pg::ClusterHostType::kMaster, "select 1").AsSingleRow<int>(), 1);
+}
+
 UTEST_F(PostgreCluster, ListenNotify) {
     constexpr auto kListenChannel = std::string_view{"foo"};
     constexpr auto kNotifyPayload = std::string_view{"bar"};
@@ -398,4 +493,84 @@ UTEST_F(PostgreCluster, ListenNotify) {
     );
 }
 
+UTEST_F(PostgreCluster, ExecuteCached) {
+    constexpr auto kChannel = std::string_view{"result_cache"};
+    const pg::Query kQuery{"select random()"};
+    const pg::ResultCacheOptions kOptions{utest::kMaxTestWaitTime, {"random"}};
+    const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    testsuite::TestsuiteTasks testsuite_tasks{true};
+    auto cluster = CreateCluster(
+        GetDsnListFromEnv(),
+        GetTaskProcessor(),
+        2,
+        testsuite_tasks,
+        kCachePreparedStatements,
+        0,
+        {1 << 20, std::string{kChannel}}
+    );
+    const auto execute = [&] {
+        return cluster.ExecuteCached(pg::ClusterHostType::kMaster, kOptions, kQuery).AsSingleRow<double>();
+    };
+
+    // Nothing is cached until the cluster listens on the invalidation channel
+    auto value = execute();
+    while (execute() != value) {
+        ASSERT_FALSE(deadline.IsReached());
+        value = execute();
+    }
+
+    UEXPECT_NO_THROW(cluster.Execute(pg::ClusterHostType::kMaster, "select pg_notify($1, 'other')", kChannel));
+    UEXPECT_NO_THROW(cluster.Execute(pg::ClusterHostType::kMaster, "select pg_notify($1, 'random')", kChannel));
+    while (execute() == value) {
+        ASSERT_FALSE(deadline.IsReached());
+        engine::SleepFor(std::chrono::milliseconds{10});
+    }
+
+    auto stats = cluster.GetStatistics();
+    ASSERT_TRUE(stats->result_cache);
+    EXPECT_GT(stats->result_cache->hits.value, 0);
+    EXPECT_GT(stats->result_cache->invalidated.value, 0);
+}
+
+UTEST_F(PostgreCluster, PowerOfTwoChoicesProbesSlowHost) {
+    testsuite::TestsuiteTasks testsuite_tasks{true};
+    const auto dsn = GetDsnFromEnv();
+    auto cluster = CreateCluster(
+        {WithApplicationName(dsn, "fast"), WithApplicationName(dsn, "slow")},
+        GetTaskProcessor(),
+        1,
+        testsuite_tasks,
+        kCachePreparedStatements,
+        0,
+        {},
+        pg::HostSelectionStrategy::kPowerOfTwoChoices
+    );
+
+    // Returns the number of transactions that were run on the slow host
+    const auto run_transactions = [&cluster](std::size_t count) {
+        std::size_t slow_count = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            auto trx = cluster.Begin(pg::ClusterHostType::kSlaveOrMaster, pg::Transaction::RO);
+            const auto host = trx.Execute("SELECT current_setting('application_name')").AsSingleRow<std::string>();
+            if (host == "slow") {
+                ++slow_count;
+                trx.Execute("SELECT pg_sleep(0.02)");
+            }
+            trx.Commit();
+        }
+        return slow_count;
+    };
+
+    // The slow host is selected only until its latency is known
+    EXPECT_LE(run_transactions(100), 3);
+
+    // The slow host loses to the fast one, but it is probed again after a
+    // while, so that it could recover its share of the load
+    engine::SleepFor(pg::detail::kHostProbeInterval + std::chrono::milliseconds{100});
+    const auto probe_count = run_transactions(20);
+    EXPECT_GE(probe_count, 1);
+    EXPECT_LE(probe_count, 2);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,147 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <userver/storages/postgres/copy_in.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+/// [CopyIn]
+struct IdAndName final {
+    int id{};
+    std::optional<std::string> name;
+};
+
+std::size_t InsertWithCopy(pg::Transaction& trx, const std::vector<IdAndName>& rows) {
+    return trx.CopyInRows("COPY copy_in_test (id, name) FROM STDIN (FORMAT binary)", rows);
+}
+/// [CopyIn]
+
+std::vector<IdAndName> MakeRows(int count) {
+    std::vector<IdAndName> rows;
+    rows.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        rows.push_back({i, i % 3 ? std::optional<std::string>{std::to_string(i)} : std::nullopt});
+    }
+    return rows;
+}
+
+void CreateTable(pg::detail::ConnectionPtr& conn) {
+    conn->Execute("create temporary table copy_in_test(id integer primary key, name text)");
+}
+
+pg::Bigint CountRows(pg::Transaction& trx) {
+    return trx.Execute("select count(*) from copy_in_test").AsSingleRow<pg::Bigint>();
+}
+
+}  // namespace
+
+UTEST_P(PostgreConnection, CopyInRows) {
+    CheckConnection(GetConn());
+    CreateTable(GetConn());
+
+    const auto rows = MakeRows(1001);
+    pg::Transaction trx{std::move(GetConn())};
+    std::size_t inserted = 0;
+    UEXPECT_NO_THROW(inserted = InsertWithCopy(trx, rows));
+    EXPECT_EQ(inserted, rows.size());
+
+    const auto res = trx.Execute("select id, name from copy_in_test order by id")
+                         .AsContainer<std::vector<IdAndName>>(pg::kRowTag);
+    ASSERT_EQ(res.size(), rows.size());
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        EXPECT_EQ(res[i].id, rows[i].id);
+        EXPECT_EQ(res[i].name, rows[i].name);
+    }
+
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyInStreamChunks) {
+    CheckConnection(GetConn());
+    CreateTable(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    {
+        auto copy = trx.MakeCopyIn("COPY copy_in_test (id, name) FROM STDIN (FORMAT binary)");
+        for (int i = 0; i < 100; ++i) {
+            copy.WriteRow(std::make_tuple(i, std::string(i, 'x')));
+        }
+        EXPECT_EQ(copy.RowsWritten(), 100);
+        EXPECT_EQ(copy.Finish(), 100);
+        UEXPECT_THROW(copy.Finish(), pg::LogicError);
+    }
+    EXPECT_EQ(CountRows(trx), 100);
+
+    // Single column rows
+    trx.Execute("delete from copy_in_test");
+    EXPECT_EQ(trx.CopyInRows("COPY copy_in_test (id) FROM STDIN (FORMAT binary)", std::vector<int>{1, 2, 3}), 3);
+    EXPECT_EQ(trx.Execute("select count(*) from copy_in_test where name is null").AsSingleRow<pg::Bigint>(), 3);
+
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyInSmallChunkSize) {
+    CheckConnection(GetConn());
+    CreateTable(GetConn());
+
+    const auto rows = MakeRows(500);
+    UEXPECT_NO_THROW(GetConn()->Begin({}, pg::detail::SteadyClock::now()));
+    {
+        pg::CopyIn copy{
+            GetConn().get(), "COPY copy_in_test (id, name) FROM STDIN (FORMAT binary)", {}, /*chunk_size=*/16};
+        copy.WriteRows(rows);
+        EXPECT_EQ(copy.Finish(), rows.size());
+    }
+    EXPECT_EQ(GetConn()->Execute("select count(*) from copy_in_test").AsSingleRow<pg::Bigint>(), 500);
+    UEXPECT_NO_THROW(GetConn()->Commit());
+}
+
+UTEST_P(PostgreConnection, CopyInAbortOnDestruction) {
+    CheckConnection(GetConn());
+    CreateTable(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    trx.Execute("savepoint before_copy");
+    {
+        auto copy = trx.MakeCopyIn("COPY copy_in_test (id, name) FROM STDIN (FORMAT binary)");
+        copy.WriteRows(MakeRows(10));
+        UEXPECT_THROW(trx.Execute("select 1"), pg::ConnectionBusy);
+    }
+    // Aborted COPY fails the statement and the transaction
+    UEXPECT_THROW(trx.Execute("select 1"), pg::Error);
+    trx.Execute("rollback to savepoint before_copy");
+    EXPECT_EQ(CountRows(trx), 0);
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyInErrors) {
+    CheckConnection(GetConn());
+    CreateTable(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    UEXPECT_THROW(trx.MakeCopyIn("select 1"), pg::LogicError);
+    EXPECT_EQ(CountRows(trx), 0);
+
+    // Text format is rejected, the COPY statement is aborted
+    trx.Execute("savepoint before_copy");
+    UEXPECT_THROW(trx.MakeCopyIn("COPY copy_in_test (id, name) FROM STDIN"), pg::LogicError);
+    trx.Execute("rollback to savepoint before_copy");
+
+    // Duplicate primary key is detected by the server when the COPY ends
+    auto rows = MakeRows(10);
+    rows.push_back(rows.front());
+    UEXPECT_THROW(InsertWithCopy(trx, rows), pg::UniqueViolation);
+    trx.Rollback();
+}
+
+USERVER_NAMESPACE_END
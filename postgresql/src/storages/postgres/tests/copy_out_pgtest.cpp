@@ -0,0 +1,133 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <userver/storages/postgres/copy_out.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+constexpr int kRowCount = 1001;
+
+/// [CopyOut]
+struct IdAndName final {
+    int id{};
+    std::optional<std::string> name;
+};
+
+std::vector<IdAndName> ReadWithCopy(pg::Transaction& trx) {
+    auto copy = trx.MakeCopyOut("COPY (SELECT id, name FROM copy_out_test ORDER BY id) TO STDOUT (FORMAT binary)");
+    std::vector<IdAndName> rows;
+    IdAndName row;
+    while (copy.ReadRow(row)) {
+        rows.push_back(std::move(row));
+    }
+    return rows;
+}
+/// [CopyOut]
+
+void FillTable(pg::detail::ConnectionPtr& conn) {
+    conn->Execute("create temporary table copy_out_test(id integer primary key, name text)");
+    conn->Execute(
+        "insert into copy_out_test select i, case when i % 3 = 0 then null else i::text end "
+        "from generate_series(0, $1 - 1) as i",
+        kRowCount
+    );
+}
+
+}  // namespace
+
+UTEST_P(PostgreConnection, CopyOutRows) {
+    CheckConnection(GetConn());
+    FillTable(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    std::vector<IdAndName> rows;
+    UEXPECT_NO_THROW(rows = ReadWithCopy(trx));
+    ASSERT_EQ(rows.size(), kRowCount);
+    for (int i = 0; i < kRowCount; ++i) {
+        EXPECT_EQ(rows[i].id, i);
+        EXPECT_EQ(rows[i].name, i % 3 ? std::optional<std::string>{std::to_string(i)} : std::nullopt);
+    }
+
+    // The connection is usable after the COPY
+    EXPECT_EQ(trx.Execute("select 1").AsSingleRow<int>(), 1);
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyOutStream) {
+    CheckConnection(GetConn());
+    FillTable(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    {
+        auto copy = trx.MakeCopyOut("COPY copy_out_test (id) TO STDOUT (FORMAT binary)");
+        int id = 0;
+        pg::Bigint sum = 0;
+        while (copy.ReadRow(id)) sum += id;
+        EXPECT_EQ(copy.RowsRead(), kRowCount);
+        EXPECT_GT(copy.BytesRead(), kRowCount * sizeof(int));
+        EXPECT_EQ(sum, pg::Bigint{kRowCount} * (kRowCount - 1) / 2);
+        EXPECT_FALSE(copy.ReadRow(id));
+    }
+    {
+        // Empty result
+        auto copy = trx.MakeCopyOut("COPY (SELECT id, name FROM copy_out_test WHERE id < 0) TO STDOUT (FORMAT binary)");
+        std::tuple<int, std::optional<std::string>> row;
+        EXPECT_FALSE(copy.ReadRow(row));
+        EXPECT_EQ(copy.RowsRead(), 0);
+    }
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyOutAbortOnDestruction) {
+    CheckConnection(GetConn());
+    FillTable(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    trx.Execute("savepoint before_copy");
+    {
+        auto copy = trx.MakeCopyOut("COPY copy_out_test TO STDOUT (FORMAT binary)");
+        IdAndName row;
+        EXPECT_TRUE(copy.ReadRow(row));
+        UEXPECT_THROW(trx.Execute("select 1"), pg::ConnectionBusy);
+    }
+    // Cancelled COPY fails the statement and the transaction
+    UEXPECT_THROW(trx.Execute("select 1"), pg::Error);
+    trx.Execute("rollback to savepoint before_copy");
+    EXPECT_EQ(trx.Execute("select count(*) from copy_out_test").AsSingleRow<pg::Bigint>(), kRowCount);
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyOutErrors) {
+    CheckConnection(GetConn());
+    FillTable(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    UEXPECT_THROW(trx.MakeCopyOut("select 1"), pg::LogicError);
+    UEXPECT_THROW(trx.MakeCopyOut("COPY copy_out_test TO STDOUT"), pg::LogicError);
+    EXPECT_EQ(trx.Execute("select 1").AsSingleRow<int>(), 1);
+
+    {
+        // Row type does not match the columns, the rest of the rows is still
+        // readable
+        auto copy = trx.MakeCopyOut("COPY copy_out_test (id) TO STDOUT (FORMAT binary)");
+        IdAndName row;
+        UEXPECT_THROW(copy.ReadRow(row), pg::InvalidTupleSizeRequested);
+        int id = 0;
+        std::size_t count = 0;
+        while (copy.ReadRow(id)) ++count;
+        EXPECT_EQ(count, kRowCount - 1);
+    }
+    trx.Commit();
+}
+
+USERVER_NAMESPACE_END
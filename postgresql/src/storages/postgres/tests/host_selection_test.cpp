@@ -0,0 +1,128 @@
+#include <userver/utest/utest.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include <storages/postgres/detail/host_selection.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pgd = storages::postgres::detail;
+
+namespace {
+
+using Microseconds = std::chrono::microseconds;
+
+constexpr std::size_t kReplicas = 3;
+constexpr std::array<std::uint32_t, kReplicas> kReplicaLatencyUs{1000, 1000, 10000};
+constexpr std::uint32_t kArrivalIntervalUs = 100;
+constexpr std::size_t kRequests = 20000;
+
+struct SimulationResult {
+    std::array<std::size_t, kReplicas> selected{};
+    double avg_latency_us{0};
+};
+
+using SelectFunc = std::function<std::size_t(const std::vector<std::size_t>&, const std::vector<Microseconds>&)>;
+
+// Requests arrive at a constant rate, each replica serves them concurrently
+// with its own fixed latency
+SimulationResult Simulate(const SelectFunc& select) {
+    std::vector<std::priority_queue<std::uint64_t, std::vector<std::uint64_t>, std::greater<>>> in_flight(kReplicas);
+    std::vector<std::size_t> outstanding(kReplicas, 0);
+    std::vector<Microseconds> latency_ewma(kReplicas, Microseconds{0});
+    std::vector<std::uint32_t> ewma_us(kReplicas, 0);
+
+    SimulationResult result;
+    std::uint64_t total_latency = 0;
+    for (std::size_t i = 0; i < kRequests; ++i) {
+        const std::uint64_t now = i * kArrivalIntervalUs;
+        for (std::size_t host = 0; host < kReplicas; ++host) {
+            auto& queue = in_flight[host];
+            while (!queue.empty() && queue.top() <= now) {
+                queue.pop();
+                --outstanding[host];
+                ewma_us[host] = pgd::UpdateLatencyEwma(ewma_us[host], kReplicaLatencyUs[host]);
+                latency_ewma[host] = Microseconds{ewma_us[host]};
+            }
+        }
+
+        const auto host = select(outstanding, latency_ewma);
+        ++result.selected[host];
+        ++outstanding[host];
+        in_flight[host].push(now + kReplicaLatencyUs[host]);
+        total_latency += kReplicaLatencyUs[host];
+    }
+    result.avg_latency_us = static_cast<double>(total_latency) / kRequests;
+    return result;
+}
+
+}  // namespace
+
+TEST(PostgreHostSelection, LatencyEwma) {
+    EXPECT_EQ(pgd::UpdateLatencyEwma(0, 1000), 1000);
+    EXPECT_EQ(pgd::UpdateLatencyEwma(1000, 1000), 1000);
+    EXPECT_EQ(pgd::UpdateLatencyEwma(1000, 1800), 1100);
+    EXPECT_EQ(pgd::UpdateLatencyEwma(1000, 200), 900);
+
+    std::uint32_t ewma = 1000;
+    for (int i = 0; i < 100; ++i) ewma = pgd::UpdateLatencyEwma(ewma, 5000);
+    EXPECT_NEAR(ewma, 5000, 10);
+}
+
+TEST(PostgreHostSelection, LoadScore) {
+    EXPECT_LT(pgd::HostLoadScore(0, Microseconds{1000}), pgd::HostLoadScore(1, Microseconds{1000}));
+    EXPECT_LT(pgd::HostLoadScore(5, Microseconds{1000}), pgd::HostLoadScore(0, Microseconds{10000}));
+    EXPECT_LT(pgd::HostLoadScore(0, Microseconds{0}), pgd::HostLoadScore(0, Microseconds{10}));
+}
+
+TEST(PostgreHostSelection, SelectionScore) {
+    const auto fresh = pgd::kHostProbeInterval / 2;
+    EXPECT_EQ(pgd::HostSelectionScore(2, Microseconds{1000}, fresh), pgd::HostLoadScore(2, Microseconds{1000}));
+    // A host that was not selected for a while wins over any other host
+    EXPECT_EQ(pgd::HostSelectionScore(2, Microseconds{1000}, pgd::kHostProbeInterval), 0);
+    EXPECT_LT(
+        pgd::HostSelectionScore(5, Microseconds{10000}, pgd::kHostProbeInterval * 2),
+        pgd::HostSelectionScore(0, Microseconds{0}, fresh)
+    );
+}
+
+TEST(PostgreHostSelection, PowerOfTwoChoices) {
+    EXPECT_EQ(pgd::SelectPowerOfTwoChoices(1, [](std::size_t) { return 0; }), 0);
+
+    // The worst host is never chosen, the others are chosen
+    std::array<std::size_t, 4> selected{};
+    for (int i = 0; i < 1000; ++i) {
+        const auto pos =
+            pgd::SelectPowerOfTwoChoices(selected.size(), [](std::size_t pos) { return pos == 2 ? 100 : pos; });
+        ASSERT_LT(pos, selected.size());
+        ++selected[pos];
+    }
+    EXPECT_EQ(selected[2], 0);
+    EXPECT_GT(selected[0], 0);
+    EXPECT_GT(selected[1], 0);
+}
+
+TEST(PostgreHostSelection, SkewedReplicaLatency) {
+    std::size_t rr_idx = 0;
+    const auto round_robin = Simulate([&rr_idx](const auto&, const auto&) { return rr_idx++ % kReplicas; });
+    const auto p2c = Simulate([](const auto& outstanding, const auto& latency) {
+        return pgd::SelectPowerOfTwoChoices(kReplicas, [&](std::size_t pos) {
+            return pgd::HostLoadScore(outstanding[pos], latency[pos]);
+        });
+    });
+
+    // Round robin gives the slow replica an equal share
+    EXPECT_NEAR(round_robin.selected[2], kRequests / kReplicas, 1);
+
+    // Latency-aware selection offloads the slow replica, but still probes it
+    EXPECT_LT(p2c.selected[2], kRequests / 10);
+    EXPECT_GT(p2c.selected[2], 0);
+    EXPECT_LT(p2c.avg_latency_us, round_robin.avg_latency_us / 2);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,142 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+#include <optional>
+#include <string>
+
+#include <userver/engine/sleep.hpp>
+
+#include <storages/postgres/detail/result_cache.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+namespace pgd = storages::postgres::detail;
+
+namespace {
+
+constexpr std::size_t kMaxSizeBytes = 4096;
+constexpr std::size_t kResultSizeBytes = 1000;
+
+const pg::ResultCacheOptions kOptions{std::chrono::minutes{1}, {"tag"}};
+const pg::ResultCacheOptions kOtherTagOptions{std::chrono::minutes{1}, {"other"}};
+
+// The cache does not look into the result, the size is passed explicitly
+pg::ResultSet MakeResult() { return pg::ResultSet{nullptr}; }
+
+std::string MakeKey(int arg) {
+    pg::ParameterStore store;
+    store.PushBack(arg);
+    return pgd::ResultCache::MakeKey(pg::ClusterHostType::kMaster, pg::Query{"select $1"}, store);
+}
+
+void Fill(pgd::ResultCache& cache, const std::string& key, const pg::ResultCacheOptions& options = kOptions) {
+    cache.Put(cache.StartFill(), key, options, MakeResult(), kResultSizeBytes);
+}
+
+}  // namespace
+
+UTEST(PostgreResultCache, Key) {
+    pg::ParameterStore null_store;
+    null_store.PushBack(std::optional<int>{});
+    const auto null_key = pgd::ResultCache::MakeKey(pg::ClusterHostType::kMaster, pg::Query{"select $1"}, null_store);
+
+    EXPECT_EQ(MakeKey(1), MakeKey(1));
+    EXPECT_NE(MakeKey(1), MakeKey(2));
+    EXPECT_NE(MakeKey(1), null_key);
+
+    pg::ParameterStore store;
+    store.PushBack(1);
+    EXPECT_NE(MakeKey(1), pgd::ResultCache::MakeKey(pg::ClusterHostType::kSlave, pg::Query{"select $1"}, store));
+    EXPECT_NE(MakeKey(1), pgd::ResultCache::MakeKey(pg::ClusterHostType::kMaster, pg::Query{"select $1 "}, store));
+}
+
+UTEST(PostgreResultCache, HitAndMiss) {
+    pgd::ResultCache cache{kMaxSizeBytes, false};
+
+    EXPECT_FALSE(cache.Get(MakeKey(1)));
+    Fill(cache, MakeKey(1));
+    EXPECT_TRUE(cache.Get(MakeKey(1)));
+    EXPECT_FALSE(cache.Get(MakeKey(2)));
+
+    const auto stats = cache.GetStatistics();
+    EXPECT_EQ(stats.hits.value, 1);
+    EXPECT_EQ(stats.misses.value, 2);
+    EXPECT_EQ(stats.entries, 1);
+    EXPECT_GT(stats.size_bytes, kResultSizeBytes);
+}
+
+UTEST(PostgreResultCache, Ttl) {
+    pgd::ResultCache cache{kMaxSizeBytes, false};
+
+    Fill(cache, MakeKey(1), {std::chrono::milliseconds{1}, {}});
+    engine::SleepFor(std::chrono::milliseconds{2});
+    EXPECT_FALSE(cache.Get(MakeKey(1)));
+    EXPECT_EQ(cache.GetStatistics().entries, 0);
+
+    Fill(cache, MakeKey(1), {});
+    EXPECT_FALSE(cache.Get(MakeKey(1)));
+}
+
+UTEST(PostgreResultCache, Eviction) {
+    pgd::ResultCache cache{kMaxSizeBytes, false};
+
+    Fill(cache, MakeKey(1));
+    Fill(cache, MakeKey(2));
+    EXPECT_TRUE(cache.Get(MakeKey(1)));
+    Fill(cache, MakeKey(3));
+
+    // The least recently used result is evicted
+    EXPECT_TRUE(cache.Get(MakeKey(1)));
+    EXPECT_FALSE(cache.Get(MakeKey(2)));
+    EXPECT_TRUE(cache.Get(MakeKey(3)));
+    EXPECT_EQ(cache.GetStatistics().evicted.value, 1);
+    EXPECT_LE(cache.GetStatistics().size_bytes, kMaxSizeBytes);
+
+    // A result that does not fit is not cached
+    cache.Put(cache.StartFill(), MakeKey(4), kOptions, MakeResult(), kMaxSizeBytes);
+    EXPECT_FALSE(cache.Get(MakeKey(4)));
+    EXPECT_TRUE(cache.Get(MakeKey(3)));
+}
+
+UTEST(PostgreResultCache, Invalidation) {
+    pgd::ResultCache cache{kMaxSizeBytes, false};
+
+    Fill(cache, MakeKey(1));
+    Fill(cache, MakeKey(2), kOtherTagOptions);
+    cache.Invalidate("tag");
+    EXPECT_FALSE(cache.Get(MakeKey(1)));
+    EXPECT_TRUE(cache.Get(MakeKey(2)));
+
+    cache.InvalidateAll();
+    EXPECT_FALSE(cache.Get(MakeKey(2)));
+    EXPECT_EQ(cache.GetStatistics().invalidated.value, 2);
+}
+
+UTEST(PostgreResultCache, InvalidationDuringExecution) {
+    pgd::ResultCache cache{kMaxSizeBytes, false};
+
+    const auto token = cache.StartFill();
+    cache.Invalidate("unrelated");
+    cache.Put(token, MakeKey(1), kOptions, MakeResult(), kResultSizeBytes);
+    EXPECT_FALSE(cache.Get(MakeKey(1)));
+
+    Fill(cache, MakeKey(1));
+    EXPECT_TRUE(cache.Get(MakeKey(1)));
+}
+
+UTEST(PostgreResultCache, Suspend) {
+    pgd::ResultCache cache{kMaxSizeBytes, true};
+
+    Fill(cache, MakeKey(1));
+    EXPECT_FALSE(cache.Get(MakeKey(1)));
+
+    cache.Resume();
+    Fill(cache, MakeKey(1));
+    EXPECT_TRUE(cache.Get(MakeKey(1)));
+
+    cache.Suspend();
+    EXPECT_FALSE(cache.Get(MakeKey(1)));
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,8 @@
 #include <storages/postgres/tests/util_pgtest.hpp>
 
+#include <boost/uuid/uuid.hpp>
+
+#include <userver/storages/postgres/io/uuid.hpp>
 #include <userver/storages/postgres/result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -155,4 +158,80 @@ UTEST_P(PostgreConnection, ResultAsOptionalSingleRow) {
     UEXPECT_THROW(res.AsOptionalSingleRow<int>(), pg::NonSingleRowResultSet);
 }
 
+UTEST_P(PostgreConnection, ResultAsColumn) {
+    CheckConnection(GetConn());
+
+    pg::ResultSet res{nullptr};
+    UEXPECT_NO_THROW(
+        res = GetConn()->Execute("select n::smallint, n, n::bigint, (n / 2.0)::real, (n / 2.0)::double precision, "
+                                 "n::text, n::varchar, ('00000000-0000-0000-0000-00000000000' || n % 10)::uuid "
+                                 "from generate_series(1, 10) n")
+    );
+    ASSERT_EQ(10, res.Size());
+
+    const auto int2 = res.AsColumn<pg::Smallint>(0);
+    const auto int4 = res.AsColumn<pg::Integer>(1);
+    const auto int8 = res.AsColumn<pg::Bigint>(2);
+    const auto float4 = res.AsColumn<float>(3);
+    const auto float8 = res.AsColumn<double>(4);
+    const auto text = res.AsColumn<std::string>(5);
+    const auto varchar = res.AsColumn<std::string>(6);
+    const auto uuids = res.AsColumn<boost::uuids::uuid>(7);
+    ASSERT_EQ(10, int2.size());
+    ASSERT_EQ(10, uuids.size());
+    for (std::size_t i = 0; i < res.Size(); ++i) {
+        const auto n = static_cast<int>(i) + 1;
+        EXPECT_EQ(n, int2[i]);
+        EXPECT_EQ(n, int4[i]);
+        EXPECT_EQ(n, int8[i]);
+        EXPECT_EQ(n / 2.0f, float4[i]);
+        EXPECT_EQ(n / 2.0, float8[i]);
+        EXPECT_EQ(std::to_string(n), text[i]);
+        EXPECT_EQ(std::to_string(n), varchar[i]);
+        EXPECT_EQ(res[i][7].As<boost::uuids::uuid>(), uuids[i]);
+    }
+
+    // Columns that need a conversion are read field by field
+    const auto widened = res.AsColumn<pg::Bigint>(1);
+    EXPECT_EQ(int8, widened);
+
+    UEXPECT_THROW(res.AsColumn<pg::Integer>(8), pg::FieldIndexOutOfBounds);
+}
+
+UTEST_P(PostgreConnection, ResultAsColumnNulls) {
+    CheckConnection(GetConn());
+
+    pg::ResultSet res{nullptr};
+    UEXPECT_NO_THROW(
+        res = GetConn()->Execute("select nullif(n, 2), nullif(n::text, '2') "
+                                 "from generate_series(1, 3) n")
+    );
+
+    UEXPECT_THROW(res.AsColumn<pg::Integer>(0), pg::FieldValueIsNull);
+    UEXPECT_THROW(res.AsColumn<std::string>(1), pg::FieldValueIsNull);
+
+    const auto ints = res.AsColumn<std::optional<pg::Integer>>(0);
+    const std::vector<std::optional<pg::Integer>> expected{1, std::nullopt, 3};
+    EXPECT_EQ(expected, ints);
+}
+
+UTEST_P(PostgreConnection, ResultAsColumns) {
+    CheckConnection(GetConn());
+
+    pg::ResultSet res{nullptr};
+    UEXPECT_NO_THROW(res = GetConn()->Execute("select n, n::text from generate_series(1, 3) n"));
+
+    const auto [ints, strings] = res.AsColumns<pg::Integer, std::string>();
+    EXPECT_EQ((std::vector<pg::Integer>{1, 2, 3}), ints);
+    EXPECT_EQ((std::vector<std::string>{"1", "2", "3"}), strings);
+
+    UEXPECT_THROW(res.AsColumns<pg::Integer>(), pg::InvalidTupleSizeRequested);
+
+    // Empty result set
+    UEXPECT_NO_THROW(res = GetConn()->Execute("select n, n::text from generate_series(1, 0) n"));
+    const auto [no_ints, no_strings] = res.AsColumns<pg::Integer, std::string>();
+    EXPECT_TRUE(no_ints.empty());
+    EXPECT_TRUE(no_strings.empty());
+}
+
 USERVER_NAMESPACE_END
@@ -81,6 +81,28 @@ ResultSet Transaction::DoExecute(
     }
 }
 
+CopyIn Transaction::MakeCopyIn(const Query& query, OptionalCommandControl statement_cmd_ctl) {
+    if (!conn_) {
+        LOG_LIMITED_ERROR() << "Make copy called after transaction finished" << logging::LogExtra::Stacktrace();
+        throw NotInTransaction("Transaction handle is not valid");
+    }
+    if (!statement_cmd_ctl) {
+        statement_cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+    }
+    return CopyIn{conn_.get(), query, std::move(statement_cmd_ctl)};
+}
+
+CopyOut Transaction::MakeCopyOut(const Query& query, OptionalCommandControl statement_cmd_ctl) {
+    if (!conn_) {
+        LOG_LIMITED_ERROR() << "Make copy called after transaction finished" << logging::LogExtra::Stacktrace();
+        throw NotInTransaction("Transaction handle is not valid");
+    }
+    if (!statement_cmd_ctl) {
+        statement_cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+    }
+    return CopyOut{conn_.get(), query, std::move(statement_cmd_ctl)};
+}
+
 Portal Transaction::MakePortal(
     const PortalName& portal_name,
     const Query& query,
@@ -0,0 +1,86 @@
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <hiredis/hiredis.h>
+
+#include <userver/storages/redis/parse_reply.hpp>
+#include <userver/storages/redis/reply.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::bench {
+
+namespace {
+
+constexpr std::size_t kValueSize = 32;
+
+// Array reply of state.range(0) bulk strings, as built by the hiredis reader
+class RawArrayReply final {
+public:
+    explicit RawArrayReply(std::size_t size) : strings_(size, std::string(kValueSize, 'x')), replies_(size) {
+        element_ptrs_.reserve(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            auto& reply = replies_[i];
+            reply.type = REDIS_REPLY_STRING;
+            reply.str = strings_[i].data();
+            reply.len = strings_[i].size();
+            element_ptrs_.push_back(&reply);
+        }
+        root_.type = REDIS_REPLY_ARRAY;
+        root_.element = element_ptrs_.data();
+        root_.elements = element_ptrs_.size();
+    }
+
+    const redisReply* Get() const { return &root_; }
+
+private:
+    std::vector<std::string> strings_;
+    std::vector<redisReply> replies_;
+    std::vector<redisReply*> element_ptrs_;
+    redisReply root_{};
+};
+
+void ReportItems(benchmark::State& state) {
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * kValueSize);
+}
+
+}  // namespace
+
+// Done on the ev thread for each reply
+void ReplyFromHiredis(benchmark::State& state) {
+    const RawArrayReply raw{static_cast<std::size_t>(state.range(0))};
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(ReplyData{raw.Get()});
+    }
+    ReportItems(state);
+}
+BENCHMARK(ReplyFromHiredis)->RangeMultiplier(10)->Range(10, 100000);
+
+// Done on the coroutine that waits for the reply
+void ReplyParseStrings(benchmark::State& state) {
+    const RawArrayReply raw{static_cast<std::size_t>(state.range(0))};
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(
+            ParseReplyDataArray(ReplyData{raw.Get()}, "bench", To<std::vector<std::string>>{})
+        );
+    }
+    ReportItems(state);
+}
+BENCHMARK(ReplyParseStrings)->RangeMultiplier(10)->Range(10, 100000);
+
+// Legacy access to the elements through ReplyData::Array
+void ReplyMaterializeArray(benchmark::State& state) {
+    const RawArrayReply raw{static_cast<std::size_t>(state.range(0))};
+    for ([[maybe_unused]] auto _ : state) {
+        ReplyData data{raw.Get()};
+        benchmark::DoNotOptimize(data.GetArray());
+    }
+    ReportItems(state);
+}
+BENCHMARK(ReplyMaterializeArray)->RangeMultiplier(10)->Range(10, 100000);
+
+}  // namespace storages::redis::bench
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,91 @@
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/current_task.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/stream_consumer.hpp>
+
+#include "redis_fixture.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::bench {
+
+namespace {
+
+constexpr std::size_t kMessagesPerIteration = 10000;
+constexpr std::size_t kProducerPipelineDepth = 256;
+
+void Produce(Client& client, std::size_t count) {
+    std::vector<RequestXadd> requests;
+    requests.reserve(kProducerPipelineDepth);
+    for (std::size_t i = 0; i < count; ++i) {
+        requests.push_back(client.Xadd("stream", {{"payload", std::string(64, 'x')}}, {}, {}));
+        if (requests.size() == kProducerPipelineDepth) {
+            for (auto& request : requests) request.Get();
+            requests.clear();
+        }
+    }
+    for (auto& request : requests) request.Get();
+}
+
+}  // namespace
+
+// Messages/s of a consumer group member that reads, processes and
+// acknowledges the messages in batches of the given size
+BENCHMARK_DEFINE_F(Redis, StreamConsume)(benchmark::State& state) {
+    RunStandalone([this, &state] {
+        StreamConsumerSettings settings;
+        settings.stream = "stream";
+        settings.group = "group";
+        settings.consumer = "consumer";
+        settings.group_start_id = "0";
+        settings.batch_size = state.range(0);
+        settings.poll_interval = std::chrono::milliseconds{1};
+
+        std::size_t total = 0;
+        for ([[maybe_unused]] auto _ : state) {
+            state.PauseTiming();
+            GetClient()->Del("stream", {}).Get();
+            Produce(*GetClient(), kMessagesPerIteration);
+            state.ResumeTiming();
+
+            std::atomic<std::size_t> processed{0};
+            engine::SingleConsumerEvent done;
+            StreamConsumer consumer{GetClient(), settings, engine::current_task::GetTaskProcessor()};
+            consumer.Start([&](const std::vector<StreamEntry>& entries) {
+                benchmark::DoNotOptimize(entries.data());
+                if ((processed += entries.size()) >= kMessagesPerIteration) done.Send();
+            });
+            [[maybe_unused]] const auto is_done = done.WaitForEvent();
+            consumer.Stop();
+
+            total += processed;
+        }
+        state.SetItemsProcessed(total);
+    });
+}
+BENCHMARK_REGISTER_F(Redis, StreamConsume)->Arg(1)->Arg(16)->Arg(128)->Arg(512)->UseRealTime();
+
+// Messages/s of the pipelined XADD producer
+BENCHMARK_DEFINE_F(Redis, StreamProduce)(benchmark::State& state) {
+    RunStandalone([this, &state] {
+        for ([[maybe_unused]] auto _ : state) {
+            Produce(*GetClient(), kMessagesPerIteration);
+
+            state.PauseTiming();
+            GetClient()->Del("stream", {}).Get();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * kMessagesPerIteration);
+    });
+}
+BENCHMARK_REGISTER_F(Redis, StreamProduce)->UseRealTime();
+
+}  // namespace storages::redis::bench
+
+USERVER_NAMESPACE_END
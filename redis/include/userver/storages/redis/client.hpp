@@ -333,6 +333,39 @@ public:
 
     virtual RequestType Type(std::string key, const CommandControl& command_control) = 0;
 
+    virtual RequestXack
+    Xack(std::string key, std::string group, std::vector<std::string> ids, const CommandControl& command_control) = 0;
+
+    virtual RequestXadd Xadd(
+        std::string key,
+        std::vector<std::pair<std::string, std::string>> field_values,
+        const XaddOptions& options,
+        const CommandControl& command_control
+    ) = 0;
+
+    virtual RequestXautoclaim Xautoclaim(
+        std::string key,
+        std::string group,
+        std::string consumer,
+        std::chrono::milliseconds min_idle_time,
+        std::string start,
+        const XautoclaimOptions& options,
+        const CommandControl& command_control
+    ) = 0;
+
+    /// Creates the consumer group and the stream if it does not exist
+    virtual RequestXgroupCreate
+    XgroupCreate(std::string key, std::string group, std::string id, const CommandControl& command_control) = 0;
+
+    virtual RequestXreadgroup Xreadgroup(
+        std::string key,
+        std::string group,
+        std::string consumer,
+        std::string id,
+        const XreadgroupOptions& options,
+        const CommandControl& command_control
+    ) = 0;
+
     virtual RequestZadd
     Zadd(std::string key, double score, std::string member, const CommandControl& command_control) = 0;
 
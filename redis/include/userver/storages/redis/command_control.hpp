@@ -122,6 +122,15 @@ struct CommandControl {
     /// ignored.
     std::optional<ServerId> force_server_id;
 
+    /// Allow GET and HGET to be sent together with the concurrent reads as a
+    /// single MGET or HMGET, if the read batching is enabled in the static
+    /// config of the redis component.
+    ///
+    /// @warning MGET returns nil for a key holding a value that is not a
+    /// string, while GET fails with WRONGTYPE. A batched GET of such a key
+    /// returns std::nullopt.
+    std::optional<bool> allow_read_batching;
+
     /// If set, command retries are directed to the master instance
     bool force_retries_to_master_on_nil_reply{false};
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <optional>
 #include <string>
 #include <vector>
@@ -175,6 +176,33 @@ struct SetOptions {
     Exist exist = Exist::kSetAlways;
 };
 
+struct XaddOptions {
+    /// Trims the stream to that many entries, zero disables the trimming
+    size_t max_len = 0;
+    /// Allows the server to keep slightly more entries (`MAXLEN ~`), which is
+    /// much cheaper
+    bool approximate_trim = true;
+    /// Does not create the stream if it does not exist
+    bool nomkstream = false;
+};
+
+struct XreadgroupOptions {
+    /// Maximum number of entries to read, all available entries if not set
+    std::optional<size_t> count;
+    /// Blocks the connection until the entries arrive.
+    /// @warning Connections are shared by all the requests of the client, so
+    /// the other requests to the same server wait for the blocking command.
+    /// Use it only with a client dedicated to the blocking reads.
+    std::optional<std::chrono::milliseconds> block;
+    /// Does not add the read entries to the pending entries list
+    bool noack = false;
+};
+
+struct XautoclaimOptions {
+    /// Maximum number of entries to claim, server default is 100
+    std::optional<size_t> count;
+};
+
 struct ScoreOptions {
     bool withscores = false;
 };
@@ -65,6 +65,9 @@ namespace components {
 /// groups.[].db | name to refer to the cluster in components::Redis::GetClient() | -
 /// groups.[].sharding_strategy | one of RedisCluster, KeyShardCrc32, KeyShardTaximeterCrc32 or KeyShardGpsStorageDriver | "KeyShardTaximeterCrc32"
 /// groups.[].allow_reads_from_master | allows read requests from master instance | false
+/// groups.[].client_side_cache_max_size_bytes | memory limit of the client side cache of GET and HGET replies kept coherent by `CLIENT TRACKING` (Redis >= 6.0), reads with explicit routing in CommandControl bypass the cache, 0 disables the cache | 0
+/// groups.[].read_batching_window_us | time in microseconds a GET or HGET with storages::redis::CommandControl::allow_read_batching set waits for the concurrent reads to the same shard to be sent with them as a single MGET or HMGET, 0 disables the batching. A batched GET of a key holding a non-string value returns nil instead of failing with WRONGTYPE | 0
+/// groups.[].read_batching_max_size | a batch is sent without waiting for the window when it gets that many reads | 64
 /// subscribe_groups | array of redis clusters to work with in subscribe mode | -
 /// subscribe_groups.[].config_name | key name in secdist with options for this cluster | -
 /// subscribe_groups.[].db | name to refer to the cluster in components::Redis::GetSubscribeClient() | -
@@ -96,6 +96,13 @@ Parse(ReplyData&& reply_data, const std::string& request_description, To<std::un
 std::unordered_map<std::string, std::string>
 Parse(ReplyData&& reply_data, const std::string& request_description, To<std::unordered_map<std::string, std::string>>);
 
+std::vector<StreamEntry>
+Parse(ReplyData&& reply_data, const std::string& request_description, To<std::vector<StreamEntry>>);
+
+XautoclaimReply Parse(ReplyData&& reply_data, const std::string& request_description, To<XautoclaimReply>);
+
+XgroupCreateReply Parse(ReplyData&& reply_data, const std::string& request_description, To<XgroupCreateReply>);
+
 ReplyData Parse(ReplyData&& reply_data, const std::string& request_description, To<ReplyData>);
 
 template <typename Result, typename ReplyType = Result>
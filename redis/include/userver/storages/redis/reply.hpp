@@ -1,7 +1,10 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <userver/logging/log_extra.hpp>
@@ -17,6 +20,17 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis {
 
+namespace impl {
+class PackedReply;
+}  // namespace impl
+
+class ReplyDataView;
+
+/// @brief Data of the Redis reply.
+///
+/// Arrays received from the server are stored in a single buffer and their
+/// elements are materialized on the first call to GetArray(). Use GetView()
+/// to read the elements without copying them.
 class ReplyData final {
 public:
     using Array = std::vector<ReplyData>;
@@ -124,6 +138,10 @@ public:
 
     explicit operator bool() const { return type_ != Type::kNoReply; }
 
+    /// @brief Returns a view to read the reply without copying its elements.
+    /// The view is valid while this ReplyData is alive and not modified.
+    ReplyDataView GetView() const;
+
     Type GetType() const { return type_; }
     std::string GetTypeString() const;
 
@@ -155,11 +173,12 @@ public:
 
     const Array& GetArray() const {
         UASSERT(IsArray());
-        return array_;
+        return packed_ ? GetPackedArray() : array_;
     }
 
     Array& GetArray() {
         UASSERT(IsArray());
+        if (packed_) Unpack();
         return array_;
     }
 
@@ -188,15 +207,9 @@ public:
         return string_;
     }
 
-    const ReplyData& operator[](size_t idx) const {
-        UASSERT(IsArray());
-        return array_.at(idx);
-    }
+    const ReplyData& operator[](size_t idx) const { return GetArray().at(idx); }
 
-    ReplyData& operator[](size_t idx) {
-        UASSERT(IsArray());
-        return array_.at(idx);
-    }
+    ReplyData& operator[](size_t idx) { return GetArray().at(idx); }
 
     size_t GetSize() const;
 
@@ -215,7 +228,16 @@ public:
     void ExpectError(const std::string& request_description = {}) const;
 
 private:
+    friend class ReplyDataView;
+    friend class impl::PackedReply;
+
     ReplyData() = default;
+    ReplyData(std::shared_ptr<const impl::PackedReply> packed, std::size_t node);
+
+    static ReplyData FromView(const ReplyDataView& view);
+
+    const Array& GetPackedArray() const;
+    void Unpack();
 
     [[noreturn]] void ThrowUnexpectedReplyType(ReplyData::Type expected, const std::string& request_description) const;
 
@@ -224,6 +246,52 @@ private:
     int64_t integer_{};
     Array array_;
     std::string string_;
+
+    // Not yet materialized array, see impl::PackedReply
+    std::shared_ptr<const impl::PackedReply> packed_;
+    std::size_t packed_node_{0};
+};
+
+/// @brief Non-owning read-only view of the ReplyData or of its element.
+///
+/// Reading the elements of an array through the view does not allocate.
+class ReplyDataView final {
+public:
+    using Type = ReplyData::Type;
+
+    Type GetType() const;
+    std::string GetTypeString() const { return ReplyData::TypeToString(GetType()); }
+
+    bool IsString() const { return GetType() == Type::kString; }
+    bool IsArray() const { return GetType() == Type::kArray; }
+    bool IsInt() const { return GetType() == Type::kInteger; }
+    bool IsNil() const { return GetType() == Type::kNil; }
+    bool IsStatus() const { return GetType() == Type::kStatus; }
+    bool IsError() const { return GetType() == Type::kError; }
+
+    std::string_view GetString() const;
+    std::string_view GetStatus() const;
+    std::string_view GetError() const;
+    int64_t GetInt() const;
+
+    /// Number of elements of the array
+    std::size_t GetArraySize() const;
+    ReplyDataView operator[](std::size_t idx) const;
+
+    std::string ToDebugString() const;
+
+private:
+    friend class ReplyData;
+    friend class impl::PackedReply;
+
+    explicit ReplyDataView(const ReplyData& data) : data_(&data) {}
+    ReplyDataView(const impl::PackedReply& packed, std::size_t node) : packed_(&packed), node_(node) {}
+
+    std::string_view GetStringUnchecked() const;
+
+    const ReplyData* data_{nullptr};
+    const impl::PackedReply* packed_{nullptr};
+    std::size_t node_{0};
 };
 
 class Reply final {
@@ -94,6 +94,29 @@ enum class StatusOk { kOk };
 
 enum class StatusPong { kPong };
 
+/// Entry of a stream, the fields are empty for the pending entries that were
+/// deleted from the stream
+struct StreamEntry final {
+    std::string id;
+    std::vector<std::pair<std::string, std::string>> fields;
+
+    bool operator==(const StreamEntry& rhs) const { return std::tie(id, fields) == std::tie(rhs.id, rhs.fields); }
+
+    bool operator!=(const StreamEntry& rhs) const { return !(*this == rhs); }
+};
+
+struct XautoclaimReply final {
+    /// Start id for the next XAUTOCLAIM call, "0-0" when the whole pending
+    /// entries list was scanned
+    std::string next_id;
+    std::vector<StreamEntry> entries;
+    /// Ids of the pending entries that were deleted from the stream and were
+    /// removed from the pending entries list (Redis 7.0+)
+    std::vector<std::string> deleted_ids;
+};
+
+enum class XgroupCreateReply { kCreated, kGroupExists };
+
 }  // namespace storages::redis
 
 USERVER_NAMESPACE_END
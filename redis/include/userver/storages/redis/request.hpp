@@ -213,6 +213,11 @@ using RequestStrlen = Request<size_t>;
 using RequestTime = Request<std::chrono::system_clock::time_point>;
 using RequestTtl = Request<TtlReply>;
 using RequestType = Request<KeyType>;
+using RequestXack = Request<size_t>;
+using RequestXadd = Request<std::string>;
+using RequestXautoclaim = Request<XautoclaimReply>;
+using RequestXgroupCreate = Request<XgroupCreateReply>;
+using RequestXreadgroup = Request<std::vector<StreamEntry>>;
 using RequestZadd = Request<size_t>;
 using RequestZaddIncr = Request<double>;
 using RequestZaddIncrExisting = Request<std::optional<double>>;
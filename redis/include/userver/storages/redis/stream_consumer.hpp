@@ -0,0 +1,137 @@
+#pragma once
+
+/// @file userver/storages/redis/stream_consumer.hpp
+/// @brief @copybrief storages::redis::StreamConsumer
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/command_control.hpp>
+#include <userver/storages/redis/reply_types.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+struct StreamConsumerSettings {
+    /// Key of the stream
+    std::string stream;
+
+    /// Consumer group, created on start if it does not exist
+    std::string group;
+
+    /// Name of the consumer in the group, must be unique among the running
+    /// consumers of the group
+    std::string consumer;
+
+    /// Id of the last entry considered delivered to the group when the group
+    /// is created on start, "$" skips the entries added before the creation
+    std::string group_start_id{"$"};
+
+    /// Maximum number of entries passed to a single callback call
+    std::size_t batch_size{100};
+
+    /// Delay before the next read when there are no entries to process
+    std::chrono::milliseconds poll_interval{100};
+
+    /// Delay before reprocessing the batch the callback failed on and before
+    /// retrying the failed reads
+    std::chrono::milliseconds restart_after_failure_delay{1000};
+
+    /// Entries that are pending for the other consumers of the group for
+    /// longer than that are claimed by this consumer, nullopt disables
+    /// claiming
+    std::optional<std::chrono::milliseconds> claim_min_idle_time;
+
+    CommandControl command_control;
+};
+
+// clang-format off
+/// @ingroup userver_clients
+///
+/// @brief Reads the entries of a Redis stream as a member of a consumer group
+/// and acknowledges them in batches.
+///
+/// The entries are read with XREADGROUP up to `batch_size` at a time, passed
+/// to the callback on the task processor of the consumer and acknowledged with
+/// a single XACK after the callback returns. The acknowledgement of a batch is
+/// sent together with the read of the next one, so processing of a batch
+/// costs a single round trip to the server. The stream key routes all the
+/// commands to the same shard in cluster mode.
+///
+/// The entries that were delivered to this consumer, but were not
+/// acknowledged (e.g. before a restart or because the callback has thrown),
+/// are processed before the new ones. If `claim_min_idle_time` is set, the
+/// consumer claims the entries stuck in the pending lists of the other
+/// consumers of the group with XAUTOCLAIM when it has nothing else to do.
+///
+/// Delivery is at-least-once, the callback should be idempotent.
+///
+/// The consumer polls the stream instead of using blocking reads, as the
+/// blocking command would delay all the other requests sent over the same
+/// connection.
+///
+/// @warning Start and Stop may be called multiple times, but only in
+/// "start-stop" order and **NOT** concurrently.
+///
+/// @see components::RedisStreamConsumer
+// clang-format on
+class StreamConsumer final {
+public:
+    /// @brief Callback that is invoked on each batch of entries.
+    /// @note If the callback throws, the whole batch is passed to it again
+    /// after `restart_after_failure_delay`.
+    using Callback = std::function<void(const std::vector<StreamEntry>&)>;
+
+    StreamConsumer(ClientPtr client, StreamConsumerSettings settings, engine::TaskProcessor& task_processor);
+
+    /// @brief Stops the consumer (if not yet stopped).
+    ~StreamConsumer();
+
+    StreamConsumer(const StreamConsumer&) = delete;
+    StreamConsumer& operator=(const StreamConsumer&) = delete;
+
+    /// @brief Creates the consumer group if needed and starts reading the
+    /// stream.
+    void Start(Callback callback);
+
+    /// @brief Stops reading the stream, waits for the running callback and
+    /// for the acknowledgement of the last processed batch.
+    void Stop() noexcept;
+
+    const StreamConsumerSettings& GetSettings() const noexcept { return settings_; }
+
+    friend void DumpMetric(utils::statistics::Writer& writer, const StreamConsumer& consumer);
+
+private:
+    void Run(const Callback& callback);
+    void CreateGroup();
+    std::vector<StreamEntry> Claim(std::string& start_id, std::chrono::steady_clock::time_point& next_claim);
+    bool Process(const Callback& callback, const std::vector<StreamEntry>& entries);
+
+    const ClientPtr client_;
+    const StreamConsumerSettings settings_;
+    engine::TaskProcessor& task_processor_;
+
+    utils::statistics::RateCounter batches_{0};
+    utils::statistics::RateCounter entries_{0};
+    utils::statistics::RateCounter failed_batches_{0};
+    utils::statistics::RateCounter claimed_entries_{0};
+    utils::statistics::RateCounter deleted_entries_{0};
+    utils::statistics::RateCounter errors_{0};
+
+    engine::TaskWithResult<void> task_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
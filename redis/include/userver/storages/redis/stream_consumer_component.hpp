@@ -0,0 +1,91 @@
+#pragma once
+
+/// @file userver/storages/redis/stream_consumer_component.hpp
+/// @brief @copybrief components::RedisStreamConsumer
+
+#include <string_view>
+
+#include <userver/components/component_base.hpp>
+#include <userver/components/component_fwd.hpp>
+#include <userver/storages/redis/stream_consumer.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Redis stream consumer component
+///
+/// Holds a storages::redis::StreamConsumer that reads a stream of a cluster
+/// of the components::Redis component as a member of a consumer group.
+///
+/// The user component starts the consumer with its callback and must stop it
+/// in its destructor, as the callback usually captures `this`:
+///
+/// @code
+/// MyConsumer::MyConsumer(const ComponentConfig& config, const ComponentContext& context)
+///     : ComponentBase(config, context),
+///       consumer_(context.FindComponent<components::RedisStreamConsumer>().GetConsumer()) {
+///     consumer_.Start([this](const std::vector<storages::redis::StreamEntry>& entries) { Process(entries); });
+/// }
+///
+/// MyConsumer::~MyConsumer() { consumer_.Stop(); }
+/// @endcode
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// db | name of the redis cluster in components::Redis | -
+/// stream | key of the stream | -
+/// group | consumer group, created on start if it does not exist | -
+/// consumer | name of the consumer in the group, must be unique among the running consumers | host name
+/// group_start_id | id of the last entry considered delivered to the group when the group is created, "$" skips the entries added before the creation | $
+/// batch_size | maximum number of entries passed to a single callback call | 100
+/// poll_interval | delay before the next read when there are no entries to process | 100ms
+/// restart_after_failure_delay | delay before reprocessing the batch the callback failed on | 1s
+/// claim_min_idle_time | entries pending for the other consumers for longer than that are claimed, claiming is disabled if not set | -
+/// task_processor | task processor to run the callback on | main-task-processor
+///
+/// ## Static configuration example:
+///
+/// ```
+///    # yaml
+///    redis-stream-consumer:
+///        db: hello_service_events
+///        stream: events
+///        group: hello_service
+///        batch_size: 500
+///        claim_min_idle_time: 1m
+/// ```
+
+// clang-format on
+class RedisStreamConsumer final : public ComponentBase {
+public:
+    /// @ingroup userver_component_names
+    /// @brief The default name of components::RedisStreamConsumer
+    static constexpr std::string_view kName = "redis-stream-consumer";
+
+    RedisStreamConsumer(const ComponentConfig& config, const ComponentContext& context);
+    ~RedisStreamConsumer() override;
+
+    storages::redis::StreamConsumer& GetConsumer() { return consumer_; }
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    storages::redis::StreamConsumer consumer_;
+
+    // Subscriptions must be the last fields! Add new fields above this comment.
+    utils::statistics::Entry statistics_holder_;
+};
+
+template <>
+inline constexpr bool kHasValidate<RedisStreamConsumer> = true;
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
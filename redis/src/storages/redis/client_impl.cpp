@@ -2,6 +2,8 @@
 
 #include <userver/utils/assert.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
+#include <storages/redis/impl/read_batcher.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 
 #include "impl/command_control_impl.hpp"
@@ -29,6 +31,10 @@ const std::string kScanCommandName<ScanTag::kHscan> = "hscan";
 template <>
 const std::string kScanCommandName<ScanTag::kZscan> = "zscan";
 
+ReplyPtr MakeCachedReply(std::string cmd, impl::ClientSideCache::Value&& value) {
+    return std::make_shared<Reply>(std::move(cmd), value ? ReplyData{std::move(*value)} : ReplyData::CreateNil());
+}
+
 void DoCheckShard(size_t shard, std::optional<size_t> force_shard_idx) {
     if (force_shard_idx && *force_shard_idx != shard)
         throw InvalidArgumentException(
@@ -40,7 +46,10 @@ void DoCheckShard(size_t shard, std::optional<size_t> force_shard_idx) {
 }  // namespace
 
 ClientImpl::ClientImpl(std::shared_ptr<impl::Sentinel> sentinel, std::optional<size_t> force_shard_idx)
-    : redis_client_(std::move(sentinel)), force_shard_idx_(force_shard_idx) {}
+    : redis_client_(std::move(sentinel)),
+      force_shard_idx_(force_shard_idx),
+      client_side_cache_(redis_client_->GetClientSideCache()),
+      read_batcher_(redis_client_->GetReadBatcher()) {}
 
 void ClientImpl::WaitConnectedOnce(RedisWaitConnected wait_connected) {
     redis_client_->WaitConnectedOnce(wait_connected);
@@ -347,9 +356,15 @@ RequestGeosearch ClientImpl::Geosearch(
 
 RequestGet ClientImpl::Get(std::string key, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
-    return CreateRequest<RequestGet>(
-        MakeRequest(CmdArgs{"get", std::move(key)}, shard, false, GetCommandControl(command_control))
-    );
+    if (UseClientSideCache(command_control)) {
+        if (auto value = client_side_cache_->Get(key)) {
+            return CreateDummyRequest<RequestGet>(MakeCachedReply("get", std::move(*value)));
+        }
+        const auto token = client_side_cache_->StartFill(key);
+        auto request = MakeGetRequest(key, shard, command_control);
+        return CreateCachingRequest<RequestGet>(std::move(request), client_side_cache_, std::move(key), {}, token);
+    }
+    return CreateRequest<RequestGet>(MakeGetRequest(std::move(key), shard, command_control));
 }
 
 RequestGetset ClientImpl::Getset(std::string key, std::string value, const CommandControl& command_control) {
@@ -383,9 +398,17 @@ RequestHexists ClientImpl::Hexists(std::string key, std::string field, const Com
 
 RequestHget ClientImpl::Hget(std::string key, std::string field, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
-    return CreateRequest<RequestHget>(
-        MakeRequest(CmdArgs{"hget", std::move(key), std::move(field)}, shard, false, GetCommandControl(command_control))
-    );
+    if (UseClientSideCache(command_control)) {
+        if (auto value = client_side_cache_->Hget(key, field)) {
+            return CreateDummyRequest<RequestHget>(MakeCachedReply("hget", std::move(*value)));
+        }
+        const auto token = client_side_cache_->StartFill(key);
+        auto request = MakeHgetRequest(key, field, shard, command_control);
+        return CreateCachingRequest<RequestHget>(
+            std::move(request), client_side_cache_, std::move(key), std::move(field), token
+        );
+    }
+    return CreateRequest<RequestHget>(MakeHgetRequest(std::move(key), std::move(field), shard, command_control));
 }
 
 RequestHgetall ClientImpl::Hgetall(std::string key, const CommandControl& command_control) {
@@ -886,6 +909,101 @@ RequestType ClientImpl::Type(std::string key, const CommandControl& command_cont
     );
 }
 
+RequestXack ClientImpl::Xack(
+    std::string key,
+    std::string group,
+    std::vector<std::string> ids,
+    const CommandControl& command_control
+) {
+    if (ids.empty()) return CreateDummyRequest<RequestXack>(std::make_shared<Reply>("xack", 0));
+    auto shard = ShardByKey(key, command_control);
+    return CreateRequest<RequestXack>(MakeRequest(
+        CmdArgs{"xack", std::move(key), std::move(group), std::move(ids)},
+        shard,
+        true,
+        GetCommandControl(command_control)
+    ));
+}
+
+RequestXadd ClientImpl::Xadd(
+    std::string key,
+    std::vector<std::pair<std::string, std::string>> field_values,
+    const XaddOptions& options,
+    const CommandControl& command_control
+) {
+    UINVARIANT(!field_values.empty(), "Stream entry must have at least one field");
+    auto shard = ShardByKey(key, command_control);
+    return CreateRequest<RequestXadd>(MakeRequest(
+        CmdArgs{"xadd", std::move(key), options, "*", std::move(field_values)},
+        shard,
+        true,
+        GetCommandControl(command_control)
+    ));
+}
+
+RequestXautoclaim ClientImpl::Xautoclaim(
+    std::string key,
+    std::string group,
+    std::string consumer,
+    std::chrono::milliseconds min_idle_time,
+    std::string start,
+    const XautoclaimOptions& options,
+    const CommandControl& command_control
+) {
+    auto shard = ShardByKey(key, command_control);
+    return CreateRequest<RequestXautoclaim>(MakeRequest(
+        CmdArgs{
+            "xautoclaim",
+            std::move(key),
+            std::move(group),
+            std::move(consumer),
+            min_idle_time.count(),
+            std::move(start),
+            options},
+        shard,
+        true,
+        GetCommandControl(command_control)
+    ));
+}
+
+RequestXgroupCreate
+ClientImpl::XgroupCreate(std::string key, std::string group, std::string id, const CommandControl& command_control) {
+    auto shard = ShardByKey(key, command_control);
+    return CreateRequest<RequestXgroupCreate>(MakeRequest(
+        CmdArgs{"xgroup", "create", std::move(key), std::move(group), std::move(id), "mkstream"},
+        shard,
+        true,
+        GetCommandControl(command_control)
+    ));
+}
+
+RequestXreadgroup ClientImpl::Xreadgroup(
+    std::string key,
+    std::string group,
+    std::string consumer,
+    std::string id,
+    const XreadgroupOptions& options,
+    const CommandControl& command_control
+) {
+    auto shard = ShardByKey(key, command_control);
+    // Reading adds the entries to the pending entries list of the group, so
+    // the command is sent to the master
+    return CreateRequest<RequestXreadgroup>(MakeRequest(
+        CmdArgs{
+            "xreadgroup",
+            "group",
+            std::move(group),
+            std::move(consumer),
+            options,
+            "streams",
+            std::move(key),
+            std::move(id)},
+        shard,
+        true,
+        GetCommandControl(command_control)
+    ));
+}
+
 RequestZadd ClientImpl::Zadd(std::string key, double score, std::string member, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
     return CreateRequest<RequestZadd>(MakeRequest(
@@ -1170,10 +1288,41 @@ impl::Request ClientImpl::MakeRequest(
     return redis_client_->MakeRequest(std::move(args), shard, master, command_control, replies_to_skip);
 }
 
+impl::Request ClientImpl::MakeGetRequest(std::string key, size_t shard, const CommandControl& command_control) {
+    auto cc = GetCommandControl(command_control);
+    if (read_batcher_ && cc.allow_read_batching.value_or(false)) {
+        return read_batcher_->Get(std::move(key), shard, cc);
+    }
+    return MakeRequest(CmdArgs{"get", std::move(key)}, shard, false, cc);
+}
+
+impl::Request ClientImpl::MakeHgetRequest(
+    std::string key,
+    std::string field,
+    size_t shard,
+    const CommandControl& command_control
+) {
+    auto cc = GetCommandControl(command_control);
+    if (read_batcher_ && cc.allow_read_batching.value_or(false)) {
+        return read_batcher_->Hget(std::move(key), std::move(field), shard, cc);
+    }
+    return MakeRequest(CmdArgs{"hget", std::move(key), std::move(field)}, shard, false, cc);
+}
+
 CommandControl ClientImpl::GetCommandControl(const CommandControl& cc) const {
     return redis_client_->GetCommandControl(cc);
 }
 
+bool ClientImpl::UseClientSideCache(const CommandControl& cc) const {
+    if (!client_side_cache_ || force_shard_idx_) return false;
+
+    // The cached reply may come from any server of the shard, explicitly
+    // routed reads go to the server
+    const auto merged_cc = GetCommandControl(cc);
+    return !merged_cc.force_shard_idx && !merged_cc.force_server_id &&
+           !merged_cc.force_request_to_master.value_or(false) && !merged_cc.force_retries_to_master_on_nil_reply;
+}
+
 size_t ClientImpl::GetPublishShard(PubShard policy, const PublishSettings& settings) {
     if (force_shard_idx_) {
         return *force_shard_idx_;
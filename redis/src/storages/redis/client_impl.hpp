@@ -18,7 +18,9 @@
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis::impl {
+class ClientSideCache;
 class CmdArgs;
+class ReadBatcher;
 class Sentinel;
 }  // namespace storages::redis::impl
 
@@ -322,6 +324,42 @@ public:
 
     RequestType Type(std::string key, const CommandControl& command_control) override;
 
+    RequestXack Xack(
+        std::string key,
+        std::string group,
+        std::vector<std::string> ids,
+        const CommandControl& command_control
+    ) override;
+
+    RequestXadd Xadd(
+        std::string key,
+        std::vector<std::pair<std::string, std::string>> field_values,
+        const XaddOptions& options,
+        const CommandControl& command_control
+    ) override;
+
+    RequestXautoclaim Xautoclaim(
+        std::string key,
+        std::string group,
+        std::string consumer,
+        std::chrono::milliseconds min_idle_time,
+        std::string start,
+        const XautoclaimOptions& options,
+        const CommandControl& command_control
+    ) override;
+
+    RequestXgroupCreate
+    XgroupCreate(std::string key, std::string group, std::string id, const CommandControl& command_control) override;
+
+    RequestXreadgroup Xreadgroup(
+        std::string key,
+        std::string group,
+        std::string consumer,
+        std::string id,
+        const XreadgroupOptions& options,
+        const CommandControl& command_control
+    ) override;
+
     RequestZadd Zadd(std::string key, double score, std::string member, const CommandControl& command_control) override;
 
     RequestZadd Zadd(
@@ -439,6 +477,11 @@ private:
         size_t replies_to_skip = 0
     );
 
+    // GET and HGET that may be batched with the concurrent reads
+    impl::Request MakeGetRequest(std::string key, size_t shard, const CommandControl& command_control);
+    impl::Request
+    MakeHgetRequest(std::string key, std::string field, size_t shard, const CommandControl& command_control);
+
     template <typename T, typename Func>
     auto MakeRequestChunks(size_t max_chunk_size, std::vector<T>&& args, Func&& func) {
         std::vector<impl::Request> requests;
@@ -458,6 +501,8 @@ private:
 
     CommandControl GetCommandControl(const CommandControl& cc) const;
 
+    bool UseClientSideCache(const CommandControl& cc) const;
+
     size_t GetPublishShard(PubShard policy, const PublishSettings& settings);
 
     size_t ShardByKey(const std::string& key, const CommandControl& cc) const;
@@ -467,6 +512,8 @@ private:
     std::shared_ptr<impl::Sentinel> redis_client_;
     std::atomic<int> publish_shard_{0};
     const std::optional<size_t> force_shard_idx_;
+    const std::shared_ptr<impl::ClientSideCache> client_side_cache_;
+    const std::shared_ptr<impl::ReadBatcher> read_batcher_;
 };
 
 }  // namespace storages::redis
@@ -1,8 +1,15 @@
 #include <storages/redis/client_redistest.hpp>
 
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/wait_any.hpp>
 
+#include <userver/storages/redis/stream_consumer.hpp>
+
+#include <storages/redis/impl/client_side_cache.hpp>
+#include <storages/redis/impl/read_batcher.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -895,4 +902,184 @@ UTEST_F(RedisClientTest, WaitAny) {
     EXPECT_EQ(finished, kReqCount);
 }
 
+UTEST_F(RedisClientTest, ClientSideCache) {
+    constexpr Version since{6, 0, 0};
+    if (!CheckVersion(since)) GTEST_SKIP() << SkipMsgByVersion("CLIENT TRACKING", since);
+
+    const auto cache = std::make_shared<storages::redis::impl::ClientSideCache>(1024 * 1024);
+    GetSentinel()->SetClientSideCache(cache);
+    const auto client = std::make_shared<storages::redis::ClientImpl>(GetSentinel());
+
+    const auto deadline = engine::Deadline::FromDuration(std::chrono::seconds{10});
+    while (!cache->GetStatistics().tracking_connections && !deadline.IsReached()) {
+        engine::SleepFor(std::chrono::milliseconds{10});
+    }
+    ASSERT_NE(cache->GetStatistics().tracking_connections, 0);
+
+    client->Set("key", "v1", {}).Get();
+    client->Hset("hash", "field", "v1", {}).Get();
+    EXPECT_EQ(client->Get("key", {}).Get(), "v1");
+    EXPECT_EQ(client->Hget("hash", "field", {}).Get(), "v1");
+    EXPECT_EQ(client->Get("missing", {}).Get(), std::nullopt);
+
+    EXPECT_EQ(client->Get("key", {}).Get(), "v1");
+    EXPECT_EQ(client->Hget("hash", "field", {}).Get(), "v1");
+    EXPECT_EQ(client->Get("missing", {}).Get(), std::nullopt);
+    EXPECT_EQ(cache->GetStatistics().hits.value, 3);
+
+    // Explicitly routed reads bypass the cache
+    storages::redis::CommandControl to_master;
+    to_master.force_request_to_master = true;
+    EXPECT_EQ(client->Get("key", to_master).Get(), "v1");
+    EXPECT_EQ(client->Hget("hash", "field", to_master).Get(), "v1");
+    EXPECT_EQ(cache->GetStatistics().hits.value, 3);
+
+    client->Set("key", "v2", {}).Get();
+    client->Hset("hash", "field", "v2", {}).Get();
+    while ((client->Get("key", {}).Get() != "v2" || client->Hget("hash", "field", {}).Get() != "v2") &&
+           !deadline.IsReached()) {
+        engine::SleepFor(std::chrono::milliseconds{10});
+    }
+    EXPECT_EQ(client->Get("key", {}).Get(), "v2");
+    EXPECT_EQ(client->Hget("hash", "field", {}).Get(), "v2");
+    EXPECT_GE(cache->GetStatistics().invalidations.value, 2);
+}
+
+UTEST_F(RedisClientTest, ReadBatching) {
+    constexpr std::size_t kMaxBatchSize = 4;
+    GetSentinel()->EnableReadBatching({std::chrono::milliseconds{10}, kMaxBatchSize});
+    const auto client = std::make_shared<storages::redis::ClientImpl>(GetSentinel());
+    storages::redis::CommandControl batched;
+    batched.allow_read_batching = true;
+
+    client->Set("k1", "v1", {}).Get();
+    client->Set("k2", "v2", {}).Get();
+    client->Hset("hash", "f1", "v1", {}).Get();
+
+    auto get1 = client->Get("k1", batched);
+    auto get2 = client->Get("k2", batched);
+    auto get_again = client->Get("k1", batched);
+    auto get_missing = client->Get("missing", batched);
+    auto hget1 = client->Hget("hash", "f1", batched);
+    auto hget_missing = client->Hget("hash", "missing", batched);
+    auto hget_no_hash = client->Hget("no_hash", "f1", batched);
+
+    EXPECT_EQ(get1.Get(), "v1");
+    EXPECT_EQ(get2.Get(), "v2");
+    EXPECT_EQ(get_again.Get(), "v1");
+    EXPECT_EQ(get_missing.Get(), std::nullopt);
+    EXPECT_EQ(hget1.Get(), "v1");
+    EXPECT_EQ(hget_missing.Get(), std::nullopt);
+    EXPECT_EQ(hget_no_hash.Get(), std::nullopt);
+
+    // Type errors of the whole batch are reported by every read
+    client->Rpush("list", "a", {}).Get();
+    auto hget_list1 = client->Hget("list", "f1", batched);
+    auto hget_list2 = client->Hget("list", "f2", batched);
+    EXPECT_THROW(hget_list1.Get(), storages::redis::ParseReplyException);
+    EXPECT_THROW(hget_list2.Get(), storages::redis::ParseReplyException);
+
+    // MGET returns nil for a key of another type, GET fails with WRONGTYPE
+    auto get_list = client->Get("list", batched);
+    auto get_list_with_other = client->Get("k1", batched);
+    EXPECT_EQ(get_list.Get(), std::nullopt);
+    EXPECT_EQ(get_list_with_other.Get(), "v1");
+    // Regardless of the number of reads in the batch
+    EXPECT_EQ(client->Get("list", batched).Get(), std::nullopt);
+    EXPECT_THROW(client->Get("list", {}).Get(), storages::redis::ParseReplyException);
+
+    const auto stats = GetSentinel()->GetReadBatcher()->GetStatistics();
+    EXPECT_GE(stats.batched_reads.value, 11);
+    EXPECT_LT(stats.batches.value, stats.batched_reads.value);
+    EXPECT_GE(stats.deduplicated_reads.value, 1);
+
+    // Not batched without the explicit permission
+    const auto batched_reads = stats.batched_reads.value;
+    EXPECT_EQ(client->Get("k1", {}).Get(), "v1");
+    EXPECT_EQ(client->Hget("hash", "f1", {}).Get(), "v1");
+    EXPECT_EQ(GetSentinel()->GetReadBatcher()->GetStatistics().batched_reads.value, batched_reads);
+}
+
+UTEST_F(RedisClientTest, Streams) {
+    const auto client = GetClient();
+    using storages::redis::StreamEntry;
+
+    EXPECT_EQ(client->XgroupCreate("stream", "group", "$", {}).Get(), storages::redis::XgroupCreateReply::kCreated);
+    EXPECT_EQ(
+        client->XgroupCreate("stream", "group", "$", {}).Get(), storages::redis::XgroupCreateReply::kGroupExists
+    );
+
+    const auto id1 = client->Xadd("stream", {{"f1", "v1"}, {"f2", "v2"}}, {}, {}).Get();
+    const auto id2 = client->Xadd("stream", {{"f1", "v3"}}, {}, {}).Get();
+    const auto id3 = client->Xadd("stream", {{"f1", "v4"}}, {}, {}).Get();
+
+    auto entries = client->Xreadgroup("stream", "group", "c1", ">", {2, std::nullopt, false}, {}).Get();
+    EXPECT_EQ(entries, (std::vector<StreamEntry>{{id1, {{"f1", "v1"}, {"f2", "v2"}}}, {id2, {{"f1", "v3"}}}}));
+
+    // Pending entries of the consumer are read by id
+    entries = client->Xreadgroup("stream", "group", "c1", "0", {}, {}).Get();
+    EXPECT_EQ(entries.size(), 2);
+    EXPECT_EQ(client->Xack("stream", "group", {id1}, {}).Get(), 1);
+    EXPECT_EQ(client->Xack("stream", "group", {}, {}).Get(), 0);
+    entries = client->Xreadgroup("stream", "group", "c1", "0", {}, {}).Get();
+    ASSERT_EQ(entries.size(), 1);
+    EXPECT_EQ(entries[0].id, id2);
+
+    // id2 is pending for c1, id3 was not delivered yet
+    const auto claimed =
+        client->Xautoclaim("stream", "group", "c2", std::chrono::milliseconds{0}, "0-0", {}, {}).Get();
+    ASSERT_EQ(claimed.entries.size(), 1);
+    EXPECT_EQ(claimed.entries[0].id, id2);
+    EXPECT_TRUE(client->Xreadgroup("stream", "group", "c1", "0", {}, {}).Get().empty());
+
+    entries = client->Xreadgroup("stream", "group", "c2", ">", {}, {}).Get();
+    ASSERT_EQ(entries.size(), 1);
+    EXPECT_EQ(entries[0].id, id3);
+    EXPECT_TRUE(client->Xreadgroup("stream", "group", "c2", ">", {}, {}).Get().empty());
+    EXPECT_EQ(client->Xack("stream", "group", {id2, id3}, {}).Get(), 2);
+
+    storages::redis::XaddOptions trim_options;
+    trim_options.max_len = 1;
+    trim_options.approximate_trim = false;
+    client->Xadd("stream", {{"f1", "v5"}}, trim_options, {}).Get();
+    EXPECT_EQ(client->Xreadgroup("stream", "group", "c1", ">", {}, {}).Get().size(), 1);
+}
+
+UTEST_F(RedisClientTest, StreamConsumer) {
+    constexpr std::size_t kEntries = 50;
+    const auto client = GetClient();
+    for (std::size_t i = 0; i < kEntries; ++i) {
+        client->Xadd("stream", {{"n", std::to_string(i)}}, {}, {}).Get();
+    }
+
+    storages::redis::StreamConsumerSettings settings;
+    settings.stream = "stream";
+    settings.group = "group";
+    settings.consumer = "consumer";
+    settings.group_start_id = "0";
+    settings.batch_size = 8;
+    settings.poll_interval = std::chrono::milliseconds{10};
+    settings.restart_after_failure_delay = std::chrono::milliseconds{10};
+
+    std::atomic<std::size_t> processed{0};
+    std::atomic<bool> failed{false};
+    std::vector<std::string> values;
+    storages::redis::StreamConsumer consumer{client, settings, engine::current_task::GetTaskProcessor()};
+    consumer.Start([&](const std::vector<storages::redis::StreamEntry>& entries) {
+        EXPECT_LE(entries.size(), settings.batch_size);
+        // The failed batch is passed to the callback again
+        if (!failed.exchange(true)) throw std::runtime_error("first batch fails");
+        for (const auto& entry : entries) values.push_back(entry.fields.at(0).second);
+        processed += entries.size();
+    });
+
+    const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+    while (processed < kEntries && !deadline.IsReached()) engine::SleepFor(std::chrono::milliseconds{10});
+    consumer.Stop();
+
+    ASSERT_EQ(values.size(), kEntries);
+    for (std::size_t i = 0; i < kEntries; ++i) EXPECT_EQ(values[i], std::to_string(i));
+    EXPECT_TRUE(client->Xreadgroup("stream", "group", "consumer", "0", {}, {}).Get().empty());
+}
+
 USERVER_NAMESPACE_END
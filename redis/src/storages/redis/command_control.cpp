@@ -89,7 +89,28 @@ CommandControl::CommandControl(
 )
     : timeout_single(timeout_single), timeout_all(timeout_all), max_retries(max_retries) {}
 
-bool CommandControl::operator==(const CommandControl& other) const { return std::tie(*this) == std::tie(other); }
+bool CommandControl::operator==(const CommandControl& other) const {
+    const auto tie = [](const CommandControl& cc) {
+        return std::tie(
+            cc.timeout_single,
+            cc.timeout_all,
+            cc.max_retries,
+            cc.strategy,
+            cc.best_dc_count,
+            cc.force_request_to_master,
+            cc.max_ping_latency,
+            cc.allow_reads_from_master,
+            cc.account_in_statistics,
+            cc.force_shard_idx,
+            cc.chunk_size,
+            cc.force_server_id,
+            cc.allow_read_batching,
+            cc.force_retries_to_master_on_nil_reply,
+            cc.retry_counter
+        );
+    };
+    return tie(*this) == tie(other);
+}
 
 CommandControl CommandControl::MergeWith(const CommandControl& b) const {
     CommandControl res(*this);
@@ -129,6 +150,9 @@ CommandControl CommandControl::MergeWith(const CommandControl& b) const {
     if (b.force_server_id.has_value()) {
         res.force_server_id = b.force_server_id;
     }
+    if (b.allow_read_batching.has_value()) {
+        res.allow_read_batching = b.allow_read_batching;
+    }
     if (b.retry_counter && b.retry_counter > res.retry_counter) {
         res.retry_counter = b.retry_counter;
     }
@@ -1,5 +1,7 @@
 #include <userver/storages/redis/component.hpp>
 
+#include <chrono>
+#include <cstdint>
 #include <stdexcept>
 #include <vector>
 
@@ -26,7 +28,9 @@
 #include <userver/storages/redis/redis_config.hpp>
 #include <userver/storages/redis/subscribe_client.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/keyshard_impl.hpp>
+#include <storages/redis/impl/read_batcher.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 #include <storages/redis/impl/subscribe_sentinel.hpp>
 
@@ -65,6 +69,9 @@ struct RedisGroup {
     std::string config_name;
     std::string sharding_strategy;
     bool allow_reads_from_master{false};
+    std::size_t client_side_cache_max_size_bytes{0};
+    std::chrono::microseconds read_batching_window{0};
+    std::size_t read_batching_max_size{64};
 };
 
 RedisGroup Parse(const yaml_config::YamlConfig& value, formats::parse::To<RedisGroup>) {
@@ -73,6 +80,9 @@ RedisGroup Parse(const yaml_config::YamlConfig& value, formats::parse::To<RedisG
     config.config_name = value["config_name"].As<std::string>();
     config.sharding_strategy = value["sharding_strategy"].As<std::string>("");
     config.allow_reads_from_master = value["allow_reads_from_master"].As<bool>(false);
+    config.client_side_cache_max_size_bytes = value["client_side_cache_max_size_bytes"].As<std::size_t>(0);
+    config.read_batching_window = std::chrono::microseconds{value["read_batching_window_us"].As<std::int64_t>(0)};
+    config.read_batching_max_size = value["read_batching_max_size"].As<std::size_t>(64);
     return config;
 }
 
@@ -217,6 +227,14 @@ void Redis::Connect(
         );
         if (sentinel) {
             sentinels_.emplace(redis_group.db, sentinel);
+            if (redis_group.client_side_cache_max_size_bytes) {
+                sentinel->SetClientSideCache(std::make_shared<storages::redis::impl::ClientSideCache>(
+                    redis_group.client_side_cache_max_size_bytes
+                ));
+            }
+            if (redis_group.read_batching_window.count() > 0) {
+                sentinel->EnableReadBatching({redis_group.read_batching_window, redis_group.read_batching_max_size});
+            }
             const auto& client = std::make_shared<storages::redis::ClientImpl>(sentinel);
             clients_.emplace(redis_group.db, client);
         } else {
@@ -386,6 +404,26 @@ properties:
                     type: boolean
                     description: allows read requests from master instance
                     defaultDescription: false
+                client_side_cache_max_size_bytes:
+                    type: integer
+                    description: |
+                        memory limit of the client side cache of GET and HGET replies
+                        kept coherent by CLIENT TRACKING (Redis >= 6.0), 0 disables the cache
+                    defaultDescription: 0
+                    minimum: 0
+                read_batching_window_us:
+                    type: integer
+                    description: |
+                        time in microseconds a GET or HGET with CommandControl::allow_read_batching set
+                        waits for the concurrent reads to the same shard to be sent with them as a single
+                        MGET or HMGET, 0 disables the batching
+                    defaultDescription: 0
+                    minimum: 0
+                read_batching_max_size:
+                    type: integer
+                    description: a batch is sent without waiting for the window when it gets that many reads
+                    defaultDescription: 64
+                    minimum: 1
     metrics_level:
         type: string
         description: set metrics detail level
@@ -0,0 +1,202 @@
+#include <storages/redis/impl/client_side_cache.hpp>
+
+#include <iterator>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::impl {
+
+namespace {
+
+// Approximate memory used by the entry and its node in the LRU besides
+// the strings
+constexpr std::size_t kEntryOverheadBytes = 128;
+constexpr std::size_t kFieldOverheadBytes = 64;
+
+std::size_t ValueSize(const ClientSideCache::Value& value) { return value ? value->size() : 0; }
+
+}  // namespace
+
+ClientSideCache::ClientSideCache(std::size_t max_size_bytes)
+    : max_size_bytes_(max_size_bytes) {}
+
+std::optional<ClientSideCache::Value> ClientSideCache::Get(const std::string& key) {
+    const std::lock_guard lock{mutex_};
+    auto* entry = FindEntry(key);
+    if (!entry || !entry->value) {
+        ++misses_;
+        return std::nullopt;
+    }
+    ++hits_;
+    return entry->value;
+}
+
+std::optional<ClientSideCache::Value> ClientSideCache::Hget(const std::string& key, const std::string& field) {
+    const std::lock_guard lock{mutex_};
+    auto* entry = FindEntry(key);
+    if (!entry) {
+        ++misses_;
+        return std::nullopt;
+    }
+    const auto it = entry->fields.find(field);
+    if (it == entry->fields.end()) {
+        ++misses_;
+        return std::nullopt;
+    }
+    ++hits_;
+    return it->second;
+}
+
+ClientSideCache::FillToken ClientSideCache::StartFill(const std::string& key) {
+    const std::lock_guard lock{mutex_};
+    const auto token = ++last_token_;
+    pending_fills_[key] = token;
+    return token;
+}
+
+void ClientSideCache::CancelFill(const std::string& key, FillToken token) {
+    const std::lock_guard lock{mutex_};
+    const auto it = pending_fills_.find(key);
+    if (it != pending_fills_.end() && it->second == token) pending_fills_.erase(it);
+}
+
+void ClientSideCache::CompleteGet(const std::string& key, FillToken token, const ServerId& server_id, Value value) {
+    const std::lock_guard lock{mutex_};
+    auto* entry = PrepareFill(key, token, server_id);
+    if (!entry) return;
+
+    const auto new_size = entry->size_bytes - ValueSize(entry->value.value_or(Value{})) + ValueSize(value);
+    entry->value = std::move(value);
+    AccountSize(*entry, new_size);
+    EvictOverflow();
+}
+
+void ClientSideCache::CompleteHget(
+    const std::string& key,
+    const std::string& field,
+    FillToken token,
+    const ServerId& server_id,
+    Value value
+) {
+    const std::lock_guard lock{mutex_};
+    auto* entry = PrepareFill(key, token, server_id);
+    if (!entry) return;
+
+    auto new_size = entry->size_bytes + ValueSize(value);
+    auto [it, inserted] = entry->fields.try_emplace(field);
+    if (inserted) {
+        new_size += field.size() + kFieldOverheadBytes;
+    } else {
+        new_size -= ValueSize(it->second);
+    }
+    it->second = std::move(value);
+    AccountSize(*entry, new_size);
+    EvictOverflow();
+}
+
+void ClientSideCache::Invalidate(const std::vector<std::string>& keys) {
+    const std::lock_guard lock{mutex_};
+    for (const auto& key : keys) {
+        pending_fills_.erase(key);
+        const auto it = index_.find(key);
+        if (it == index_.end()) continue;
+        EraseEntry(it->second);
+        ++invalidations_;
+    }
+}
+
+void ClientSideCache::InvalidateAll() {
+    const std::lock_guard lock{mutex_};
+    ClearLocked();
+}
+
+void ClientSideCache::OnTrackingStarted(const ServerId& server_id) {
+    const std::lock_guard lock{mutex_};
+    // Only the requests started after this point are sent after
+    // the `CLIENT TRACKING` command on this connection
+    tracking_servers_[server_id] = ++last_token_;
+}
+
+void ClientSideCache::OnTrackingStopped(const ServerId& server_id) {
+    const std::lock_guard lock{mutex_};
+    if (!tracking_servers_.erase(server_id)) return;
+    ClearLocked();
+}
+
+ClientSideCacheStatistics ClientSideCache::GetStatistics() const {
+    ClientSideCacheStatistics stats;
+    stats.hits = hits_.Load();
+    stats.misses = misses_.Load();
+    stats.rejected_fills = rejected_fills_.Load();
+    stats.invalidations = invalidations_.Load();
+    stats.flushes = flushes_.Load();
+    stats.evictions = evictions_.Load();
+
+    const std::lock_guard lock{mutex_};
+    stats.size_bytes = size_bytes_;
+    stats.entries = entries_.size();
+    stats.tracking_connections = tracking_servers_.size();
+    return stats;
+}
+
+ClientSideCache::Entry* ClientSideCache::FindEntry(const std::string& key) {
+    const auto it = index_.find(key);
+    if (it == index_.end()) return nullptr;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return &*it->second;
+}
+
+void ClientSideCache::EraseEntry(EntryList::iterator it) {
+    size_bytes_ -= it->size_bytes;
+    index_.erase(it->key);
+    entries_.erase(it);
+}
+
+ClientSideCache::Entry*
+ClientSideCache::PrepareFill(const std::string& key, FillToken token, const ServerId& server_id) {
+    const auto pending_it = pending_fills_.find(key);
+    const auto tracking_it = tracking_servers_.find(server_id);
+    const bool is_fresh = pending_it != pending_fills_.end() && pending_it->second == token;
+    if (is_fresh) pending_fills_.erase(pending_it);
+
+    if (!is_fresh || tracking_it == tracking_servers_.end() || tracking_it->second > token) {
+        ++rejected_fills_;
+        return nullptr;
+    }
+
+    auto* entry = FindEntry(key);
+    if (!entry) {
+        entries_.push_front(Entry{key, std::nullopt, {}, 0});
+        index_.emplace(entries_.front().key, entries_.begin());
+        entry = &entries_.front();
+        AccountSize(*entry, key.size() * 2 + kEntryOverheadBytes);
+    }
+    return entry;
+}
+
+void ClientSideCache::AccountSize(Entry& entry, std::size_t new_size_bytes) {
+    size_bytes_ = size_bytes_ - entry.size_bytes + new_size_bytes;
+    entry.size_bytes = new_size_bytes;
+}
+
+void ClientSideCache::EvictOverflow() {
+    while (size_bytes_ > max_size_bytes_ && !entries_.empty()) {
+        EraseEntry(std::prev(entries_.end()));
+        ++evictions_;
+    }
+    UASSERT(!entries_.empty() || size_bytes_ == 0);
+}
+
+void ClientSideCache::ClearLocked() {
+    index_.clear();
+    entries_.clear();
+    pending_fills_.clear();
+    size_bytes_ = 0;
+    ++flushes_;
+}
+
+}  // namespace storages::redis::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/storages/redis/command_control.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+#include <storages/redis/impl/redis_stats.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::impl {
+
+/// @brief Memory bounded cache of GET and HGET replies, kept coherent with the
+/// server by the `CLIENT TRACKING` invalidation messages.
+///
+/// The values are only accepted from the connections that were tracking keys
+/// before the request started. Any invalidation of the key that arrives while
+/// the request is in flight cancels the fill. Losing the tracking on any
+/// connection drops the whole cache, as the invalidation messages for it may
+/// have been lost.
+///
+/// Thread safe, invalidations are called from the ev threads.
+class ClientSideCache final {
+public:
+    using Value = std::optional<std::string>;
+    using FillToken = std::uint64_t;
+
+    explicit ClientSideCache(std::size_t max_size_bytes);
+
+    ClientSideCache(const ClientSideCache&) = delete;
+    ClientSideCache& operator=(const ClientSideCache&) = delete;
+
+    /// Returns the cached reply, a nullopt value stands for the cached nil
+    std::optional<Value> Get(const std::string& key);
+    std::optional<Value> Hget(const std::string& key, const std::string& field);
+
+    /// Must be called before sending the request that fills the key
+    FillToken StartFill(const std::string& key);
+    void CancelFill(const std::string& key, FillToken token);
+
+    void CompleteGet(const std::string& key, FillToken token, const ServerId& server_id, Value value);
+    void CompleteHget(
+        const std::string& key,
+        const std::string& field,
+        FillToken token,
+        const ServerId& server_id,
+        Value value
+    );
+
+    void Invalidate(const std::vector<std::string>& keys);
+    void InvalidateAll();
+
+    void OnTrackingStarted(const ServerId& server_id);
+    void OnTrackingStopped(const ServerId& server_id);
+
+    ClientSideCacheStatistics GetStatistics() const;
+
+private:
+    struct Entry {
+        std::string key;
+        std::optional<Value> value;
+        std::unordered_map<std::string, Value> fields;
+        std::size_t size_bytes{0};
+    };
+
+    using EntryList = std::list<Entry>;
+
+    // Returns the entry marked as recently used or nullptr
+    Entry* FindEntry(const std::string& key);
+    void EraseEntry(EntryList::iterator it);
+
+    // Returns the entry to fill or nullptr if the fill is stale
+    Entry* PrepareFill(const std::string& key, FillToken token, const ServerId& server_id);
+    void AccountSize(Entry& entry, std::size_t new_size_bytes);
+    void EvictOverflow();
+    void ClearLocked();
+
+    const std::size_t max_size_bytes_;
+
+    mutable std::mutex mutex_;
+    // The most recently used entries are in front, the keys of the index point
+    // into the entries
+    EntryList entries_;
+    std::unordered_map<std::string_view, EntryList::iterator> index_;
+    std::unordered_map<std::string, FillToken> pending_fills_;
+    std::unordered_map<ServerId, FillToken, ServerIdHasher> tracking_servers_;
+    FillToken last_token_{0};
+    std::size_t size_bytes_{0};
+
+    utils::statistics::RateCounter hits_{0};
+    utils::statistics::RateCounter misses_{0};
+    utils::statistics::RateCounter rejected_fills_{0};
+    utils::statistics::RateCounter invalidations_{0};
+    utils::statistics::RateCounter flushes_{0};
+    utils::statistics::RateCounter evictions_{0};
+};
+
+}  // namespace storages::redis::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,137 @@
+#include <storages/redis/impl/client_side_cache.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using storages::redis::ServerId;
+using storages::redis::impl::ClientSideCache;
+
+constexpr std::size_t kMaxSizeBytes = 64 * 1024;
+
+}  // namespace
+
+TEST(ClientSideCache, FillAndHit) {
+    ClientSideCache cache{kMaxSizeBytes};
+    const auto server_id = ServerId::Generate();
+    cache.OnTrackingStarted(server_id);
+
+    EXPECT_EQ(cache.Get("key"), std::nullopt);
+    const auto token = cache.StartFill("key");
+    cache.CompleteGet("key", token, server_id, "value");
+    EXPECT_EQ(cache.Get("key"), ClientSideCache::Value{"value"});
+
+    const auto hget_token = cache.StartFill("hash");
+    cache.CompleteHget("hash", "field", hget_token, server_id, std::nullopt);
+    const auto nil = cache.Hget("hash", "field");
+    ASSERT_TRUE(nil.has_value());
+    EXPECT_EQ(*nil, std::nullopt);
+    EXPECT_EQ(cache.Hget("hash", "other"), std::nullopt);
+    EXPECT_EQ(cache.Get("hash"), std::nullopt);
+
+    const auto stats = cache.GetStatistics();
+    EXPECT_EQ(stats.hits.value, 2);
+    EXPECT_EQ(stats.misses.value, 3);
+    EXPECT_EQ(stats.entries, 2);
+    EXPECT_EQ(stats.tracking_connections, 1);
+}
+
+TEST(ClientSideCache, InvalidationDuringFill) {
+    ClientSideCache cache{kMaxSizeBytes};
+    const auto server_id = ServerId::Generate();
+    cache.OnTrackingStarted(server_id);
+
+    const auto token = cache.StartFill("key");
+    cache.Invalidate({"key"});
+    cache.CompleteGet("key", token, server_id, "stale");
+    EXPECT_EQ(cache.Get("key"), std::nullopt);
+
+    const auto first = cache.StartFill("key");
+    const auto second = cache.StartFill("key");
+    cache.CompleteGet("key", first, server_id, "old");
+    EXPECT_EQ(cache.Get("key"), std::nullopt);
+    cache.CompleteGet("key", second, server_id, "new");
+    EXPECT_EQ(cache.Get("key"), ClientSideCache::Value{"new"});
+
+    cache.Invalidate({"key"});
+    EXPECT_EQ(cache.Get("key"), std::nullopt);
+    EXPECT_EQ(cache.GetStatistics().rejected_fills.value, 2);
+    EXPECT_EQ(cache.GetStatistics().invalidations.value, 1);
+}
+
+TEST(ClientSideCache, UntrackedServer) {
+    ClientSideCache cache{kMaxSizeBytes};
+    const auto server_id = ServerId::Generate();
+
+    auto token = cache.StartFill("key");
+    cache.CompleteGet("key", token, server_id, "value");
+    EXPECT_EQ(cache.Get("key"), std::nullopt);
+
+    // Requests started before the tracking may have been sent before
+    // CLIENT TRACKING on the connection
+    token = cache.StartFill("key");
+    cache.OnTrackingStarted(server_id);
+    cache.CompleteGet("key", token, server_id, "value");
+    EXPECT_EQ(cache.Get("key"), std::nullopt);
+
+    token = cache.StartFill("key");
+    cache.CompleteGet("key", token, ServerId::Generate(), "value");
+    EXPECT_EQ(cache.Get("key"), std::nullopt);
+}
+
+TEST(ClientSideCache, TrackingStoppedFlushes) {
+    ClientSideCache cache{kMaxSizeBytes};
+    const auto server_id = ServerId::Generate();
+    cache.OnTrackingStarted(server_id);
+
+    auto token = cache.StartFill("key");
+    cache.CompleteGet("key", token, server_id, "value");
+    const auto pending = cache.StartFill("other");
+
+    cache.OnTrackingStopped(server_id);
+    EXPECT_EQ(cache.Get("key"), std::nullopt);
+    cache.CompleteGet("other", pending, server_id, "value");
+    EXPECT_EQ(cache.Get("other"), std::nullopt);
+
+    cache.OnTrackingStarted(server_id);
+    token = cache.StartFill("key");
+    cache.CompleteGet("key", token, server_id, "value");
+    cache.InvalidateAll();
+    EXPECT_EQ(cache.Get("key"), std::nullopt);
+
+    const auto stats = cache.GetStatistics();
+    EXPECT_EQ(stats.flushes.value, 2);
+    EXPECT_EQ(stats.size_bytes, 0);
+    EXPECT_EQ(stats.entries, 0);
+}
+
+TEST(ClientSideCache, EvictsLeastRecentlyUsed) {
+    constexpr std::size_t kValueSize = 1024;
+    ClientSideCache cache{kValueSize * 4};
+    const auto server_id = ServerId::Generate();
+    cache.OnTrackingStarted(server_id);
+
+    const std::string value(kValueSize, 'x');
+    for (const auto* key : {"a", "b", "c"}) {
+        cache.CompleteGet(key, cache.StartFill(key), server_id, value);
+    }
+    EXPECT_TRUE(cache.Get("a").has_value());
+
+    cache.CompleteGet("d", cache.StartFill("d"), server_id, value);
+    EXPECT_FALSE(cache.Get("b").has_value());
+    EXPECT_TRUE(cache.Get("a").has_value());
+    EXPECT_TRUE(cache.Get("c").has_value());
+    EXPECT_TRUE(cache.Get("d").has_value());
+
+    const auto stats = cache.GetStatistics();
+    EXPECT_EQ(stats.evictions.value, 1);
+    EXPECT_LE(stats.size_bytes, kValueSize * 4);
+
+    cache.CompleteGet("huge", cache.StartFill("huge"), server_id, std::string(kValueSize * 8, 'x'));
+    EXPECT_FALSE(cache.Get("huge").has_value());
+    EXPECT_LE(cache.GetStatistics().size_bytes, kValueSize * 4);
+}
+
+USERVER_NAMESPACE_END
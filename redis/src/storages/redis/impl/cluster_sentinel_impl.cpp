@@ -348,6 +348,16 @@ public:
         }
     }
 
+    void SetClientSideCache(const std::shared_ptr<ClientSideCache>& cache) {
+        {
+            auto cache_ptr = client_side_cache_.Lock();
+            *cache_ptr = cache;
+        }
+        for (const auto& node : nodes_) {
+            node.second->SetClientSideCache(cache);
+        }
+    }
+
     void SetConnectionInfo(const std::vector<ConnectionInfoInt>& info_array) {
         sentinels_->SetConnectionInfo(info_array);
     }
@@ -428,6 +438,7 @@ private:
     concurrent::Variable<std::optional<CommandsBufferingSettings>, std::mutex> commands_buffering_settings_;
     concurrent::Variable<ReplicationMonitoringSettings, std::mutex> monitoring_settings_;
     concurrent::Variable<utils::RetryBudgetSettings, std::mutex> retry_budget_settings_;
+    concurrent::Variable<std::shared_ptr<ClientSideCache>, std::mutex> client_side_cache_;
     concurrent::Variable<std::unordered_set<HostPort>, std::mutex> nodes_to_create_;
     concurrent::Variable<std::unordered_set<HostPort>, std::mutex> actual_nodes_;
     // work only from sentinel thread so no need to synchronize it
@@ -659,6 +670,7 @@ std::shared_ptr<RedisConnectionHolder> ClusterTopologyHolder::CreateRedisInstanc
     const auto buffering_settings_ptr = commands_buffering_settings_.Lock();
     const auto replication_monitoring_settings_ptr = monitoring_settings_.Lock();
     const auto retry_budget_settings_ptr = retry_budget_settings_.Lock();
+    const auto client_side_cache_ptr = client_side_cache_.Lock();
     LOG_DEBUG() << "Create new redis instance " << host_port;
     return std::make_shared<RedisConnectionHolder>(
         ev_thread_,
@@ -668,7 +680,8 @@ std::shared_ptr<RedisConnectionHolder> ClusterTopologyHolder::CreateRedisInstanc
         GetPassword(),
         buffering_settings_ptr->value_or(CommandsBufferingSettings{}),
         *replication_monitoring_settings_ptr,
-        *retry_budget_settings_ptr
+        *retry_budget_settings_ptr,
+        *client_side_cache_ptr
     );
 }
 
@@ -1043,6 +1056,12 @@ void ClusterSentinelImpl::SetRetryBudgetSettings(const utils::RetryBudgetSetting
     }
 }
 
+void ClusterSentinelImpl::SetClientSideCache(const std::shared_ptr<ClientSideCache>& cache) {
+    if (topology_holder_) {
+        topology_holder_->SetClientSideCache(cache);
+    }
+}
+
 SentinelStatistics ClusterSentinelImpl::GetStatistics(const MetricsSettings& settings) const {
     if (!topology_holder_) {
         return {settings, {}};
@@ -65,6 +65,7 @@ public:
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings
     ) override;
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings) override;
+    void SetClientSideCache(const std::shared_ptr<ClientSideCache>& cache) override;
     PublishSettings GetPublishSettings() override;
 
     static size_t GetClusterSlotsCalledCounter();
@@ -155,6 +155,34 @@ void CmdWithArgs::PutArg(const ZaddOptions& arg) {
     if (arg.return_value == ZaddOptions::ReturnValue::kChangedCount) args_.emplace_back("CH");
 }
 
+void CmdWithArgs::PutArg(const XaddOptions& arg) {
+    if (arg.nomkstream) args_.emplace_back("NOMKSTREAM");
+    if (arg.max_len) {
+        args_.emplace_back("MAXLEN");
+        if (arg.approximate_trim) args_.emplace_back("~");
+        args_.emplace_back(std::to_string(arg.max_len));
+    }
+}
+
+void CmdWithArgs::PutArg(const XreadgroupOptions& arg) {
+    if (arg.count) {
+        args_.emplace_back("COUNT");
+        args_.emplace_back(std::to_string(*arg.count));
+    }
+    if (arg.block) {
+        args_.emplace_back("BLOCK");
+        args_.emplace_back(std::to_string(arg.block->count()));
+    }
+    if (arg.noack) args_.emplace_back("NOACK");
+}
+
+void CmdWithArgs::PutArg(const XautoclaimOptions& arg) {
+    if (arg.count) {
+        args_.emplace_back("COUNT");
+        args_.emplace_back(std::to_string(*arg.count));
+    }
+}
+
 void CmdWithArgs::PutArg(const ScoreOptions& arg) {
     if (arg.withscores) args_.emplace_back("WITHSCORES");
 }
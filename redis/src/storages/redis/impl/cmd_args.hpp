@@ -142,6 +142,9 @@ private:
     void PutArg(const SetOptions& arg);
     void PutArg(const ZaddOptions& arg);
     void PutArg(const ScanOptions& arg);
+    void PutArg(const XaddOptions& arg);
+    void PutArg(const XreadgroupOptions& arg);
+    void PutArg(const XautoclaimOptions& arg);
 
     void PutArg(const ScoreOptions& arg);
     void PutArg(const RangeOptions& arg);
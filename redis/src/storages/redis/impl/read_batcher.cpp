@@ -0,0 +1,301 @@
+#include <storages/redis/impl/read_batcher.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <string_view>
+#include <unordered_map>
+
+#include <boost/crc.hpp>
+
+#include <userver/logging/log.hpp>
+#include <userver/storages/redis/impl/keyshard.hpp>
+#include <userver/storages/redis/reply.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <storages/redis/impl/command.hpp>
+#include <storages/redis/impl/sentinel.hpp>
+
+#include "command_control_impl.hpp"
+#include "redis.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::impl {
+
+namespace {
+
+constexpr double kBatchSizeBounds[] = {1, 2, 4, 8, 16, 32, 64, 128, 256};
+
+size_t HashSlot(const std::string& key) {
+    size_t start = 0;
+    size_t len = 0;
+    GetRedisKey(key, &start, &len);
+    return std::for_each(key.data() + start, key.data() + start + len, boost::crc_optimal<16, 0x1021>())() & 0x3fff;
+}
+
+// Splits the reply of the batch command into the replies of the reads
+class Fanout final {
+public:
+    Fanout(
+        std::string cmd,
+        size_t args_count,
+        bool is_multi,
+        std::vector<engine::Promise<ReplyPtr>>&& promises,
+        std::vector<size_t>&& read_args
+    )
+        : cmd_(std::move(cmd)),
+          args_count_(args_count),
+          is_multi_(is_multi),
+          promises_(std::move(promises)),
+          read_args_(std::move(read_args)) {}
+
+    void OnReply(ReplyPtr reply) {
+        if (done_) {
+            LOG_LIMITED_WARNING() << "redis::Command keeps running after triggering the callback initially";
+            return;
+        }
+        done_ = true;
+
+        if (is_multi_ && reply->IsOk() && reply->data.IsArray()) {
+            if (reply->data.GetArray().size() == args_count_) {
+                Split(*reply);
+                return;
+            }
+            LOG_ERROR() << "Unexpected size of the reply to '" << reply->cmd << "' with " << args_count_
+                        << " arguments: " << reply->data.GetArray().size();
+            reply->status = ReplyStatus::kOtherError;
+        }
+
+        // Errors and replies to HGET are delivered as is, so that the reads
+        // report them as usual
+        for (size_t i = 0; i + 1 < promises_.size(); ++i) {
+            promises_[i].set_value(std::make_shared<Reply>(*reply));
+        }
+        promises_.back().set_value(std::move(reply));
+    }
+
+private:
+    void Split(Reply& reply) {
+        auto& array = reply.data.GetArray();
+        std::vector<size_t> uses(array.size());
+        for (const auto arg : read_args_) ++uses[arg];
+
+        for (size_t i = 0; i < promises_.size(); ++i) {
+            const auto arg = read_args_[i];
+            auto result = std::make_shared<Reply>(cmd_, ReplyData::CreateNil());
+            if (--uses[arg]) {
+                result->data = array[arg];
+            } else {
+                result->data = std::move(array[arg]);
+            }
+            result->server = reply.server;
+            result->server_id = reply.server_id;
+            result->time = reply.time;
+            promises_[i].set_value(std::move(result));
+        }
+    }
+
+    const std::string cmd_;
+    const size_t args_count_;
+    // MGET or HMGET
+    const bool is_multi_;
+    std::vector<engine::Promise<ReplyPtr>> promises_;
+    // Index of the argument of the batch command for each read
+    const std::vector<size_t> read_args_;
+    bool done_{false};
+};
+
+}  // namespace
+
+ReadBatcher::ReadBatcher(Sentinel& sentinel, engine::ev::ThreadPool& thread_pool, ReadBatchingSettings settings)
+    : sentinel_(sentinel),
+      settings_(settings),
+      thread_control_(thread_pool.NextThread()),
+      batch_size_(kBatchSizeBounds) {
+    UINVARIANT(settings_.window.count() > 0, "Read batching window must be positive");
+    UINVARIANT(settings_.max_batch_size > 0, "Read batch size must be positive");
+
+    wakeup_watcher_.data = this;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    ev_async_init(&wakeup_watcher_, OnWakeupEv);
+
+    timer_.data = this;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    ev_timer_init(&timer_, OnTimerEv, 0.0, 0.0);
+
+    thread_control_.RunInEvLoopBlocking([this] { thread_control_.Start(wakeup_watcher_); });
+}
+
+ReadBatcher::~ReadBatcher() {
+    thread_control_.RunInEvLoopBlocking([this] {
+        thread_control_.Stop(wakeup_watcher_);
+        thread_control_.Stop(timer_);
+    });
+}
+
+Request ReadBatcher::Get(std::string key, size_t shard, const CommandControl& command_control) {
+    // MGET keys must belong to the same hash slot in cluster mode
+    std::optional<size_t> slot;
+    if (sentinel_.IsInClusterMode()) slot = HashSlot(key);
+    return Enqueue(std::move(key), std::nullopt, slot, shard, command_control);
+}
+
+Request ReadBatcher::Hget(std::string key, std::string field, size_t shard, const CommandControl& command_control) {
+    return Enqueue(std::move(field), std::move(key), std::nullopt, shard, command_control);
+}
+
+ReadBatchingStatistics ReadBatcher::GetStatistics() const {
+    return {batches_.Load(), batched_reads_.Load(), deduplicated_reads_.Load(), batch_size_};
+}
+
+Request ReadBatcher::Enqueue(
+    std::string arg,
+    std::optional<std::string> hash_key,
+    std::optional<size_t> slot,
+    size_t shard,
+    const CommandControl& command_control
+) {
+    engine::Promise<ReplyPtr> promise;
+    auto future = promise.get_future();
+    const auto deadline =
+        engine::Deadline::FromDuration(CommandControlImpl{command_control}.timeout_all + settings_.window);
+
+    bool need_wakeup = false;
+    {
+        const std::lock_guard lock{mutex_};
+        auto it = std::find_if(pending_.begin(), pending_.end(), [&](const Batch& batch) {
+            return batch.shard == shard && batch.slot == slot && batch.hash_key == hash_key &&
+                   batch.command_control == command_control;
+        });
+        if (it == pending_.end()) {
+            it = pending_.insert(pending_.end(), Batch{shard, slot, std::move(hash_key), command_control, {}});
+        }
+        it->reads.push_back(Read{std::move(arg), std::move(promise)});
+
+        if (it->reads.size() >= settings_.max_batch_size) {
+            ready_.push_back(std::move(*it));
+            pending_.erase(it);
+            need_wakeup = true;
+        }
+        if (!flush_scheduled_) {
+            flush_scheduled_ = true;
+            need_wakeup = true;
+        }
+    }
+    if (need_wakeup) thread_control_.Send(wakeup_watcher_);
+
+    return Request{std::move(future), deadline};
+}
+
+void ReadBatcher::Send(std::vector<Batch> batches) {
+    for (auto& batch : batches) {
+        try {
+            Send(std::move(batch));
+        } catch (const std::exception& ex) {
+            LOG_ERROR() << "exception while sending redis read batch: " << ex;
+        }
+    }
+}
+
+void ReadBatcher::Send(Batch&& batch) {
+    UASSERT(!batch.reads.empty());
+
+    std::vector<std::string> args;
+    std::vector<size_t> read_args;
+    std::vector<engine::Promise<ReplyPtr>> promises;
+    read_args.reserve(batch.reads.size());
+    promises.reserve(batch.reads.size());
+    {
+        std::unordered_map<std::string_view, size_t> arg_indices;
+        for (auto& read : batch.reads) {
+            const auto [it, inserted] = arg_indices.emplace(read.arg, args.size());
+            if (inserted) args.push_back(read.arg);
+            read_args.push_back(it->second);
+            promises.push_back(std::move(read.promise));
+        }
+    }
+
+    ++batches_;
+    batched_reads_ += utils::statistics::Rate{batch.reads.size()};
+    deduplicated_reads_ += utils::statistics::Rate{batch.reads.size() - args.size()};
+    batch_size_.Account(batch.reads.size());
+
+    const auto args_count = args.size();
+    // A single GET is sent as MGET too, so that a key of another type results
+    // in nil regardless of the number of reads in the batch
+    const bool is_multi = !batch.hash_key || args_count > 1;
+    std::string cmd = batch.hash_key ? "hget" : "get";
+    CmdArgs cmd_args = [&] {
+        if (batch.hash_key) {
+            if (is_multi) return CmdArgs{"hmget", std::move(*batch.hash_key), std::move(args)};
+            return CmdArgs{"hget", std::move(*batch.hash_key), std::move(args.front())};
+        }
+        return CmdArgs{"mget", std::move(args)};
+    }();
+
+    // Sadly, we don't have std::move_only_function, so we need a shared_ptr.
+    auto fanout = std::make_shared<Fanout>(
+        std::move(cmd), args_count, is_multi, std::move(promises), std::move(read_args)
+    );
+    auto command = PrepareCommand(
+        std::move(cmd_args),
+        [fanout = std::move(fanout)](const CommandPtr&, ReplyPtr reply) { fanout->OnReply(std::move(reply)); },
+        batch.command_control
+    );
+    sentinel_.AsyncCommand(std::move(command), false, batch.shard);
+}
+
+void ReadBatcher::OnWakeup() {
+    std::vector<Batch> batches;
+    bool need_timer = false;
+    {
+        const std::lock_guard lock{mutex_};
+        batches.swap(ready_);
+        if (pending_.empty()) {
+            flush_scheduled_ = false;
+        } else {
+            need_timer = flush_scheduled_;
+        }
+    }
+    Send(std::move(batches));
+
+    if (need_timer && !ev_is_active(&timer_)) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+        ev_timer_set(&timer_, ToEvDuration(settings_.window), 0.0);
+        thread_control_.Start(timer_);
+    }
+}
+
+void ReadBatcher::OnTimer() {
+    std::vector<Batch> batches;
+    {
+        const std::lock_guard lock{mutex_};
+        batches.swap(ready_);
+        std::move(pending_.begin(), pending_.end(), std::back_inserter(batches));
+        pending_.clear();
+        flush_scheduled_ = false;
+    }
+    Send(std::move(batches));
+}
+
+void ReadBatcher::OnWakeupEv(struct ev_loop*, ev_async* w, int) noexcept {
+    auto* batcher = static_cast<ReadBatcher*>(w->data);
+    try {
+        batcher->OnWakeup();
+    } catch (const std::exception& ex) {
+        LOG_ERROR() << "exception while sending redis read batches: " << ex;
+    }
+}
+
+void ReadBatcher::OnTimerEv(struct ev_loop*, ev_timer* w, int) noexcept {
+    auto* batcher = static_cast<ReadBatcher*>(w->data);
+    try {
+        batcher->OnTimer();
+    } catch (const std::exception& ex) {
+        LOG_ERROR() << "exception while sending redis read batches: " << ex;
+    }
+}
+
+}  // namespace storages::redis::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <engine/ev/thread_control.hpp>
+#include <engine/ev/thread_pool.hpp>
+
+#include <userver/engine/future.hpp>
+#include <userver/storages/redis/command_control.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+#include <storages/redis/impl/redis_stats.hpp>
+#include <storages/redis/impl/request.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::impl {
+
+class Sentinel;
+
+struct ReadBatchingSettings {
+    /// Time a read waits for other reads to the same shard, zero disables
+    /// the batching
+    std::chrono::microseconds window{0};
+
+    /// Batch is sent without waiting for the window when it gets that many
+    /// reads
+    std::size_t max_batch_size{64};
+};
+
+/// @brief Coalesces the concurrent single-key reads into multi-key commands.
+///
+/// GET requests to the same shard (to the same hash slot in cluster mode) that
+/// arrive within the batching window are sent as a single MGET, HGET requests
+/// of the same key are sent as a single HMGET. The replies are split back into
+/// the replies of the individual requests, requests for the same key or field
+/// share a single argument of the command.
+///
+/// Only the reads with equal CommandControl are batched together. ClientImpl
+/// only passes the reads with CommandControl::allow_read_batching set.
+///
+/// Errors of the batch command are delivered to every read of the batch.
+/// MGET returns nil for a key holding a value that is not a string, so
+/// a batched GET of such a key returns nil instead of failing with WRONGTYPE
+/// as a standalone GET does. HMGET fails with WRONGTYPE the same way as HGET.
+///
+/// Thread safe, the batches are sent from the ev thread.
+class ReadBatcher final {
+public:
+    ReadBatcher(Sentinel& sentinel, engine::ev::ThreadPool& thread_pool, ReadBatchingSettings settings);
+    ~ReadBatcher();
+
+    ReadBatcher(const ReadBatcher&) = delete;
+    ReadBatcher& operator=(const ReadBatcher&) = delete;
+
+    Request Get(std::string key, size_t shard, const CommandControl& command_control);
+    Request Hget(std::string key, std::string field, size_t shard, const CommandControl& command_control);
+
+    ReadBatchingStatistics GetStatistics() const;
+
+private:
+    struct Read {
+        std::string arg;
+        engine::Promise<ReplyPtr> promise;
+    };
+
+    struct Batch {
+        size_t shard{0};
+        // Hash slot in cluster mode
+        std::optional<size_t> slot;
+        // Key of HMGET, nullopt for MGET
+        std::optional<std::string> hash_key;
+        CommandControl command_control;
+        std::vector<Read> reads;
+    };
+
+    Request Enqueue(
+        std::string arg,
+        std::optional<std::string> hash_key,
+        std::optional<size_t> slot,
+        size_t shard,
+        const CommandControl& command_control
+    );
+    void Send(std::vector<Batch> batches);
+    void Send(Batch&& batch);
+
+    void OnWakeup();
+    void OnTimer();
+
+    static void OnWakeupEv(struct ev_loop*, ev_async* w, int) noexcept;
+    static void OnTimerEv(struct ev_loop*, ev_timer* w, int) noexcept;
+
+    Sentinel& sentinel_;
+    const ReadBatchingSettings settings_;
+    engine::ev::ThreadControl thread_control_;
+
+    ev_async wakeup_watcher_{};
+    ev_timer timer_{};
+
+    std::mutex mutex_;
+    std::vector<Batch> pending_;
+    // Full batches to send without waiting for the timer
+    std::vector<Batch> ready_;
+    bool flush_scheduled_{false};
+
+    utils::statistics::RateCounter batches_{0};
+    utils::statistics::RateCounter batched_reads_{0};
+    utils::statistics::RateCounter deduplicated_reads_{0};
+    utils::statistics::Histogram batch_size_;
+};
+
+}  // namespace storages::redis::impl
+
+USERVER_NAMESPACE_END
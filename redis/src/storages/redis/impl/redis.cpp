@@ -22,8 +22,10 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/userver_experiments.hpp>
 #include <userver/utils/retry_budget.hpp>
+#include <userver/utils/str_icase.hpp>
 #include <userver/utils/swappingsmart.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/command.hpp>
 #include <storages/redis/impl/ev_wrapper.hpp>
 #include <storages/redis/impl/redis_info.hpp>
@@ -42,6 +44,8 @@ const auto kPingLatencyExp = 0.7;
 const auto kInitialPingLatencyMs = 1000;
 const size_t kMissedPingStreakThresholdDefault = 3;
 
+constexpr std::string_view kInvalidationChannel = "__redis__:invalidate";
+
 // required for libhiredis < 1.0.0
 #ifndef REDIS_ERR_TIMEOUT
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
@@ -74,11 +78,11 @@ bool IsFinalState(Redis::State state) {
 
 bool IsUnsubscribeReply(const ReplyPtr& reply) {
     if (!reply->data || !reply->data.IsArray()) return false;
-    const auto& reply_array = reply->data.GetArray();
-    if (reply_array.size() != 3 || !reply_array[0].IsString()) return false;
-    return !strcasecmp(reply_array[0].GetString().c_str(), "UNSUBSCRIBE") ||
-           !strcasecmp(reply_array[0].GetString().c_str(), "PUNSUBSCRIBE") ||
-           !strcasecmp(reply_array[0].GetString().c_str(), "SUNSUBSCRIBE");
+    const auto reply_array = reply->data.GetView();
+    if (reply_array.GetArraySize() != 3 || !reply_array[0].IsString()) return false;
+    const auto type = reply_array[0].GetString();
+    const utils::StrIcaseEqual equal;
+    return equal(type, "UNSUBSCRIBE") || equal(type, "PUNSUBSCRIBE") || equal(type, "SUNSUBSCRIBE");
 }
 
 #ifdef USERVER_FEATURE_REDIS_TLS
@@ -88,6 +92,24 @@ struct SSLContextDeleter final {
 using SSLContextPtr = std::unique_ptr<redisSSLContext, SSLContextDeleter>;
 #endif
 
+// Replies on the connection that receives the invalidation messages
+enum class TrackingReply : std::uintptr_t {
+    kAuth,
+    kClientId,
+    kInvalidation,
+};
+
+void* ToPrivdata(TrackingReply reply) { return reinterpret_cast<void*>(static_cast<std::uintptr_t>(reply)); }
+
+TrackingReply FromPrivdata(void* privdata) {
+    return static_cast<TrackingReply>(reinterpret_cast<std::uintptr_t>(privdata));
+}
+
+bool IsReplyString(const redisReply* reply, std::string_view value) {
+    return reply && reply->type == REDIS_REPLY_STRING && reply->len == value.size() &&
+           !strncasecmp(reply->str, value.data(), value.size());
+}
+
 }  // namespace
 
 class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
@@ -123,6 +145,7 @@ public:
     void SetCommandsBufferingSettings(CommandsBufferingSettings commands_buffering_settings);
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings);
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings);
+    void SetClientSideCache(std::shared_ptr<ClientSideCache> cache);
 
     void ResetRedisObj() { redis_obj_ = nullptr; }
 
@@ -148,10 +171,25 @@ private:
     static void OnTimerInfo(struct ev_loop* loop, ev_timer* w, int revents) noexcept;
     static void OnConnectTimeout(struct ev_loop* loop, ev_timer* w, int revents) noexcept;
     static void OnCommandTimeout(struct ev_loop* loop, ev_timer* w, int revents) noexcept;
+    static void OnTrackingConnect(const redisAsyncContext* c, int status) noexcept;
+    static void OnTrackingDisconnect(const redisAsyncContext* c, int status) noexcept;
+    static void OnTrackingReply(redisAsyncContext* c, void* r, void* privdata) noexcept;
 
     void OnConnectImpl(int status);
     void OnDisconnectImpl(int status);
-    bool InitSecureConnection();
+    bool InitSecureConnection(redisAsyncContext* context);
+
+    // Client side caching: a separate connection receives the invalidation
+    // messages for the keys read through the main one
+    void StartTracking();
+    void StopTracking();
+    void OnTrackingConnectImpl(int status);
+    void OnTrackingDisconnectImpl();
+    void OnTrackingReplyImpl(const redisReply* reply, TrackingReply type);
+    void SendTrackingCommand(TrackingReply type, const std::vector<std::string_view>& args);
+    void EnableTracking(long long client_id);
+    void DisableTracking();
+    void OnInvalidation(const redisReply* keys);
     void InvokeCommand(const CommandPtr& command, ReplyPtr&& reply);
     void InvokeCommandError(
         const CommandPtr& command,
@@ -244,6 +282,14 @@ private:
     bool attached_ = false;
     std::shared_ptr<RedisImpl> self_;
     utils::RetryBudget retry_budget_;
+
+    std::shared_ptr<ClientSideCache> client_side_cache_;
+    redisAsyncContext* tracking_context_ = nullptr;
+    bool tracking_connected_ = false;
+    bool tracking_requested_ = false;
+    bool tracking_enabled_ = false;
+    long long tracking_client_id_ = 0;
+    std::shared_ptr<RedisImpl> tracking_self_;
 };
 
 std::string_view StateToString(RedisState state) {
@@ -314,6 +360,8 @@ void Redis::SetReplicationMonitoringSettings(const ReplicationMonitoringSettings
     impl_->SetReplicationMonitoringSettings(replication_monitoring_settings);
 }
 
+void Redis::SetClientSideCache(std::shared_ptr<ClientSideCache> cache) { impl_->SetClientSideCache(std::move(cache)); }
+
 Redis::RedisImpl::RedisImpl(
     const std::shared_ptr<engine::ev::ThreadPool>& thread_pool,
     const engine::ev::ThreadControl& thread_control,
@@ -434,6 +482,7 @@ void Redis::RedisImpl::Disconnect() {
 
 void Redis::RedisImpl::DoDisconnect() {
     Detach();
+    StopTracking();
 
     if (state_ == State::kInit || state_ == State::kConnected) redisAsyncDisconnect(context_);
 
@@ -750,6 +799,7 @@ void Redis::RedisImpl::SetState(State state) {
             ev_thread_control_.Start(ping_timer_);
             ev_thread_control_.Start(info_timer_);
         });
+        StartTracking();
     } else if (state == State::kInitError || state == State::kDisconnectError || state == State::kDisconnected)
         Disconnect();
 
@@ -871,7 +921,7 @@ void Redis::RedisImpl::OnConnectImpl(int status) {
         return;
     }
 
-    if (connection_security_ == ConnectionSecurity::kTLS && !InitSecureConnection()) {
+    if (connection_security_ == ConnectionSecurity::kTLS && !InitSecureConnection(context_)) {
         Disconnect();
         return;
     }
@@ -902,7 +952,7 @@ void Redis::RedisImpl::OnDisconnectImpl(int status) {
     self_.reset();
 }
 
-bool Redis::RedisImpl::InitSecureConnection() {
+bool Redis::RedisImpl::InitSecureConnection(redisAsyncContext* context) {
 #ifdef USERVER_FEATURE_REDIS_TLS
     if (!ssl_context_) {
         redisSSLContextError ssl_error{};
@@ -913,14 +963,15 @@ bool Redis::RedisImpl::InitSecureConnection() {
         }
     }
 
-    if (redisInitiateSSLWithContext(&context_->c, ssl_context_.get()) != REDIS_OK) {
-        LOG_ERROR() << "redisInitiateSSLWithContext failed. Hiredis errstr='" << context_->errstr << '\''
+    if (redisInitiateSSLWithContext(&context->c, ssl_context_.get()) != REDIS_OK) {
+        LOG_ERROR() << "redisInitiateSSLWithContext failed. Hiredis errstr='" << context->errstr << '\''
                     << " server=" << server_;
         return false;
     }
 
     return true;
 #else
+    (void)context;
     LOG_ERROR() << log_extra_ << "SSL/TLS connections are not supported";
     return false;
 #endif
@@ -1137,6 +1188,234 @@ void Redis::RedisImpl::SetRetryBudgetSettings(const utils::RetryBudgetSettings&
     retry_budget_.SetSettings(settings);
 }
 
+void Redis::RedisImpl::SetClientSideCache(std::shared_ptr<ClientSideCache> cache) {
+    ev_thread_control_.RunInEvLoopAsync([self = shared_from_this(), cache = std::move(cache)]() mutable {
+        if (self->client_side_cache_ == cache) return;
+        self->StopTracking();
+        self->client_side_cache_ = std::move(cache);
+        if (self->state_ == State::kConnected && !self->IsDestroying()) self->StartTracking();
+    });
+}
+
+void Redis::RedisImpl::StartTracking() {
+    if (!client_side_cache_ || tracking_context_ || subscriber_) return;
+
+    LOG_INFO() << log_extra_ << "Connecting to receive the client side cache invalidations";
+    tracking_context_ = redisAsyncConnect(host_.c_str(), port_);
+    UASSERT(tracking_context_ != nullptr);
+    if (tracking_context_->err) {
+        LOG_WARNING() << log_extra_
+                      << "error after redisAsyncConnect for invalidations: " << tracking_context_->errstr;
+        redisAsyncFree(tracking_context_);
+        tracking_context_ = nullptr;
+        return;
+    }
+
+    tracking_context_->data = this;
+    if (redisLibevAttach(ev_thread_control_.GetEvLoop(), tracking_context_) != REDIS_OK ||
+        redisAsyncSetConnectCallback(tracking_context_, OnTrackingConnect) != REDIS_OK ||
+        redisAsyncSetDisconnectCallback(tracking_context_, OnTrackingDisconnect) != REDIS_OK) {
+        LOG_WARNING() << log_extra_ << "failed to set up the connection for invalidations";
+        redisAsyncFree(tracking_context_);
+        tracking_context_ = nullptr;
+        return;
+    }
+    tracking_self_ = shared_from_this();
+}
+
+void Redis::RedisImpl::StopTracking() {
+    tracking_requested_ = false;
+    if (tracking_enabled_) {
+        tracking_enabled_ = false;
+        client_side_cache_->OnTrackingStopped(server_id_);
+    }
+    if (!tracking_context_) return;
+
+    // The callbacks of the detached context are no-op, the callers of
+    // StopTracking() keep this alive
+    auto* context = std::exchange(tracking_context_, nullptr);
+    context->data = nullptr;
+    if (std::exchange(tracking_connected_, false)) {
+        redisAsyncDisconnect(context);
+    } else {
+        redisAsyncFree(context);
+    }
+    tracking_self_.reset();
+}
+
+void Redis::RedisImpl::OnTrackingConnect(const redisAsyncContext* c, int status) noexcept {
+    auto* impl = static_cast<Redis::RedisImpl*>(c->data);
+    if (!impl) return;
+    try {
+        impl->OnTrackingConnectImpl(status);
+    } catch (const std::exception& ex) {
+        LOG_ERROR() << "OnTrackingConnectImpl() failed: " << ex;
+    }
+}
+
+void Redis::RedisImpl::OnTrackingDisconnect(const redisAsyncContext* c, int) noexcept {
+    auto* impl = static_cast<Redis::RedisImpl*>(c->data);
+    if (!impl) return;
+    try {
+        impl->OnTrackingDisconnectImpl();
+    } catch (const std::exception& ex) {
+        LOG_ERROR() << "OnTrackingDisconnectImpl() failed: " << ex;
+    }
+}
+
+void Redis::RedisImpl::OnTrackingReply(redisAsyncContext* c, void* r, void* privdata) noexcept {
+    auto* impl = static_cast<Redis::RedisImpl*>(c->data);
+    if (!impl) return;
+    try {
+        impl->OnTrackingReplyImpl(static_cast<const redisReply*>(r), FromPrivdata(privdata));
+    } catch (const std::exception& ex) {
+        LOG_ERROR() << "OnTrackingReplyImpl() failed: " << ex;
+    }
+}
+
+void Redis::RedisImpl::OnTrackingConnectImpl(int status) {
+    if (status != REDIS_OK) {
+        // hiredis frees the context after the failed connect
+        LOG_WARNING() << log_extra_ << "Connect for invalidations failed, client side cache is not used for "
+                      << GetServer();
+        tracking_context_ = nullptr;
+        tracking_self_.reset();
+        return;
+    }
+    tracking_connected_ = true;
+
+    if (connection_security_ == ConnectionSecurity::kTLS && !InitSecureConnection(tracking_context_)) {
+        redisAsyncDisconnect(tracking_context_);
+        return;
+    }
+
+    if (!password_.GetUnderlying().empty()) {
+        SendTrackingCommand(TrackingReply::kAuth, {"AUTH", password_.GetUnderlying()});
+    }
+    SendTrackingCommand(TrackingReply::kClientId, {"CLIENT", "ID"});
+    SendTrackingCommand(TrackingReply::kInvalidation, {"SUBSCRIBE", kInvalidationChannel});
+}
+
+void Redis::RedisImpl::OnTrackingDisconnectImpl() {
+    LOG_INFO() << log_extra_ << "Connection for invalidations closed";
+    tracking_context_ = nullptr;
+    tracking_connected_ = false;
+    if (tracking_enabled_) {
+        tracking_enabled_ = false;
+        client_side_cache_->OnTrackingStopped(server_id_);
+    }
+
+    // The server keeps redirecting the invalidations to the closed connection.
+    // Only the client side cache is disabled for the server, the main connection
+    // keeps serving the commands and tracking is restarted on its reconnect
+    if (std::exchange(tracking_requested_, false) && state_ == State::kConnected) DisableTracking();
+    tracking_self_.reset();
+}
+
+void Redis::RedisImpl::SendTrackingCommand(TrackingReply type, const std::vector<std::string_view>& args) {
+    std::vector<const char*> argv;
+    std::vector<std::size_t> argv_len;
+    argv.reserve(args.size());
+    argv_len.reserve(args.size());
+    for (const auto& arg : args) {
+        argv.push_back(arg.data());
+        argv_len.push_back(arg.size());
+    }
+    if (redisAsyncCommandArgv(
+            tracking_context_, OnTrackingReply, ToPrivdata(type), argv.size(), argv.data(), argv_len.data()
+        ) != REDIS_OK) {
+        LOG_WARNING() << log_extra_ << "redisAsyncCommandArgv() failed on the connection for invalidations";
+        redisAsyncDisconnect(tracking_context_);
+    }
+}
+
+void Redis::RedisImpl::OnTrackingReplyImpl(const redisReply* reply, TrackingReply type) {
+    // Disconnecting, OnTrackingDisconnectImpl() does the cleanup
+    if (!reply || !tracking_connected_) return;
+
+    if (reply->type == REDIS_REPLY_ERROR) {
+        LOG_WARNING() << log_extra_ << "Error on the connection for invalidations: "
+                      << std::string_view{reply->str, reply->len};
+        redisAsyncDisconnect(tracking_context_);
+        return;
+    }
+
+    switch (type) {
+        case TrackingReply::kAuth:
+            return;
+        case TrackingReply::kClientId:
+            if (reply->type == REDIS_REPLY_INTEGER) tracking_client_id_ = reply->integer;
+            return;
+        case TrackingReply::kInvalidation:
+            if (reply->type != REDIS_REPLY_ARRAY || reply->elements != 3) return;
+            if (IsReplyString(reply->element[0], "subscribe")) {
+                EnableTracking(tracking_client_id_);
+            } else if (IsReplyString(reply->element[0], "message")) {
+                OnInvalidation(reply->element[2]);
+            }
+            return;
+    }
+}
+
+void Redis::RedisImpl::EnableTracking(long long client_id) {
+    CommandControl cc{ping_timeout_, ping_timeout_, 1};
+    cc.account_in_statistics = false;
+
+    tracking_requested_ = true;
+    ProcessCommand(PrepareCommand(
+        CmdArgs{"CLIENT", "TRACKING", "ON", "REDIRECT", client_id},
+        [this](const CommandPtr&, ReplyPtr reply) {
+            if (!tracking_connected_) return;
+            if (!*reply || !reply->data.IsStatus()) {
+                // Redis < 6.0 or the tracking is disabled on the server
+                LOG_WARNING() << log_extra_ << "CLIENT TRACKING failed, client side cache is not used for "
+                              << GetServer() << ": " << reply->data.ToDebugString();
+                StopTracking();
+                return;
+            }
+            tracking_enabled_ = true;
+            client_side_cache_->OnTrackingStarted(server_id_);
+        },
+        cc
+    ));
+}
+
+void Redis::RedisImpl::DisableTracking() {
+    CommandControl cc{ping_timeout_, ping_timeout_, 1};
+    cc.account_in_statistics = false;
+
+    // Sent after CLIENT TRACKING ON over the same connection, so it also turns
+    // off the tracking that is still being enabled
+    ProcessCommand(PrepareCommand(
+        CmdArgs{"CLIENT", "TRACKING", "OFF"},
+        [this](const CommandPtr&, ReplyPtr reply) {
+            if (!*reply || !reply->data.IsStatus()) {
+                LOG_WARNING() << log_extra_ << "CLIENT TRACKING OFF failed for " << GetServer() << ": "
+                              << reply->data.ToDebugString();
+            }
+        },
+        cc
+    ));
+}
+
+void Redis::RedisImpl::OnInvalidation(const redisReply* keys) {
+    if (!tracking_enabled_) return;
+
+    // nil is sent on FLUSHALL/FLUSHDB
+    if (keys->type != REDIS_REPLY_ARRAY) {
+        client_side_cache_->InvalidateAll();
+        return;
+    }
+
+    std::vector<std::string> invalidated;
+    invalidated.reserve(keys->elements);
+    for (std::size_t i = 0; i < keys->elements; ++i) {
+        const auto* key = keys->element[i];
+        if (key->type == REDIS_REPLY_STRING) invalidated.emplace_back(key->str, key->len);
+    }
+    client_side_cache_->Invalidate(invalidated);
+}
+
 }  // namespace storages::redis::impl
 
 USERVER_NAMESPACE_END
@@ -20,6 +20,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis::impl {
 
+class ClientSideCache;
 class Statistics;
 
 class Redis {
@@ -50,6 +51,7 @@ public:
     void SetCommandsBufferingSettings(CommandsBufferingSettings commands_buffering_settings);
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings);
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings);
+    void SetClientSideCache(std::shared_ptr<ClientSideCache> cache);
 
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
     boost::signals2::signal<void(State)> signal_state_change;
@@ -12,11 +12,13 @@ RedisConnectionHolder::RedisConnectionHolder(
     Password password,
     CommandsBufferingSettings buffering_settings,
     ReplicationMonitoringSettings replication_monitoring_settings,
-    utils::RetryBudgetSettings retry_budget_settings
+    utils::RetryBudgetSettings retry_budget_settings,
+    std::shared_ptr<ClientSideCache> client_side_cache
 )
     : commands_buffering_settings_(std::move(buffering_settings)),
       replication_monitoring_settings_(std::move(replication_monitoring_settings)),
       retry_budget_settings_(std::move(retry_budget_settings)),
+      client_side_cache_(std::move(client_side_cache)),
       ev_thread_(sentinel_thread_control),
       redis_thread_pool_(redis_thread_pool),
       host_(host),
@@ -76,6 +78,10 @@ void RedisConnectionHolder::CreateConnection() {
         auto settings_ptr = retry_budget_settings_.Lock();
         instance->SetRetryBudgetSettings(*settings_ptr);
     }
+    {
+        auto cache_ptr = client_side_cache_.Lock();
+        if (*cache_ptr) instance->SetClientSideCache(*cache_ptr);
+    }
 
     instance->Connect({host_}, port_, password_);
     redis_.Assign(std::move(instance));
@@ -99,6 +105,12 @@ void RedisConnectionHolder::SetRetryBudgetSettings(utils::RetryBudgetSettings se
     redis_.ReadCopy()->SetRetryBudgetSettings(std::move(settings));
 }
 
+void RedisConnectionHolder::SetClientSideCache(std::shared_ptr<ClientSideCache> cache) {
+    auto ptr = client_side_cache_.Lock();
+    *ptr = cache;
+    redis_.ReadCopy()->SetClientSideCache(std::move(cache));
+}
+
 Redis::State RedisConnectionHolder::GetState() const {
     auto ptr = redis_.Read();
     return ptr->get()->GetState();
@@ -24,7 +24,8 @@ public:
         Password password,
         CommandsBufferingSettings buffering_settings,
         ReplicationMonitoringSettings replication_monitoring_settings,
-        utils::RetryBudgetSettings retry_budget_settings
+        utils::RetryBudgetSettings retry_budget_settings,
+        std::shared_ptr<ClientSideCache> client_side_cache
     );
     ~RedisConnectionHolder();
     RedisConnectionHolder(const RedisConnectionHolder&) = delete;
@@ -35,6 +36,7 @@ public:
     void SetReplicationMonitoringSettings(ReplicationMonitoringSettings settings);
     void SetCommandsBufferingSettings(CommandsBufferingSettings settings);
     void SetRetryBudgetSettings(utils::RetryBudgetSettings settings);
+    void SetClientSideCache(std::shared_ptr<ClientSideCache> cache);
 
     Redis::State GetState() const;
 
@@ -49,6 +51,7 @@ private:
     concurrent::Variable<std::optional<CommandsBufferingSettings>, std::mutex> commands_buffering_settings_;
     concurrent::Variable<ReplicationMonitoringSettings, std::mutex> replication_monitoring_settings_;
     concurrent::Variable<utils::RetryBudgetSettings, std::mutex> retry_budget_settings_;
+    concurrent::Variable<std::shared_ptr<ClientSideCache>, std::mutex> client_side_cache_;
     engine::ev::ThreadControl ev_thread_;
     std::shared_ptr<engine::ev::ThreadPool> redis_thread_pool_;
     const std::string host_;
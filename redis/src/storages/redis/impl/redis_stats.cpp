@@ -252,6 +252,25 @@ void DumpMetric(utils::statistics::Writer& writer, const ShardStatistics& stats)
     }
 }
 
+void DumpMetric(utils::statistics::Writer& writer, const ClientSideCacheStatistics& stats) {
+    writer["hits"] = stats.hits;
+    writer["misses"] = stats.misses;
+    writer["rejected_fills"] = stats.rejected_fills;
+    writer["invalidations"] = stats.invalidations;
+    writer["flushes"] = stats.flushes;
+    writer["evictions"] = stats.evictions;
+    writer["size_bytes"] = stats.size_bytes;
+    writer["entries"] = stats.entries;
+    writer["tracking_connections"] = stats.tracking_connections;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const ReadBatchingStatistics& stats) {
+    writer["batches"] = stats.batches;
+    writer["batched_reads"] = stats.batched_reads;
+    writer["deduplicated_reads"] = stats.deduplicated_reads;
+    writer["batch_size"] = stats.batch_size;
+}
+
 void DumpMetric(utils::statistics::Writer& writer, const SentinelStatistics& stats) {
     const auto& settings = stats.shard_group_total.settings;
     DumpMetric(writer, stats.shard_group_total, false);
@@ -291,6 +310,13 @@ void DumpMetric(utils::statistics::Writer& writer, const SentinelStatistics& sta
         conn_stat.Add(stats.sentinel.value());
         writer.ValueWithLabels(conn_stat, {{"redis_instance_type", "sentinels"}});
     }
+
+    if (stats.client_side_cache) {
+        writer["client_side_cache"] = *stats.client_side_cache;
+    }
+    if (stats.read_batching) {
+        writer["read_batching"] = *stats.read_batching;
+    }
 }
 
 }  // namespace storages::redis::impl
@@ -3,12 +3,14 @@
 #include <array>
 #include <atomic>
 #include <chrono>
+#include <optional>
 #include <string_view>
 #include <unordered_map>
 
 #include <userver/storages/redis/base.hpp>
 #include <userver/storages/redis/fwd.hpp>
 #include <userver/storages/redis/redis_state.hpp>
+#include <userver/utils/statistics/histogram.hpp>
 #include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
@@ -123,6 +125,26 @@ struct SentinelStatisticsInternal {
     utils::statistics::RateCounter cluster_topology_updates{0};
 };
 
+struct ClientSideCacheStatistics {
+    utils::statistics::Rate hits;
+    utils::statistics::Rate misses;
+    utils::statistics::Rate rejected_fills;
+    utils::statistics::Rate invalidations;
+    utils::statistics::Rate flushes;
+    utils::statistics::Rate evictions;
+    std::size_t size_bytes{0};
+    std::size_t entries{0};
+    std::size_t tracking_connections{0};
+};
+
+struct ReadBatchingStatistics {
+    utils::statistics::Rate batches;
+    utils::statistics::Rate batched_reads;
+    utils::statistics::Rate deduplicated_reads;
+    // Reads in a batch
+    utils::statistics::Histogram batch_size;
+};
+
 struct SentinelStatistics {
     SentinelStatistics(const MetricsSettings& settings, const SentinelStatisticsInternal& internal)
         : shard_group_total(settings), internal(internal) {}
@@ -134,12 +156,18 @@ struct SentinelStatistics {
     std::unordered_map<std::string, ShardStatistics> slaves;
     InstanceStatistics shard_group_total;
     SentinelStatisticsInternal internal;
+    std::optional<ClientSideCacheStatistics> client_side_cache;
+    std::optional<ReadBatchingStatistics> read_batching;
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const InstanceStatistics& stats, bool real_instance = true);
 
 void DumpMetric(utils::statistics::Writer& writer, const ShardStatistics& stats);
 
+void DumpMetric(utils::statistics::Writer& writer, const ClientSideCacheStatistics& stats);
+
+void DumpMetric(utils::statistics::Writer& writer, const ReadBatchingStatistics& stats);
+
 void DumpMetric(utils::statistics::Writer& writer, const SentinelStatistics& stats);
 
 }  // namespace storages::redis::impl
@@ -1,7 +1,10 @@
 #include <userver/storages/redis/reply.hpp>
 
+#include <cstdint>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include <hiredis/hiredis.h>
 #include <boost/algorithm/string/predicate.hpp>
@@ -14,6 +17,167 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis {
 
+namespace impl {
+
+/// Strings of all the elements of the hiredis array reply in a single buffer.
+/// Elements of each array occupy consecutive nodes, so the whole reply takes
+/// two allocations regardless of the elements count.
+class PackedReply final {
+public:
+    struct Node {
+        ReplyData::Type type{ReplyData::Type::kNoReply};
+        // offset of the string in buffer_ or index of the first array element
+        std::size_t offset{0};
+        // length of the string or count of the array elements
+        std::size_t size{0};
+        std::int64_t integer{0};
+    };
+
+    explicit PackedReply(const redisReply* reply);
+
+    const Node& GetNode(std::size_t node) const { return nodes_[node]; }
+    std::string_view GetString(const Node& node) const { return {buffer_.data() + node.offset, node.size}; }
+    std::size_t GetSize(std::size_t node) const;
+
+    // Materializes the elements of the array, nested arrays stay packed
+    ReplyData::Array Unpack(const std::shared_ptr<const PackedReply>& self, std::size_t node) const;
+
+    // Materializes the whole subtree once. Unlike Unpack() the result does not
+    // reference this object, otherwise it would own itself.
+    const ReplyData::Array& GetUnpacked(std::size_t node) const;
+
+private:
+    static void Count(const redisReply* reply, std::size_t& nodes, std::size_t& bytes);
+    std::size_t Pack(const redisReply* reply, std::size_t node, std::size_t& next_free);
+
+    std::vector<Node> nodes_;
+    std::string buffer_;
+    std::size_t reply_size_{0};
+
+    // Materialized arrays for the const access
+    mutable std::mutex unpacked_mutex_;
+    mutable std::unordered_map<std::size_t, ReplyData::Array> unpacked_;
+};
+
+PackedReply::PackedReply(const redisReply* reply) {
+    std::size_t nodes_count = 0;
+    std::size_t bytes = 0;
+    Count(reply, nodes_count, bytes);
+    nodes_.resize(nodes_count);
+    buffer_.reserve(bytes);
+
+    std::size_t next_free = 1;
+    reply_size_ = Pack(reply, 0, next_free);
+    UASSERT(next_free == nodes_count);
+    UASSERT(buffer_.size() == bytes);
+}
+
+void PackedReply::Count(const redisReply* reply, std::size_t& nodes, std::size_t& bytes) {
+    ++nodes;
+    switch (reply->type) {
+        case REDIS_REPLY_STRING:
+        case REDIS_REPLY_STATUS:
+        case REDIS_REPLY_ERROR:
+            bytes += reply->len;
+            break;
+        case REDIS_REPLY_ARRAY:
+            for (std::size_t i = 0; i < reply->elements; ++i) Count(reply->element[i], nodes, bytes);
+            break;
+        default:
+            break;
+    }
+}
+
+std::size_t PackedReply::Pack(const redisReply* reply, std::size_t node, std::size_t& next_free) {
+    auto& packed = nodes_[node];
+    switch (reply->type) {
+        case REDIS_REPLY_STRING:
+        case REDIS_REPLY_STATUS:
+        case REDIS_REPLY_ERROR:
+            packed.type = reply->type == REDIS_REPLY_STRING   ? ReplyData::Type::kString
+                          : reply->type == REDIS_REPLY_STATUS ? ReplyData::Type::kStatus
+                                                              : ReplyData::Type::kError;
+            packed.offset = buffer_.size();
+            packed.size = reply->len;
+            buffer_.append(reply->str, reply->len);
+            return reply->len;
+        case REDIS_REPLY_ARRAY: {
+            packed.type = ReplyData::Type::kArray;
+            packed.offset = next_free;
+            packed.size = reply->elements;
+            next_free += reply->elements;
+
+            // `packed` is not used below, nodes_ are not reallocated anyway
+            const auto first = packed.offset;
+            std::size_t size = 0;
+            for (std::size_t i = 0; i < reply->elements; ++i) size += Pack(reply->element[i], first + i, next_free);
+            return size;
+        }
+        case REDIS_REPLY_INTEGER:
+            packed.type = ReplyData::Type::kInteger;
+            packed.integer = reply->integer;
+            return sizeof(packed.integer);
+        case REDIS_REPLY_NIL:
+            packed.type = ReplyData::Type::kNil;
+            return 1;
+        default:
+            packed.type = ReplyData::Type::kNoReply;
+            return 1;
+    }
+}
+
+std::size_t PackedReply::GetSize(std::size_t node) const {
+    if (node == 0) return reply_size_;
+
+    const auto& packed = nodes_[node];
+    switch (packed.type) {
+        case ReplyData::Type::kString:
+        case ReplyData::Type::kStatus:
+        case ReplyData::Type::kError:
+            return packed.size;
+        case ReplyData::Type::kInteger:
+            return sizeof(packed.integer);
+        case ReplyData::Type::kArray: {
+            std::size_t size = 0;
+            for (std::size_t i = 0; i < packed.size; ++i) size += GetSize(packed.offset + i);
+            return size;
+        }
+        case ReplyData::Type::kNil:
+        case ReplyData::Type::kNoReply:
+            return 1;
+    }
+    return 1;
+}
+
+ReplyData::Array PackedReply::Unpack(const std::shared_ptr<const PackedReply>& self, std::size_t node) const {
+    UASSERT(self.get() == this);
+    const auto& packed = nodes_[node];
+    UASSERT(packed.type == ReplyData::Type::kArray);
+
+    ReplyData::Array array;
+    array.reserve(packed.size);
+    for (std::size_t i = packed.offset; i < packed.offset + packed.size; ++i) {
+        if (nodes_[i].type == ReplyData::Type::kArray && nodes_[i].size) {
+            array.push_back(ReplyData{self, i});
+        } else {
+            array.push_back(ReplyData::FromView(ReplyDataView{*this, i}));
+        }
+    }
+    return array;
+}
+
+const ReplyData::Array& PackedReply::GetUnpacked(std::size_t node) const {
+    const std::lock_guard lock{unpacked_mutex_};
+    auto it = unpacked_.find(node);
+    if (it == unpacked_.end()) {
+        auto data = ReplyData::FromView(ReplyDataView{*this, node});
+        it = unpacked_.emplace(node, std::move(data.GetArray())).first;
+    }
+    return it->second;
+}
+
+}  // namespace impl
+
 ReplyData::ReplyData(const redisReply* reply) {
     if (!reply) return;
 
@@ -24,8 +188,7 @@ ReplyData::ReplyData(const redisReply* reply) {
             break;
         case REDIS_REPLY_ARRAY:
             type_ = Type::kArray;
-            array_.reserve(reply->elements);
-            for (size_t i = 0; i < reply->elements; i++) array_.emplace_back(reply->element[i]);
+            if (reply->elements) packed_ = std::make_shared<const impl::PackedReply>(reply);
             break;
         case REDIS_REPLY_INTEGER:
             type_ = Type::kInteger;
@@ -50,6 +213,9 @@ ReplyData::ReplyData(const redisReply* reply) {
 
 ReplyData::ReplyData(Array&& array) : type_(Type::kArray), array_(std::move(array)) {}
 
+ReplyData::ReplyData(std::shared_ptr<const impl::PackedReply> packed, std::size_t node)
+    : type_(Type::kArray), packed_(std::move(packed)), packed_node_(node) {}
+
 ReplyData::ReplyData(std::string s) : type_(Type::kString), string_(std::move(s)) {}
 
 ReplyData::ReplyData(int value) : type_(Type::kInteger), integer_(value) {}
@@ -72,42 +238,57 @@ ReplyData ReplyData::CreateNil() {
     return data;
 }
 
-std::string ReplyData::GetTypeString() const { return TypeToString(GetType()); }
-
-std::string ReplyData::ToDebugString() const {
-    switch (GetType()) {
-        case ReplyData::Type::kNoReply:
-            return {};
-        case ReplyData::Type::kNil:
-            return "(nil)";
-        case ReplyData::Type::kString:
-        case ReplyData::Type::kStatus:
-        case ReplyData::Type::kError:
-            return string_;
-        case ReplyData::Type::kInteger:
-            return std::to_string(integer_);
-        case ReplyData::Type::kArray: {
-            std::ostringstream os;
-            os << "[";
-            for (size_t i = 0; i < array_.size(); i++) {
-                if (i) os << ", ";
-                os << array_[i].ToDebugString();
-            }
-            os << "]";
-            return os.str();
+ReplyData ReplyData::FromView(const ReplyDataView& view) {
+    switch (view.GetType()) {
+        case Type::kString:
+            return ReplyData{std::string{view.GetString()}};
+        case Type::kStatus:
+            return CreateStatus(std::string{view.GetStatus()});
+        case Type::kError:
+            return CreateError(std::string{view.GetError()});
+        case Type::kInteger: {
+            ReplyData data;
+            data.type_ = Type::kInteger;
+            data.integer_ = view.GetInt();
+            return data;
         }
-        default:
-            return "(unknown type)";
+        case Type::kNil:
+            return CreateNil();
+        case Type::kArray: {
+            Array array;
+            array.reserve(view.GetArraySize());
+            for (size_t i = 0; i < view.GetArraySize(); ++i) array.push_back(FromView(view[i]));
+            return ReplyData{std::move(array)};
+        }
+        case Type::kNoReply:
+            break;
     }
+    return ReplyData{};
+}
+
+ReplyDataView ReplyData::GetView() const {
+    return packed_ ? ReplyDataView{*packed_, packed_node_} : ReplyDataView{*this};
+}
+
+const ReplyData::Array& ReplyData::GetPackedArray() const { return packed_->GetUnpacked(packed_node_); }
+
+void ReplyData::Unpack() {
+    array_ = packed_->Unpack(packed_, packed_node_);
+    packed_.reset();
+    packed_node_ = 0;
 }
 
+std::string ReplyData::GetTypeString() const { return TypeToString(GetType()); }
+
+std::string ReplyData::ToDebugString() const { return GetView().ToDebugString(); }
+
 ReplyData::KeyValues ReplyData::GetKeyValues() const {
     if (!IsArray())
         throw ParseReplyException("Incorrect ReplyData type: expected kArray, found " + TypeToString(GetType()));
     if (GetArray().size() & 1) throw ParseReplyException("Array size is odd: " + std::to_string(GetArray().size()));
     for (const auto& elem : GetArray())
         if (!elem.IsString()) throw ParseReplyException("Non-string element (" + elem.GetTypeString() + ')');
-    return ReplyData::KeyValues(array_);
+    return ReplyData::KeyValues(GetArray());
 }
 
 ReplyData::MovableKeyValues ReplyData::GetMovableKeyValues() {
@@ -116,7 +297,7 @@ ReplyData::MovableKeyValues ReplyData::GetMovableKeyValues() {
     if (GetArray().size() & 1) throw ParseReplyException("Array size is odd: " + std::to_string(GetArray().size()));
     for (const auto& elem : GetArray())
         if (!elem.IsString()) throw ParseReplyException("Non-string element (" + elem.GetTypeString() + ')');
-    return ReplyData::MovableKeyValues(array_);
+    return ReplyData::MovableKeyValues(GetArray());
 }
 
 std::string ReplyData::TypeToString(Type type) {
@@ -141,6 +322,8 @@ std::string ReplyData::TypeToString(Type type) {
 }
 
 size_t ReplyData::GetSize() const {
+    if (packed_) return packed_->GetSize(packed_node_);
+
     size_t sum = 0;
 
     switch (type_) {
@@ -243,6 +426,71 @@ void ReplyData::ExpectError(const std::string& request_description) const {
     );
 }
 
+ReplyDataView::Type ReplyDataView::GetType() const {
+    return data_ ? data_->GetType() : packed_->GetNode(node_).type;
+}
+
+std::string_view ReplyDataView::GetStringUnchecked() const {
+    return data_ ? std::string_view{data_->string_} : packed_->GetString(packed_->GetNode(node_));
+}
+
+std::string_view ReplyDataView::GetString() const {
+    UASSERT(IsString());
+    return GetStringUnchecked();
+}
+
+std::string_view ReplyDataView::GetStatus() const {
+    UASSERT(IsStatus());
+    return GetStringUnchecked();
+}
+
+std::string_view ReplyDataView::GetError() const {
+    UASSERT(IsError());
+    return GetStringUnchecked();
+}
+
+int64_t ReplyDataView::GetInt() const {
+    UASSERT(IsInt());
+    return data_ ? data_->integer_ : packed_->GetNode(node_).integer;
+}
+
+std::size_t ReplyDataView::GetArraySize() const {
+    UASSERT(IsArray());
+    return data_ ? data_->array_.size() : packed_->GetNode(node_).size;
+}
+
+ReplyDataView ReplyDataView::operator[](std::size_t idx) const {
+    UINVARIANT(idx < GetArraySize(), "Reply array index is out of range");
+    if (data_) return data_->array_[idx].GetView();
+    return ReplyDataView{*packed_, packed_->GetNode(node_).offset + idx};
+}
+
+std::string ReplyDataView::ToDebugString() const {
+    switch (GetType()) {
+        case Type::kNoReply:
+            return {};
+        case Type::kNil:
+            return "(nil)";
+        case Type::kString:
+        case Type::kStatus:
+        case Type::kError:
+            return std::string{GetStringUnchecked()};
+        case Type::kInteger:
+            return std::to_string(GetInt());
+        case Type::kArray: {
+            std::ostringstream os;
+            os << "[";
+            for (size_t i = 0; i < GetArraySize(); i++) {
+                if (i) os << ", ";
+                os << (*this)[i].ToDebugString();
+            }
+            os << "]";
+            return os.str();
+        }
+    }
+    return "(unknown type)";
+}
+
 Reply::Reply(std::string cmd, redisReply* redis_reply, ReplyStatus status)
     : cmd(std::move(cmd)), data(redis_reply), status(status) {}
 
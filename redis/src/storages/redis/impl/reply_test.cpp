@@ -1,9 +1,75 @@
 #include <userver/storages/redis/reply.hpp>
 
+#include <deque>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
+#include <hiredis/hiredis.h>
+
+#include <userver/storages/redis/parse_reply.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace {
+
+using storages::redis::ReplyData;
+
+// Owns the hand-made hiredis replies, that are normally built by the hiredis
+// reader
+class RawReplies final {
+public:
+    redisReply* String(std::string value) {
+        auto& reply = Make(REDIS_REPLY_STRING);
+        auto& str = strings_.emplace_back(std::move(value));
+        reply.str = str.data();
+        reply.len = str.size();
+        return &reply;
+    }
+
+    redisReply* Status(std::string value) {
+        auto* reply = String(std::move(value));
+        reply->type = REDIS_REPLY_STATUS;
+        return reply;
+    }
+
+    redisReply* Error(std::string value) {
+        auto* reply = String(std::move(value));
+        reply->type = REDIS_REPLY_ERROR;
+        return reply;
+    }
+
+    redisReply* Integer(long long value) {
+        auto& reply = Make(REDIS_REPLY_INTEGER);
+        reply.integer = value;
+        return &reply;
+    }
+
+    redisReply* Nil() { return &Make(REDIS_REPLY_NIL); }
+
+    redisReply* Array(std::vector<redisReply*> elements) {
+        auto& reply = Make(REDIS_REPLY_ARRAY);
+        auto& stored = elements_.emplace_back(std::move(elements));
+        reply.element = stored.data();
+        reply.elements = stored.size();
+        return &reply;
+    }
+
+private:
+    redisReply& Make(int type) {
+        auto& reply = replies_.emplace_back();
+        reply = redisReply{};
+        reply.type = type;
+        return reply;
+    }
+
+    std::deque<redisReply> replies_;
+    std::deque<std::string> strings_;
+    std::deque<std::vector<redisReply*>> elements_;
+};
+
+}  // namespace
+
 TEST(Reply, IsUnusableInstanceErrorMASTERDOWN) {
     auto data = storages::redis::ReplyData::CreateError(
         "MASTERDOWN Link with MASTER is down and slave-serve-stale-data is set "
@@ -22,4 +88,152 @@ TEST(Reply, IsUnusableInstanceErrorERR) {
     EXPECT_FALSE(data.IsUnusableInstanceError());
 }
 
+TEST(Reply, PackedArrayView) {
+    RawReplies raw;
+    const ReplyData data{raw.Array({
+        raw.String("value"),
+        raw.Nil(),
+        raw.Integer(42),
+        raw.Array({raw.String("x"), raw.Array({})}),
+        raw.Status("OK"),
+    })};
+
+    const auto view = data.GetView();
+    ASSERT_TRUE(view.IsArray());
+    ASSERT_EQ(view.GetArraySize(), 5);
+    EXPECT_EQ(view[0].GetString(), "value");
+    EXPECT_TRUE(view[1].IsNil());
+    EXPECT_EQ(view[2].GetInt(), 42);
+    ASSERT_EQ(view[3].GetArraySize(), 2);
+    EXPECT_EQ(view[3][0].GetString(), "x");
+    EXPECT_EQ(view[3][1].GetArraySize(), 0);
+    EXPECT_EQ(view[4].GetStatus(), "OK");
+    EXPECT_EQ(data.ToDebugString(), "[value, (nil), 42, [x, []], OK]");
+
+    // "value" + nil + integer + "x" + "OK"
+    EXPECT_EQ(data.GetSize(), 5 + 1 + sizeof(int64_t) + 1 + 2);
+}
+
+TEST(Reply, PackedArrayMaterialization) {
+    RawReplies raw;
+    const ReplyData data{raw.Array({
+        raw.String("a"),
+        raw.Array({raw.String("b"), raw.Integer(1)}),
+    })};
+
+    const auto& array = data.GetArray();
+    ASSERT_EQ(array.size(), 2);
+    EXPECT_EQ(array[0].GetString(), "a");
+    EXPECT_EQ(array[1].GetSize(), 1 + sizeof(int64_t));
+    EXPECT_EQ(array[1].ToDebugString(), "[b, 1]");
+    EXPECT_EQ(&array, &data.GetArray());
+
+    auto copy = data;
+    auto& nested = copy.GetArray().at(1).GetArray();
+    nested[0].GetString() = "c";
+    EXPECT_EQ(copy.ToDebugString(), "[a, [c, 1]]");
+    EXPECT_EQ(data.ToDebugString(), "[a, [b, 1]]");
+    EXPECT_EQ(data.GetSize(), copy.GetSize());
+}
+
+TEST(Reply, ParseFromPackedArray) {
+    using storages::redis::To;
+
+    RawReplies raw;
+    auto strings = [&raw] {
+        return ReplyData{raw.Array({raw.String("k1"), raw.String("1.5"), raw.String("k2"), raw.String("2")})};
+    };
+
+    const auto vector = storages::redis::ParseReplyDataArray(strings(), "test", To<std::vector<std::string>>{});
+    EXPECT_EQ(vector, (std::vector<std::string>{"k1", "1.5", "k2", "2"}));
+
+    const auto map = storages::redis::Parse(strings(), "test", To<std::unordered_map<std::string, std::string>>{});
+    EXPECT_EQ(map, (std::unordered_map<std::string, std::string>{{"k1", "1.5"}, {"k2", "2"}}));
+
+    const auto scores =
+        storages::redis::ParseReplyDataArray(strings(), "test", To<std::vector<storages::redis::MemberScore>>{});
+    ASSERT_EQ(scores.size(), 2);
+    EXPECT_EQ(scores[0].member, "k1");
+    EXPECT_EQ(scores[0].score, 1.5);
+    EXPECT_EQ(scores[1].score, 2.0);
+
+    const auto optionals = storages::redis::ParseReplyDataArray(
+        ReplyData{raw.Array({raw.Nil(), raw.String("v")})}, "test", To<std::vector<std::optional<std::string>>>{}
+    );
+    EXPECT_EQ(optionals, (std::vector<std::optional<std::string>>{std::nullopt, "v"}));
+
+    EXPECT_THROW(
+        storages::redis::ParseReplyDataArray(
+            ReplyData{raw.Array({raw.String("k"), raw.Integer(1)})},
+            "test",
+            To<std::vector<std::pair<std::string, std::string>>>{}
+        ),
+        storages::redis::ParseReplyException
+    );
+    EXPECT_THROW(
+        storages::redis::ParseReplyDataArray(
+            ReplyData{raw.Array({raw.String("k"), raw.String("not a number")})},
+            "test",
+            To<std::vector<storages::redis::MemberScore>>{}
+        ),
+        storages::redis::ParseReplyException
+    );
+}
+
+TEST(Reply, ParseStreamReplies) {
+    using storages::redis::StreamEntry;
+    using storages::redis::To;
+
+    RawReplies raw;
+    auto entries = [&raw] {
+        return raw.Array({
+            raw.Array(
+                {raw.String("1-0"), raw.Array({raw.String("f1"), raw.String("v1"), raw.String("f2"), raw.String("v2")})}
+            ),
+            raw.Array({raw.String("2-0"), raw.Nil()}),
+        });
+    };
+    const std::vector<StreamEntry> expected{{"1-0", {{"f1", "v1"}, {"f2", "v2"}}}, {"2-0", {}}};
+
+    const auto read = storages::redis::Parse(
+        ReplyData{raw.Array({raw.Array({raw.String("stream"), entries()})})}, "test", To<std::vector<StreamEntry>>{}
+    );
+    EXPECT_EQ(read, expected);
+    EXPECT_TRUE(storages::redis::Parse(ReplyData{raw.Nil()}, "test", To<std::vector<StreamEntry>>{}).empty());
+
+    const auto claimed = storages::redis::Parse(
+        ReplyData{raw.Array({raw.String("3-0"), entries(), raw.Array({raw.String("0-1")})})},
+        "test",
+        To<storages::redis::XautoclaimReply>{}
+    );
+    EXPECT_EQ(claimed.next_id, "3-0");
+    EXPECT_EQ(claimed.entries, expected);
+    EXPECT_EQ(claimed.deleted_ids, std::vector<std::string>{"0-1"});
+
+    EXPECT_THROW(
+        storages::redis::Parse(
+            ReplyData{raw.Array({raw.Array({raw.String("stream"), raw.Array({raw.String("1-0")})})})},
+            "test",
+            To<std::vector<StreamEntry>>{}
+        ),
+        storages::redis::ParseReplyException
+    );
+
+    using storages::redis::XgroupCreateReply;
+    EXPECT_EQ(
+        storages::redis::Parse(ReplyData{raw.Status("OK")}, "test", To<XgroupCreateReply>{}),
+        XgroupCreateReply::kCreated
+    );
+    EXPECT_EQ(
+        storages::redis::Parse(
+            ReplyData{raw.Error("BUSYGROUP Consumer Group name already exists")}, "test", To<XgroupCreateReply>{}
+        ),
+        XgroupCreateReply::kGroupExists
+    );
+    EXPECT_THROW(
+        storages::redis::Parse(ReplyData{raw.Error("ERR no such key")}, "test", To<XgroupCreateReply>{}),
+        storages::redis::ParseReplyException
+    );
+}
+
 USERVER_NAMESPACE_END
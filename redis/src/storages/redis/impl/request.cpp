@@ -77,6 +77,9 @@ Request::Request(
     sentinel.AsyncCommand(std::move(command_ptr), master, shard);
 }
 
+Request::Request(engine::Future<ReplyPtr>&& future, engine::Deadline deadline)
+    : future_(std::move(future)), deadline_(deadline) {}
+
 CommandPtr Request::PrepareRequest(CmdArgs&& args, const CommandControl& command_control, size_t replies_to_skip) {
     deadline_ = engine::Deadline::FromDuration(CommandControlImpl{command_control}.timeout_all);
 
@@ -34,6 +34,9 @@ public:
 
 private:
     friend class Sentinel;
+    friend class ReadBatcher;
+
+    Request(engine::Future<ReplyPtr>&& future, engine::Deadline deadline);
 
     Request(
         Sentinel& sentinel,
@@ -16,8 +16,10 @@
 #include <userver/utils/impl/userver_experiments.hpp>
 
 #include <storages/redis/dynamic_config.hpp>
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/cluster_sentinel_impl.hpp>
 #include <storages/redis/impl/command.hpp>
+#include <storages/redis/impl/read_batcher.hpp>
 #include <storages/redis/impl/redis.hpp>
 #include <storages/redis/impl/sentinel_impl.hpp>
 #include <storages/redis/impl/subscribe_sentinel.hpp>
@@ -123,6 +125,8 @@ Sentinel::Sentinel(
 }
 
 Sentinel::~Sentinel() {
+    // Stops sending the batches before the commands are no longer accepted
+    read_batcher_.reset();
     impl_.reset();
     UASSERT(!impl_);
 }
@@ -332,7 +336,10 @@ void Sentinel::CheckShardIdx(size_t shard_idx, size_t shard_count) {
 const std::string& Sentinel::GetAnyKeyForShard(size_t shard_idx) const { return impl_->GetAnyKeyForShard(shard_idx); }
 
 SentinelStatistics Sentinel::GetStatistics(const MetricsSettings& settings) const {
-    return impl_->GetStatistics(settings);
+    auto stats = impl_->GetStatistics(settings);
+    if (const auto cache = client_side_cache_.Get()) stats.client_side_cache = cache->GetStatistics();
+    if (read_batcher_) stats.read_batching = read_batcher_->GetStatistics();
+    return stats;
 }
 
 void Sentinel::SetCommandsBufferingSettings(CommandsBufferingSettings commands_buffering_settings) {
@@ -347,6 +354,19 @@ void Sentinel::SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings
     impl_->SetRetryBudgetSettings(settings);
 }
 
+void Sentinel::SetClientSideCache(std::shared_ptr<ClientSideCache> cache) {
+    impl_->SetClientSideCache(cache);
+    client_side_cache_.Set(cache);
+}
+
+std::shared_ptr<ClientSideCache> Sentinel::GetClientSideCache() const { return client_side_cache_.Get(); }
+
+void Sentinel::EnableReadBatching(const ReadBatchingSettings& settings) {
+    read_batcher_ = std::make_shared<ReadBatcher>(*this, *thread_pools_->GetRedisThreadPool(), settings);
+}
+
+std::shared_ptr<ReadBatcher> Sentinel::GetReadBatcher() const { return read_batcher_; }
+
 std::vector<Request>
 Sentinel::MakeRequests(CmdArgs&& args, bool master, const CommandControl& command_control, size_t replies_to_skip) {
     std::vector<Request> rslt;
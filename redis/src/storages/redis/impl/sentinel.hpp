@@ -42,6 +42,9 @@ const auto kCheckRedisConnectedInterval = std::chrono::seconds(3);
 // Forward declarations
 class SentinelImplBase;
 class SentinelImpl;
+class ClientSideCache;
+class ReadBatcher;
+struct ReadBatchingSettings;
 class Shard;
 
 class Sentinel {
@@ -145,6 +148,16 @@ public:
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings);
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings);
 
+    /// Enables caching of the read commands on the client side, the cache is
+    /// kept coherent by the `CLIENT TRACKING` of every connection
+    void SetClientSideCache(std::shared_ptr<ClientSideCache> cache);
+    std::shared_ptr<ClientSideCache> GetClientSideCache() const;
+
+    /// Enables coalescing of the concurrent GET and HGET requests into MGET
+    /// and HMGET commands. Must be called before the clients are created.
+    void EnableReadBatching(const ReadBatchingSettings& settings);
+    std::shared_ptr<ReadBatcher> GetReadBatcher() const;
+
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
     boost::signals2::signal<void(size_t shard)> signal_instances_changed;
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
@@ -240,6 +253,8 @@ private:
     utils::SwappingSmart<CommandControl> config_default_command_control_;
     std::atomic_int publish_shard_{0};
     testsuite::RedisControl testsuite_redis_control_;
+    utils::SwappingSmart<ClientSideCache> client_side_cache_;
+    std::shared_ptr<ReadBatcher> read_batcher_;
 };
 
 }  // namespace storages::redis::impl
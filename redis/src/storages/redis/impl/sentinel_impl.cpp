@@ -540,6 +540,10 @@ void SentinelImpl::SetRetryBudgetSettings(const utils::RetryBudgetSettings& retr
     for (auto& shard : master_shards_) shard->SetRetryBudgetSettings(retry_budget_settings);
 }
 
+void SentinelImpl::SetClientSideCache(const std::shared_ptr<ClientSideCache>& cache) {
+    for (auto& shard : master_shards_) shard->SetClientSideCache(cache);
+}
+
 PublishSettings SentinelImpl::GetPublishSettings() {
     /// Why do we always publish to master? We can actually publish to any host in
     /// shard to distribute load evenly
@@ -84,6 +84,7 @@ public:
     virtual void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings
     ) = 0;
     virtual void SetRetryBudgetSettings(const utils::RetryBudgetSettings& retry_budget_settings) = 0;
+    virtual void SetClientSideCache(const std::shared_ptr<ClientSideCache>& cache) = 0;
 
     virtual PublishSettings GetPublishSettings() = 0;
     virtual void SetConnectionInfo(const std::vector<ConnectionInfoInt>& info_array) = 0;
@@ -143,6 +144,7 @@ public:
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings
     ) override;
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& retry_budget_settings) override;
+    void SetClientSideCache(const std::shared_ptr<ClientSideCache>& cache) override;
     PublishSettings GetPublishSettings() override;
 
     void SetConnectionInfo(const std::vector<ConnectionInfoInt>& info_array) override;
@@ -8,6 +8,7 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/retry_budget.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/command.hpp>
 #include <userver/storages/redis/base.hpp>
 
@@ -276,6 +277,7 @@ bool Shard::ProcessCreation(const std::shared_ptr<engine::ev::ThreadPool>& redis
             entry.instance->SetCommandsBufferingSettings(*commands_buffering_settings);
         if (auto retry_budget_settings = retry_budget_settings_.Get())
             entry.instance->SetRetryBudgetSettings(*retry_budget_settings);
+        if (auto client_side_cache = client_side_cache_.Get()) entry.instance->SetClientSideCache(client_side_cache);
         auto server_id = entry.instance->GetServerId();
         entry.instance->signal_state_change.connect([this, server_id](Redis::State state) {
             LOG_TRACE() << "Signaled server_id: " << server_id.GetDescription();
@@ -434,6 +436,20 @@ void Shard::SetRetryBudgetSettings(const utils::RetryBudgetSettings& retry_budge
     retry_budget_settings_.Set(std::make_shared<utils::RetryBudgetSettings>(retry_budget_settings));
 }
 
+void Shard::SetClientSideCache(const std::shared_ptr<ClientSideCache>& cache) {
+    std::shared_lock lock(mutex_);
+
+    for (const auto& instance : instances_) {
+        instance.instance->SetClientSideCache(cache);
+    }
+
+    for (const auto& instance : clean_wait_) {
+        instance.instance->SetClientSideCache(cache);
+    }
+
+    client_side_cache_.Set(cache);
+}
+
 std::vector<ConnectionInfoInt> Shard::GetConnectionInfosToCreate() const {
     std::shared_lock lock(mutex_);
 
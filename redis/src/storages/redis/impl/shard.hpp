@@ -98,6 +98,7 @@ public:
     void SetCommandsBufferingSettings(CommandsBufferingSettings commands_buffering_settings);
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings);
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& replication_monitoring_settings);
+    void SetClientSideCache(const std::shared_ptr<ClientSideCache>& cache);
 
 private:
     std::vector<unsigned char>
@@ -128,6 +129,7 @@ private:
 
     utils::SwappingSmart<CommandsBufferingSettings> commands_buffering_settings_;
     utils::SwappingSmart<utils::RetryBudgetSettings> retry_budget_settings_;
+    utils::SwappingSmart<ClientSideCache> client_side_cache_;
 
     bool prev_connected_ = false;
     const bool cluster_mode_ = false;
@@ -10,27 +10,73 @@ namespace {
 
 const std::string kOk{"OK"};
 const std::string kPong{"PONG"};
+constexpr std::string_view kBusyGroupError{"BUSYGROUP "};
 
-std::string ExtractStringElem(ReplyData& array_data, size_t elem_idx, const std::string& request_description) {
-    auto& array = array_data.GetArray();
-    auto& elem = array.at(elem_idx);
+std::string_view
+ExtractStringElem(const ReplyDataView& array, size_t elem_idx, const std::string& request_description) {
+    const auto elem = array[elem_idx];
     if (!elem.IsString()) {
         throw ParseReplyException(
             "Unexpected redis reply type to '" + request_description + "' request: " + "array[" +
             std::to_string(elem_idx) + "]: expected " + ReplyData::TypeToString(ReplyData::Type::kString) +
-            ", got type=" + elem.GetTypeString() + " elem=" + elem.ToDebugString() +
-            " array=" + array_data.ToDebugString()
+            ", got type=" + elem.GetTypeString() + " elem=" + elem.ToDebugString() + " array=" + array.ToDebugString()
         );
     }
-    return std::move(elem.GetString());
+    return elem.GetString();
 }
 
-ReplyData::MovableKeyValues GetKeyValues(ReplyData& array_data, const std::string& request_description) {
-    try {
-        return array_data.GetMovableKeyValues();
-    } catch (const std::exception& ex) {
-        throw ParseReplyException("Can't parse response to '" + request_description + "' request: " + ex.what());
+// Same checks as in ReplyData::GetKeyValues(), but without materializing
+// the elements of the array
+ReplyDataView GetKeyValues(const ReplyData& array_data, const std::string& request_description) {
+    const auto fail = [&request_description](const std::string& what) {
+        throw ParseReplyException("Can't parse response to '" + request_description + "' request: " + what);
+    };
+
+    const auto array = array_data.GetView();
+    if (!array.IsArray()) fail("Incorrect ReplyData type: expected kArray, found " + array.GetTypeString());
+    if (array.GetArraySize() & 1) fail("Array size is odd: " + std::to_string(array.GetArraySize()));
+    for (size_t i = 0; i < array.GetArraySize(); ++i) {
+        if (!array[i].IsString()) fail("Non-string element (" + array[i].GetTypeString() + ')');
+    }
+    return array;
+}
+
+// Parses the [[id, [field, value, ...]], ...] array of the stream entries
+std::vector<StreamEntry> ParseStreamEntries(const ReplyDataView& array, const std::string& request_description) {
+    const auto fail = [&](const std::string& what) {
+        throw ParseReplyException(
+            "Can't parse stream entries from reply to '" + request_description + "' request: " + what +
+            " array=" + array.ToDebugString()
+        );
+    };
+
+    if (!array.IsArray()) fail("expected kArray, found " + array.GetTypeString());
+
+    std::vector<StreamEntry> result;
+    result.reserve(array.GetArraySize());
+    for (size_t i = 0; i < array.GetArraySize(); ++i) {
+        const auto entry = array[i];
+        if (!entry.IsArray() || entry.GetArraySize() != 2 || !entry[0].IsString()) {
+            fail("unexpected entry " + entry.ToDebugString());
+        }
+
+        auto& result_entry = result.emplace_back();
+        result_entry.id = entry[0].GetString();
+
+        // Pending entries that were deleted from the stream have nil fields
+        const auto fields = entry[1];
+        if (fields.IsNil()) continue;
+        if (!fields.IsArray() || (fields.GetArraySize() & 1)) fail("unexpected fields " + fields.ToDebugString());
+
+        result_entry.fields.reserve(fields.GetArraySize() / 2);
+        for (size_t j = 0; j < fields.GetArraySize(); j += 2) {
+            if (!fields[j].IsString() || !fields[j + 1].IsString()) {
+                fail("non-string field in " + fields.ToDebugString());
+            }
+            result_entry.fields.emplace_back(fields[j].GetString(), fields[j + 1].GetString());
+        }
     }
+    return result;
 }
 
 Point ParsePointArray(const redis::ReplyData& elem, const std::string& request_description) {
@@ -83,61 +129,60 @@ const std::string& RequestDescription(const ReplyPtr& reply, const std::string&
 
 std::vector<std::string>
 ParseReplyDataArray(ReplyData&& array_data, const std::string& request_description, To<std::vector<std::string>>) {
-    const auto& array = array_data.GetArray();
+    const auto array = array_data.GetView();
     std::vector<std::string> result;
-    result.reserve(array.size());
+    result.reserve(array.GetArraySize());
 
-    for (size_t elem_idx = 0; elem_idx < array.size(); ++elem_idx) {
-        result.emplace_back(ExtractStringElem(array_data, elem_idx, request_description));
+    for (size_t elem_idx = 0; elem_idx < array.GetArraySize(); ++elem_idx) {
+        result.emplace_back(ExtractStringElem(array, elem_idx, request_description));
     }
     return result;
 }
 
 std::vector<std::optional<std::string>>
 ParseReplyDataArray(ReplyData&& array_data, const std::string& request_description, To<std::vector<std::optional<std::string>>>) {
-    const auto& array = array_data.GetArray();
+    const auto array = array_data.GetView();
     std::vector<std::optional<std::string>> result;
-    result.reserve(array.size());
+    result.reserve(array.GetArraySize());
 
-    for (size_t elem_idx = 0; elem_idx < array.size(); ++elem_idx) {
-        const auto& elem = array[elem_idx];
-        if (elem.IsNil()) {
+    for (size_t elem_idx = 0; elem_idx < array.GetArraySize(); ++elem_idx) {
+        if (array[elem_idx].IsNil()) {
             result.emplace_back(std::nullopt);
             continue;
         }
-        result.emplace_back(ExtractStringElem(array_data, elem_idx, request_description));
+        result.emplace_back(ExtractStringElem(array, elem_idx, request_description));
     }
     return result;
 }
 
 std::vector<std::pair<std::string, std::string>>
 ParseReplyDataArray(ReplyData&& array_data, const std::string& request_description, To<std::vector<std::pair<std::string, std::string>>>) {
-    auto key_values = GetKeyValues(array_data, request_description);
+    const auto key_values = GetKeyValues(array_data, request_description);
 
     std::vector<std::pair<std::string, std::string>> result;
 
-    result.reserve(key_values.size());
+    result.reserve(key_values.GetArraySize() / 2);
 
-    for (auto elem : key_values) {
-        result.emplace_back(std::move(elem.Key()), std::move(elem.Value()));
+    for (size_t i = 0; i < key_values.GetArraySize(); i += 2) {
+        result.emplace_back(key_values[i].GetString(), key_values[i + 1].GetString());
     }
     return result;
 }
 
 std::vector<MemberScore>
 ParseReplyDataArray(ReplyData&& array_data, const std::string& request_description, To<std::vector<MemberScore>>) {
-    auto key_values = GetKeyValues(array_data, request_description);
+    const auto key_values = GetKeyValues(array_data, request_description);
 
     std::vector<MemberScore> result;
 
-    result.reserve(key_values.size());
+    result.reserve(key_values.GetArraySize() / 2);
 
-    for (auto elem : key_values) {
-        auto& member_elem = elem.Key();
-        const auto& score_elem = elem.Value();
+    for (size_t i = 0; i < key_values.GetArraySize(); i += 2) {
+        const auto member_elem = key_values[i].GetString();
+        const auto score_elem = key_values[i + 1].GetString();
         double score = NAN;
         try {
-            score = std::stod(score_elem);
+            score = utils::FromString<double>(score_elem);
         } catch (const std::exception& ex) {
             throw ParseReplyException(std::string("Can't parse response to '")
                                           .append(request_description)
@@ -149,7 +194,7 @@ ParseReplyDataArray(ReplyData&& array_data, const std::string& request_descripti
                                           .append(ex.what()));
         }
 
-        result.emplace_back(std::move(member_elem), score);
+        result.emplace_back(std::string{member_elem}, score);
     }
     return result;
 }
@@ -244,19 +289,25 @@ int64_t Parse(ReplyData&& reply_data, const std::string& request_description, To
 std::chrono::system_clock::time_point
 Parse(ReplyData&& reply_data, const std::string& request_description, To<std::chrono::system_clock::time_point>) {
     reply_data.ExpectArray(request_description);
-    auto&& result = reply_data.GetArray();
-    if (result.size() != 2) {
+    const auto result = reply_data.GetView();
+    if (result.GetArraySize() != 2) {
         throw ParseReplyException(
             "Unexpected reply to '" + request_description + "'. Expected 2 elements in array, got " +
-            std::to_string(result.size())
+            std::to_string(result.GetArraySize())
         );
     }
-    for (auto&& i : result) {
-        i.ExpectString(request_description);
+    for (size_t i = 0; i < result.GetArraySize(); ++i) {
+        if (!result[i].IsString()) {
+            throw ParseReplyException(
+                "Unexpected redis reply type to '" + request_description + "' request: expected " +
+                ReplyData::TypeToString(ReplyData::Type::kString) + ", got type=" + result[i].GetTypeString() +
+                " data=" + result[i].ToDebugString()
+            );
+        }
     }
     return std::chrono::system_clock::time_point(
-        std::chrono::seconds(std::stoi(result[0].GetString())) +
-        std::chrono::microseconds(std::stoi(result[1].GetString()))
+        std::chrono::seconds(std::stoi(std::string{result[0].GetString()})) +
+        std::chrono::microseconds(std::stoi(std::string{result[1].GetString()}))
     );
 }
 
@@ -319,12 +370,12 @@ std::unordered_set<std::string>
 Parse(ReplyData&& reply_data, const std::string& request_description, To<std::unordered_set<std::string>>) {
     reply_data.ExpectArray(request_description);
 
-    const auto& array = reply_data.GetArray();
+    const auto array = reply_data.GetView();
     std::unordered_set<std::string> result;
-    result.reserve(array.size());
+    result.reserve(array.GetArraySize());
 
-    for (size_t elem_idx = 0; elem_idx < array.size(); ++elem_idx) {
-        result.emplace(ExtractStringElem(reply_data, elem_idx, request_description));
+    for (size_t elem_idx = 0; elem_idx < array.GetArraySize(); ++elem_idx) {
+        result.emplace(ExtractStringElem(array, elem_idx, request_description));
     }
     return result;
 }
@@ -333,18 +384,75 @@ std::unordered_map<std::string, std::string>
 Parse(ReplyData&& reply_data, const std::string& request_description, To<std::unordered_map<std::string, std::string>>) {
     reply_data.ExpectArray(request_description);
 
-    auto key_values = GetKeyValues(reply_data, request_description);
+    const auto key_values = GetKeyValues(reply_data, request_description);
 
     std::unordered_map<std::string, std::string> result;
 
-    result.reserve(key_values.size());
+    result.reserve(key_values.GetArraySize() / 2);
+
+    for (size_t i = 0; i < key_values.GetArraySize(); i += 2) {
+        result.insert_or_assign(std::string{key_values[i].GetString()}, key_values[i + 1].GetString());
+    }
+    return result;
+}
+
+std::vector<StreamEntry>
+Parse(ReplyData&& reply_data, const std::string& request_description, To<std::vector<StreamEntry>>) {
+    // Nil is returned if there are no entries to read
+    if (reply_data.IsNil()) return {};
+    reply_data.ExpectArray(request_description);
+
+    // [[key, entries]] for the single stream
+    const auto streams = reply_data.GetView();
+    if (streams.GetArraySize() == 0) return {};
+    const auto stream = streams[0];
+    if (streams.GetArraySize() != 1 || !stream.IsArray() || stream.GetArraySize() != 2) {
+        throw ParseReplyException(
+            "Unexpected reply to '" + request_description + "' request, expected entries of a single stream, got " +
+            streams.ToDebugString()
+        );
+    }
+    return ParseStreamEntries(stream[1], request_description);
+}
+
+XautoclaimReply Parse(ReplyData&& reply_data, const std::string& request_description, To<XautoclaimReply>) {
+    reply_data.ExpectArray(request_description);
+
+    const auto array = reply_data.GetView();
+    if (array.GetArraySize() != 2 && array.GetArraySize() != 3) {
+        throw ParseReplyException(
+            "Unexpected reply to '" + request_description + "' request, expected 2 or 3 elements in array, got " +
+            std::to_string(array.GetArraySize())
+        );
+    }
 
-    for (auto elem : key_values) {
-        result[std::move(elem.Key())] = std::move(elem.Value());
+    XautoclaimReply result;
+    result.next_id = ExtractStringElem(array, 0, request_description);
+    result.entries = ParseStreamEntries(array[1], request_description);
+    if (array.GetArraySize() == 3) {
+        const auto deleted = array[2];
+        if (!deleted.IsArray()) {
+            throw ParseReplyException(
+                "Unexpected reply to '" + request_description + "' request, expected array of deleted ids, got " +
+                deleted.ToDebugString()
+            );
+        }
+        result.deleted_ids.reserve(deleted.GetArraySize());
+        for (size_t i = 0; i < deleted.GetArraySize(); ++i) {
+            result.deleted_ids.emplace_back(ExtractStringElem(deleted, i, request_description));
+        }
     }
     return result;
 }
 
+XgroupCreateReply Parse(ReplyData&& reply_data, const std::string& request_description, To<XgroupCreateReply>) {
+    if (reply_data.IsError() && reply_data.GetError().compare(0, kBusyGroupError.size(), kBusyGroupError) == 0) {
+        return XgroupCreateReply::kGroupExists;
+    }
+    reply_data.ExpectStatusEqualTo(kOk, request_description);
+    return XgroupCreateReply::kCreated;
+}
+
 ReplyData Parse(ReplyData&& reply_data, const std::string&, To<ReplyData>) { return std::move(reply_data); }
 
 }  // namespace storages::redis
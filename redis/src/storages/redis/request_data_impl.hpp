@@ -1,8 +1,10 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/request.hpp>
 #include <userver/storages/redis/base.hpp>
 #include <userver/utils/assert.hpp>
@@ -124,6 +126,70 @@ private:
     ReplyPtr reply_;
 };
 
+/// Fills the client side cache with the reply of GET or HGET
+template <typename Result, typename ReplyType>
+class CachingRequestDataImpl final : public RequestDataBase<ReplyType> {
+public:
+    CachingRequestDataImpl(
+        impl::Request&& request,
+        std::shared_ptr<impl::ClientSideCache> cache,
+        std::string key,
+        std::optional<std::string> field,
+        impl::ClientSideCache::FillToken token
+    )
+        : request_(std::move(request)),
+          cache_(std::move(cache)),
+          key_(std::move(key)),
+          field_(std::move(field)),
+          token_(token) {}
+
+    ~CachingRequestDataImpl() override {
+        if (cache_) cache_->CancelFill(key_, token_);
+    }
+
+    void Wait() override { impl::Wait(request_); }
+
+    ReplyType Get(const std::string& request_description) override {
+        auto reply = GetReply();
+        return ParseReply<Result, ReplyType>(std::move(reply), request_description);
+    }
+
+    ReplyPtr GetRaw() override { return GetReply(); }
+
+    engine::impl::ContextAccessor* TryGetContextAccessor() noexcept override {
+        return request_.TryGetContextAccessor();
+    }
+
+private:
+    ReplyPtr GetReply() {
+        auto reply = request_.Get();
+        if (cache_) Fill(*reply);
+        return reply;
+    }
+
+    void Fill(const Reply& reply) {
+        auto cache = std::move(cache_);
+        if (!reply.IsOk() || !(reply.data.IsString() || reply.data.IsNil())) {
+            cache->CancelFill(key_, token_);
+            return;
+        }
+
+        impl::ClientSideCache::Value value;
+        if (reply.data.IsString()) value = reply.data.GetString();
+        if (field_) {
+            cache->CompleteHget(key_, *field_, token_, reply.server_id, std::move(value));
+        } else {
+            cache->CompleteGet(key_, token_, reply.server_id, std::move(value));
+        }
+    }
+
+    impl::Request request_;
+    std::shared_ptr<impl::ClientSideCache> cache_;
+    const std::string key_;
+    const std::optional<std::string> field_;
+    const impl::ClientSideCache::FillToken token_;
+};
+
 template <ScanTag scan_tag>
 class RequestScanData final : public RequestScanDataBase<scan_tag> {
 public:
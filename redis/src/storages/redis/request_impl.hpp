@@ -30,6 +30,19 @@ Request CreateAggregateRequest(std::vector<impl::Request>&& requests) {
     return Request(std::make_unique<ThisAggregateRequestDataImpl>(std::move(req_data)));
 }
 
+template <typename Request>
+Request CreateCachingRequest(
+    impl::Request&& request,
+    std::shared_ptr<impl::ClientSideCache> cache,
+    std::string key,
+    std::optional<std::string> field,
+    impl::ClientSideCache::FillToken token
+) {
+    return Request(std::make_unique<CachingRequestDataImpl<typename Request::Result, typename Request::Reply>>(
+        std::move(request), std::move(cache), std::move(key), std::move(field), token
+    ));
+}
+
 template <typename Request>
 Request CreateDummyRequest(ReplyPtr reply) {
     return Request(
@@ -0,0 +1,226 @@
+#include <userver/storages/redis/stream_consumer.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <string_view>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+// Reads the entries that were delivered to this consumer, but were not
+// acknowledged
+constexpr std::string_view kPendingEntriesId = "0";
+
+// Reads the entries that were never delivered to the consumers of the group
+constexpr std::string_view kNewEntriesId = ">";
+
+constexpr std::string_view kClaimStartId = "0-0";
+
+}  // namespace
+
+StreamConsumer::StreamConsumer(
+    ClientPtr client,
+    StreamConsumerSettings settings,
+    engine::TaskProcessor& task_processor
+)
+    : client_(std::move(client)), settings_(std::move(settings)), task_processor_(task_processor) {
+    UINVARIANT(client_, "Redis client is required for the stream consumer");
+    UINVARIANT(!settings_.stream.empty(), "Stream key must not be empty");
+    UINVARIANT(!settings_.group.empty(), "Consumer group name must not be empty");
+    UINVARIANT(!settings_.consumer.empty(), "Consumer name must not be empty");
+    UINVARIANT(settings_.batch_size > 0, "Batch size must be positive");
+}
+
+StreamConsumer::~StreamConsumer() { Stop(); }
+
+void StreamConsumer::Start(Callback callback) {
+    UINVARIANT(callback, "Stream consumer callback is required");
+    UINVARIANT(!task_.IsValid(), "Stream consumer is already started");
+
+    task_ = utils::CriticalAsync(
+        task_processor_,
+        "redis-stream-consumer",
+        [this, callback = std::move(callback)] { Run(callback); }
+    );
+}
+
+void StreamConsumer::Stop() noexcept {
+    if (!task_.IsValid()) return;
+    task_.SyncCancel();
+    task_ = {};
+}
+
+void StreamConsumer::Run(const Callback& callback) {
+    CreateGroup();
+
+    std::string read_id{kPendingEntriesId};
+    std::string claim_id{kClaimStartId};
+    auto next_claim = std::chrono::steady_clock::now();
+
+    // Ids of the processed entries, the acknowledgement is awaited after the
+    // read of the next batch is sent
+    std::vector<std::string> ack_ids;
+    std::optional<RequestXack> ack;
+    const auto finish_ack = [&] {
+        if (!ack) return;
+        try {
+            ack->Get();
+            ack_ids.clear();
+        } catch (const std::exception& ex) {
+            ++errors_;
+            LOG_WARNING() << "Failed to acknowledge " << ack_ids.size() << " entries of redis stream '"
+                          << settings_.stream << "', retrying with the next batch: " << ex;
+        }
+        ack.reset();
+    };
+
+    const XreadgroupOptions read_options{settings_.batch_size, std::nullopt, false};
+
+    while (!engine::current_task::ShouldCancel()) {
+        std::vector<StreamEntry> entries;
+        try {
+            auto read = client_->Xreadgroup(
+                settings_.stream, settings_.group, settings_.consumer, read_id, read_options, settings_.command_control
+            );
+            finish_ack();
+            entries = read.Get();
+        } catch (const std::exception& ex) {
+            ++errors_;
+            LOG_ERROR() << "Failed to read redis stream '" << settings_.stream << "': " << ex;
+            // The failed read may still have delivered new entries to the
+            // consumer, so they are read again from its pending entries list
+            finish_ack();
+            read_id = kPendingEntriesId;
+            engine::InterruptibleSleepFor(settings_.restart_after_failure_delay);
+            continue;
+        }
+
+        if (read_id != kNewEntriesId) {
+            // The entries of the previous batch may be not acknowledged yet,
+            // so the pending entries are read starting after the last one
+            read_id = entries.size() < settings_.batch_size ? std::string{kNewEntriesId} : entries.back().id;
+        }
+
+        if (entries.empty() && settings_.claim_min_idle_time && std::chrono::steady_clock::now() >= next_claim) {
+            entries = Claim(claim_id, next_claim);
+        }
+        if (entries.empty()) {
+            engine::InterruptibleSleepFor(settings_.poll_interval);
+            continue;
+        }
+
+        std::vector<std::string> ids;
+        ids.reserve(entries.size());
+        for (const auto& entry : entries) ids.push_back(entry.id);
+
+        // XADD requires at least one field, so the pending entries without
+        // fields were deleted from the stream. They are only acknowledged.
+        const auto deleted = std::remove_if(entries.begin(), entries.end(), [](const StreamEntry& entry) {
+            return entry.fields.empty();
+        });
+        deleted_entries_ += utils::statistics::Rate{static_cast<std::size_t>(entries.end() - deleted)};
+        entries.erase(deleted, entries.end());
+
+        if (!entries.empty() && !Process(callback, entries)) {
+            // The batch stays in the pending entries list of the consumer
+            // and is read again
+            read_id = kPendingEntriesId;
+            engine::InterruptibleSleepFor(settings_.restart_after_failure_delay);
+            continue;
+        }
+
+        std::move(ids.begin(), ids.end(), std::back_inserter(ack_ids));
+        ack = client_->Xack(settings_.stream, settings_.group, ack_ids, settings_.command_control);
+    }
+
+    const engine::TaskCancellationBlocker block_cancel;
+    finish_ack();
+}
+
+void StreamConsumer::CreateGroup() {
+    while (!engine::current_task::ShouldCancel()) {
+        try {
+            auto request = client_->XgroupCreate(
+                settings_.stream, settings_.group, settings_.group_start_id, settings_.command_control
+            );
+            if (request.Get() == XgroupCreateReply::kCreated) {
+                LOG_INFO() << "Created consumer group '" << settings_.group << "' of redis stream '"
+                           << settings_.stream << "'";
+            }
+            return;
+        } catch (const std::exception& ex) {
+            ++errors_;
+            LOG_ERROR() << "Failed to create consumer group '" << settings_.group << "' of redis stream '"
+                        << settings_.stream << "': " << ex;
+            engine::InterruptibleSleepFor(settings_.restart_after_failure_delay);
+        }
+    }
+}
+
+std::vector<StreamEntry>
+StreamConsumer::Claim(std::string& start_id, std::chrono::steady_clock::time_point& next_claim) {
+    UASSERT(settings_.claim_min_idle_time);
+    try {
+        auto request = client_->Xautoclaim(
+            settings_.stream,
+            settings_.group,
+            settings_.consumer,
+            *settings_.claim_min_idle_time,
+            start_id,
+            XautoclaimOptions{settings_.batch_size},
+            settings_.command_control
+        );
+        auto reply = request.Get();
+        start_id = std::move(reply.next_id);
+        // The whole pending entries list was scanned, the entries pending
+        // now are not idle long enough
+        if (start_id == kClaimStartId) {
+            next_claim = std::chrono::steady_clock::now() + *settings_.claim_min_idle_time;
+        }
+        claimed_entries_ += utils::statistics::Rate{reply.entries.size()};
+        return std::move(reply.entries);
+    } catch (const std::exception& ex) {
+        ++errors_;
+        LOG_ERROR() << "Failed to claim the pending entries of redis stream '" << settings_.stream << "': " << ex;
+        next_claim = std::chrono::steady_clock::now() + settings_.restart_after_failure_delay;
+        return {};
+    }
+}
+
+bool StreamConsumer::Process(const Callback& callback, const std::vector<StreamEntry>& entries) {
+    try {
+        callback(entries);
+    } catch (const std::exception& ex) {
+        ++failed_batches_;
+        LOG_ERROR() << "Failed to process " << entries.size() << " entries of redis stream '" << settings_.stream
+                    << "': " << ex;
+        return false;
+    }
+    ++batches_;
+    entries_ += utils::statistics::Rate{entries.size()};
+    return true;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const StreamConsumer& consumer) {
+    writer["batches"] = consumer.batches_;
+    writer["entries"] = consumer.entries_;
+    writer["failed_batches"] = consumer.failed_batches_;
+    writer["claimed_entries"] = consumer.claimed_entries_;
+    writer["deleted_entries"] = consumer.deleted_entries_;
+    writer["errors"] = consumer.errors_;
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,106 @@
+#include <userver/storages/redis/stream_consumer_component.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/hostinfo/blocking/get_hostname.hpp>
+#include <userver/storages/redis/component.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+namespace {
+
+storages::redis::StreamConsumerSettings ParseSettings(const ComponentConfig& config) {
+    storages::redis::StreamConsumerSettings settings;
+    settings.stream = config["stream"].As<std::string>();
+    settings.group = config["group"].As<std::string>();
+    settings.consumer = config["consumer"].As<std::string>(hostinfo::blocking::GetRealHostName());
+    settings.group_start_id = config["group_start_id"].As<std::string>(settings.group_start_id);
+    settings.batch_size = config["batch_size"].As<std::size_t>(settings.batch_size);
+    settings.poll_interval = config["poll_interval"].As<std::chrono::milliseconds>(settings.poll_interval);
+    settings.restart_after_failure_delay =
+        config["restart_after_failure_delay"].As<std::chrono::milliseconds>(settings.restart_after_failure_delay);
+    settings.claim_min_idle_time =
+        config["claim_min_idle_time"].As<std::optional<std::chrono::milliseconds>>(std::nullopt);
+    return settings;
+}
+
+}  // namespace
+
+RedisStreamConsumer::RedisStreamConsumer(const ComponentConfig& config, const ComponentContext& context)
+    : ComponentBase(config, context),
+      consumer_(
+          context.FindComponent<Redis>().GetClient(config["db"].As<std::string>()),
+          ParseSettings(config),
+          context.GetTaskProcessor(config["task_processor"].As<std::string>("main-task-processor"))
+      ) {
+    auto& storage = context.FindComponent<StatisticsStorage>().GetStorage();
+    statistics_holder_ = storage.RegisterWriter(
+        "redis.stream_consumer",
+        [this](utils::statistics::Writer& writer) { writer = consumer_; },
+        {{"redis_stream_consumer", config.Name()}}
+    );
+}
+
+RedisStreamConsumer::~RedisStreamConsumer() {
+    statistics_holder_.Unregister();
+    consumer_.Stop();
+}
+
+yaml_config::Schema RedisStreamConsumer::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<ComponentBase>(R"(
+type: object
+description: Redis stream consumer component
+additionalProperties: false
+properties:
+    db:
+        type: string
+        description: name of the redis cluster in components::Redis
+    stream:
+        type: string
+        description: key of the stream
+    group:
+        type: string
+        description: consumer group, created on start if it does not exist
+    consumer:
+        type: string
+        description: name of the consumer in the group, must be unique among the running consumers
+        defaultDescription: host name
+    group_start_id:
+        type: string
+        description: |
+            id of the last entry considered delivered to the group when the group is created,
+            "$" skips the entries added before the creation
+        defaultDescription: $
+    batch_size:
+        type: integer
+        description: maximum number of entries passed to a single callback call
+        defaultDescription: 100
+        minimum: 1
+    poll_interval:
+        type: string
+        description: delay before the next read when there are no entries to process
+        defaultDescription: 100ms
+    restart_after_failure_delay:
+        type: string
+        description: delay before reprocessing the batch the callback failed on
+        defaultDescription: 1s
+    claim_min_idle_time:
+        type: string
+        description: |
+            entries pending for the other consumers of the group for longer than that
+            are claimed by this consumer, claiming is disabled if not set
+    task_processor:
+        type: string
+        description: task processor to run the callback on
+        defaultDescription: main-task-processor
+)");
+}
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
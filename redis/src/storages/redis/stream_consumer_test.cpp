@@ -0,0 +1,72 @@
+#include <userver/storages/redis/stream_consumer.hpp>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/current_task.hpp>
+#include <userver/storages/redis/mock_client_google.hpp>
+#include <userver/storages/redis/mock_request.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace redis = storages::redis;
+
+using testing::_;
+
+}  // namespace
+
+UTEST(StreamConsumer, RereadsPendingEntriesAfterFailedRead) {
+    auto client = std::make_shared<redis::GMockClient>();
+
+    EXPECT_CALL(*client, XgroupCreate("stream", "group", "$", _)).WillOnce([](auto&&...) {
+        return redis::CreateMockRequest<redis::RequestXgroupCreate>(redis::XgroupCreateReply::kCreated);
+    });
+
+    // The pending entries list is empty, the first read of new entries times
+    // out after the entry was delivered to the consumer
+    const redis::StreamEntry entry{"1-0", {{"key", "value"}}};
+    std::vector<std::string> read_ids;
+    EXPECT_CALL(*client, Xreadgroup("stream", "group", "consumer", _, _, _))
+        .WillRepeatedly([&](auto&&, auto&&, auto&&, std::string id, auto&&, auto&&) {
+            read_ids.push_back(id);
+            if (read_ids.size() == 2) return redis::CreateMockRequestTimeout<redis::RequestXreadgroup>();
+            if (read_ids.size() == 3 && id == "0") {
+                return redis::CreateMockRequest<redis::RequestXreadgroup>(std::vector{entry});
+            }
+            return redis::CreateMockRequest<redis::RequestXreadgroup>(std::vector<redis::StreamEntry>{});
+        });
+    EXPECT_CALL(*client, Xack("stream", "group", std::vector<std::string>{"1-0"}, _)).WillOnce([](auto&&...) {
+        return redis::CreateMockRequest<redis::RequestXack>(1);
+    });
+
+    redis::StreamConsumerSettings settings;
+    settings.stream = "stream";
+    settings.group = "group";
+    settings.consumer = "consumer";
+    settings.poll_interval = std::chrono::milliseconds{1};
+    settings.restart_after_failure_delay = std::chrono::milliseconds{1};
+
+    std::vector<redis::StreamEntry> consumed;
+    engine::SingleConsumerEvent consumed_event;
+    redis::StreamConsumer consumer{client, settings, engine::current_task::GetTaskProcessor()};
+    consumer.Start([&](const std::vector<redis::StreamEntry>& entries) {
+        consumed.insert(consumed.end(), entries.begin(), entries.end());
+        consumed_event.Send();
+    });
+
+    ASSERT_TRUE(consumed_event.WaitForEventFor(utest::kMaxTestWaitTime));
+    // Wait for the acknowledgement that is finished with the next read
+    while (read_ids.size() < 5) engine::Yield();
+    consumer.Stop();
+
+    EXPECT_EQ(consumed, std::vector{entry});
+    ASSERT_GE(read_ids.size(), 4);
+    EXPECT_EQ(read_ids[0], "0");
+    EXPECT_EQ(read_ids[1], ">");
+    EXPECT_EQ(read_ids[2], "0");
+    EXPECT_EQ(read_ids[3], ">");
+}
+
+USERVER_NAMESPACE_END
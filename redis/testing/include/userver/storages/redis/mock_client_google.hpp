@@ -397,6 +397,55 @@ public:
 
     MOCK_METHOD(RequestType, Type, (std::string key, const CommandControl& command_control), (override));
 
+    MOCK_METHOD(
+        RequestXack,
+        Xack,
+        (std::string key, std::string group, std::vector<std::string> ids, const CommandControl& command_control),
+        (override)
+    );
+
+    MOCK_METHOD(
+        RequestXadd,
+        Xadd,
+        (std::string key,
+         (std::vector<std::pair<std::string, std::string>>)field_values,
+         const XaddOptions& options,
+         const CommandControl& command_control),
+        (override)
+    );
+
+    MOCK_METHOD(
+        RequestXautoclaim,
+        Xautoclaim,
+        (std::string key,
+         std::string group,
+         std::string consumer,
+         std::chrono::milliseconds min_idle_time,
+         std::string start,
+         const XautoclaimOptions& options,
+         const CommandControl& command_control),
+        (override)
+    );
+
+    MOCK_METHOD(
+        RequestXgroupCreate,
+        XgroupCreate,
+        (std::string key, std::string group, std::string id, const CommandControl& command_control),
+        (override)
+    );
+
+    MOCK_METHOD(
+        RequestXreadgroup,
+        Xreadgroup,
+        (std::string key,
+         std::string group,
+         std::string consumer,
+         std::string id,
+         const XreadgroupOptions& options,
+         const CommandControl& command_control),
+        (override)
+    );
+
     MOCK_METHOD(
         RequestZadd,
         Zadd,
@@ -595,6 +595,61 @@ RequestType MockClientBase::Type(std::string /*key*/, const CommandControl& /*co
     return RequestType{nullptr};
 }
 
+RequestXack MockClientBase::Xack(
+    std::string /*key*/,
+    std::string /*group*/,
+    std::vector<std::string> /*ids*/,
+    const CommandControl& /*command_control*/
+) {
+    UASSERT_MSG(false, "redis method not mocked");
+    return RequestXack{nullptr};
+}
+
+RequestXadd MockClientBase::Xadd(
+    std::string /*key*/,
+    std::vector<std::pair<std::string, std::string>> /*field_values*/,
+    const XaddOptions& /*options*/,
+    const CommandControl& /*command_control*/
+) {
+    UASSERT_MSG(false, "redis method not mocked");
+    return RequestXadd{nullptr};
+}
+
+RequestXautoclaim MockClientBase::Xautoclaim(
+    std::string /*key*/,
+    std::string /*group*/,
+    std::string /*consumer*/,
+    std::chrono::milliseconds /*min_idle_time*/,
+    std::string /*start*/,
+    const XautoclaimOptions& /*options*/,
+    const CommandControl& /*command_control*/
+) {
+    UASSERT_MSG(false, "redis method not mocked");
+    return RequestXautoclaim{nullptr};
+}
+
+RequestXgroupCreate MockClientBase::XgroupCreate(
+    std::string /*key*/,
+    std::string /*group*/,
+    std::string /*id*/,
+    const CommandControl& /*command_control*/
+) {
+    UASSERT_MSG(false, "redis method not mocked");
+    return RequestXgroupCreate{nullptr};
+}
+
+RequestXreadgroup MockClientBase::Xreadgroup(
+    std::string /*key*/,
+    std::string /*group*/,
+    std::string /*consumer*/,
+    std::string /*id*/,
+    const XreadgroupOptions& /*options*/,
+    const CommandControl& /*command_control*/
+) {
+    UASSERT_MSG(false, "redis method not mocked");
+    return RequestXreadgroup{nullptr};
+}
+
 RequestZadd MockClientBase::
     Zadd(std::string /*key*/, double /*score*/, std::string /*member*/, const CommandControl& /*command_control*/) {
     UASSERT_MSG(false, "redis method not mocked");
@@ -0,0 +1,15 @@
+// Large enough to be precompressed by the fs-cache-main component
+const kGreetings = [
+    'Welcome to userver',
+    'Welcome to userver static service',
+    'Welcome to userver static service sample',
+];
+
+function greet(index) {
+    const greeting = kGreetings[index % kGreetings.length];
+    document.body.appendChild(document.createTextNode(greeting));
+}
+
+for (let i = 0; i < kGreetings.length; ++i) {
+    greet(i);
+}
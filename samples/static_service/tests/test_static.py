@@ -25,3 +25,76 @@ async def test_hidden_file(service_client, service_source_dir):
     response = await service_client.get('/dir1/.hidden_file.txt')
     assert response.status == 404
     assert response.content.decode() == 'File not found'
+
+
+async def test_not_modified(service_client):
+    response = await service_client.get('/index.html')
+    assert response.status == 200
+    etag = response.headers['ETag']
+    last_modified = response.headers['Last-Modified']
+    assert 'Vary' not in response.headers
+
+    response = await service_client.get(
+        '/index.html', headers={'If-None-Match': f'"other", W/{etag}'},
+    )
+    assert response.status == 304
+    assert response.headers['ETag'] == etag
+    assert not response.content
+
+    response = await service_client.get(
+        '/index.html', headers={'If-Modified-Since': last_modified},
+    )
+    assert response.status == 304
+
+    response = await service_client.get(
+        '/index.html', headers={'If-None-Match': '"other"'},
+    )
+    assert response.status == 200
+
+
+async def test_accept_encoding(service_client, service_source_dir):
+    path = '/dir1/script.js'
+    identity = await service_client.get(
+        path, headers={'Accept-Encoding': 'identity'},
+    )
+    assert identity.status == 200
+    assert identity.headers['Content-Type'] == 'application/javascript'
+    assert identity.headers['Vary'] == 'Accept-Encoding'
+    assert 'Content-Encoding' not in identity.headers
+    file = service_source_dir.joinpath('public') / 'dir1' / 'script.js'
+    assert identity.content.decode() == file.open().read()
+
+    etags = {identity.headers['ETag']}
+    for accept_encoding, encoding in (
+        ('gzip', 'gzip'),
+        ('gzip, zstd', 'zstd'),
+        ('gzip, zstd;q=0', 'gzip'),
+    ):
+        response = await service_client.get(
+            path, headers={'Accept-Encoding': accept_encoding},
+        )
+        assert response.status == 200
+        assert response.headers['Vary'] == 'Accept-Encoding'
+        assert response.headers['Content-Encoding'] == encoding
+        etags.add(response.headers['ETag'])
+    # identity, gzip and zstd
+    assert len(etags) == 3
+
+    # the ETag of a variant does not match the other variants
+    response = await service_client.get(
+        path,
+        headers={
+            'Accept-Encoding': 'gzip',
+            'If-None-Match': identity.headers['ETag'],
+        },
+    )
+    assert response.status == 200
+    response = await service_client.get(
+        path,
+        headers={
+            'Accept-Encoding': 'identity',
+            'If-None-Match': identity.headers['ETag'],
+        },
+    )
+    assert response.status == 304
+    assert response.headers['Vary'] == 'Accept-Encoding'
@@ -0,0 +1,611 @@
+#pragma once
+
+/// @file userver/cache/persistent_map.hpp
+/// @brief @copybrief cache::PersistentMap
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <boost/intrusive_ptr.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+namespace impl::persistent_map {
+
+inline constexpr std::size_t kBitsPerLevel = 5;
+inline constexpr std::size_t kLevelMask = (std::size_t{1} << kBitsPerLevel) - 1;
+inline constexpr std::size_t kHashBits = sizeof(std::size_t) * 8;
+// Branch levels that consume the whole hash plus a level of collision nodes
+inline constexpr std::size_t kMaxDepth = (kHashBits + kBitsPerLevel - 1) / kBitsPerLevel + 1;
+
+enum class NodeKind : std::uint8_t { kLeaf, kBranch, kCollision };
+
+inline std::uint32_t GetBit(std::size_t hash, std::size_t shift) noexcept {
+    return std::uint32_t{1} << ((hash >> shift) & kLevelMask);
+}
+
+inline std::size_t GetPosition(std::uint32_t bitmap, std::uint32_t bit) noexcept {
+    return static_cast<std::size_t>(__builtin_popcount(bitmap & (bit - 1)));
+}
+
+}  // namespace impl::persistent_map
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Immutable-snapshot friendly hash map (a hash array mapped trie).
+///
+/// Copying the map is O(1): the copy shares all the nodes with the original.
+/// Modification of a map copies only the nodes on the path from the root to
+/// the modified element, i.e. O(log n) nodes, while the rest of the nodes stay
+/// shared with other snapshots. Nodes that are owned by a single map are
+/// modified in place.
+///
+/// It makes the map a good fit for big caches with incremental updates
+/// (see components::PostgreCache and components::CachingComponentBase), where
+/// copying the whole std::unordered_map on each update to modify just a few
+/// rows is too expensive.
+///
+/// Thread safety matches Standard Library thread safety. Snapshots that share
+/// nodes may be safely read and modified from different threads.
+///
+/// Elements are immutable through iterators, iteration order is unspecified.
+/// Any modification invalidates iterators and references to the elements of
+/// the modified map.
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class PersistentMap final {
+    struct Node;
+    struct Leaf;
+    struct Branch;
+    struct Collision;
+    using NodePtr = boost::intrusive_ptr<Node>;
+    using NodeKind = impl::persistent_map::NodeKind;
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<const Key, Value>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using reference = const value_type&;
+    using const_reference = const value_type&;
+
+    class const_iterator;
+    using iterator = const_iterator;
+
+    PersistentMap() = default;
+
+    explicit PersistentMap(const Hash& hash, const KeyEqual& equal = KeyEqual()) : hash_(hash), equal_(equal) {}
+
+    PersistentMap(std::initializer_list<value_type> values) {
+        for (const auto& value : values) insert(value);
+    }
+
+    PersistentMap(const PersistentMap& other) = default;
+    PersistentMap& operator=(const PersistentMap& other) = default;
+
+    PersistentMap(PersistentMap&& other) noexcept
+        : root_(std::move(other.root_)),
+          size_(std::exchange(other.size_, 0)),
+          hash_(std::move(other.hash_)),
+          equal_(std::move(other.equal_)) {}
+
+    PersistentMap& operator=(PersistentMap&& other) noexcept {
+        PersistentMap{std::move(other)}.swap(*this);
+        return *this;
+    }
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    const_iterator begin() const { return const_iterator{root_.get()}; }
+    const_iterator end() const noexcept { return const_iterator{}; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    const_iterator find(const Key& key) const;
+
+    /// @throws std::out_of_range if there is no such key
+    const Value& at(const Key& key) const {
+        const auto it = find(key);
+        if (it == end()) throw std::out_of_range("PersistentMap::at: no such key");
+        return it->second;
+    }
+
+    bool contains(const Key& key) const { return find(key) != end(); }
+    size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+    /// Adds or rewrites key/value
+    /// @returns true if key is a new one
+    template <typename M>
+    bool insert_or_assign(const Key& key, M&& value) {
+        return DoInsertOrAssign(key, std::forward<M>(value));
+    }
+
+    /// @overload
+    template <typename M>
+    bool insert_or_assign(Key&& key, M&& value) {
+        return DoInsertOrAssign(std::move(key), std::forward<M>(value));
+    }
+
+    /// Adds key/value if there is no such key
+    /// @returns true if key is a new one
+    template <typename K, typename M>
+    bool emplace(K&& key, M&& value) {
+        if (contains(key)) return false;
+        return DoInsertOrAssign(std::forward<K>(key), std::forward<M>(value));
+    }
+
+    /// @overload
+    bool insert(const value_type& value) { return emplace(value.first, value.second); }
+
+    /// Removes key from the map
+    /// @returns the number of removed elements (0 or 1)
+    size_type erase(const Key& key);
+
+    void clear() noexcept {
+        root_.reset();
+        size_ = 0;
+    }
+
+    void swap(PersistentMap& other) noexcept {
+        using std::swap;
+        swap(root_, other.root_);
+        swap(size_, other.size_);
+        swap(hash_, other.hash_);
+        swap(equal_, other.equal_);
+    }
+
+    hasher hash_function() const { return hash_; }
+    key_equal key_eq() const { return equal_; }
+
+private:
+    template <typename K, typename M>
+    bool DoInsertOrAssign(K&& key, M&& value);
+
+    template <typename K, typename M>
+    bool InsertOrAssignImpl(NodePtr& node, std::size_t hash, std::size_t shift, K&& key, M&& value);
+
+    void EraseImpl(NodePtr& node, std::size_t hash, std::size_t shift, const Key& key);
+
+    template <typename K, typename M>
+    static NodePtr MakeLeaf(std::size_t hash, K&& key, M&& value) {
+        return NodePtr{new Leaf(hash, std::forward<K>(key), std::forward<M>(value))};
+    }
+
+    template <typename M>
+    static void AssignLeaf(NodePtr& leaf_ptr, M&& value);
+
+    static NodePtr MergeLeaves(NodePtr first, NodePtr second, std::size_t shift);
+
+    static NodePtr ExtractSingleLeaf(const Node& node);
+
+    template <typename T>
+    static T& MakeMutable(NodePtr& node) {
+        if (!node->IsUnique()) node = NodePtr{new T(static_cast<const T&>(*node))};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+        return static_cast<T&>(*node);
+    }
+
+    static const std::vector<NodePtr>& GetChildren(const Node& node) noexcept;
+
+    NodePtr root_;
+    size_type size_{0};
+    Hash hash_;
+    KeyEqual equal_;
+};
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+struct PersistentMap<Key, Value, Hash, KeyEqual>::Node {
+    explicit Node(NodeKind kind) noexcept : kind(kind) {}
+
+    Node(const Node&) = delete;
+    Node& operator=(const Node&) = delete;
+
+    bool IsUnique() const noexcept { return ref_count.load(std::memory_order_acquire) == 1; }
+
+    static void Destroy(Node* node) noexcept;
+
+    friend void intrusive_ptr_add_ref(Node* node) noexcept { node->ref_count.fetch_add(1, std::memory_order_relaxed); }
+
+    friend void intrusive_ptr_release(Node* node) noexcept {
+        if (node->ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1) Destroy(node);
+    }
+
+    std::atomic<std::uint32_t> ref_count{0};
+    const NodeKind kind;
+};
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+struct PersistentMap<Key, Value, Hash, KeyEqual>::Leaf final : Node {
+    template <typename K, typename M>
+    Leaf(std::size_t hash, K&& key, M&& value)
+        : Node(NodeKind::kLeaf), hash(hash), value(std::forward<K>(key), std::forward<M>(value)) {}
+
+    const std::size_t hash;
+    value_type value;
+};
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+struct PersistentMap<Key, Value, Hash, KeyEqual>::Branch final : Node {
+    Branch() noexcept : Node(NodeKind::kBranch) {}
+
+    // Reserve a slot for the insertion that usually follows the copying
+    Branch(const Branch& other) : Node(NodeKind::kBranch), bitmap(other.bitmap) {
+        children.reserve(other.children.size() + 1);
+        children.assign(other.children.begin(), other.children.end());
+    }
+
+    std::uint32_t bitmap{0};
+    std::vector<NodePtr> children;
+};
+
+// All the leaves have the same hash
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+struct PersistentMap<Key, Value, Hash, KeyEqual>::Collision final : Node {
+    explicit Collision(std::size_t hash) noexcept : Node(NodeKind::kCollision), hash(hash) {}
+
+    Collision(const Collision& other) : Node(NodeKind::kCollision), hash(other.hash), leaves(other.leaves) {}
+
+    const std::size_t hash;
+    std::vector<NodePtr> leaves;
+};
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void PersistentMap<Key, Value, Hash, KeyEqual>::Node::Destroy(Node* node) noexcept {
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-static-cast-downcast)
+    switch (node->kind) {
+        case NodeKind::kLeaf:
+            delete static_cast<Leaf*>(node);
+            return;
+        case NodeKind::kBranch:
+            delete static_cast<Branch*>(node);
+            return;
+        case NodeKind::kCollision:
+            delete static_cast<Collision*>(node);
+            return;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-type-static-cast-downcast)
+    UASSERT_MSG(false, "Unknown PersistentMap node kind");
+}
+
+/// @brief Forward iterator over the elements of cache::PersistentMap
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+class PersistentMap<Key, Value, Hash, KeyEqual>::const_iterator final {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename PersistentMap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    const_iterator() = default;
+
+    reference operator*() const {
+        UASSERT(leaf_);
+        return leaf_->value;
+    }
+
+    pointer operator->() const {
+        UASSERT(leaf_);
+        return &leaf_->value;
+    }
+
+    const_iterator& operator++() {
+        Advance();
+        return *this;
+    }
+
+    const_iterator operator++(int) {
+        auto copy = *this;
+        Advance();
+        return copy;
+    }
+
+    bool operator==(const const_iterator& other) const noexcept { return leaf_ == other.leaf_; }
+    bool operator!=(const const_iterator& other) const noexcept { return leaf_ != other.leaf_; }
+
+private:
+    friend class PersistentMap;
+
+    struct Frame {
+        const Node* node;
+        std::size_t next_child;
+    };
+
+    explicit const_iterator(const Node* root) {
+        if (!root) return;
+        Push(root, 0);
+        Advance();
+    }
+
+    void Push(const Node* node, std::size_t next_child) noexcept {
+        UASSERT(depth_ < stack_.size());
+        stack_[depth_++] = Frame{node, next_child};
+    }
+
+    // Depth-first search of the next leaf
+    void Advance() {
+        leaf_ = nullptr;
+        while (depth_ > 0) {
+            auto& frame = stack_[depth_ - 1];
+            const auto& children = GetChildren(*frame.node);
+            if (frame.next_child == children.size()) {
+                --depth_;
+                continue;
+            }
+
+            const Node* child = children[frame.next_child++].get();
+            if (child->kind == NodeKind::kLeaf) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+                leaf_ = static_cast<const Leaf*>(child);
+                return;
+            }
+            Push(child, 0);
+        }
+    }
+
+    // Only the first depth_ frames are initialized
+    std::array<Frame, impl::persistent_map::kMaxDepth> stack_;
+    std::size_t depth_{0};
+    const Leaf* leaf_{nullptr};
+};
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename PersistentMap<Key, Value, Hash, KeyEqual>::const_iterator PersistentMap<Key, Value, Hash, KeyEqual>::find(
+    const Key& key
+) const {
+    using impl::persistent_map::GetBit;
+    using impl::persistent_map::GetPosition;
+    using impl::persistent_map::kBitsPerLevel;
+
+    const_iterator it;
+    if (!root_) return it;
+
+    const auto hash = hash_(key);
+    const Node* node = root_.get();
+    std::size_t shift = 0;
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-static-cast-downcast)
+    while (node->kind == NodeKind::kBranch) {
+        const auto& branch = static_cast<const Branch&>(*node);
+        const auto bit = GetBit(hash, shift);
+        if (!(branch.bitmap & bit)) return end();
+
+        const auto position = GetPosition(branch.bitmap, bit);
+        it.Push(node, position + 1);
+        node = branch.children[position].get();
+        shift += kBitsPerLevel;
+    }
+
+    if (node->kind == NodeKind::kCollision) {
+        const auto& leaves = static_cast<const Collision&>(*node).leaves;
+        for (std::size_t i = 0; i < leaves.size(); ++i) {
+            const auto& leaf = static_cast<const Leaf&>(*leaves[i]);
+            if (leaf.hash == hash && equal_(leaf.value.first, key)) {
+                it.Push(node, i + 1);
+                it.leaf_ = &leaf;
+                return it;
+            }
+        }
+        return end();
+    }
+
+    const auto& leaf = static_cast<const Leaf&>(*node);
+    // NOLINTEND(cppcoreguidelines-pro-type-static-cast-downcast)
+    if (leaf.hash != hash || !equal_(leaf.value.first, key)) return end();
+    it.leaf_ = &leaf;
+    return it;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename PersistentMap<Key, Value, Hash, KeyEqual>::size_type PersistentMap<Key, Value, Hash, KeyEqual>::erase(
+    const Key& key
+) {
+    // Avoid copying the path to a missing key
+    if (!contains(key)) return 0;
+
+    EraseImpl(root_, hash_(key), 0, key);
+    if (--size_ == 0) root_.reset();
+    return 1;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+template <typename K, typename M>
+bool PersistentMap<Key, Value, Hash, KeyEqual>::DoInsertOrAssign(K&& key, M&& value) {
+    if (!root_) root_ = NodePtr{new Branch()};
+
+    const auto hash = hash_(key);
+    const bool inserted = InsertOrAssignImpl(root_, hash, 0, std::forward<K>(key), std::forward<M>(value));
+    if (inserted) ++size_;
+    return inserted;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+template <typename K, typename M>
+bool PersistentMap<Key, Value, Hash, KeyEqual>::InsertOrAssignImpl(
+    NodePtr& node,
+    std::size_t hash,
+    std::size_t shift,
+    K&& key,
+    M&& value
+) {
+    using impl::persistent_map::GetBit;
+    using impl::persistent_map::GetPosition;
+    using impl::persistent_map::kBitsPerLevel;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-static-cast-downcast)
+    if (node->kind == NodeKind::kCollision) {
+        auto& collision = MakeMutable<Collision>(node);
+        UASSERT(collision.hash == hash);
+        for (auto& leaf : collision.leaves) {
+            if (equal_(static_cast<const Leaf&>(*leaf).value.first, key)) {
+                AssignLeaf(leaf, std::forward<M>(value));
+                return false;
+            }
+        }
+        collision.leaves.push_back(MakeLeaf(hash, std::forward<K>(key), std::forward<M>(value)));
+        return true;
+    }
+
+    // Nodes are made mutable on the way down, so that a shared subtree is
+    // copied together with all its nodes on the path.
+    auto& branch = MakeMutable<Branch>(node);
+    const auto bit = GetBit(hash, shift);
+    const auto position = GetPosition(branch.bitmap, bit);
+    if (!(branch.bitmap & bit)) {
+        branch.children.insert(
+            branch.children.begin() + position, MakeLeaf(hash, std::forward<K>(key), std::forward<M>(value))
+        );
+        branch.bitmap |= bit;
+        return true;
+    }
+
+    auto& child = branch.children[position];
+    if (child->kind != NodeKind::kLeaf) {
+        return InsertOrAssignImpl(child, hash, shift + kBitsPerLevel, std::forward<K>(key), std::forward<M>(value));
+    }
+
+    const auto& leaf = static_cast<const Leaf&>(*child);
+    // NOLINTEND(cppcoreguidelines-pro-type-static-cast-downcast)
+    if (leaf.hash == hash && equal_(leaf.value.first, key)) {
+        AssignLeaf(child, std::forward<M>(value));
+        return false;
+    }
+
+    child = MergeLeaves(
+        std::move(child), MakeLeaf(hash, std::forward<K>(key), std::forward<M>(value)), shift + kBitsPerLevel
+    );
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void PersistentMap<Key, Value, Hash, KeyEqual>::EraseImpl(
+    NodePtr& node,
+    std::size_t hash,
+    std::size_t shift,
+    const Key& key
+) {
+    using impl::persistent_map::GetBit;
+    using impl::persistent_map::GetPosition;
+    using impl::persistent_map::kBitsPerLevel;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-static-cast-downcast)
+    if (node->kind == NodeKind::kCollision) {
+        auto& leaves = MakeMutable<Collision>(node).leaves;
+        for (auto it = leaves.begin(); it != leaves.end(); ++it) {
+            if (equal_(static_cast<const Leaf&>(**it).value.first, key)) {
+                leaves.erase(it);
+                return;
+            }
+        }
+        UASSERT_MSG(false, "Erasing a missing key from PersistentMap");
+        return;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-type-static-cast-downcast)
+
+    auto& branch = MakeMutable<Branch>(node);
+    const auto bit = GetBit(hash, shift);
+    UASSERT(branch.bitmap & bit);
+    const auto position = GetPosition(branch.bitmap, bit);
+
+    auto& child = branch.children[position];
+    if (child->kind == NodeKind::kLeaf) {
+        branch.children.erase(branch.children.begin() + position);
+        branch.bitmap &= ~bit;
+        return;
+    }
+
+    EraseImpl(child, hash, shift + kBitsPerLevel, key);
+
+    // Keep the trie canonical: a subtree with a single leaf is replaced with
+    // the leaf itself.
+    if (auto leaf = ExtractSingleLeaf(*child)) child = std::move(leaf);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+template <typename M>
+void PersistentMap<Key, Value, Hash, KeyEqual>::AssignLeaf(NodePtr& leaf_ptr, M&& value) {
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-static-cast-downcast)
+    if (leaf_ptr->IsUnique()) {
+        static_cast<Leaf&>(*leaf_ptr).value.second = std::forward<M>(value);
+        return;
+    }
+
+    const auto& leaf = static_cast<const Leaf&>(*leaf_ptr);
+    // NOLINTEND(cppcoreguidelines-pro-type-static-cast-downcast)
+    leaf_ptr = MakeLeaf(leaf.hash, leaf.value.first, std::forward<M>(value));
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename PersistentMap<Key, Value, Hash, KeyEqual>::NodePtr
+PersistentMap<Key, Value, Hash, KeyEqual>::MergeLeaves(NodePtr first, NodePtr second, std::size_t shift) {
+    using impl::persistent_map::GetBit;
+    using impl::persistent_map::kBitsPerLevel;
+    using impl::persistent_map::kHashBits;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-static-cast-downcast)
+    const auto first_hash = static_cast<const Leaf&>(*first).hash;
+    const auto second_hash = static_cast<const Leaf&>(*second).hash;
+    // NOLINTEND(cppcoreguidelines-pro-type-static-cast-downcast)
+
+    if (shift >= kHashBits) {
+        UASSERT(first_hash == second_hash);
+        auto* collision = new Collision(first_hash);
+        NodePtr result{collision};
+        collision->leaves.reserve(2);
+        collision->leaves.push_back(std::move(first));
+        collision->leaves.push_back(std::move(second));
+        return result;
+    }
+
+    auto* branch = new Branch();
+    NodePtr result{branch};
+    const auto first_bit = GetBit(first_hash, shift);
+    const auto second_bit = GetBit(second_hash, shift);
+    if (first_bit == second_bit) {
+        branch->bitmap = first_bit;
+        branch->children.push_back(MergeLeaves(std::move(first), std::move(second), shift + kBitsPerLevel));
+    } else {
+        branch->bitmap = first_bit | second_bit;
+        branch->children.reserve(2);
+        if (first_bit > second_bit) std::swap(first, second);
+        branch->children.push_back(std::move(first));
+        branch->children.push_back(std::move(second));
+    }
+    return result;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename PersistentMap<Key, Value, Hash, KeyEqual>::NodePtr
+PersistentMap<Key, Value, Hash, KeyEqual>::ExtractSingleLeaf(const Node& node) {
+    const auto& children = GetChildren(node);
+    if (children.size() == 1 && children.front()->kind == NodeKind::kLeaf) return children.front();
+    return {};
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+const std::vector<typename PersistentMap<Key, Value, Hash, KeyEqual>::NodePtr>&
+PersistentMap<Key, Value, Hash, KeyEqual>::GetChildren(const Node& node) noexcept {
+    UASSERT(node.kind != NodeKind::kLeaf);
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-static-cast-downcast)
+    if (node.kind == NodeKind::kCollision) return static_cast<const Collision&>(node).leaves;
+    return static_cast<const Branch&>(node).children;
+    // NOLINTEND(cppcoreguidelines-pro-type-static-cast-downcast)
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -12,6 +12,10 @@ namespace compression::zstd {
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Compresses the string with the specified compression level (1-19).
+/// @throws std::runtime_error on compression failure
+std::string Compress(std::string_view data, int level);
+
 }  // namespace compression::zstd
 
 USERVER_NAMESPACE_END
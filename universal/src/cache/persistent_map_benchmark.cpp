@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <userver/cache/persistent_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kChangedRows = 16;
+
+template <typename Map>
+Map FillMap(std::size_t size) {
+    Map map;
+    for (std::size_t i = 0; i < size; ++i) {
+        map.insert_or_assign(i, std::to_string(i));
+    }
+    return map;
+}
+
+// Emulates an incremental cache update: take a snapshot of the current data
+// and apply a few changed rows to it.
+template <typename Map>
+void IncrementalUpdate(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    auto current = std::make_shared<const Map>(FillMap<Map>(size));
+
+    std::size_t key = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        auto snapshot = std::make_shared<Map>(*current);
+        for (std::size_t i = 0; i < kChangedRows; ++i) {
+            key = (key + 7919) % (size * 2);
+            snapshot->insert_or_assign(key, "changed");
+        }
+        current = std::move(snapshot);
+    }
+    benchmark::DoNotOptimize(current);
+}
+
+template <typename Map>
+void Find(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto map = FillMap<Map>(size);
+
+    std::size_t key = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        key = (key + 7919) % size;
+        benchmark::DoNotOptimize(map.find(key));
+    }
+}
+
+using UnorderedMap = std::unordered_map<std::size_t, std::string>;
+using PersistentMap = cache::PersistentMap<std::size_t, std::string>;
+
+}  // namespace
+
+void UnorderedMapIncrementalUpdate(benchmark::State& state) { IncrementalUpdate<UnorderedMap>(state); }
+BENCHMARK(UnorderedMapIncrementalUpdate)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+void PersistentMapIncrementalUpdate(benchmark::State& state) { IncrementalUpdate<PersistentMap>(state); }
+BENCHMARK(PersistentMapIncrementalUpdate)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+void UnorderedMapFind(benchmark::State& state) { Find<UnorderedMap>(state); }
+BENCHMARK(UnorderedMapFind)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+void PersistentMapFind(benchmark::State& state) { Find<PersistentMap>(state); }
+BENCHMARK(PersistentMapFind)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include <userver/cache/persistent_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Map = cache::PersistentMap<int, std::string>;
+
+// Forces deep tries and collision nodes
+struct BadHash {
+    std::size_t operator()(int value) const noexcept { return static_cast<std::size_t>(value % 3); }
+};
+
+template <typename PersistentMap, typename Key, typename Value>
+void ExpectSameContents(const PersistentMap& map, const std::unordered_map<Key, Value>& expected) {
+    ASSERT_EQ(map.size(), expected.size());
+
+    std::size_t iterated = 0;
+    for (const auto& [key, value] : map) {
+        ++iterated;
+        const auto it = expected.find(key);
+        ASSERT_NE(it, expected.end()) << key;
+        EXPECT_EQ(it->second, value);
+    }
+    EXPECT_EQ(iterated, expected.size());
+
+    for (const auto& [key, value] : expected) {
+        const auto it = map.find(key);
+        ASSERT_NE(it, map.end()) << key;
+        EXPECT_EQ(it->second, value);
+    }
+}
+
+}  // namespace
+
+TEST(PersistentMap, Empty) {
+    const Map map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_EQ(map.begin(), map.end());
+    EXPECT_EQ(map.find(1), map.end());
+    EXPECT_THROW(map.at(1), std::out_of_range);
+}
+
+TEST(PersistentMap, InsertFindErase) {
+    Map map;
+    EXPECT_TRUE(map.insert_or_assign(1, "one"));
+    EXPECT_TRUE(map.insert_or_assign(2, "two"));
+    EXPECT_FALSE(map.insert_or_assign(1, "uno"));
+    EXPECT_FALSE(map.emplace(2, "dos"));
+
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map.at(1), "uno");
+    EXPECT_EQ(map.at(2), "two");
+    EXPECT_TRUE(map.contains(1));
+    EXPECT_EQ(map.count(3), 0);
+
+    EXPECT_EQ(map.erase(3), 0);
+    EXPECT_EQ(map.erase(1), 1);
+    EXPECT_EQ(map.size(), 1);
+    EXPECT_FALSE(map.contains(1));
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(PersistentMap, SnapshotsAreIndependent) {
+    Map original;
+    for (int i = 0; i < 1000; ++i) original.insert_or_assign(i, std::to_string(i));
+
+    Map snapshot = original;
+    snapshot.insert_or_assign(1, "changed");
+    snapshot.insert_or_assign(1000, "new");
+    snapshot.erase(2);
+
+    EXPECT_EQ(original.size(), 1000);
+    EXPECT_EQ(original.at(1), "1");
+    EXPECT_EQ(original.at(2), "2");
+    EXPECT_FALSE(original.contains(1000));
+
+    EXPECT_EQ(snapshot.size(), 1000);
+    EXPECT_EQ(snapshot.at(1), "changed");
+    EXPECT_EQ(snapshot.at(1000), "new");
+    EXPECT_FALSE(snapshot.contains(2));
+
+    original.insert_or_assign(3, "original");
+    EXPECT_EQ(snapshot.at(3), "3");
+}
+
+TEST(PersistentMap, FindIteratorContinuesIteration) {
+    Map map;
+    for (int i = 0; i < 100; ++i) map.insert_or_assign(i, std::to_string(i));
+
+    std::size_t remaining = 0;
+    for (auto it = map.find(42); it != map.end(); ++it) ++remaining;
+
+    std::size_t position = 0;
+    for (const auto& [key, value] : map) {
+        ++position;
+        if (key == 42) break;
+    }
+    EXPECT_EQ(remaining, map.size() - position + 1);
+}
+
+TEST(PersistentMap, Collisions) {
+    cache::PersistentMap<int, int, BadHash> map;
+    std::unordered_map<int, int> expected;
+    for (int i = 0; i < 100; ++i) {
+        map.insert_or_assign(i, i * 10);
+        expected[i] = i * 10;
+    }
+    ExpectSameContents(map, expected);
+
+    auto snapshot = map;
+    for (int i = 0; i < 100; i += 2) {
+        EXPECT_EQ(snapshot.erase(i), 1);
+    }
+    ExpectSameContents(map, expected);
+
+    for (int i = 0; i < 100; i += 2) expected.erase(i);
+    ExpectSameContents(snapshot, expected);
+}
+
+TEST(PersistentMap, RandomizedAgainstUnorderedMap) {
+    std::minstd_rand rng{42};
+    std::uniform_int_distribution<int> keys{0, 5000};
+
+    Map map;
+    std::unordered_map<int, std::string> expected;
+    std::vector<std::pair<Map, std::unordered_map<int, std::string>>> snapshots;
+
+    for (int i = 0; i < 20000; ++i) {
+        const auto key = keys(rng);
+        if (i % 3 == 0) {
+            EXPECT_EQ(map.erase(key), expected.erase(key));
+        } else {
+            const auto value = std::to_string(i);
+            EXPECT_EQ(map.insert_or_assign(key, value), expected.insert_or_assign(key, value).second);
+        }
+
+        if (i % 2000 == 0) snapshots.emplace_back(map, expected);
+    }
+
+    ExpectSameContents(map, expected);
+    for (const auto& [snapshot, snapshot_expected] : snapshots) {
+        ExpectSameContents(snapshot, snapshot_expected);
+    }
+
+    for (const auto& [key, value] : expected) map.erase(key);
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,9 @@
 #include <userver/compression/zstd.hpp>
 
 #include <memory>
+#include <stdexcept>
+
+#include <fmt/format.h>
 
 #include <zstd.h>
 #include <zstd_errors.h>
@@ -80,5 +83,15 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
     return decompressed;
 }
 
+std::string Compress(std::string_view data, int level) {
+    std::string compressed(ZSTD_compressBound(data.size()), '\0');
+    const auto ret = ZSTD_compress(compressed.data(), compressed.size(), data.data(), data.size(), level);
+    if (ZSTD_isError(ret)) {
+        throw std::runtime_error(fmt::format("Compression failed: {}", ZSTD_getErrorName(ret)));
+    }
+    compressed.resize(ret);
+    return compressed;
+}
+
 }  // namespace compression::zstd
 USERVER_NAMESPACE_END
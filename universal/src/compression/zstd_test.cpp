@@ -60,4 +60,15 @@ TEST(Zstd, TestOverflow) {
     );
 }
 
+TEST(Zstd, CompressDecompress) {
+    constexpr std::size_t kSize = 16'000;
+    const std::string str(kSize, 'a');
+
+    const auto compressed = compression::zstd::Compress(str, 3);
+    EXPECT_LT(compressed.size(), str.size());
+    EXPECT_EQ(compression::zstd::Decompress(compressed, kSize), str);
+
+    EXPECT_EQ(compression::zstd::Decompress(compression::zstd::Compress({}, 3), 0), "");
+}
+
 USERVER_NAMESPACE_END